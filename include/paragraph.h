@@ -18,6 +18,8 @@ extern "C"
 #endif
 
 #include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /** 22:10 fixed point math */
@@ -123,15 +125,48 @@ typedef struct paragraph_config {
 	 * and errors to emerge.
 	 */
 	paragraph_log_t log_level;
+	/**
+	 * Path of a hyphenation pattern file, or NULL for no hyphenation.
+	 *
+	 * Pattern files are compiled from TeX hyphenation patterns by
+	 * `tools/hyph_gen.c`.  The file is memory-mapped by
+	 * \ref paragraph_ctx_create, and must not change while the context
+	 * exists.
+	 */
+	const char *hyphenation_patterns;
+	/**
+	 * Byte budget of the context's text measurement cache, or zero for
+	 * no cache.  Budgets smaller than 4 KiB are raised to 4 KiB, which
+	 * holds the cache's first hash table and some measurements.
+	 *
+	 * Measurements are shared by all the context's paragraphs, and are
+	 * keyed on the style pointer and the text's bytes, embedding level
+	 * and script.  So `measure_text` must not depend on anything else,
+	 * and a style's metrics must not change while the cache may hold
+	 * measurements in it.  Use \ref paragraph_ctx_clear_measure_cache
+	 * when styles are freed or fonts change.
+	 */
+	size_t measure_cache_size;
 } paragraph_config_t;
 
 typedef void paragraph_style_t;
 typedef void paragraph_string_t;
 
 typedef struct paragraph_text_s {
+	/** Client string, or NULL if the text isn't from a client string. */
 	paragraph_string_t *text;
-	size_t offset;
-	size_t len;
+	size_t offset;    /**< Byte offset into client string. */
+	size_t len;       /**< Byte length of text. */
+	const char *data; /**< UTF-8 text data, `len` bytes long. */
+	/** Bidirectional embedding level.  Odd levels are right-to-left. */
+	uint8_t level;
+	/**
+	 * Script of the text, as an ISO 15924 code packed big-endian, like
+	 * HarfBuzz's `hb_script_t`.  For example, Latin is 'Latn', or
+	 * 0x4C61746E.  Text of only digits, punctuation and the like is
+	 * Common, 'Zyyy'.
+	 */
+	uint32_t script;
 } paragraph_text_t;
 
 typedef struct paragraph_position_s {
@@ -139,6 +174,55 @@ typedef struct paragraph_position_s {
 	uint32_t y;
 } paragraph_position_t;
 
+/**
+ * Values of the CSS `white-space` property.
+ */
+typedef enum paragraph_white_space_e {
+	PARAGRAPH_WHITE_SPACE_NORMAL,       /**< Collapse spaces, and wrap. */
+	PARAGRAPH_WHITE_SPACE_NOWRAP,       /**< Collapse spaces, no wrap. */
+	PARAGRAPH_WHITE_SPACE_PRE,          /**< Keep spaces, no wrap. */
+	PARAGRAPH_WHITE_SPACE_PRE_WRAP,     /**< Keep spaces, and wrap. */
+	PARAGRAPH_WHITE_SPACE_PRE_LINE,     /**< Keep newlines, and wrap. */
+	PARAGRAPH_WHITE_SPACE_BREAK_SPACES, /**< As pre-wrap, spaces fill. */
+} paragraph_white_space_t;
+
+/**
+ * Values of the CSS `text-transform` property.
+ */
+typedef enum paragraph_text_transform_e {
+	PARAGRAPH_TEXT_TRANSFORM_NONE,       /**< Text as it is. */
+	PARAGRAPH_TEXT_TRANSFORM_UPPERCASE,  /**< Uppercase every letter. */
+	PARAGRAPH_TEXT_TRANSFORM_LOWERCASE,  /**< Lowercase every letter. */
+	PARAGRAPH_TEXT_TRANSFORM_CAPITALIZE, /**< Titlecase first of words. */
+	PARAGRAPH_TEXT_TRANSFORM_FULL_WIDTH, /**< Use fullwidth forms. */
+} paragraph_text_transform_t;
+
+/**
+ * Values of the CSS `hyphens` property.
+ */
+typedef enum paragraph_hyphens_e {
+	PARAGRAPH_HYPHENS_MANUAL, /**< Don't hyphenate words. */
+	PARAGRAPH_HYPHENS_NONE,   /**< Treated as manual. */
+	PARAGRAPH_HYPHENS_AUTO,   /**< Also hyphenate with patterns. */
+} paragraph_hyphens_t;
+
+/**
+ * A piece of text to measure with the `measure_text_batch` callback.
+ */
+typedef struct paragraph_text_segment_s {
+	paragraph_text_t text;          /**< The text to measure. */
+	const paragraph_style_t *style; /**< Style to measure text in. */
+} paragraph_text_segment_t;
+
+/**
+ * Measurements of a piece of text.
+ */
+typedef struct paragraph_text_metrics_s {
+	uint32_t width;    /**< Width of text. */
+	uint32_t height;   /**< Height of text. */
+	uint32_t baseline; /**< Baseline offset from top of text. */
+} paragraph_text_metrics_t;
+
 /**
  * These are implemented by the chosen backends.
  */
@@ -155,6 +239,105 @@ typedef struct paragraph_callbacks_s {
 			const paragraph_string_t *text,
 			const char **data_out,
 			size_t *len_out);
+	/**
+	 * Get the value of a style's `white-space` property.
+	 *
+	 * May be NULL, in which case all text is
+	 * \ref PARAGRAPH_WHITE_SPACE_NORMAL.  A style's value must not change
+	 * while content uses the style.
+	 */
+	paragraph_white_space_t (*white_space)(
+			void *pw,
+			const paragraph_style_t *style);
+	/**
+	 * Get the value of a style's `text-transform` property.
+	 *
+	 * May be NULL, in which case no text is transformed.  A style's value
+	 * must not change while content uses the style.
+	 */
+	paragraph_text_transform_t (*text_transform)(
+			void *pw,
+			const paragraph_style_t *style);
+	/**
+	 * Get the value of a style's `hyphens` property.
+	 *
+	 * May be NULL, in which case no text is hyphenated.  A style's value
+	 * must not change while content uses the style.
+	 */
+	paragraph_hyphens_t (*hyphens)(
+			void *pw,
+			const paragraph_style_t *style);
+	/**
+	 * Check whether two styles measure text the same.
+	 *
+	 * May be NULL, in which case only text in the same style is measured
+	 * across content entries.  Otherwise, a word that crosses from one
+	 * style to another that measures the same, such as a `<span>` that
+	 * only changes the colour, is measured as one, so kerning and shaping
+	 * across the change is kept.  Styles with different `white-space` or
+	 * `text-transform` values are never measured together.  The answer
+	 * for two styles must not change while content uses them.
+	 */
+	bool (*same_font)(
+			void *pw,
+			const paragraph_style_t *a,
+			const paragraph_style_t *b);
+	/**
+	 * Measure many pieces of text in one call.
+	 *
+	 * May be NULL, in which case `measure_text` is called for each piece.
+	 * Otherwise, the pieces of a paragraph's text that need measuring
+	 * are gathered, and measured in one call when the paragraph is laid
+	 * out.  Each piece's measurements must be the same as `measure_text`
+	 * would give.  Words that are hyphenated, and the hyphens, are still
+	 * measured with `measure_text`.
+	 *
+	 * Where a word crosses content entries, the batch also has the text up
+	 * to the end of each entry's part of the word, so the parts can be
+	 * placed where the text before them ends.  Without this callback, the
+	 * parts share the word's width in proportion to their numbers of
+	 * characters.
+	 *
+	 * \param[in]  pw           Client's private data.
+	 * \param[in]  segments     The pieces of text to measure.
+	 * \param[out] metrics_out  Returns the measurements of each piece.
+	 * \param[in]  count        Number of pieces in segments.
+	 * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+	 */
+	paragraph_err_t (*measure_text_batch)(
+			void *pw,
+			const paragraph_text_segment_t *segments,
+			paragraph_text_metrics_t *metrics_out,
+			size_t count);
+	/**
+	 * Take a reference to a style.
+	 *
+	 * May be NULL, in which case styles aren't referenced, and the client
+	 * must keep them valid for as long as paragraphs use them.  Otherwise,
+	 * each style a paragraph keeps, on its style stack or for its content,
+	 * is referenced with this, and released with `style_unref` when the
+	 * paragraph no longer uses it.  If referencing fails, the library call
+	 * that needed the reference fails, and leaves the paragraph's styles
+	 * as they were.
+	 *
+	 * \param[in]  pw     Client's private data.
+	 * \param[in]  style  The style to reference.
+	 * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+	 */
+	paragraph_err_t (*style_ref)(
+			void *pw,
+			paragraph_style_t *style);
+	/**
+	 * Release a reference to a style taken with `style_ref`.
+	 *
+	 * May be NULL if `style_ref` is NULL.
+	 *
+	 * \param[in]  pw     Client's private data.
+	 * \param[in]  style  The style to release.
+	 */
+	void (*style_unref)(
+			void *pw,
+			paragraph_style_t *style);
 } paragraph_cb_text_t;
 
 /**
@@ -164,8 +347,12 @@ typedef struct paragraph_callbacks_s {
  * It is destroyed with \ref paragraph_ctx_destroy and it must not be
  * destroyed before all the paragraphs created with it have been destroyed.
  *
+ * If the configuration has hyphenation patterns, the pattern file is
+ * memory-mapped here.
+ *
  * \param[in]  pw       Client's private data.
  * \param[out] ctx_out  Returns the newly created library context on success.
+ * \param[in]  config   Client configuration.
  * \param[in]  cb_text  Client callback table.
  * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
  */
@@ -191,6 +378,43 @@ paragraph_err_t paragraph_ctx_create(
 paragraph_ctx_t *paragraph_ctx_destroy(
 		paragraph_ctx_t *ctx);
 
+/**
+ * Text measurement cache counters.
+ *
+ * The counters stay at zero if the context has no cache.
+ */
+typedef struct paragraph_measure_stats_s {
+	uint64_t hits;      /**< Measurements found in the cache. */
+	uint64_t misses;    /**< Measurements made by `measure_text`. */
+	uint64_t evictions; /**< Measurements evicted to stay in budget. */
+	size_t entries;     /**< Number of measurements in the cache. */
+	size_t bytes;       /**< Bytes used by the cache. */
+} paragraph_measure_stats_t;
+
+/**
+ * Get a context's text measurement cache counters.
+ *
+ * \param[in]  ctx        The context.
+ * \param[out] stats_out  Returns the counters.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_ctx_get_measure_stats(
+		const paragraph_ctx_t *ctx,
+		paragraph_measure_stats_t *stats_out);
+
+/**
+ * Forget a context's cached text measurements.
+ *
+ * This must be called before a style that may have been used to measure
+ * text is freed, if its address could be reused, or when the metrics of
+ * styles change.  The counters are kept.
+ *
+ * \param[in]  ctx  The context.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_ctx_clear_measure_cache(
+		paragraph_ctx_t *ctx);
+
 /**
  * Create a paragraph.
  *
@@ -207,12 +431,58 @@ paragraph_err_t paragraph_create(
 		paragraph_para_t **para_out,
 		paragraph_style_t *container_style);
 
+/**
+ * Clear a paragraph, so it can be reused.
+ *
+ * This removes all the paragraph's content and layout, and empties its
+ * style stack, leaving it as if it had just been created.  Any memory
+ * allocated by the paragraph is kept for reuse.
+ *
+ * \param[in]  para             The paragraph to reset.
+ * \param[in]  container_style  The style of the paragraph container.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_reset(
+		paragraph_para_t *para,
+		paragraph_style_t *container_style);
+
+/**
+ * Create a copy of a paragraph.
+ *
+ * The copy has the same content and style stack as the source paragraph,
+ * but no layout.  Content handles from the source identify the same
+ * content in the copy.  The two paragraphs are independent: changes to
+ * either don't affect the other.
+ *
+ * The content is shared by the paragraphs until one of them changes it,
+ * so making a copy is cheap, and doesn't call the client's `text_get`
+ * callback.  Client strings and text buffers must stay valid for as long
+ * as any copy uses them.
+ *
+ * If the source paragraph has been laid out since its content last
+ * changed, its text analysis and measurements are shared too, so the copy
+ * can be laid out at any width without measuring any text.
+ *
+ * \param[in]  pw         Client's private data for the copy.
+ * \param[in]  para       The paragraph to copy.
+ * \param[out] clone_out  Returns the new paragraph on success.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_clone(
+		void *pw,
+		paragraph_para_t *para,
+		paragraph_para_t **clone_out);
+
 /**
  * Destroy a paragraph.
  *
  * This frees any memory and resources owned by the paragraph, frees the
  * paragraph itself, and returns NULL.
  *
+ * The library context may keep a number of destroyed paragraphs, with their
+ * memory, for reuse by \ref paragraph_create.  These are freed when the
+ * context is destroyed.
+ *
  * Assign the returned NULL to the paragraph pointer being freed, so that wild
  * pointers to freed memory aren't left lying around:
  *
@@ -249,7 +519,13 @@ typedef struct paragraph_content_params_s {
 			const paragraph_string_t *string;
 		} text;
 
-		/** Data for type \ref PARAGRAPH_CONTENT_FLOAT. */
+		/**
+		 * Data for type \ref PARAGRAPH_CONTENT_FLOAT.
+		 *
+		 * Floats aren't placed by layout yet.  They are kept in the
+		 * content as placeholders that take no room on their line,
+		 * and no layout callback is made for them.
+		 */
 		struct {
 			paragraph_style_t *style; /**< Style for content. */
 		} floated;
@@ -270,14 +546,24 @@ typedef struct paragraph_content_params_s {
 	void *pw;
 } paragraph_content_params_t;
 
-typedef uint32_t paragraph_content_id_t;
+/**
+ * Identifier for a paragraph content entry.
+ *
+ * Identifiers are returned by \ref paragraph_content_add.  They remain safe
+ * to use after the entry they identify has been removed: functions given a
+ * stale identifier fail with \ref PARAGRAPH_ERR_BAD_PARAM.
+ */
+typedef uint64_t paragraph_content_id_t;
+
+/** Content identifier value that never identifies a content entry. */
+#define PARAGRAPH_CONTENT_ID_NONE ((paragraph_content_id_t) 0)
 
 /**
  * Paragraph content spec.
  */
 typedef struct paragraph_content_position_s {
 	/** Content entry to position relative to. */
-	paragraph_content_id_t *rel;
+	paragraph_content_id_t rel;
 	/** Whether to position new content before or after \ref rel. */
 	paragraph_content_pos_t pos;
 } paragraph_content_position_t;
@@ -285,19 +571,85 @@ typedef struct paragraph_content_position_s {
 /**
  * Create a content entry in a paragraph.
  *
+ * Text should be UTF-8.  Text that isn't is still added, and each maximal
+ * subpart of an ill-formed sequence is treated as U+FFFD REPLACEMENT
+ * CHARACTER.  The client's bytes are not changed, so apart from white space
+ * processing, the `measure_text` callback is given the text as it was added.
+ *
  * \param[in]  para    The paragraph object to add content to.
  * \param[in]  params  The content to add.
  * \param[in]  pos     The position to add content, or NULL for end.
- * \param[out] new     Returns pointer to new content identifier on success.
+ * \param[out] new     Returns new content identifier on success.
  */
 paragraph_err_t paragraph_content_add(
 		paragraph_para_t *para,
 		const paragraph_content_params_t *params,
 		const paragraph_content_position_t *pos,
-		paragraph_content_id_t **new);
+		paragraph_content_id_t *new);
 
 /**
- * Create a content entry in a paragraph.
+ * Content entry spec for \ref paragraph_content_add_spans.
+ *
+ * Text is given as a range of the buffer passed to
+ * \ref paragraph_content_add_spans, rather than as a client string.
+ */
+typedef struct paragraph_content_span_s {
+	/** Content type. */
+	enum paragraph_content_type_e type;
+	/** Byte offset of text in buffer, for \ref PARAGRAPH_CONTENT_TEXT. */
+	size_t offset;
+	/** Byte length of text in buffer, for \ref PARAGRAPH_CONTENT_TEXT. */
+	size_t len;
+	/**
+	 * Style for content.  For \ref PARAGRAPH_CONTENT_TEXT this may be
+	 * NULL, to use the current style.  Ignored for
+	 * \ref PARAGRAPH_CONTENT_INLINE_END.
+	 */
+	paragraph_style_t *style;
+	/** Width in pixels, for \ref PARAGRAPH_CONTENT_REPLACED. */
+	uint32_t px_width;
+	/** Height in pixels, for \ref PARAGRAPH_CONTENT_REPLACED. */
+	uint32_t px_height;
+	/** Client handle for content, e.g. corresponding DOM node. */
+	void *pw;
+} paragraph_content_span_t;
+
+/**
+ * Append a sequence of content entries to a paragraph.
+ *
+ * This is equivalent to calling \ref paragraph_content_add for each span,
+ * for clients that already hold the paragraph text in one buffer.  The text
+ * is not fetched with the `text_get` callback and is not copied, so the
+ * buffer must remain valid and unchanged until the content is removed or
+ * the paragraph is destroyed.
+ *
+ * If any span is invalid, no content is added.  If count is zero, nothing
+ * is changed.  Text that isn't valid UTF-8 is handled as for
+ * \ref paragraph_content_add.
+ *
+ * \param[in]  para      The paragraph object to add content to.
+ * \param[in]  text      UTF-8 buffer containing text for the spans.
+ * \param[in]  text_len  Byte length of text.
+ * \param[in]  spans     Array of content to add, in document order.
+ * \param[in]  count     Number of entries in spans.
+ * \param[out] ids_out   Array of count entries to return new content
+ *                       identifiers in on success, or NULL.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_content_add_spans(
+		paragraph_para_t *para,
+		const char *text,
+		size_t text_len,
+		const paragraph_content_span_t *spans,
+		size_t count,
+		paragraph_content_id_t *ids_out);
+
+/**
+ * Remove a content entry from a paragraph.
+ *
+ * Removing an entry of type \ref PARAGRAPH_CONTENT_INLINE_START or
+ * \ref PARAGRAPH_CONTENT_INLINE_END removes only that entry.  To remove an
+ * inline along with its content, use \ref paragraph_content_remove_inline.
  *
  * \param[in]  para  The paragraph object to remove content from.
  * \param[in]  id    An identifier for the content to remove from the paragraph.
@@ -305,7 +657,60 @@ paragraph_err_t paragraph_content_add(
  */
 paragraph_err_t paragraph_content_remove(
 		paragraph_para_t *para,
-		paragraph_content_id_t *id);
+		paragraph_content_id_t id);
+
+/**
+ * Remove an inline and all its content from a paragraph.
+ *
+ * Removes everything from the given \ref PARAGRAPH_CONTENT_INLINE_START
+ * entry up to and including its matching \ref PARAGRAPH_CONTENT_INLINE_END
+ * entry.  If the inline has no matching end, everything to the end of the
+ * paragraph is removed.
+ *
+ * \param[in]  para  The paragraph object to remove content from.
+ * \param[in]  id    Identifier for the inline start content entry.
+ * \return \ref PARAGRAPH_OK on success, \ref PARAGRAPH_ERR_BAD_TYPE if the
+ *         entry is not an inline start, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_content_remove_inline(
+		paragraph_para_t *para,
+		paragraph_content_id_t id);
+
+/**
+ * Change the style of a content entry.
+ *
+ * Only lines affected by the change are measured again by the next
+ * layout pass.
+ *
+ * \param[in]  para   The paragraph object containing the content.
+ * \param[in]  id     Identifier for the content to change.
+ * \param[in]  style  The new style for the content.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_content_set_style(
+		paragraph_para_t *para,
+		paragraph_content_id_t id,
+		paragraph_style_t *style);
+
+/**
+ * Change the dimensions of replaced content.
+ *
+ * For example, when an image has loaded and its real dimensions are
+ * known.  Only lines affected by the change are measured again by the next
+ * layout pass.
+ *
+ * \param[in]  para       The paragraph object containing the content.
+ * \param[in]  id         Identifier for the replaced content to resize.
+ * \param[in]  px_width   New width in pixels.
+ * \param[in]  px_height  New height in pixels.
+ * \return \ref PARAGRAPH_OK on success, \ref PARAGRAPH_ERR_BAD_TYPE if the
+ *         content is not replaced content, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_content_set_replaced_size(
+		paragraph_para_t *para,
+		paragraph_content_id_t id,
+		uint32_t px_width,
+		uint32_t px_height);
 
 /**
  * Get the minimum and maximum widths of the paragraph.
@@ -375,9 +780,44 @@ typedef paragraph_err_t (* const paragraph_layout_float_fn)(
  * on the same paragraph will lay out the next line.  Once all
  * the content has undergone layout, \ref PARAGRAPH_OK will be returned.
  *
- * If some content on this line is to be floated, callbacks for that content
- * will emerge first.  Once all the floated content from the line has been
- * handled, callbacks for the in-flow content will emerge.
+ * Floating content isn't laid out: it takes no room on its line, and no
+ * callback is made for it.
+ *
+ * Positions given to the callbacks are relative to the top left of the line.
+ * Callbacks are made in text order.  Right-to-left text is resolved as
+ * described by UAX #9, Unicode Bidirectional Algorithm, and the positions
+ * reflect each line's visual order.  Each text callback is for text at a
+ * single embedding level and in a single script, both given in
+ * \ref paragraph_text_t, for the client to shape in that level's direction
+ * with that script.
+ *
+ * White space in the text is processed as described by each style's
+ * `white-space` property, from the `white_space` callback.  Text given to the
+ * callbacks has spaces collapsed and newlines that are not preserved turned
+ * into spaces.  Where processing has changed text, its `text` is NULL.
+ * Preserved newlines end the line, and aren't given to the callbacks or
+ * measured.
+ *
+ * Text is then transformed as described by each style's `text-transform`
+ * property, from the `text_transform` callback, and is measured and given
+ * to the callbacks as transformed.  Where transforming has changed text,
+ * its `text` is NULL.  Hit testing still gives offsets in the text as it
+ * was added.
+ *
+ * Where a style's `hyphens` property is `auto`, from the `hyphens`
+ * callback, a word that doesn't fit at the end of a line may be hyphenated
+ * with the context's hyphenation patterns.  The line's last text callback
+ * is then followed by one for the hyphen, with NULL `text`.
+ *
+ * Lines are filled greedily, and the paragraph's content is only walked once
+ * over a complete set of calls, so laying out a paragraph is linear in the
+ * size of its content.
+ *
+ * Lines from the previous complete layout pass are reused, without being
+ * measured again, if they are unaffected by content changes made since and
+ * are given the same available width.  If the paragraph's content is
+ * changed part way through a layout pass, the pass restarts at the first
+ * line.
  *
  * \param[in]  para             The paragraph to lay out.
  * \param[in]  available_width  The containing block width in physical pixels.
@@ -393,6 +833,117 @@ paragraph_err_t paragraph_layout_line(
 		paragraph_layout_replaced_fn replaced_fn,
 		uint32_t *line_height_out);
 
+/**
+ * A position in the text of a paragraph content entry.
+ */
+typedef struct paragraph_content_offset_s {
+	paragraph_content_id_t id; /**< Content entry. */
+	size_t offset; /**< Byte offset into the content entry's text. */
+} paragraph_content_offset_t;
+
+/**
+ * A rectangle, in physical pixels.
+ */
+typedef struct paragraph_rect_s {
+	uint32_t x;      /**< Left edge. */
+	uint32_t y;      /**< Top edge. */
+	uint32_t width;  /**< Width. */
+	uint32_t height; /**< Height. */
+} paragraph_rect_t;
+
+/**
+ * Find the content at a point in a laid out paragraph.
+ *
+ * This uses the lines from the most recent complete layout pass, so it
+ * doesn't cause any layout or measurement.  It fails if the paragraph's
+ * content has changed since then.
+ *
+ * The point is relative to the top left of the first line, with each line
+ * placed directly below the previous one.  Points outside the paragraph
+ * find the nearest content.  Within a piece of text, character positions
+ * are estimated by sharing the piece's width evenly between its bytes.
+ * Points past the end of a line that ends with a preserved newline find the
+ * position before the newline, and points on an empty line find its start.
+ *
+ * \param[in]  para     The paragraph to hit test.
+ * \param[in]  x        Horizontal position of point.
+ * \param[in]  y        Vertical position of point.
+ * \param[out] hit_out  Returns the content at the point on success.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_hit_test(
+		paragraph_para_t *para,
+		uint32_t x,
+		uint32_t y,
+		paragraph_content_offset_t *hit_out);
+
+/**
+ * Get the rectangles covering a range of a laid out paragraph's text.
+ *
+ * This gives one rectangle per line the range is on, using the lines from
+ * the most recent complete layout pass, in the same coordinates as
+ * \ref paragraph_hit_test.  It fails if the paragraph's content has changed
+ * since then.  Where right-to-left text splits the range on a line, there
+ * is a rectangle for each part.
+ *
+ * \param[in]  para        The paragraph to get selection rectangles from.
+ * \param[in]  start       Start of range.
+ * \param[in]  end         End of range.
+ * \param[out] rects       Array to return rectangles in, or NULL.
+ * \param[in]  rects_len   Number of entries in rects.
+ * \param[out] count_out   Returns the number of rectangles covering the
+ *                         range on success.  This may be more than
+ *                         rects_len, in which case only the first rects_len
+ *                         rectangles are returned.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_selection_rects(
+		paragraph_para_t *para,
+		const paragraph_content_offset_t *start,
+		const paragraph_content_offset_t *end,
+		paragraph_rect_t *rects,
+		size_t rects_len,
+		size_t *count_out);
+
+/**
+ * Kinds of text boundary, as described by UAX #29.
+ */
+typedef enum paragraph_boundary_e {
+	PARAGRAPH_BOUNDARY_GRAPHEME, /**< Between grapheme clusters. */
+	PARAGRAPH_BOUNDARY_WORD,     /**< Between words. */
+} paragraph_boundary_t;
+
+/**
+ * Find the nearest text boundary before or after a position.
+ *
+ * This is for moving a caret by character or by word, and for selecting
+ * words.  Grapheme cluster boundaries are where a caret may be placed.
+ * Word boundaries are at both ends of each word, and between other
+ * characters, such as spaces and punctuation.
+ *
+ * Like \ref paragraph_hit_test, this uses the most recent complete layout
+ * pass, and fails if the paragraph's content has changed since then.  The
+ * start and end of the paragraph's text are always boundaries.  Replaced
+ * content is a grapheme cluster of its own, and is between words.
+ *
+ * \param[in]  para          The paragraph to find a boundary in.
+ * \param[in]  from          The position to search from.
+ * \param[in]  kind          The kind of boundary to find.
+ * \param[in]  forwards      Whether to find the first boundary after from,
+ *                           or the last one before it.
+ * \param[out] boundary_out  Returns the boundary on success.  If from is
+ *                           at the end of the text and forwards is true, or
+ *                           at the start and forwards is false, this is
+ *                           from.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_text_boundary(
+		paragraph_para_t *para,
+		const paragraph_content_offset_t *from,
+		paragraph_boundary_t kind,
+		bool forwards,
+		paragraph_content_offset_t *boundary_out);
+
 /**
  * Convert a paragraph error code to a string.
  *
@@ -0,0 +1,1370 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Bidirectional text implementation.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <paragraph.h>
+
+#include "vec.h"
+#include "bidi.h"
+#include "bidi_data.h"
+#include "prop.h"
+#include "utf8.h"
+
+/** Maximum explicit embedding level, from BD2. */
+#define PARAGRAPH_BIDI_MAX_DEPTH 125
+
+/** Maximum number of open brackets tracked, from BD16. */
+#define PARAGRAPH_BIDI_BRACKET_MAX 63
+
+/** Unit index meaning there is no unit. */
+#define PARAGRAPH_BIDI_NONE UINT32_MAX
+
+/** Unit index marking a PDI whose level run is in a run sequence. */
+#define PARAGRAPH_BIDI_DONE (UINT32_MAX - 1)
+
+static const vec_opts_t options = {
+	.sso_element_max = 0,
+};
+
+/**
+ * An entry on the directional status stack.
+ */
+typedef struct paragraph_bidi_status_s {
+	uint8_t level;    /**< Embedding level. */
+	uint8_t override; /**< Override class: L, R, or ON for none. */
+	bool isolate;     /**< Whether the entry is for an isolate. */
+} paragraph_bidi_status_t;
+
+/**
+ * An opening bracket waiting for its closing bracket.
+ */
+typedef struct paragraph_bidi_open_s {
+	uint32_t id;  /**< Canonical opening bracket code point. */
+	uint32_t pos; /**< Position of bracket in run sequence. */
+} paragraph_bidi_open_t;
+
+/**
+ * Get the bidirectional class of a code point.
+ *
+ * \param[in]  cp  The code point to classify.
+ * \return the code point's \ref paragraph_bidi_e.
+ */
+static inline uint8_t paragraph__bidi_class(
+		uint32_t cp)
+{
+	return paragraph_prop__get(cp)->bidi;
+}
+
+/**
+ * Find a code point in the paired bracket table.
+ *
+ * \param[in]  cp  The code point to look up.
+ * \return the index of the bracket plus one, or 0 if cp isn't a bracket.
+ */
+static uint8_t paragraph__bidi_bracket(
+		uint32_t cp)
+{
+	size_t lo = 0;
+	size_t hi = PARAGRAPH_ARRAY_LEN(paragraph_bidi_brackets);
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (paragraph_bidi_brackets[mid].cp < cp) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	if (lo < PARAGRAPH_ARRAY_LEN(paragraph_bidi_brackets) &&
+			paragraph_bidi_brackets[lo].cp == cp) {
+		return lo + 1;
+	}
+
+	return 0;
+}
+
+/**
+ * Test whether a class is an isolate initiator.
+ *
+ * \param[in]  cls  The \ref paragraph_bidi_e to test.
+ * \return true if cls is LRI, RLI or FSI.
+ */
+static inline bool paragraph__bidi_is_isolate(
+		uint8_t cls)
+{
+	return cls == PARAGRAPH_BIDI_LRI ||
+	       cls == PARAGRAPH_BIDI_RLI ||
+	       cls == PARAGRAPH_BIDI_FSI;
+}
+
+/**
+ * Test whether a unit was removed by rule X9.
+ *
+ * \param[in]  unit  The unit to test.
+ * \return true if the unit is to be skipped by the later rules.
+ */
+static inline bool paragraph__bidi_removed(
+		const paragraph_bidi_unit_t *unit)
+{
+	return unit->type == PARAGRAPH_BIDI_BN;
+}
+
+/**
+ * Get the strong direction a resolved type counts as, for rules N0 to N2.
+ *
+ * \param[in]  type  The \ref paragraph_bidi_e to get the direction of.
+ * \return L or R, or ON if type is neutral.
+ */
+static inline uint8_t paragraph__bidi_strong(
+		uint8_t type)
+{
+	switch (type) {
+	case PARAGRAPH_BIDI_L:
+		return PARAGRAPH_BIDI_L;
+	case PARAGRAPH_BIDI_R:
+	case PARAGRAPH_BIDI_AL:
+	case PARAGRAPH_BIDI_EN:
+	case PARAGRAPH_BIDI_AN:
+		return PARAGRAPH_BIDI_R;
+	default:
+		return PARAGRAPH_BIDI_ON;
+	}
+}
+
+/**
+ * Get the direction of an embedding level.
+ *
+ * \param[in]  level  The embedding level.
+ * \return R if level is odd, otherwise L.
+ */
+static inline uint8_t paragraph__bidi_dir(
+		uint8_t level)
+{
+	return (level & 1) ? PARAGRAPH_BIDI_R : PARAGRAPH_BIDI_L;
+}
+
+/**
+ * Find the direction of the first strong character, as in rules P2 and P3.
+ *
+ * Characters between an isolate initiator and its matching PDI are skipped.
+ * The search stops at a paragraph separator.
+ *
+ * \param[in]  units    The units to search.
+ * \param[in]  start    Index of first unit to search.
+ * \param[in]  end      Index after last unit to search.
+ * \param[in]  isolate  Whether to stop at an unmatched PDI, for FSI.
+ * \return 1 if the first strong character is R or AL, 0 if it is L, or -1
+ *         if there is none.
+ */
+static int paragraph__bidi_first_strong(
+		const paragraph_bidi_unit_t *units,
+		uint32_t start,
+		uint32_t end,
+		bool isolate)
+{
+	uint32_t depth = 0;
+
+	for (uint32_t i = start; i < end; i++) {
+		switch (units[i].cls) {
+		case PARAGRAPH_BIDI_L:
+			if (depth == 0) {
+				return 0;
+			}
+			break;
+
+		case PARAGRAPH_BIDI_R:
+		case PARAGRAPH_BIDI_AL:
+			if (depth == 0) {
+				return 1;
+			}
+			break;
+
+		case PARAGRAPH_BIDI_LRI:
+		case PARAGRAPH_BIDI_RLI:
+		case PARAGRAPH_BIDI_FSI:
+			depth++;
+			break;
+
+		case PARAGRAPH_BIDI_PDI:
+			if (depth > 0) {
+				depth--;
+			} else if (isolate) {
+				return -1;
+			}
+			break;
+
+		case PARAGRAPH_BIDI_B:
+			return -1;
+
+		default:
+			break;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * Split the content into units, and classify them.
+ *
+ * \param[in]  bidi       The embedding levels.
+ * \param[in]  content    The content to split.
+ * \param[out] count_out  Returns the number of units.
+ */
+static void paragraph__bidi_units(
+		paragraph_bidi_t *bidi,
+		const paragraph_content_t *content,
+		uint32_t *count_out)
+{
+	paragraph_bidi_unit_t *units = bidi->units;
+	uint32_t count = 0;
+	size_t pos = 0;
+
+	for (uint32_t e = 0; e < content->count; e++) {
+		switch (content->type[e]) {
+		case PARAGRAPH_CONTENT_TEXT: {
+			const uint8_t *s = (const uint8_t *)
+					content->cold[e].data;
+			uint8_t utf8 = content->cold[e].utf8;
+			size_t len = content->text_len[e];
+
+			for (size_t i = 0; i < len; ) {
+				uint32_t cp;
+				size_t n;
+
+				if (s[i] < 0x80) {
+					cp = s[i];
+					n = 1;
+				} else if (utf8 == PARAGRAPH_UTF8_VALID) {
+					cp = paragraph_utf8__decode_valid(
+							s + i, &n);
+				} else {
+					cp = paragraph_utf8__decode(
+							s + i, len - i, &n);
+				}
+
+				units[count] = (paragraph_bidi_unit_t) {
+					.pos = pos + i,
+					.len = n,
+					.cls = paragraph__bidi_class(cp),
+				};
+				if (units[count].cls == PARAGRAPH_BIDI_ON) {
+					units[count].bracket =
+						paragraph__bidi_bracket(cp);
+				}
+				count++;
+				i += n;
+			}
+			pos += len;
+			break;
+		}
+
+		case PARAGRAPH_CONTENT_REPLACED:
+			units[count++] = (paragraph_bidi_unit_t) {
+				.pos = e,
+				.cls = PARAGRAPH_BIDI_ON,
+			};
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	*count_out = count;
+}
+
+/**
+ * Match isolate initiators with PDIs, as described by BD9.
+ *
+ * \param[in]  units  The units to match.
+ * \param[in]  count  Number of units.
+ * \param[out] match  Returns, for each isolate initiator and PDI, the index
+ *                    of the unit it matches, or \ref PARAGRAPH_BIDI_NONE.
+ */
+static void paragraph__bidi_match(
+		const paragraph_bidi_unit_t *units,
+		uint32_t count,
+		uint32_t *match)
+{
+	/* Unmatched initiators are chained through their match entries. */
+	uint32_t open = PARAGRAPH_BIDI_NONE;
+
+	for (uint32_t i = 0; i <= count; i++) {
+		uint8_t cls = i < count ? units[i].cls : PARAGRAPH_BIDI_B;
+
+		if (i < count) {
+			match[i] = PARAGRAPH_BIDI_NONE;
+		}
+
+		if (paragraph__bidi_is_isolate(cls)) {
+			match[i] = open;
+			open = i;
+
+		} else if (cls == PARAGRAPH_BIDI_PDI &&
+				open != PARAGRAPH_BIDI_NONE) {
+			uint32_t next = match[open];
+
+			match[open] = i;
+			match[i] = open;
+			open = next;
+
+		} else if (cls == PARAGRAPH_BIDI_B) {
+			while (open != PARAGRAPH_BIDI_NONE) {
+				uint32_t next = match[open];
+
+				match[open] = PARAGRAPH_BIDI_NONE;
+				open = next;
+			}
+		}
+	}
+}
+
+/**
+ * Resolve explicit embedding levels, with rules X1 to X9.
+ *
+ * \param[in]  bidi   The embedding levels.
+ * \param[in]  count  Number of units.
+ * \param[in]  match  Matching isolate initiators and PDIs.
+ */
+static void paragraph__bidi_explicit(
+		paragraph_bidi_t *bidi,
+		uint32_t count,
+		const uint32_t *match)
+{
+	paragraph_bidi_status_t stack[PARAGRAPH_BIDI_MAX_DEPTH + 2];
+	paragraph_bidi_unit_t *units = bidi->units;
+	uint32_t overflow_isolate = 0;
+	uint32_t overflow_embedding = 0;
+	uint32_t valid_isolate = 0;
+	size_t depth = 1;
+
+	stack[0] = (paragraph_bidi_status_t) {
+		.level = bidi->level,
+		.override = PARAGRAPH_BIDI_ON,
+	};
+
+	for (uint32_t i = 0; i < count; i++) {
+		paragraph_bidi_unit_t *unit = &units[i];
+		paragraph_bidi_status_t *top = &stack[depth - 1];
+		uint8_t override;
+		uint8_t level;
+		bool rtl;
+
+		unit->level = top->level;
+		unit->type = unit->cls;
+
+		switch (unit->cls) {
+		case PARAGRAPH_BIDI_RLE:
+		case PARAGRAPH_BIDI_LRE:
+		case PARAGRAPH_BIDI_RLO:
+		case PARAGRAPH_BIDI_LRO:
+			rtl = unit->cls == PARAGRAPH_BIDI_RLE ||
+			      unit->cls == PARAGRAPH_BIDI_RLO;
+			level = rtl ? (top->level + 1) | 1 :
+					(top->level + 2) & ~1;
+			override = unit->cls == PARAGRAPH_BIDI_RLO ?
+					PARAGRAPH_BIDI_R :
+					unit->cls == PARAGRAPH_BIDI_LRO ?
+					PARAGRAPH_BIDI_L : PARAGRAPH_BIDI_ON;
+
+			if (level <= PARAGRAPH_BIDI_MAX_DEPTH &&
+					overflow_isolate == 0 &&
+					overflow_embedding == 0) {
+				stack[depth++] = (paragraph_bidi_status_t) {
+					.level = level,
+					.override = override,
+				};
+			} else if (overflow_isolate == 0) {
+				overflow_embedding++;
+			}
+			unit->type = PARAGRAPH_BIDI_BN;
+			break;
+
+		case PARAGRAPH_BIDI_RLI:
+		case PARAGRAPH_BIDI_LRI:
+		case PARAGRAPH_BIDI_FSI:
+			if (top->override != PARAGRAPH_BIDI_ON) {
+				unit->type = top->override;
+			}
+
+			rtl = unit->cls == PARAGRAPH_BIDI_RLI;
+			if (unit->cls == PARAGRAPH_BIDI_FSI) {
+				rtl = paragraph__bidi_first_strong(units,
+						i + 1, match[i] <= count ?
+						match[i] : count, true) == 1;
+			}
+			level = rtl ? (top->level + 1) | 1 :
+					(top->level + 2) & ~1;
+
+			if (level <= PARAGRAPH_BIDI_MAX_DEPTH &&
+					overflow_isolate == 0 &&
+					overflow_embedding == 0) {
+				valid_isolate++;
+				stack[depth++] = (paragraph_bidi_status_t) {
+					.level = level,
+					.override = PARAGRAPH_BIDI_ON,
+					.isolate = true,
+				};
+			} else {
+				overflow_isolate++;
+			}
+			break;
+
+		case PARAGRAPH_BIDI_PDI:
+			if (overflow_isolate > 0) {
+				overflow_isolate--;
+			} else if (valid_isolate > 0) {
+				overflow_embedding = 0;
+				while (!stack[depth - 1].isolate) {
+					depth--;
+				}
+				depth--;
+				valid_isolate--;
+			}
+
+			top = &stack[depth - 1];
+			unit->level = top->level;
+			if (top->override != PARAGRAPH_BIDI_ON) {
+				unit->type = top->override;
+			}
+			break;
+
+		case PARAGRAPH_BIDI_PDF:
+			if (overflow_isolate > 0) {
+				/* Nothing to do. */
+			} else if (overflow_embedding > 0) {
+				overflow_embedding--;
+			} else if (!top->isolate && depth >= 2) {
+				depth--;
+			}
+			unit->type = PARAGRAPH_BIDI_BN;
+			break;
+
+		case PARAGRAPH_BIDI_B:
+			/* Rule X8: separators end all embeddings. */
+			unit->level = bidi->level;
+			overflow_isolate = 0;
+			overflow_embedding = 0;
+			valid_isolate = 0;
+			depth = 1;
+			break;
+
+		case PARAGRAPH_BIDI_BN:
+			break;
+
+		default:
+			if (top->override != PARAGRAPH_BIDI_ON) {
+				unit->type = top->override;
+			}
+			break;
+		}
+	}
+}
+
+/**
+ * Find the end of a level run.
+ *
+ * \param[in]  units     The units.
+ * \param[in]  start     Index of the run's first unit.  Must not be removed.
+ * \param[in]  count     Number of units.
+ * \param[out] last_out  Returns the index of the run's last unit.
+ * \return the index of the first unit of the next run, or count.
+ */
+static uint32_t paragraph__bidi_run(
+		const paragraph_bidi_unit_t *units,
+		uint32_t start,
+		uint32_t count,
+		uint32_t *last_out)
+{
+	uint32_t last = start;
+	uint32_t i;
+
+	for (i = start + 1; i < count; i++) {
+		if (paragraph__bidi_removed(&units[i])) {
+			continue;
+		}
+		if (units[i].level != units[start].level) {
+			break;
+		}
+		last = i;
+	}
+
+	*last_out = last;
+	return i;
+}
+
+/**
+ * Apply the weak type rules, W1 to W7, to an isolating run sequence.
+ *
+ * \param[in]  units  The units.
+ * \param[in]  seq    Indices of the units in the run sequence.
+ * \param[in]  m      Number of units in the run sequence.
+ * \param[in]  sos    Class of the start of the sequence.
+ */
+static void paragraph__bidi_weak(
+		paragraph_bidi_unit_t *units,
+		const uint32_t *seq,
+		uint32_t m,
+		uint8_t sos)
+{
+	uint8_t prev = sos;
+	uint8_t strong = sos;
+
+	/* W1: NSM takes the type of the previous character. */
+	for (uint32_t k = 0; k < m; k++) {
+		paragraph_bidi_unit_t *unit = &units[seq[k]];
+
+		if (unit->type == PARAGRAPH_BIDI_NSM) {
+			unit->type = (paragraph__bidi_is_isolate(prev) ||
+					prev == PARAGRAPH_BIDI_PDI) ?
+					PARAGRAPH_BIDI_ON : prev;
+		}
+		prev = unit->type;
+	}
+
+	/* W2: EN after AL becomes AN.  W3: AL becomes R. */
+	for (uint32_t k = 0; k < m; k++) {
+		paragraph_bidi_unit_t *unit = &units[seq[k]];
+
+		switch (unit->type) {
+		case PARAGRAPH_BIDI_L:
+		case PARAGRAPH_BIDI_R:
+			strong = unit->type;
+			break;
+		case PARAGRAPH_BIDI_AL:
+			strong = unit->type;
+			unit->type = PARAGRAPH_BIDI_R;
+			break;
+		case PARAGRAPH_BIDI_EN:
+			if (strong == PARAGRAPH_BIDI_AL) {
+				unit->type = PARAGRAPH_BIDI_AN;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	/* W4: A single separator between two numbers of the same type. */
+	for (uint32_t k = 1; k + 1 < m; k++) {
+		paragraph_bidi_unit_t *unit = &units[seq[k]];
+		uint8_t before = units[seq[k - 1]].type;
+		uint8_t after = units[seq[k + 1]].type;
+
+		if (before != after) {
+			continue;
+		}
+		if ((unit->type == PARAGRAPH_BIDI_ES &&
+				before == PARAGRAPH_BIDI_EN) ||
+		    (unit->type == PARAGRAPH_BIDI_CS &&
+				(before == PARAGRAPH_BIDI_EN ||
+				 before == PARAGRAPH_BIDI_AN))) {
+			unit->type = before;
+		}
+	}
+
+	/* W5: ETs adjacent to EN become EN. */
+	for (uint32_t k = 0; k < m; k++) {
+		uint32_t end = k;
+
+		if (units[seq[k]].type != PARAGRAPH_BIDI_ET) {
+			continue;
+		}
+		while (end < m && units[seq[end]].type == PARAGRAPH_BIDI_ET) {
+			end++;
+		}
+		if ((k > 0 && units[seq[k - 1]].type == PARAGRAPH_BIDI_EN) ||
+		    (end < m && units[seq[end]].type == PARAGRAPH_BIDI_EN)) {
+			for (uint32_t j = k; j < end; j++) {
+				units[seq[j]].type = PARAGRAPH_BIDI_EN;
+			}
+		}
+		k = end;
+	}
+
+	/* W6: Remaining separators and terminators become ON.
+	 * W7: EN after L becomes L. */
+	strong = sos;
+	for (uint32_t k = 0; k < m; k++) {
+		paragraph_bidi_unit_t *unit = &units[seq[k]];
+
+		switch (unit->type) {
+		case PARAGRAPH_BIDI_ES:
+		case PARAGRAPH_BIDI_ET:
+		case PARAGRAPH_BIDI_CS:
+			unit->type = PARAGRAPH_BIDI_ON;
+			break;
+		case PARAGRAPH_BIDI_L:
+		case PARAGRAPH_BIDI_R:
+			strong = unit->type;
+			break;
+		case PARAGRAPH_BIDI_EN:
+			if (strong == PARAGRAPH_BIDI_L) {
+				unit->type = PARAGRAPH_BIDI_L;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+/**
+ * Order bracket pairs by the position of their opening bracket.
+ */
+static int paragraph__bidi_pair_cmp(
+		const void *a,
+		const void *b)
+{
+	const paragraph_bidi_pair_t *x = a;
+	const paragraph_bidi_pair_t *y = b;
+
+	return (x->open > y->open) - (x->open < y->open);
+}
+
+/**
+ * Set the type of a bracket, and any NSMs that follow it.
+ *
+ * \param[in]  units  The units.
+ * \param[in]  seq    Indices of the units in the run sequence.
+ * \param[in]  m      Number of units in the run sequence.
+ * \param[in]  k      Position of the bracket in the run sequence.
+ * \param[in]  type   The type to set.
+ */
+static void paragraph__bidi_set_bracket(
+		paragraph_bidi_unit_t *units,
+		const uint32_t *seq,
+		uint32_t m,
+		uint32_t k,
+		uint8_t type)
+{
+	units[seq[k]].type = type;
+
+	while (++k < m && units[seq[k]].cls == PARAGRAPH_BIDI_NSM) {
+		units[seq[k]].type = type;
+	}
+}
+
+/**
+ * Apply the paired bracket rule, N0, to an isolating run sequence.
+ *
+ * \param[in]  bidi  The embedding levels.
+ * \param[in]  seq   Indices of the units in the run sequence.
+ * \param[in]  m     Number of units in the run sequence.
+ * \param[in]  sos   Class of the start of the sequence.
+ */
+static void paragraph__bidi_brackets(
+		paragraph_bidi_t *bidi,
+		const uint32_t *seq,
+		uint32_t m,
+		uint8_t sos)
+{
+	paragraph_bidi_open_t stack[PARAGRAPH_BIDI_BRACKET_MAX];
+	paragraph_bidi_unit_t *units = bidi->units;
+	paragraph_bidi_pair_t *pairs = bidi->pairs;
+	uint8_t e = paragraph__bidi_dir(units[seq[0]].level);
+	size_t pair_count = 0;
+	size_t depth = 0;
+
+	/* BD16: Identify the bracket pairs. */
+	for (uint32_t k = 0; k < m; k++) {
+		const paragraph_bidi_unit_t *unit = &units[seq[k]];
+		const paragraph_bidi_bracket_t *b;
+
+		if (unit->type != PARAGRAPH_BIDI_ON || unit->bracket == 0) {
+			continue;
+		}
+
+		b = &paragraph_bidi_brackets[unit->bracket - 1];
+		if (b->open) {
+			if (depth == PARAGRAPH_BIDI_BRACKET_MAX) {
+				break;
+			}
+			stack[depth++] = (paragraph_bidi_open_t) {
+				.id = b->id,
+				.pos = k,
+			};
+			continue;
+		}
+
+		for (size_t s = depth; s-- > 0; ) {
+			if (stack[s].id == b->id) {
+				pairs[pair_count++] = (paragraph_bidi_pair_t) {
+					.open = stack[s].pos,
+					.close = k,
+				};
+				depth = s;
+				break;
+			}
+		}
+	}
+
+	if (pair_count == 0) {
+		return;
+	}
+	qsort(pairs, pair_count, sizeof(*pairs), paragraph__bidi_pair_cmp);
+
+	for (size_t p = 0; p < pair_count; p++) {
+		const paragraph_bidi_pair_t *pair = &pairs[p];
+		bool opposite = false;
+		bool embedding = false;
+		uint8_t type;
+
+		for (uint32_t k = pair->open + 1; k < pair->close; k++) {
+			uint8_t dir = paragraph__bidi_strong(
+					units[seq[k]].type);
+
+			if (dir == e) {
+				embedding = true;
+				break;
+			} else if (dir != PARAGRAPH_BIDI_ON) {
+				opposite = true;
+			}
+		}
+
+		if (embedding) {
+			type = e;
+		} else if (opposite) {
+			uint8_t context = sos;
+
+			for (uint32_t k = pair->open; k-- > 0; ) {
+				uint8_t dir = paragraph__bidi_strong(
+						units[seq[k]].type);
+
+				if (dir != PARAGRAPH_BIDI_ON) {
+					context = dir;
+					break;
+				}
+			}
+			/* The context is either the embedding direction,
+			 * or opposite to it, as the brackets become. */
+			type = context;
+		} else {
+			continue;
+		}
+
+		paragraph__bidi_set_bracket(units, seq, m, pair->open, type);
+		paragraph__bidi_set_bracket(units, seq, m, pair->close, type);
+	}
+}
+
+/**
+ * Apply the neutral rules, N1 and N2, to an isolating run sequence.
+ *
+ * \param[in]  units  The units.
+ * \param[in]  seq    Indices of the units in the run sequence.
+ * \param[in]  m      Number of units in the run sequence.
+ * \param[in]  sos    Class of the start of the sequence.
+ * \param[in]  eos    Class of the end of the sequence.
+ */
+static void paragraph__bidi_neutral(
+		paragraph_bidi_unit_t *units,
+		const uint32_t *seq,
+		uint32_t m,
+		uint8_t sos,
+		uint8_t eos)
+{
+	uint8_t e = paragraph__bidi_dir(units[seq[0]].level);
+
+	for (uint32_t k = 0; k < m; k++) {
+		uint8_t before, after, type;
+		uint32_t end = k;
+
+		if (paragraph__bidi_strong(units[seq[k]].type) !=
+				PARAGRAPH_BIDI_ON) {
+			continue;
+		}
+
+		while (end < m && paragraph__bidi_strong(
+				units[seq[end]].type) == PARAGRAPH_BIDI_ON) {
+			end++;
+		}
+
+		before = k > 0 ? paragraph__bidi_strong(
+				units[seq[k - 1]].type) : sos;
+		after = end < m ? paragraph__bidi_strong(
+				units[seq[end]].type) : eos;
+		type = (before == after) ? before : e;
+
+		for (uint32_t j = k; j < end; j++) {
+			units[seq[j]].type = type;
+		}
+		k = end;
+	}
+}
+
+/**
+ * Apply the implicit rules, I1 and I2, to all the units.
+ *
+ * This is done once every isolating run sequence is resolved, since
+ * finding each sequence's sos and eos needs the embedding levels of the
+ * units around it.
+ *
+ * \param[in]  units  The units.
+ * \param[in]  count  Number of units.
+ */
+static void paragraph__bidi_implicit(
+		paragraph_bidi_unit_t *units,
+		uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		paragraph_bidi_unit_t *unit = &units[i];
+
+		if (paragraph__bidi_removed(unit)) {
+			continue;
+		}
+
+		if ((unit->level & 1) == 0) {
+			if (unit->type == PARAGRAPH_BIDI_R) {
+				unit->level += 1;
+			} else if (unit->type == PARAGRAPH_BIDI_AN ||
+					unit->type == PARAGRAPH_BIDI_EN) {
+				unit->level += 2;
+			}
+		} else if (unit->type == PARAGRAPH_BIDI_L ||
+				unit->type == PARAGRAPH_BIDI_AN ||
+				unit->type == PARAGRAPH_BIDI_EN) {
+			unit->level += 1;
+		}
+	}
+}
+
+/**
+ * Resolve an isolating run sequence.
+ *
+ * \param[in]  bidi   The embedding levels.
+ * \param[in]  count  Number of units.
+ * \param[in]  seq    Indices of the units in the run sequence.
+ * \param[in]  m      Number of units in the run sequence.
+ */
+static void paragraph__bidi_sequence(
+		paragraph_bidi_t *bidi,
+		uint32_t count,
+		const uint32_t *seq,
+		uint32_t m)
+{
+	paragraph_bidi_unit_t *units = bidi->units;
+	uint8_t level = units[seq[0]].level;
+	uint8_t before = bidi->level;
+	uint8_t after = bidi->level;
+	uint32_t last = seq[m - 1];
+	uint8_t sos, eos;
+
+	for (uint32_t i = seq[0]; i-- > 0; ) {
+		if (!paragraph__bidi_removed(&units[i])) {
+			before = units[i].level;
+			break;
+		}
+	}
+
+	/* An isolate initiator ends a sequence only if it has no match. */
+	if (!paragraph__bidi_is_isolate(units[last].cls)) {
+		for (uint32_t i = last + 1; i < count; i++) {
+			if (!paragraph__bidi_removed(&units[i])) {
+				after = units[i].level;
+				break;
+			}
+		}
+	}
+
+	sos = paragraph__bidi_dir(before > level ? before : level);
+	eos = paragraph__bidi_dir(after > level ? after : level);
+
+	paragraph__bidi_weak(units, seq, m, sos);
+	paragraph__bidi_brackets(bidi, seq, m, sos);
+	paragraph__bidi_neutral(units, seq, m, sos, eos);
+}
+
+/**
+ * Find the isolating run sequences, and resolve each.
+ *
+ * \param[in]  bidi   The embedding levels.
+ * \param[in]  count  Number of units.
+ * \param[in]  match  Matching isolate initiators and PDIs.  Modified.
+ * \param[in]  seq    Space for the unit indices of a run sequence.
+ */
+static void paragraph__bidi_sequences(
+		paragraph_bidi_t *bidi,
+		uint32_t count,
+		uint32_t *match,
+		uint32_t *seq)
+{
+	const paragraph_bidi_unit_t *units = bidi->units;
+	uint32_t i = 0;
+
+	while (i < count) {
+		uint32_t start = i;
+		uint32_t last;
+		uint32_t m = 0;
+
+		if (paragraph__bidi_removed(&units[i])) {
+			i++;
+			continue;
+		}
+
+		i = paragraph__bidi_run(units, start, count, &last);
+		if (units[start].cls == PARAGRAPH_BIDI_PDI &&
+				match[start] == PARAGRAPH_BIDI_DONE) {
+			/* Already resolved with its isolate initiator. */
+			continue;
+		}
+
+		while (true) {
+			uint32_t end = last + 1;
+
+			for (uint32_t j = start; j < end; j++) {
+				if (!paragraph__bidi_removed(&units[j])) {
+					seq[m++] = j;
+				}
+			}
+
+			if (!paragraph__bidi_is_isolate(units[last].cls) ||
+					match[last] == PARAGRAPH_BIDI_NONE) {
+				break;
+			}
+
+			/* Continue with the matching PDI's level run. */
+			start = match[last];
+			match[start] = PARAGRAPH_BIDI_DONE;
+			(void) paragraph__bidi_run(units, start, count, &last);
+		}
+
+		paragraph__bidi_sequence(bidi, count, seq, m);
+	}
+}
+
+/**
+ * Apply rule L1 to the paragraph's separators and trailing whitespace.
+ *
+ * Removed units are given the level of the unit before them, first.
+ *
+ * \param[in]  bidi   The embedding levels.
+ * \param[in]  count  Number of units.
+ */
+static void paragraph__bidi_separators(
+		paragraph_bidi_t *bidi,
+		uint32_t count)
+{
+	paragraph_bidi_unit_t *units = bidi->units;
+	uint8_t level = bidi->level;
+	bool trailing = true;
+
+	for (uint32_t i = 0; i < count; i++) {
+		if (paragraph__bidi_removed(&units[i])) {
+			units[i].level = level;
+		}
+		level = units[i].level;
+	}
+
+	for (uint32_t i = count; i-- > 0; ) {
+		paragraph_bidi_unit_t *unit = &units[i];
+
+		switch (unit->cls) {
+		case PARAGRAPH_BIDI_S:
+		case PARAGRAPH_BIDI_B:
+			unit->level = bidi->level;
+			trailing = true;
+			break;
+
+		case PARAGRAPH_BIDI_WS:
+		case PARAGRAPH_BIDI_LRI:
+		case PARAGRAPH_BIDI_RLI:
+		case PARAGRAPH_BIDI_FSI:
+		case PARAGRAPH_BIDI_PDI:
+		case PARAGRAPH_BIDI_BN:
+		case PARAGRAPH_BIDI_LRE:
+		case PARAGRAPH_BIDI_RLE:
+		case PARAGRAPH_BIDI_LRO:
+		case PARAGRAPH_BIDI_RLO:
+		case PARAGRAPH_BIDI_PDF:
+			if (trailing) {
+				unit->level = bidi->level;
+			}
+			break;
+
+		default:
+			trailing = false;
+			break;
+		}
+	}
+}
+
+/**
+ * Store the resolved levels of the units.
+ *
+ * Content entries that aren't text or replaced content take the lower of
+ * the levels either side of them, so they don't split a run of higher
+ * levels when lines are reordered.
+ *
+ * \param[in]  bidi     The embedding levels.
+ * \param[in]  content  The resolved content.
+ * \param[in]  count    Number of units.
+ */
+static void paragraph__bidi_store(
+		paragraph_bidi_t *bidi,
+		const paragraph_content_t *content,
+		uint32_t count)
+{
+	const paragraph_bidi_unit_t *units = bidi->units;
+	uint8_t level = bidi->level;
+	size_t pos = 0;
+
+	for (uint32_t i = 0; i < count; i++) {
+		if (units[i].len > 0) {
+			memset(bidi->levels + units[i].pos, units[i].level,
+					units[i].len);
+		} else {
+			bidi->entry_levels[units[i].pos] = units[i].level;
+		}
+	}
+
+	for (uint32_t e = 0; e < content->count; e++) {
+		switch (content->type[e]) {
+		case PARAGRAPH_CONTENT_TEXT:
+			bidi->entry_levels[e] = 0;
+			pos += content->text_len[e];
+			if (content->text_len[e] > 0) {
+				level = bidi->levels[pos - 1];
+			}
+			break;
+		case PARAGRAPH_CONTENT_REPLACED:
+			level = bidi->entry_levels[e];
+			break;
+		default:
+			bidi->entry_levels[e] = level;
+			break;
+		}
+	}
+
+	level = bidi->level;
+	for (uint32_t e = content->count; e-- > 0; ) {
+		switch (content->type[e]) {
+		case PARAGRAPH_CONTENT_TEXT:
+			pos -= content->text_len[e];
+			if (content->text_len[e] > 0) {
+				level = bidi->levels[pos];
+			}
+			break;
+		case PARAGRAPH_CONTENT_REPLACED:
+			level = bidi->entry_levels[e];
+			break;
+		default:
+			if (bidi->entry_levels[e] > level) {
+				bidi->entry_levels[e] = level;
+			}
+			break;
+		}
+	}
+}
+
+/**
+ * Resolve the embedding levels of all the content.
+ *
+ * \param[in]  bidi     The embedding levels.
+ * \param[in]  content  The content to resolve.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__bidi_resolve(
+		paragraph_bidi_t *bidi,
+		const paragraph_content_t *content)
+{
+	size_t max = content->len + content->count;
+	paragraph_err_t err;
+	uint32_t count;
+
+	err = vec_ensure((void **)&bidi->levels, content->len,
+			sizeof(*bidi->levels), 0, &bidi->alloc, options);
+	if (err == PARAGRAPH_OK) {
+		err = vec_ensure((void **)&bidi->entry_levels, content->count,
+				sizeof(*bidi->entry_levels), 0,
+				&bidi->entry_alloc, options);
+	}
+	if (err == PARAGRAPH_OK) {
+		err = vec_ensure((void **)&bidi->units, max,
+				sizeof(*bidi->units), 0,
+				&bidi->unit_alloc, options);
+	}
+	if (err == PARAGRAPH_OK) {
+		err = vec_ensure((void **)&bidi->index, max * 2,
+				sizeof(*bidi->index), 0,
+				&bidi->index_alloc, options);
+	}
+	if (err == PARAGRAPH_OK) {
+		err = vec_ensure((void **)&bidi->pairs, max / 2 + 1,
+				sizeof(*bidi->pairs), 0,
+				&bidi->pair_alloc, options);
+	}
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	paragraph__bidi_units(bidi, content, &count);
+
+	bidi->level = paragraph__bidi_first_strong(bidi->units,
+			0, count, false) == 1 ? 1 : 0;
+
+	paragraph__bidi_match(bidi->units, count, bidi->index);
+	paragraph__bidi_explicit(bidi, count, bidi->index);
+	paragraph__bidi_sequences(bidi, count, bidi->index,
+			bidi->index + count);
+	paragraph__bidi_implicit(bidi->units, count);
+	paragraph__bidi_separators(bidi, count);
+	paragraph__bidi_store(bidi, content, count);
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Find where two sets of levels differ.
+ *
+ * \param[in]  a        Levels, or NULL if they are all zero.
+ * \param[in]  b        Levels to compare with, or NULL if all zero.
+ * \param[in]  len      Number of levels to compare.
+ * \param[in]  last     Whether to find the last difference, not the first.
+ * \param[out] pos_out  Returns the index of the difference, if any.
+ * \return true if the levels differ, false otherwise.
+ */
+static bool paragraph__bidi_diff(
+		const uint8_t *a,
+		const uint8_t *b,
+		size_t len,
+		bool last,
+		size_t *pos_out)
+{
+	for (size_t i = 0; i < len; i++) {
+		size_t pos = last ? len - 1 - i : i;
+
+		if ((a != NULL ? a[pos] : 0) != (b != NULL ? b[pos] : 0)) {
+			*pos_out = pos;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Extend the changed entry range to cover changed levels.
+ *
+ * \param[in]  bidi     The embedding levels.
+ * \param[in]  content  The resolved content.
+ */
+static void paragraph__bidi_extend(
+		const paragraph_bidi_t *bidi,
+		paragraph_content_t *content)
+{
+	const uint8_t *levels = bidi->active ? bidi->levels : NULL;
+	const uint8_t *entries = bidi->active ? bidi->entry_levels : NULL;
+	const uint8_t *old = bidi->old_active ? bidi->old : NULL;
+	const uint8_t *old_entries = bidi->old_active ? bidi->old_entry : NULL;
+	paragraph_content_dirty_t *dirty = &content->dirty;
+	int64_t shift = (int64_t)content->count - bidi->old_count;
+	uint32_t index;
+	size_t offset;
+	size_t pos;
+
+	/* Unchanged text before the changes is at the same offsets. */
+	pos = dirty->start < content->count ?
+			paragraph_content__offset(content, dirty->start) :
+			content->len;
+	if (paragraph__bidi_diff(levels, old, pos, false, &pos) &&
+	    paragraph_content__entry_at(content, pos,
+			&index, &offset) == PARAGRAPH_OK &&
+	    index < dirty->start) {
+		dirty->start = index;
+	}
+	for (uint32_t e = 0; e < dirty->start; e++) {
+		if (content->type[e] != PARAGRAPH_CONTENT_TEXT &&
+				(entries != NULL ? entries[e] : 0) !=
+				(old_entries != NULL ? old_entries[e] : 0)) {
+			dirty->start = e;
+			break;
+		}
+	}
+
+	if (dirty->end >= content->count) {
+		return;
+	}
+
+	/* Unchanged text after the changes is at the end of both. */
+	pos = paragraph_content__offset(content, dirty->end);
+	if (paragraph__bidi_diff(
+			levels != NULL ? levels + pos : NULL,
+			old != NULL ? old + bidi->old_len -
+					(content->len - pos) : NULL,
+			content->len - pos, true, &offset) &&
+	    paragraph_content__entry_at(content, pos + offset,
+			&index, &offset) == PARAGRAPH_OK &&
+	    index >= dirty->end) {
+		dirty->end = index + 1;
+	}
+	for (uint32_t e = content->count; e-- > dirty->end; ) {
+		if (content->type[e] != PARAGRAPH_CONTENT_TEXT &&
+				(entries != NULL ? entries[e] : 0) !=
+				(old_entries != NULL ?
+						old_entries[e - shift] : 0)) {
+			dirty->end = e + 1;
+			break;
+		}
+	}
+}
+
+/* Internally exported function, documented in `src/bidi.h` */
+paragraph_err_t paragraph_bidi__update(
+		paragraph_bidi_t *bidi,
+		paragraph_content_t *content)
+{
+	bool compare = bidi->valid;
+	paragraph_err_t err;
+	uint8_t *swap;
+	size_t alloc;
+
+	if (bidi->valid && !content->dirty.dirty) {
+		return PARAGRAPH_OK;
+	}
+
+	/* Keep the previous levels to compare with. */
+	swap = bidi->old;
+	bidi->old = bidi->levels;
+	bidi->levels = swap;
+	alloc = bidi->old_alloc;
+	bidi->old_alloc = bidi->alloc;
+	bidi->alloc = alloc;
+	swap = bidi->old_entry;
+	bidi->old_entry = bidi->entry_levels;
+	bidi->entry_levels = swap;
+	alloc = bidi->old_entry_alloc;
+	bidi->old_entry_alloc = bidi->entry_alloc;
+	bidi->entry_alloc = alloc;
+	bidi->old_len = bidi->len;
+	bidi->old_count = bidi->count;
+	bidi->old_active = bidi->active;
+	bidi->valid = false;
+
+	/* Text with nothing right-to-left is all at level zero. */
+	bidi->active = false;
+	for (uint32_t i = 0; i < content->count; i++) {
+		if (content->cold[i].bidi) {
+			bidi->active = true;
+			break;
+		}
+	}
+
+	bidi->level = 0;
+	bidi->len = content->len;
+	bidi->count = content->count;
+	if (bidi->active) {
+		err = paragraph__bidi_resolve(bidi, content);
+		if (err != PARAGRAPH_OK) {
+			bidi->active = false;
+			return err;
+		}
+	}
+	bidi->valid = true;
+
+	if (compare && content->dirty.dirty &&
+			(bidi->active || bidi->old_active)) {
+		paragraph__bidi_extend(bidi, content);
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/bidi.h` */
+void paragraph_bidi__reset(
+		paragraph_bidi_t *bidi)
+{
+	bidi->len = 0;
+	bidi->count = 0;
+	bidi->old_len = 0;
+	bidi->old_count = 0;
+	bidi->level = 0;
+	bidi->active = false;
+	bidi->old_active = false;
+	bidi->valid = false;
+}
+
+/* Internally exported function, documented in `src/bidi.h` */
+void paragraph_bidi__destroy(
+		paragraph_bidi_t *bidi)
+{
+	vec_free((void **)&bidi->levels, &bidi->alloc, options);
+	vec_free((void **)&bidi->entry_levels, &bidi->entry_alloc, options);
+	vec_free((void **)&bidi->old, &bidi->old_alloc, options);
+	vec_free((void **)&bidi->old_entry, &bidi->old_entry_alloc, options);
+	vec_free((void **)&bidi->units, &bidi->unit_alloc, options);
+	vec_free((void **)&bidi->index, &bidi->index_alloc, options);
+	vec_free((void **)&bidi->pairs, &bidi->pair_alloc, options);
+	*bidi = (paragraph_bidi_t) { 0 };
+}
+
+/* Internally exported function, documented in `src/bidi.h` */
+void paragraph_bidi__share(
+		paragraph_bidi_t *bidi,
+		const paragraph_bidi_t *src)
+{
+	vec_free((void **)&bidi->levels, &bidi->alloc, options);
+	vec_free((void **)&bidi->entry_levels, &bidi->entry_alloc, options);
+
+	bidi->levels = src->levels;
+	bidi->alloc = src->alloc;
+	bidi->len = src->len;
+	bidi->entry_levels = src->entry_levels;
+	bidi->entry_alloc = src->entry_alloc;
+	bidi->count = src->count;
+	bidi->level = src->level;
+	bidi->active = src->active;
+	bidi->valid = src->valid;
+}
+
+/* Internally exported function, documented in `src/bidi.h` */
+paragraph_err_t paragraph_bidi__own(
+		paragraph_bidi_t *bidi)
+{
+	paragraph_bidi_t own = *bidi;
+	paragraph_err_t err;
+
+	err = vec_dup((void **)&own.levels, sizeof(*own.levels),
+			bidi->len, &own.alloc);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = vec_dup((void **)&own.entry_levels, sizeof(*own.entry_levels),
+			bidi->count, &own.entry_alloc);
+	if (err != PARAGRAPH_OK) {
+		free(own.levels);
+		return err;
+	}
+
+	*bidi = own;
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/bidi.h` */
+void paragraph_bidi__forget(
+		paragraph_bidi_t *bidi)
+{
+	bidi->levels = NULL;
+	bidi->alloc = 0;
+	bidi->len = 0;
+	bidi->entry_levels = NULL;
+	bidi->entry_alloc = 0;
+	bidi->count = 0;
+	bidi->level = 0;
+	bidi->active = false;
+	bidi->valid = false;
+}
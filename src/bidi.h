@@ -0,0 +1,196 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Bidirectional text interface.
+ */
+
+#ifndef PARAGRAPH__BIDI_H
+#define PARAGRAPH__BIDI_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "content.h"
+
+/**
+ * Bidirectional resolution scratch data for a unit of text.
+ *
+ * A unit is a character, or a replaced content entry, which is treated as
+ * U+FFFC OBJECT REPLACEMENT CHARACTER.
+ */
+typedef struct paragraph_bidi_unit_s {
+	uint32_t pos;    /**< Text offset, or replaced content entry index. */
+	uint8_t len;     /**< Byte length of the character, or 0 if replaced. */
+	uint8_t cls;     /**< Original \ref paragraph_bidi_e class. */
+	uint8_t type;    /**< Current \ref paragraph_bidi_e class. */
+	uint8_t level;   /**< Embedding level. */
+	uint8_t bracket; /**< Index in bracket table plus one, or 0. */
+} paragraph_bidi_unit_t;
+
+/**
+ * A matched pair of brackets, as identified by BD16.
+ */
+typedef struct paragraph_bidi_pair_s {
+	uint32_t open;  /**< Position of opening bracket in run sequence. */
+	uint32_t close; /**< Position of closing bracket in run sequence. */
+} paragraph_bidi_pair_t;
+
+/**
+ * Embedding levels of a paragraph's text.
+ */
+typedef struct paragraph_bidi_s {
+	uint8_t *levels; /**< Level of each text byte, if active. */
+	size_t len;      /**< Byte length of the text the levels are for. */
+	size_t alloc;    /**< Number of bytes levels has space for. */
+
+	/** Level of each content entry that isn't text, if active. */
+	uint8_t *entry_levels;
+	uint32_t count;     /**< Number of content entries levels are for. */
+	size_t entry_alloc; /**< Number of entries entry_levels can hold. */
+
+	/** Levels from the previous resolution, to compare with. */
+	uint8_t *old;
+	size_t old_len;      /**< Byte length of the text old is for. */
+	size_t old_alloc;    /**< Number of bytes old has space for. */
+	uint8_t *old_entry;  /**< Entry levels from previous resolution. */
+	uint32_t old_count;  /**< Number of entries old_entry is for. */
+	size_t old_entry_alloc; /**< Number of entries old_entry can hold. */
+	bool old_active;     /**< Whether the previous levels were active. */
+
+	/** Resolution scratch space. */
+	paragraph_bidi_unit_t *units;
+	size_t unit_alloc; /**< Number of units the scratch space can hold. */
+	uint32_t *index;   /**< Scratch unit indices. */
+	size_t index_alloc; /**< Number of indices the scratch can hold. */
+	paragraph_bidi_pair_t *pairs; /**< Scratch bracket pairs. */
+	size_t pair_alloc; /**< Number of pairs the scratch space can hold. */
+
+	uint8_t level; /**< Paragraph embedding level. */
+	bool active;   /**< Whether there are levels; otherwise all are zero. */
+	bool valid;    /**< Whether levels are for the current content. */
+} paragraph_bidi_t;
+
+/**
+ * Resolve the embedding levels of changed content.
+ *
+ * Does nothing unless the content has changed since the last call.
+ *
+ * A change can affect the levels of unchanged content either side of it.
+ * The content's changed entry range is extended to cover any that differ
+ * from the previous resolution.
+ *
+ * \param[in]  bidi     The embedding levels to update.
+ * \param[in]  content  The content to resolve.  Must be settled.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_bidi__update(
+		paragraph_bidi_t *bidi,
+		paragraph_content_t *content);
+
+/**
+ * Forget all embedding levels, keeping allocations for reuse.
+ *
+ * \param[in]  bidi  The embedding levels to reset.
+ */
+void paragraph_bidi__reset(
+		paragraph_bidi_t *bidi);
+
+/**
+ * Free all embedding levels.
+ *
+ * \param[in]  bidi  The embedding levels to destroy.
+ */
+void paragraph_bidi__destroy(
+		paragraph_bidi_t *bidi);
+
+/**
+ * Use another paragraph's embedding levels, without copying them.
+ *
+ * Any levels bidi has are freed.  The levels are then shared, so they
+ * must not be changed or freed until bidi stops sharing them, with
+ * \ref paragraph_bidi__own or \ref paragraph_bidi__forget.  The
+ * resolution scratch space isn't shared.
+ *
+ * \param[in]  bidi  The embedding levels to share into.
+ * \param[in]  src   The embedding levels to share.
+ */
+void paragraph_bidi__share(
+		paragraph_bidi_t *bidi,
+		const paragraph_bidi_t *src);
+
+/**
+ * Take a copy of shared embedding levels, so they can be changed.
+ *
+ * \param[in]  bidi  The shared embedding levels.  Unchanged on failure.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_bidi__own(
+		paragraph_bidi_t *bidi);
+
+/**
+ * Stop using shared embedding levels, without freeing them.
+ *
+ * \param[in]  bidi  The shared embedding levels.
+ */
+void paragraph_bidi__forget(
+		paragraph_bidi_t *bidi);
+
+/**
+ * Get the embedding level of a text byte.
+ *
+ * \param[in]  bidi  The embedding levels.
+ * \param[in]  pos   Byte offset in paragraph text.
+ * \return the embedding level.
+ */
+static inline uint8_t paragraph_bidi__level(
+		const paragraph_bidi_t *bidi,
+		size_t pos)
+{
+	return bidi->active ? bidi->levels[pos] : 0;
+}
+
+/**
+ * Get the embedding level of a content entry that isn't text.
+ *
+ * \param[in]  bidi   The embedding levels.
+ * \param[in]  entry  Index of the content entry.
+ * \return the embedding level.
+ */
+static inline uint8_t paragraph_bidi__entry_level(
+		const paragraph_bidi_t *bidi,
+		uint32_t entry)
+{
+	return bidi->active ? bidi->entry_levels[entry] : 0;
+}
+
+/**
+ * Find where the embedding level next changes.
+ *
+ * \param[in]  bidi  The embedding levels.
+ * \param[in]  pos   Byte offset in paragraph text to search from.
+ * \param[in]  end   Byte offset in paragraph text to search to.
+ * \return the offset of the first byte after pos with a different level to
+ *         the byte at pos, or end if there is none.
+ */
+static inline size_t paragraph_bidi__run_end(
+		const paragraph_bidi_t *bidi,
+		size_t pos,
+		size_t end)
+{
+	if (bidi->active && pos < end) {
+		uint8_t level = bidi->levels[pos];
+
+		while (++pos < end && bidi->levels[pos] == level) {
+		}
+		return pos;
+	}
+
+	return end;
+}
+
+#endif
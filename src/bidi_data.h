@@ -0,0 +1,188 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Bidirectional class tables.
+ *
+ * Generated by `tools/bidi_gen.c` from DerivedBidiClass-14.0.0.txt and BidiBrackets-14.0.0.txt.
+ * Do not edit.
+ */
+
+#ifndef PARAGRAPH__BIDI_DATA_H
+#define PARAGRAPH__BIDI_DATA_H
+
+#include <stdint.h>
+
+/** Bidirectional classes. */
+enum paragraph_bidi_e {
+	PARAGRAPH_BIDI_L,
+	PARAGRAPH_BIDI_R,
+	PARAGRAPH_BIDI_AL,
+	PARAGRAPH_BIDI_EN,
+	PARAGRAPH_BIDI_ES,
+	PARAGRAPH_BIDI_ET,
+	PARAGRAPH_BIDI_AN,
+	PARAGRAPH_BIDI_CS,
+	PARAGRAPH_BIDI_NSM,
+	PARAGRAPH_BIDI_BN,
+	PARAGRAPH_BIDI_B,
+	PARAGRAPH_BIDI_S,
+	PARAGRAPH_BIDI_WS,
+	PARAGRAPH_BIDI_ON,
+	PARAGRAPH_BIDI_LRE,
+	PARAGRAPH_BIDI_LRO,
+	PARAGRAPH_BIDI_RLE,
+	PARAGRAPH_BIDI_RLO,
+	PARAGRAPH_BIDI_PDF,
+	PARAGRAPH_BIDI_LRI,
+	PARAGRAPH_BIDI_RLI,
+	PARAGRAPH_BIDI_FSI,
+	PARAGRAPH_BIDI_PDI,
+	PARAGRAPH_BIDI__COUNT,
+};
+
+/** A paired bracket. */
+typedef struct paragraph_bidi_bracket_s {
+	uint32_t cp; /**< The bracket. */
+	/** Canonical opening bracket of the pair, for matching. */
+	uint32_t id;
+	uint8_t open; /**< Whether the bracket is an opening bracket. */
+} paragraph_bidi_bracket_t;
+
+/** Paired brackets, sorted by code point. */
+static const paragraph_bidi_bracket_t paragraph_bidi_brackets[128] = {
+	{ 0x0028, 0x0028, 1 },
+	{ 0x0029, 0x0028, 0 },
+	{ 0x005B, 0x005B, 1 },
+	{ 0x005D, 0x005B, 0 },
+	{ 0x007B, 0x007B, 1 },
+	{ 0x007D, 0x007B, 0 },
+	{ 0x0F3A, 0x0F3A, 1 },
+	{ 0x0F3B, 0x0F3A, 0 },
+	{ 0x0F3C, 0x0F3C, 1 },
+	{ 0x0F3D, 0x0F3C, 0 },
+	{ 0x169B, 0x169B, 1 },
+	{ 0x169C, 0x169B, 0 },
+	{ 0x2045, 0x2045, 1 },
+	{ 0x2046, 0x2045, 0 },
+	{ 0x207D, 0x207D, 1 },
+	{ 0x207E, 0x207D, 0 },
+	{ 0x208D, 0x208D, 1 },
+	{ 0x208E, 0x208D, 0 },
+	{ 0x2308, 0x2308, 1 },
+	{ 0x2309, 0x2308, 0 },
+	{ 0x230A, 0x230A, 1 },
+	{ 0x230B, 0x230A, 0 },
+	{ 0x2329, 0x3008, 1 },
+	{ 0x232A, 0x3008, 0 },
+	{ 0x2768, 0x2768, 1 },
+	{ 0x2769, 0x2768, 0 },
+	{ 0x276A, 0x276A, 1 },
+	{ 0x276B, 0x276A, 0 },
+	{ 0x276C, 0x276C, 1 },
+	{ 0x276D, 0x276C, 0 },
+	{ 0x276E, 0x276E, 1 },
+	{ 0x276F, 0x276E, 0 },
+	{ 0x2770, 0x2770, 1 },
+	{ 0x2771, 0x2770, 0 },
+	{ 0x2772, 0x2772, 1 },
+	{ 0x2773, 0x2772, 0 },
+	{ 0x2774, 0x2774, 1 },
+	{ 0x2775, 0x2774, 0 },
+	{ 0x27C5, 0x27C5, 1 },
+	{ 0x27C6, 0x27C5, 0 },
+	{ 0x27E6, 0x27E6, 1 },
+	{ 0x27E7, 0x27E6, 0 },
+	{ 0x27E8, 0x27E8, 1 },
+	{ 0x27E9, 0x27E8, 0 },
+	{ 0x27EA, 0x27EA, 1 },
+	{ 0x27EB, 0x27EA, 0 },
+	{ 0x27EC, 0x27EC, 1 },
+	{ 0x27ED, 0x27EC, 0 },
+	{ 0x27EE, 0x27EE, 1 },
+	{ 0x27EF, 0x27EE, 0 },
+	{ 0x2983, 0x2983, 1 },
+	{ 0x2984, 0x2983, 0 },
+	{ 0x2985, 0x2985, 1 },
+	{ 0x2986, 0x2985, 0 },
+	{ 0x2987, 0x2987, 1 },
+	{ 0x2988, 0x2987, 0 },
+	{ 0x2989, 0x2989, 1 },
+	{ 0x298A, 0x2989, 0 },
+	{ 0x298B, 0x298B, 1 },
+	{ 0x298C, 0x298B, 0 },
+	{ 0x298D, 0x298D, 1 },
+	{ 0x298E, 0x298F, 0 },
+	{ 0x298F, 0x298F, 1 },
+	{ 0x2990, 0x298D, 0 },
+	{ 0x2991, 0x2991, 1 },
+	{ 0x2992, 0x2991, 0 },
+	{ 0x2993, 0x2993, 1 },
+	{ 0x2994, 0x2993, 0 },
+	{ 0x2995, 0x2995, 1 },
+	{ 0x2996, 0x2995, 0 },
+	{ 0x2997, 0x2997, 1 },
+	{ 0x2998, 0x2997, 0 },
+	{ 0x29D8, 0x29D8, 1 },
+	{ 0x29D9, 0x29D8, 0 },
+	{ 0x29DA, 0x29DA, 1 },
+	{ 0x29DB, 0x29DA, 0 },
+	{ 0x29FC, 0x29FC, 1 },
+	{ 0x29FD, 0x29FC, 0 },
+	{ 0x2E22, 0x2E22, 1 },
+	{ 0x2E23, 0x2E22, 0 },
+	{ 0x2E24, 0x2E24, 1 },
+	{ 0x2E25, 0x2E24, 0 },
+	{ 0x2E26, 0x2E26, 1 },
+	{ 0x2E27, 0x2E26, 0 },
+	{ 0x2E28, 0x2E28, 1 },
+	{ 0x2E29, 0x2E28, 0 },
+	{ 0x2E55, 0x2E55, 1 },
+	{ 0x2E56, 0x2E55, 0 },
+	{ 0x2E57, 0x2E57, 1 },
+	{ 0x2E58, 0x2E57, 0 },
+	{ 0x2E59, 0x2E59, 1 },
+	{ 0x2E5A, 0x2E59, 0 },
+	{ 0x2E5B, 0x2E5B, 1 },
+	{ 0x2E5C, 0x2E5B, 0 },
+	{ 0x3008, 0x3008, 1 },
+	{ 0x3009, 0x3008, 0 },
+	{ 0x300A, 0x300A, 1 },
+	{ 0x300B, 0x300A, 0 },
+	{ 0x300C, 0x300C, 1 },
+	{ 0x300D, 0x300C, 0 },
+	{ 0x300E, 0x300E, 1 },
+	{ 0x300F, 0x300E, 0 },
+	{ 0x3010, 0x3010, 1 },
+	{ 0x3011, 0x3010, 0 },
+	{ 0x3014, 0x3014, 1 },
+	{ 0x3015, 0x3014, 0 },
+	{ 0x3016, 0x3016, 1 },
+	{ 0x3017, 0x3016, 0 },
+	{ 0x3018, 0x3018, 1 },
+	{ 0x3019, 0x3018, 0 },
+	{ 0x301A, 0x301A, 1 },
+	{ 0x301B, 0x301A, 0 },
+	{ 0xFE59, 0xFE59, 1 },
+	{ 0xFE5A, 0xFE59, 0 },
+	{ 0xFE5B, 0xFE5B, 1 },
+	{ 0xFE5C, 0xFE5B, 0 },
+	{ 0xFE5D, 0xFE5D, 1 },
+	{ 0xFE5E, 0xFE5D, 0 },
+	{ 0xFF08, 0xFF08, 1 },
+	{ 0xFF09, 0xFF08, 0 },
+	{ 0xFF3B, 0xFF3B, 1 },
+	{ 0xFF3D, 0xFF3B, 0 },
+	{ 0xFF5B, 0xFF5B, 1 },
+	{ 0xFF5D, 0xFF5B, 0 },
+	{ 0xFF5F, 0xFF5F, 1 },
+	{ 0xFF60, 0xFF5F, 0 },
+	{ 0xFF62, 0xFF62, 1 },
+	{ 0xFF63, 0xFF62, 0 },
+};
+
+#endif
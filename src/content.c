@@ -9,238 +9,1203 @@
  * \brief Paragraph content handling.
  */
 
+#include <assert.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <paragraph.h>
 
+#include "vec.h"
 #include "content.h"
 #include "style.h"
 #include "para.h"
 #include "ctx.h"
 #include "log.h"
+#include "utf8.h"
 
-static void paragraph__content_entry_cleanup(
-		paragraph_content_entry_t *content_entry)
+static const vec_opts_t options = {
+	.sso_element_max = 0,
+};
+
+/** Size of all the array data for one content entry. */
+#define PARAGRAPH_CONTENT_ENTRY_SIZE ( \
+		sizeof(paragraph_content_cold_t) + \
+		sizeof(paragraph_content_slot_t) + \
+		3 * sizeof(uint32_t) + \
+		sizeof(uint8_t))
+
+/** Minimum number of entries to allocate space for. */
+#define PARAGRAPH_CONTENT_ALLOC_MIN 16
+
+/** Number of recently added styles to check for reuse. */
+#define PARAGRAPH_CONTENT_STYLE_REUSE 4
+
+/**
+ * Make a content handle.
+ *
+ * \param[in]  slot  Handle slot index.
+ * \param[in]  gen   Handle slot generation.
+ * \return the content handle.
+ */
+static inline paragraph_content_id_t paragraph__content_id(
+		uint32_t slot,
+		uint32_t gen)
 {
-	content_entry->style = paragraph_style__unref(content_entry->style);
+	return ((paragraph_content_id_t)gen << 32) | slot;
+}
+
+/**
+ * Release a reference to a content entry array block.
+ *
+ * \param[in]  block  The block to release, or NULL.
+ */
+static void paragraph__content_block_unref(
+		paragraph_content_block_t *block)
+{
+	if (block != NULL && --block->refs == 0) {
+		free(block);
+	}
 }
 
 /* Internally exported function, documented in `src/content.h` */
 paragraph_err_t paragraph__content_destroy(
+		const paragraph_ctx_t *ctx,
 		paragraph_content_t *content)
 {
-	while (content->first != NULL) {
-		paragraph_content_entry_t *content_entry = content->first;
+	for (size_t i = 0; i < content->style_count; i++) {
+		paragraph_style__unref(ctx, content->styles[i]);
+	}
+	vec_free((void **)&content->styles, &content->style_alloc, options);
+	content->style_count = 0;
+
+	content->slot_count = 0;
+	content->slot_free = 0;
+
+	paragraph__content_block_unref(content->block);
+	content->block = NULL;
+	content->slots = NULL;
+	content->text_sum = NULL;
+	content->text_len = NULL;
+	content->style = NULL;
+	content->type = NULL;
+	content->cold = NULL;
+	content->count = 0;
+	content->alloc = 0;
 
-		paragraph__content_entry_cleanup(content_entry);
+	content->len = 0;
+	content->dirty = (paragraph_content_dirty_t) { 0 };
+
+	return PARAGRAPH_OK;
+}
 
-		content->first = content_entry->next;
-		free(content_entry);
+/* Internally exported function, documented in `src/content.h` */
+void paragraph__content_reset(
+		const paragraph_ctx_t *ctx,
+		paragraph_content_t *content)
+{
+	for (size_t i = 0; i < content->style_count; i++) {
+		paragraph_style__unref(ctx, content->styles[i]);
 	}
+	content->style_count = 0;
 
-	content->count = 0;
-	content->last = NULL;
+	/* New slots start beyond every generation used so far. */
+	for (size_t i = 0; i < content->slot_count; i++) {
+		uint32_t gen = (content->slots[i].gen + 1) & ~(uint32_t)1;
 
-	free(content->text);
-	content->text = NULL;
+		if (gen > content->slot_gen) {
+			content->slot_gen = gen;
+		}
+	}
+	content->slot_count = 0;
+	content->slot_free = 0;
+
+	/* Leave shared arrays to the other paragraphs using them. */
+	if (content->block != NULL && content->block->refs > 1) {
+		paragraph__content_block_unref(content->block);
+		content->block = NULL;
+		content->alloc = 0;
+	}
+
+	content->count = 0;
+	content->removed = 0;
+	content->settled = 0;
 	content->len = 0;
+	content->dirty = (paragraph_content_dirty_t) { 0 };
+}
+
+/* Internally exported function, documented in `src/content.h` */
+paragraph_err_t paragraph__content_clone(
+		const paragraph_ctx_t *ctx,
+		paragraph_content_t *content,
+		const paragraph_content_t *src)
+{
+	paragraph_style_t **styles;
+	size_t style_alloc;
+	paragraph_err_t err;
+
+	assert(content->count == 0 && content->style_count == 0);
+	assert(src->removed == 0);
+
+	err = vec_ensure((void **)&content->styles, src->style_count,
+			sizeof(*content->styles), 0,
+			&content->style_alloc,
+			options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	styles = content->styles;
+	style_alloc = content->style_alloc;
+	for (size_t i = 0; i < src->style_count; i++) {
+		err = paragraph_style__ref(ctx, src->styles[i]);
+		if (err != PARAGRAPH_OK) {
+			while (i > 0) {
+				paragraph_style__unref(ctx, styles[--i]);
+			}
+			return err;
+		}
+		styles[i] = src->styles[i];
+	}
+
+	paragraph__content_block_unref(content->block);
+	if (src->block != NULL) {
+		src->block->refs++;
+	}
+
+	*content = *src;
+	content->styles = styles;
+	content->style_alloc = style_alloc;
+	content->dirty = (paragraph_content_dirty_t) { 0 };
 
 	return PARAGRAPH_OK;
 }
 
+/* Internally exported function, documented in `src/content.h` */
+paragraph_err_t paragraph_content__index(
+		const paragraph_content_t *content,
+		paragraph_content_id_t id,
+		uint32_t *index_out)
+{
+	uint32_t slot = (uint32_t)id;
+	uint32_t gen = (uint32_t)(id >> 32);
+
+	if (slot >= content->slot_count ||
+	    content->slots[slot].gen != gen ||
+	    (gen & 1) == 0) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	*index_out = content->slots[slot].index;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Recalculate the text length Fenwick tree nodes from an entry onwards.
+ *
+ * The nodes for entries before the given one must be valid.  Each node is
+ * found from the ones before it, so appending an entry takes time
+ * logarithmic in the number of entries.
+ *
+ * \param[in]  content  The content to update.
+ * \param[in]  from     Index of the first entry whose length has changed.
+ */
+static void paragraph__content_sum_update(
+		paragraph_content_t *content,
+		uint32_t from)
+{
+	for (uint32_t i = from + 1; i <= content->count; i++) {
+		uint32_t sum = content->text_len[i - 1];
+
+		for (uint32_t step = 1; step < (i & -i); step <<= 1) {
+			sum += content->text_sum[i - step - 1];
+		}
+		content->text_sum[i - 1] = sum;
+	}
+}
+
+/**
+ * Subtract from an entry's length in the text length Fenwick tree.
+ *
+ * \param[in]  content  The content to update.
+ * \param[in]  index    Index of the entry.
+ * \param[in]  len      Number of bytes the entry's length has shrunk by.
+ */
+static void paragraph__content_sum_sub(
+		paragraph_content_t *content,
+		uint32_t index,
+		uint32_t len)
+{
+	for (uint32_t i = index + 1; i <= content->count; i += i & -i) {
+		content->text_sum[i - 1] -= len;
+	}
+}
+
+/* Internally exported function, documented in `src/content.h` */
+paragraph_err_t paragraph_content__entry_at(
+		const paragraph_content_t *content,
+		size_t pos,
+		uint32_t *index_out,
+		size_t *offset_out)
+{
+	uint32_t step = 1;
+	uint32_t index = 0;
+	size_t offset = pos;
+
+	if (pos > content->len || content->count == 0) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	/* Find the most entries whose text ends at or before pos. */
+	while (step <= content->count / 2) {
+		step <<= 1;
+	}
+	for (; step > 0; step >>= 1) {
+		if (index + step <= content->count &&
+		    content->text_sum[index + step - 1] <= offset) {
+			index += step;
+			offset -= content->text_sum[index - 1];
+		}
+	}
+
+	/* At the end of the text, that is all of them. */
+	if (index == content->count) {
+		index--;
+		offset += content->text_len[index];
+	}
+
+	*index_out = index;
+	*offset_out = offset;
+	return PARAGRAPH_OK;
+}
+
 /**
- * Get a new empty content entry at the end of the content entries array.
+ * Extend a changed entry range to cover an edit.
  *
- * \param[in]  para         The paragraph context to get new content entry for.
- * \param[out] entries_out  Returns pointer to new content entry on success.
+ * \param[in]  range     The changed range to update.
+ * \param[in]  index     Index of the first changed entry.
+ * \param[in]  count     Number of changed entries.
+ * \param[in]  inserted  Number of the changed entries that were inserted.
+ */
+static void paragraph__content_dirty_edit(
+		paragraph_content_dirty_t *range,
+		uint32_t index,
+		uint32_t count,
+		uint32_t inserted)
+{
+	uint32_t start = index;
+	uint32_t end = index + count;
+
+	if (range->dirty) {
+		/* Map the existing range through the insertion. */
+		uint32_t s = range->start;
+		uint32_t e = range->end;
+
+		if (s >= index) {
+			s += inserted;
+		}
+		if (e > index) {
+			e += inserted;
+		}
+
+		if (s < start) {
+			start = s;
+		}
+		if (e > end) {
+			end = e;
+		}
+	}
+
+	range->dirty = true;
+	range->start = start;
+	range->end = end;
+}
+
+/**
+ * Reallocate the content entry arrays.
+ *
+ * All of the per-entry arrays, including the handle slots, share a single
+ * allocation.  Since slots are reused, there are never more slots than the
+ * peak number of entries.
+ *
+ * The new arrays are not shared, even if the old ones were.
+ *
+ * \param[in]  content  The content to reallocate.
+ * \param[in]  alloc    Number of entries to make space for.  Must not be
+ *                      less than the number of entries or handle slots.
  * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
  */
-static paragraph_err_t paragraph__content_entry_get_new(
-		paragraph_para_t *para,
-		const paragraph_content_position_t *pos,
-		paragraph_content_entry_t **entry_out)
+static paragraph_err_t paragraph__content_realloc(
+		paragraph_content_t *content,
+		size_t alloc)
+{
+	paragraph_content_t grown;
+	size_t count = content->count;
+	paragraph_content_block_t *block;
+
+	assert(alloc >= count && alloc >= content->slot_count);
+
+	block = malloc(sizeof(*block) + alloc * PARAGRAPH_CONTENT_ENTRY_SIZE);
+	if (block == NULL) {
+		return PARAGRAPH_ERR_OOM;
+	}
+	block->refs = 1;
+
+	/* Arrays are laid out in order of decreasing alignment. */
+	grown.cold = block->cold;
+	grown.slots = (paragraph_content_slot_t *)(grown.cold + alloc);
+	grown.text_sum = (uint32_t *)(grown.slots + alloc);
+	grown.text_len = grown.text_sum + alloc;
+	grown.style = grown.text_len + alloc;
+	grown.type = (uint8_t *)(grown.style + alloc);
+
+	if (content->alloc > 0) {
+		memcpy(grown.cold, content->cold,
+				count * sizeof(*grown.cold));
+		memcpy(grown.slots, content->slots,
+				content->slot_count * sizeof(*grown.slots));
+		memcpy(grown.text_sum, content->text_sum,
+				count * sizeof(*grown.text_sum));
+		memcpy(grown.text_len, content->text_len,
+				count * sizeof(*grown.text_len));
+		memcpy(grown.style, content->style,
+				count * sizeof(*grown.style));
+		memcpy(grown.type, content->type,
+				count * sizeof(*grown.type));
+	}
+	paragraph__content_block_unref(content->block);
+
+	content->block = block;
+	content->cold = grown.cold;
+	content->slots = grown.slots;
+	content->text_sum = grown.text_sum;
+	content->text_len = grown.text_len;
+	content->style = grown.style;
+	content->type = grown.type;
+	content->alloc = alloc;
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Ensure content's entry arrays aren't shared, so they can be changed.
+ *
+ * \param[in]  content  The content to take ownership of the arrays for.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static inline paragraph_err_t paragraph__content_own(
+		paragraph_content_t *content)
+{
+	if (content->block == NULL || content->block->refs == 1) {
+		return PARAGRAPH_OK;
+	}
+
+	return paragraph__content_realloc(content, content->alloc);
+}
+
+/**
+ * Ensure there is space for more entries in the content entry arrays, and
+ * that the arrays aren't shared.
+ *
+ * If the arrays are full, they are settled before being grown, so this
+ * may change entry indices.
+ *
+ * \param[in]  ctx      The context the content's styles are referenced with.
+ * \param[in]  content  The content to grow.
+ * \param[in]  extra    Number of entries to make space for.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__content_reserve(
+		const paragraph_ctx_t *ctx,
+		paragraph_content_t *content,
+		size_t extra)
 {
-	paragraph_content_t *content;
-	paragraph_content_entry_t *entry;
+	size_t alloc;
 
-	content = &para->content;
+	if (extra <= content->alloc - content->count) {
+		return paragraph__content_own(content);
+	}
 
-	entry = calloc(1, sizeof(*entry));
-	if (entry == NULL) {
+	if (content->removed > 0) {
+		paragraph_content__settle(ctx, content);
+		if (extra <= content->alloc - content->count) {
+			return PARAGRAPH_OK;
+		}
+	}
+
+	alloc = content->alloc == 0 ? PARAGRAPH_CONTENT_ALLOC_MIN :
+			content->alloc * 2;
+	if (alloc < content->count + extra) {
+		alloc = content->count + extra;
+	}
+	if (alloc > UINT32_MAX) {
 		return PARAGRAPH_ERR_OOM;
 	}
 
-	if (content->count == 0) {
-		assert(content->first == NULL);
-		assert(content->last == NULL);
+	return paragraph__content_realloc(content, alloc);
+}
+
+/**
+ * Get a free handle slot.
+ *
+ * There must be space for another entry in the content entry arrays.
+ *
+ * \param[in]  content  The content to get a handle slot from.
+ * \return the slot index.
+ */
+static uint32_t paragraph__content_slot_get(
+		paragraph_content_t *content)
+{
+	uint32_t slot;
 
-		content->first = entry;
-		content->last = entry;
+	if (content->slot_free != 0) {
+		slot = content->slot_free - 1;
+		content->slot_free = content->slots[slot].index;
 	} else {
-		paragraph_content_entry_t *rel = content->last;
-		paragraph_content_pos_t place = PARAGRAPH_CONTENT_POS_AFTER;
+		assert(content->slot_count < content->alloc);
 
-		if (pos != NULL && pos->rel != NULL) {
-			rel = (paragraph_content_entry_t *) pos->rel;
-			place = pos->pos;
+		slot = content->slot_count++;
+		content->slots[slot].gen = content->slot_gen;
+	}
+
+	content->slots[slot].gen++;
+	return slot;
+}
+
+/**
+ * Release a handle slot, invalidating any handles that refer to it.
+ *
+ * \param[in]  content  The content to release a handle slot in.
+ * \param[in]  slot     The slot to release.
+ */
+static void paragraph__content_slot_put(
+		paragraph_content_t *content,
+		uint32_t slot)
+{
+	content->slots[slot].gen++;
+	content->slots[slot].index = content->slot_free;
+	content->slot_free = slot + 1;
+}
+
+/**
+ * Drop styles that are no longer used by any content entry.
+ *
+ * This is an opportunistic reclamation, so it is skipped if the temporary
+ * index map can't be allocated.
+ *
+ * \param[in]  ctx      The context the content's styles are referenced with.
+ * \param[in]  content  The content to drop unused styles from.
+ */
+static void paragraph__content_sweep_styles(
+		const paragraph_ctx_t *ctx,
+		paragraph_content_t *content)
+{
+	uint32_t *map;
+	size_t kept = 0;
+
+	if (content->style_count == 0) {
+		return;
+	}
+
+	map = malloc(content->style_count * sizeof(*map));
+	if (map == NULL) {
+		return;
+	}
+
+	for (size_t i = 0; i < content->style_count; i++) {
+		map[i] = UINT32_MAX;
+	}
+	for (uint32_t i = 0; i < content->count; i++) {
+		map[content->style[i]] = 0;
+	}
+
+	for (size_t i = 0; i < content->style_count; i++) {
+		if (map[i] == UINT32_MAX) {
+			paragraph_style__unref(ctx, content->styles[i]);
+			continue;
 		}
+		map[i] = kept;
+		content->styles[kept++] = content->styles[i];
+	}
+	content->style_count = kept;
 
-		if (place == PARAGRAPH_CONTENT_POS_BEFORE) {
-			if (content->first == rel) {
-				content->first = entry;
-			}
+	for (uint32_t i = 0; i < content->count; i++) {
+		content->style[i] = map[content->style[i]];
+	}
 
-			entry->prev = rel->prev;
-			entry->next = rel;
-			rel->prev = entry;
-		} else {
-			if (content->last == rel) {
-				content->last = entry;
-			}
+	free(map);
+}
 
-			entry->prev = rel;
-			entry->next = rel->next;
-			rel->next = entry;
+/**
+ * Drop free handle slots at the end of the slot table, and rebuild the
+ * free slot list in slot order.
+ *
+ * Slots created later start at a generation beyond any dropped slot's, so
+ * stale handles to dropped slots are never matched.
+ *
+ * \param[in]  content  The content to trim handle slots in.
+ */
+static void paragraph__content_trim_slots(
+		paragraph_content_t *content)
+{
+	size_t count = content->slot_count;
+
+	while (count > 0 && (content->slots[count - 1].gen & 1) == 0) {
+		uint32_t gen = content->slots[count - 1].gen;
+
+		if (gen > content->slot_gen) {
+			content->slot_gen = gen;
 		}
+		count--;
 	}
+	content->slot_count = count;
 
-	content->count++;
+	content->slot_free = 0;
+	for (size_t i = count; i > 0; i--) {
+		if ((content->slots[i - 1].gen & 1) == 0) {
+			content->slots[i - 1].index = content->slot_free;
+			content->slot_free = i;
+		}
+	}
+}
+
+/* Internally exported function, documented in `src/content.h` */
+void paragraph_content__settle(
+		const paragraph_ctx_t *ctx,
+		paragraph_content_t *content)
+{
+	uint32_t to = content->settled;
+	size_t need;
+
+	if (content->removed == 0) {
+		return;
+	}
+
+	/* Content with tombstones has been changed, so isn't shared. */
+	assert(content->block->refs == 1);
+
+	for (uint32_t from = to; from < content->count; from++) {
+		if (content->type[from] == PARAGRAPH_CONTENT_NONE) {
+			continue;
+		}
+
+		content->cold[to] = content->cold[from];
+		content->type[to] = content->type[from];
+		content->style[to] = content->style[from];
+		content->text_len[to] = content->text_len[from];
+		content->slots[content->cold[to].slot].index = to;
+		to++;
+	}
+
+	/* Tombstones are all within the changed range. */
+	assert(content->dirty.dirty);
+	content->dirty.end -= content->removed;
+
+	content->count = to;
+	content->removed = 0;
+	paragraph__content_sum_update(content, content->settled);
+	assert(paragraph_content__offset(content, to) == content->len);
+
+	paragraph__content_sweep_styles(ctx, content);
+	paragraph__content_trim_slots(content);
+
+	/* Give back storage if the arrays are mostly empty. */
+	need = content->count > content->slot_count ?
+			content->count : content->slot_count;
+	if (need * 4 < content->alloc &&
+	    content->alloc > PARAGRAPH_CONTENT_ALLOC_MIN) {
+		size_t alloc = need * 2;
+
+		if (alloc < PARAGRAPH_CONTENT_ALLOC_MIN) {
+			alloc = PARAGRAPH_CONTENT_ALLOC_MIN;
+		}
+
+		/* On failure, the existing arrays are kept. */
+		(void) paragraph__content_realloc(content, alloc);
+	}
+}
+
+/**
+ * Get the index of a style in the content's style table.
+ *
+ * The most recently used styles are reused, since content usually arrives
+ * in document order.  Otherwise the style is added to the table.
+ *
+ * \param[in]  ctx        The context to reference the style with.
+ * \param[in]  content    The content to get a style index in.
+ * \param[in]  style      The style to get an index for.
+ * \param[out] index_out  Returns the style index on success.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__content_style_index(
+		const paragraph_ctx_t *ctx,
+		paragraph_content_t *content,
+		paragraph_style_t *style,
+		uint32_t *index_out)
+{
+	paragraph_err_t err;
+	size_t checked = 0;
+
+	for (size_t i = content->style_count; i > 0 &&
+			checked < PARAGRAPH_CONTENT_STYLE_REUSE; i--) {
+		if (content->styles[i - 1] == style) {
+			*index_out = i - 1;
+			return PARAGRAPH_OK;
+		}
+		checked++;
+	}
+
+	err = vec_ensure((void **)&content->styles, 1,
+			sizeof(*content->styles),
+			content->style_count,
+			&content->style_alloc,
+			options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
 
-	*entry_out = entry;
+	err = paragraph_style__ref(ctx, style);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	*index_out = content->style_count;
+	content->styles[content->style_count++] = style;
 	return PARAGRAPH_OK;
 }
 
 /**
- * Create a content entry in a paragraph.
+ * Move a range of entries in the content entry arrays.
+ *
+ * Handle slots for the moved entries are updated to the new positions.
+ *
+ * \param[in]  content  The content to move entries in.
+ * \param[in]  dst      The index to move entries to.
+ * \param[in]  src      The index of the first entry to move.
+ * \param[in]  count    The number of entries to move.
  */
-paragraph_err_t paragraph_content_add(
-		paragraph_para_t *para,
-		const paragraph_content_params_t *params,
+static void paragraph__content_move(
+		paragraph_content_t *content,
+		uint32_t dst,
+		uint32_t src,
+		uint32_t count)
+{
+	if (count == 0) {
+		return;
+	}
+
+	memmove(content->text_len + dst, content->text_len + src,
+			count * sizeof(*content->text_len));
+	memmove(content->style + dst, content->style + src,
+			count * sizeof(*content->style));
+	memmove(content->type + dst, content->type + src,
+			count * sizeof(*content->type));
+	memmove(content->cold + dst, content->cold + src,
+			count * sizeof(*content->cold));
+
+	for (uint32_t i = dst; i < dst + count; i++) {
+		if (content->type[i] == PARAGRAPH_CONTENT_NONE) {
+			/* Tombstone's slot may have been reused. */
+			continue;
+		}
+		content->slots[content->cold[i].slot].index = i;
+	}
+}
+
+/**
+ * Get the index to insert new content at.
+ *
+ * \param[in]  content    The content to add to.
+ * \param[in]  pos        The position to add content, or NULL for end.
+ * \param[out] index_out  Returns the index for the new entry on success.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__content_insert_index(
+		const paragraph_content_t *content,
 		const paragraph_content_position_t *pos,
-		paragraph_content_id_t **new)
+		uint32_t *index_out)
 {
 	paragraph_err_t err;
-	paragraph_content_entry_t *entry;
-	enum paragraph_content_type_e type = params->type;
+	uint32_t index;
 
-	err = paragraph__content_entry_get_new(para, pos, &entry);
+	if (pos == NULL || pos->rel == PARAGRAPH_CONTENT_ID_NONE) {
+		*index_out = content->count;
+		return PARAGRAPH_OK;
+	}
+
+	err = paragraph_content__index(content, pos->rel, &index);
 	if (err != PARAGRAPH_OK) {
 		return err;
 	}
 
-	entry->pw = params->pw;
-	entry->type = type;
+	if (pos->pos != PARAGRAPH_CONTENT_POS_BEFORE) {
+		index++;
+	}
+
+	*index_out = index;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Create a content entry in a paragraph.
+ */
+paragraph_err_t paragraph_content_add(
+		paragraph_para_t *para,
+		const paragraph_content_params_t *params,
+		const paragraph_content_position_t *pos,
+		paragraph_content_id_t *new)
+{
+	paragraph_content_t *content = &para->content;
+	enum paragraph_content_type_e type = params->type;
+	paragraph_content_cold_t cold = {
+		.pw = params->pw,
+	};
+	paragraph_style_t *style;
+	uint32_t style_index;
+	paragraph_err_t err;
+	uint32_t len = 0;
+	uint32_t index;
+	uint32_t slot;
 
 	paragraph__log(para->ctx->config, LOG_INFO,"%p: Add '%s'",
 			params->pw, paragraph__content_typestr(type));
 
 	switch (type) {
-		case PARAGRAPH_CONTENT_TEXT:
-			entry->text.string = params->text.string;
-			para->ctx->cb_text->text_get(
+		case PARAGRAPH_CONTENT_TEXT: {
+			size_t text_len;
+
+			err = para->ctx->cb_text->text_get(
 					para->ctx->pw,
 					params->text.string,
-					&entry->text.data,
-					&entry->text.len);
+					&cold.data,
+					&text_len);
+			if (err != PARAGRAPH_OK) {
+				return err;
+			}
 
-			para->content.len += entry->text.len;
-			entry->style = paragraph_style__get_current(
-					&para->styles);
+			if (text_len > UINT32_MAX - content->len) {
+				return PARAGRAPH_ERR_BAD_PARAM;
+			}
+
+			cold.string = params->text.string;
+			cold.utf8 = paragraph_utf8__check(cold.data, text_len,
+					&cold.bidi);
+			if (cold.utf8 == PARAGRAPH_UTF8_INVALID) {
+				paragraph__log(para->ctx->config, LOG_WARNING,
+						"%p: Text is not valid UTF-8",
+						params->pw);
+			}
+			len = text_len;
+			style = paragraph_style__get_current(&para->styles);
 
 			paragraph__log(para->ctx->config, LOG_INFO,
 					"        content (%zu): \"%.*s\"",
-					entry->text.len,
-					(int)entry->text.len,
-					entry->text.data);
+					text_len, (int)text_len, cold.data);
 			break;
+		}
 
 		case PARAGRAPH_CONTENT_FLOAT:
-			entry->style = paragraph_style__ref(
-					params->floated.style);
+			style = params->floated.style;
 			break;
 
 		case PARAGRAPH_CONTENT_REPLACED:
-			entry->replaced.px_width = params->replaced.px_width;
-			entry->replaced.px_height = params->replaced.px_height;
+			cold.px_width = params->replaced.px_width;
+			cold.px_height = params->replaced.px_height;
+			style = params->replaced.style;
+			break;
+
+		case PARAGRAPH_CONTENT_INLINE_START:
+			style = params->inline_start.style;
+			break;
+
+		case PARAGRAPH_CONTENT_INLINE_END:
+			style = paragraph_style__get_current(&para->styles);
+			break;
+
+		default:
+			return PARAGRAPH_ERR_BAD_TYPE;
+	}
+
+	err = paragraph__content_reserve(para->ctx, content, 1);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = paragraph__content_insert_index(content, pos, &index);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = paragraph__content_style_index(para->ctx, content, style,
+			&style_index);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	slot = paragraph__content_slot_get(content);
+
+	paragraph__content_move(content, index + 1, index,
+			content->count - index);
+	content->count++;
+	if (content->removed > 0 && index <= content->settled) {
+		content->settled++;
+	}
+
+	cold.slot = slot;
+	content->cold[index] = cold;
+	content->type[index] = type;
+	content->style[index] = style_index;
+	content->text_len[index] = len;
+	content->slots[slot].index = index;
+
+	paragraph__content_sum_update(content, index);
+	content->len += len;
+	paragraph__content_dirty_edit(&content->dirty, index, 1, 1);
+
+	*new = paragraph__content_id(slot, content->slots[slot].gen);
+	return PARAGRAPH_OK;
+}
 
-			entry->style = paragraph_style__ref(
-					params->replaced.style);
+/**
+ * Check a content span is valid.
+ *
+ * \param[in]  span      The span to check.
+ * \param[in]  text_len  Byte length of the text buffer.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__content_span_check(
+		const paragraph_content_span_t *span,
+		size_t text_len)
+{
+	switch (span->type) {
+		case PARAGRAPH_CONTENT_TEXT:
+			if (span->offset > text_len ||
+			    span->len > text_len - span->offset) {
+				return PARAGRAPH_ERR_BAD_PARAM;
+			}
 			break;
 
+		case PARAGRAPH_CONTENT_FLOAT:
+		case PARAGRAPH_CONTENT_REPLACED:
 		case PARAGRAPH_CONTENT_INLINE_START:
-			entry->style = paragraph_style__ref(
-					params->inline_start.style);
+			if (span->style == NULL) {
+				return PARAGRAPH_ERR_BAD_PARAM;
+			}
 			break;
 
 		case PARAGRAPH_CONTENT_INLINE_END:
-			entry->style = paragraph_style__get_current(
-					&para->styles);
 			break;
 
 		default:
 			return PARAGRAPH_ERR_BAD_TYPE;
 	}
 
-	*new = (void *)entry;
 	return PARAGRAPH_OK;
 }
 
-paragraph_err_t paragraph_content__get_text(
+/* Exported function, documented in `include/paragraph.h`. */
+paragraph_err_t paragraph_content_add_spans(
 		paragraph_para_t *para,
-		const char **text_out,
-		size_t *len_out)
+		const char *text,
+		size_t text_len,
+		const paragraph_content_span_t *spans,
+		size_t count,
+		paragraph_content_id_t *ids_out)
 {
 	paragraph_content_t *content = &para->content;
-	char *text;
+	paragraph_style_t *current;
+	size_t style_count;
+	size_t total = 0;
+	paragraph_err_t err;
+	uint32_t first;
 
-	/** TODO: Cache? */
-	/** TODO: Partial changes? */
+	paragraph__log(para->ctx->config, LOG_INFO,
+			"Add %zu spans (%zu bytes)", count, text_len);
 
-	text = realloc(content->text, content->len);
-	if (text == NULL) {
-		return PARAGRAPH_ERR_OOM;
+	if (count == 0) {
+		return PARAGRAPH_OK;
 	}
 
-	content->text = text;
-	for (paragraph_content_entry_t *e = content->first;
-			e != NULL; e = e->next) {
-		if (e->type != PARAGRAPH_CONTENT_TEXT) {
-			continue;
+	for (size_t i = 0; i < count; i++) {
+		err = paragraph__content_span_check(&spans[i], text_len);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+		if (spans[i].type == PARAGRAPH_CONTENT_TEXT) {
+			total += spans[i].len;
+		}
+	}
+
+	if (total > UINT32_MAX - content->len ||
+	    count > UINT32_MAX - content->count) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	err = paragraph__content_reserve(para->ctx, content, count);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	/* Resolve all styles before anything is added, so failure is clean. */
+	first = content->count;
+	style_count = content->style_count;
+	current = paragraph_style__get_current(&para->styles);
+	for (size_t i = 0; i < count; i++) {
+		paragraph_style_t *style = spans[i].style;
+
+		if (spans[i].type == PARAGRAPH_CONTENT_INLINE_END ||
+		    style == NULL) {
+			style = current;
+		}
+
+		err = paragraph__content_style_index(para->ctx, content, style,
+				&content->style[first + i]);
+		if (err != PARAGRAPH_OK) {
+			/* Release the styles added so far, newest first, so the
+			 * style table is as it was. */
+			while (content->style_count > style_count) {
+				style = content->styles[--content->style_count];
+				paragraph_style__unref(para->ctx, style);
+			}
+			return err;
+		}
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		const paragraph_content_span_t *span = &spans[i];
+		uint32_t index = first + i;
+		uint8_t utf8 = PARAGRAPH_UTF8_ASCII;
+		bool bidi = false;
+		uint32_t len = 0;
+		uint32_t slot;
+
+		if (span->type == PARAGRAPH_CONTENT_TEXT) {
+			len = span->len;
+		}
+		if (len > 0) {
+			utf8 = paragraph_utf8__check(text + span->offset, len,
+					&bidi);
+		}
+
+		slot = paragraph__content_slot_get(content);
+		content->cold[index] = (paragraph_content_cold_t) {
+			.pw = span->pw,
+			.data = len > 0 ? text + span->offset : NULL,
+			.utf8 = utf8,
+			.bidi = bidi,
+			.px_width = span->px_width,
+			.px_height = span->px_height,
+			.slot = slot,
+		};
+		content->type[index] = span->type;
+		content->text_len[index] = len;
+		content->slots[slot].index = index;
+		content->count++;
+		content->len += len;
+
+		if (ids_out != NULL) {
+			ids_out[i] = paragraph__content_id(slot,
+					content->slots[slot].gen);
 		}
-		memcpy(text, e->text.data, e->text.len);
-		text += e->text.len;
 	}
 
-	*text_out = content->text;
-	*len_out = content->len;
+	paragraph__content_sum_update(content, first);
+	paragraph__content_dirty_edit(&content->dirty, first, count, count);
+
 	return PARAGRAPH_OK;
 }
 
+/**
+ * Remove a range of content entries.
+ *
+ * The entries are turned into tombstones, so this costs time proportional
+ * to the number of entries removed.
+ *
+ * \param[in]  content  The content to remove entries from.
+ * \param[in]  index    Index of the first entry to remove.
+ * \param[in]  count    Number of entries to remove.  Any tombstones in the
+ *                      range are skipped.
+ */
+static void paragraph__content_remove_entries(
+		paragraph_content_t *content,
+		uint32_t index,
+		uint32_t count)
+{
+	uint32_t removed = 0;
+	size_t len = 0;
+
+	for (uint32_t i = index; i < index + count; i++) {
+		if (content->type[i] == PARAGRAPH_CONTENT_NONE) {
+			continue;
+		}
+
+		paragraph__content_slot_put(content, content->cold[i].slot);
+		paragraph__content_sum_sub(content, i, content->text_len[i]);
+		len += content->text_len[i];
+		content->type[i] = PARAGRAPH_CONTENT_NONE;
+		content->text_len[i] = 0;
+		removed++;
+	}
+
+	if (content->removed == 0 || index < content->settled) {
+		content->settled = index;
+	}
+	paragraph__content_dirty_edit(&content->dirty, index, count, 0);
+	content->len -= len;
+
+	content->removed += removed;
+}
+
 /* Exported function, documented in `include/paragraph.h`. */
 paragraph_err_t paragraph_content_remove(
 		paragraph_para_t *para,
-		paragraph_content_id_t *id)
+		paragraph_content_id_t id)
 {
-	paragraph_content_entry_t *entry = (void *) id;
+	paragraph_content_t *content = &para->content;
+	paragraph_err_t err;
+	uint32_t index;
 
-	if (para->content.first == entry) {
-		para->content.first = entry->next;
+	err = paragraph_content__index(content, id, &index);
+	if (err != PARAGRAPH_OK) {
+		return err;
 	}
-	if (para->content.last == entry) {
-		para->content.last = entry->prev;
+
+	err = paragraph__content_own(content);
+	if (err != PARAGRAPH_OK) {
+		return err;
 	}
 
-	if (entry->prev != NULL) {
-		entry->prev->next = entry->next;
+	paragraph__content_remove_entries(content, index, 1);
+
+	return PARAGRAPH_OK;
+}
+
+/* Exported function, documented in `include/paragraph.h`. */
+paragraph_err_t paragraph_content_remove_inline(
+		paragraph_para_t *para,
+		paragraph_content_id_t id)
+{
+	paragraph_content_t *content = &para->content;
+	paragraph_err_t err;
+	uint32_t depth = 0;
+	uint32_t index;
+	uint32_t end;
+
+	err = paragraph_content__index(content, id, &index);
+	if (err != PARAGRAPH_OK) {
+		return err;
 	}
-	if (entry->next != NULL) {
-		entry->next->prev = entry->prev;
+
+	if (content->type[index] != PARAGRAPH_CONTENT_INLINE_START) {
+		return PARAGRAPH_ERR_BAD_TYPE;
 	}
 
-	para->content.count--;
+	/* Find the matching end.  An unterminated inline runs to the end of
+	 * the paragraph. */
+	for (end = index; end < content->count; end++) {
+		if (content->type[end] == PARAGRAPH_CONTENT_INLINE_START) {
+			depth++;
+		} else if (content->type[end] ==
+				PARAGRAPH_CONTENT_INLINE_END) {
+			if (--depth == 0) {
+				end++;
+				break;
+			}
+		}
+	}
+
+	err = paragraph__content_own(content);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	paragraph__content_remove_entries(content, index, end - index);
+
+	return PARAGRAPH_OK;
+}
+
+/* Exported function, documented in `include/paragraph.h`. */
+paragraph_err_t paragraph_content_set_style(
+		paragraph_para_t *para,
+		paragraph_content_id_t id,
+		paragraph_style_t *style)
+{
+	paragraph_content_t *content = &para->content;
+	paragraph_err_t err;
+	uint32_t style_index;
+	uint32_t index;
+
+	err = paragraph_content__index(content, id, &index);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	if (style == NULL) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	if (paragraph_content__style(content, index) == style) {
+		return PARAGRAPH_OK;
+	}
+
+	err = paragraph__content_own(content);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	/* Styles replaced by earlier changes may no longer be used, so drop
+	 * them rather than grow the table. */
+	if (content->style_count == content->style_alloc &&
+	    content->style_count > content->count) {
+		paragraph__content_sweep_styles(para->ctx, content);
+	}
+
+	err = paragraph__content_style_index(para->ctx, content, style,
+			&style_index);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	content->style[index] = style_index;
+	paragraph__content_dirty_edit(&content->dirty, index, 1, 0);
+
+	return PARAGRAPH_OK;
+}
+
+/* Exported function, documented in `include/paragraph.h`. */
+paragraph_err_t paragraph_content_set_replaced_size(
+		paragraph_para_t *para,
+		paragraph_content_id_t id,
+		uint32_t px_width,
+		uint32_t px_height)
+{
+	paragraph_content_t *content = &para->content;
+	paragraph_content_cold_t *cold;
+	paragraph_err_t err;
+	uint32_t index;
+
+	err = paragraph_content__index(content, id, &index);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	if (content->type[index] != PARAGRAPH_CONTENT_REPLACED) {
+		return PARAGRAPH_ERR_BAD_TYPE;
+	}
+
+	cold = &content->cold[index];
+	if (cold->px_width == px_width && cold->px_height == px_height) {
+		return PARAGRAPH_OK;
+	}
+
+	err = paragraph__content_own(content);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
 
-	paragraph__content_entry_cleanup(entry);
+	cold = &content->cold[index];
+	cold->px_width = px_width;
+	cold->px_height = px_height;
+	paragraph__content_dirty_edit(&content->dirty, index, 1, 0);
 
 	return PARAGRAPH_OK;
 }
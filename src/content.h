@@ -12,44 +12,96 @@
 #ifndef PARAGRAPH__CONTENT_H
 #define PARAGRAPH__CONTENT_H
 
+#include <stdbool.h>
+
 #include "util.h"
 
 /**
- * Paragraph content spec.
+ * Infrequently accessed content entry data.
  */
-typedef struct paragraph_content_entry_s {
-	/** Content type. */
-	enum paragraph_content_type_e type;
-	/** Content type-specific data. */
-	union {
-		/** Data for type \ref PARAGRAPH_CONTENT_TEXT. */
-		struct {
-			const paragraph_string_t *string;
-			const char *data;
-			size_t len;
-		} text;
-		/** Data for type \ref PARAGRAPH_CONTENT_REPLACED. */
-		struct {
-			uint32_t px_width;
-			uint32_t px_height;
-		} replaced;
-	};
+typedef struct paragraph_content_cold_s {
 	/** Client handle for content, e.g. corresponding DOM node. */
 	void *pw;
-	/** Style for content. */
-	paragraph_style_t *style;
+	/** Client string, for type \ref PARAGRAPH_CONTENT_TEXT. */
+	const paragraph_string_t *string;
+	/** Client string data, for type \ref PARAGRAPH_CONTENT_TEXT. */
+	const char *data;
+	/** Encoding of data, a \ref paragraph_utf8_e. */
+	uint8_t utf8;
+	/** Whether data may need bidirectional resolution. */
+	bool bidi;
+	/** Width, for type \ref PARAGRAPH_CONTENT_REPLACED. */
+	uint32_t px_width;
+	/** Height, for type \ref PARAGRAPH_CONTENT_REPLACED. */
+	uint32_t px_height;
+	/** Handle slot that refers to this entry. */
+	uint32_t slot;
+} paragraph_content_cold_t;
 
-	struct paragraph_content_entry_s *prev;
-	struct paragraph_content_entry_s *next;
-} paragraph_content_entry_t;
+/**
+ * Content handle slot.
+ */
+typedef struct paragraph_content_slot_s {
+	/** Generation.  Odd if slot is in use, even if free. */
+	uint32_t gen;
+	/** Entry index if slot is in use, otherwise next free slot plus one. */
+	uint32_t index;
+} paragraph_content_slot_t;
+
+/**
+ * Storage for the content entry arrays, shared between clones.
+ */
+typedef struct paragraph_content_block_s {
+	uint32_t refs; /**< Number of paragraphs using the block. */
+	paragraph_content_cold_t cold[]; /**< Start of the entry arrays. */
+} paragraph_content_block_t;
+
+/**
+ * A range of content entries that have changed.
+ *
+ * Entries after the range are unchanged, although their indices may have
+ * shifted.  A zeroed range is a valid empty range.
+ */
+typedef struct paragraph_content_dirty_s {
+	bool dirty;     /**< Whether content has changed. */
+	uint32_t start; /**< Index of first changed entry. */
+	uint32_t end;   /**< Index after last changed entry. */
+} paragraph_content_dirty_t;
 
 typedef struct paragraph_content_s {
-	paragraph_content_entry_t *first;
-	paragraph_content_entry_t *last;
-	uint32_t count;
+	/*
+	 * Hot entry data.  These, and the cold data and handle slots, live
+	 * in `block`.
+	 */
+	uint32_t *text_sum;    /**< Fenwick tree of `text_len`; see below. */
+	uint32_t *text_len;    /**< Byte length of entry's text. */
+	uint32_t *style;       /**< Index of entry's style in `styles`. */
+	uint8_t *type;         /**< Entry's \ref paragraph_content_type_e. */
+
+	paragraph_content_cold_t *cold; /**< Cold entry data. */
+
+	/** Allocation holding the entry arrays.  May be shared. */
+	paragraph_content_block_t *block;
+
+	uint32_t count; /**< Number of content entries, including tombstones. */
+	size_t alloc;   /**< Number of entries the arrays can hold. */
+
+	uint32_t removed; /**< Number of tombstone entries. */
+	uint32_t settled; /**< Index of the first tombstone, if any. */
+
+	paragraph_content_slot_t *slots; /**< Handle slots. */
+	size_t slot_count; /**< Number of handle slots. */
+	uint32_t slot_free; /**< First free handle slot plus one, or zero. */
+	uint32_t slot_gen;  /**< Initial generation for new handle slots. */
+
+	paragraph_style_t **styles; /**< Styles used by content entries. */
+	size_t style_count; /**< Number of styles. */
+	size_t style_alloc; /**< Number of styles `styles` can hold. */
 
-	char *text; /**< Complete paragraph text. */
 	size_t len; /**< Total byte-length of text. */
+
+	/** Entries changed since the paragraph was last laid out. */
+	paragraph_content_dirty_t dirty;
 } paragraph_content_t;
 
 /**
@@ -58,16 +110,144 @@ typedef struct paragraph_content_s {
  * Note, the passed object itself is not freed, only its contents are
  * destroyed.
  *
+ * \param[in]  ctx      The context the content's styles were referenced with.
  * \param[in]  content  The content object to destroy all content inside.
  * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
  */
 paragraph_err_t paragraph__content_destroy(
+		const paragraph_ctx_t *ctx,
 		paragraph_content_t *content);
 
-paragraph_err_t paragraph_content__get_text(
-		paragraph_para_t *para,
-		const char **text_out,
-		size_t *len_out);
+/**
+ * Remove all content, keeping allocations for reuse.
+ *
+ * Handles to the removed content remain invalid.
+ *
+ * \param[in]  ctx      The context the content's styles were referenced with.
+ * \param[in]  content  The content object to remove all content from.
+ */
+void paragraph__content_reset(
+		const paragraph_ctx_t *ctx,
+		paragraph_content_t *content);
+
+/**
+ * Make content a copy of another paragraph's content.
+ *
+ * The entry arrays are shared rather than copied.  Handles to the source
+ * content identify the same entries in the copy.  The source must not have
+ * any tombstones; see \ref paragraph_content__settle.
+ *
+ * \param[in]  ctx      The context to reference the copy's styles with.
+ * \param[in]  content  Empty content object to make the copy in.
+ * \param[in]  src      The content to copy.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph__content_clone(
+		const paragraph_ctx_t *ctx,
+		paragraph_content_t *content,
+		const paragraph_content_t *src);
+
+/**
+ * Get the entry index for a content handle.
+ *
+ * \param[in]  content    The content to look up handle in.
+ * \param[in]  id         The handle to look up.
+ * \param[out] index_out  Returns the entry index on success.
+ * \return \ref PARAGRAPH_OK on success, or \ref PARAGRAPH_ERR_BAD_PARAM if
+ *         the handle doesn't identify an entry.
+ */
+paragraph_err_t paragraph_content__index(
+		const paragraph_content_t *content,
+		paragraph_content_id_t id,
+		uint32_t *index_out);
+
+/**
+ * Compact the content entry arrays, removing any tombstones.
+ *
+ * Entry indices may change, so this must not be called while entry indices
+ * are held.
+ *
+ * \param[in]  ctx      The context the content's styles are referenced with.
+ * \param[in]  content  The content to settle.
+ */
+void paragraph_content__settle(
+		const paragraph_ctx_t *ctx,
+		paragraph_content_t *content);
+
+/**
+ * Get the byte offset of a content entry's text in the paragraph text.
+ *
+ * Entry text offsets are prefix sums of `text_len`, kept as a Fenwick tree
+ * in `text_sum`, so this takes time logarithmic in the number of entries.
+ * Node `i` of the tree, at `text_sum[i - 1]`, holds the sum of the
+ * `i & -i` entry lengths up to and including entry `i - 1`.
+ *
+ * \param[in]  content  The content containing the entry.
+ * \param[in]  index    Index of the entry, or the number of entries.
+ * \return the entry's text offset.
+ */
+static inline uint32_t paragraph_content__offset(
+		const paragraph_content_t *content,
+		uint32_t index)
+{
+	uint32_t offset = 0;
+
+	for (uint32_t i = index; i > 0; i &= i - 1) {
+		offset += content->text_sum[i - 1];
+	}
+
+	return offset;
+}
+
+/**
+ * Find the content entry containing a paragraph text offset.
+ *
+ * The entry found is the one containing the byte at the offset.  If the
+ * offset is the length of the paragraph's text, the last entry is found.
+ *
+ * \param[in]  content     The content to search.
+ * \param[in]  pos         Byte offset into the paragraph text.
+ * \param[out] index_out   Returns the entry index on success.
+ * \param[out] offset_out  Returns the byte offset into the entry's text on
+ *                         success.
+ * \return \ref PARAGRAPH_OK on success, or \ref PARAGRAPH_ERR_BAD_PARAM if
+ *         the offset is outside the paragraph's text.
+ */
+paragraph_err_t paragraph_content__entry_at(
+		const paragraph_content_t *content,
+		size_t pos,
+		uint32_t *index_out,
+		size_t *offset_out);
+
+/**
+ * Get the handle for a content entry.
+ *
+ * \param[in]  content  The content containing the entry.
+ * \param[in]  index    Index of the entry to get the handle of.
+ * \return the entry's handle.
+ */
+static inline paragraph_content_id_t paragraph_content__id(
+		const paragraph_content_t *content,
+		uint32_t index)
+{
+	uint32_t slot = content->cold[index].slot;
+
+	return ((paragraph_content_id_t)content->slots[slot].gen << 32) | slot;
+}
+
+/**
+ * Get the style of a content entry.
+ *
+ * \param[in]  content  The content to get style from.
+ * \param[in]  index    Index of the entry to get the style of.
+ * \return the entry's style.
+ */
+static inline paragraph_style_t *paragraph_content__style(
+		const paragraph_content_t *content,
+		uint32_t index)
+{
+	return content->styles[content->style[index]];
+}
 
 static inline const char *paragraph__content_typestr(
 		enum paragraph_content_type_e type)
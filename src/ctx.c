@@ -14,6 +14,7 @@
 #include <paragraph.h>
 
 #include "ctx.h"
+#include "para.h"
 
 /* Exported function, documented in `include/paragraph.h` */
 paragraph_err_t paragraph_ctx_create(
@@ -23,6 +24,7 @@ paragraph_err_t paragraph_ctx_create(
 		const paragraph_cb_text_t *cb_text)
 {
 	paragraph_ctx_t *ctx;
+	paragraph_err_t err;
 
 	if (ctx_out == NULL || cb_text == NULL) {
 		return PARAGRAPH_ERR_BAD_PARAM;
@@ -37,6 +39,16 @@ paragraph_err_t paragraph_ctx_create(
 	ctx->config = config;
 	ctx->cb_text = cb_text;
 
+	paragraph_measure__init(&ctx->measure, config != NULL ?
+			config->measure_cache_size : 0);
+
+	err = paragraph_hyphen__init(&ctx->hyphen, config != NULL ?
+			config->hyphenation_patterns : NULL);
+	if (err != PARAGRAPH_OK) {
+		free(ctx);
+		return err;
+	}
+
 	*ctx_out = ctx;
 	return PARAGRAPH_OK;
 }
@@ -45,7 +57,39 @@ paragraph_err_t paragraph_ctx_create(
 paragraph_ctx_t *paragraph_ctx_destroy(
 		paragraph_ctx_t *ctx)
 {
+	paragraph__para_pool_fini(ctx);
+	paragraph_hyphen__fini(&ctx->hyphen);
+	paragraph_measure__fini(&ctx->measure);
 	free(ctx);
 
 	return NULL;
 }
+
+/* Exported function, documented in `include/paragraph.h` */
+paragraph_err_t paragraph_ctx_get_measure_stats(
+		const paragraph_ctx_t *ctx,
+		paragraph_measure_stats_t *stats_out)
+{
+	if (ctx == NULL || stats_out == NULL) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	stats_out->hits = ctx->measure.hits;
+	stats_out->misses = ctx->measure.misses;
+	stats_out->evictions = ctx->measure.evictions;
+	stats_out->entries = ctx->measure.count;
+	stats_out->bytes = ctx->measure.bytes;
+	return PARAGRAPH_OK;
+}
+
+/* Exported function, documented in `include/paragraph.h` */
+paragraph_err_t paragraph_ctx_clear_measure_cache(
+		paragraph_ctx_t *ctx)
+{
+	if (ctx == NULL) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	paragraph_measure__clear(&ctx->measure);
+	return PARAGRAPH_OK;
+}
@@ -12,10 +12,26 @@
 #ifndef PARAGRAPH__CTX_H
 #define PARAGRAPH__CTX_H
 
+#include "hyphen.h"
+#include "measure.h"
+
+/** Maximum number of destroyed paragraphs a context keeps for reuse. */
+#define PARAGRAPH_CTX_POOL_MAX 32
+
 struct paragraph_ctx_s {
 	void *pw;
 	const paragraph_config_t *config;
 	const paragraph_cb_text_t *cb_text;
+
+	/** Hyphenation patterns from the configuration. */
+	paragraph_hyphen_t hyphen;
+
+	/** Text measurements, shared by the context's paragraphs. */
+	paragraph_measure_t measure;
+
+	/** Destroyed paragraphs, kept for reuse by \ref paragraph_create. */
+	paragraph_para_t *pool;
+	size_t pool_count; /**< Number of paragraphs in pool. */
 };
 
 #endif
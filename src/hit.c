@@ -0,0 +1,705 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Paragraph hit testing and selection implementation.
+ */
+
+#include <paragraph.h>
+
+#include "para.h"
+#include "layout.h"
+#include "content.h"
+
+/**
+ * Get the lines from the most recent complete layout pass.
+ *
+ * \param[in]  para       The paragraph to get lines from.
+ * \param[out] lines_out  Returns the lines on success.
+ * \return \ref PARAGRAPH_OK on success, or \ref PARAGRAPH_ERR_BAD_PARAM if
+ *         there are no lines, or the content has changed since layout.
+ */
+static paragraph_err_t paragraph__hit_lines(
+		paragraph_para_t *para,
+		const paragraph_layout_lines_t **lines_out)
+{
+	const paragraph_layout_t *layout = &para->layout;
+
+	if (layout->in_progress ||
+	    layout->prev.line_count == 0 ||
+	    para->content.dirty.dirty) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	*lines_out = &layout->prev;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Get the paragraph text offset of a layout piece.
+ *
+ * \param[in]  content  The laid out content.
+ * \param[in]  item     The piece.
+ * \return the offset of the start of the piece in the paragraph text.
+ */
+static inline size_t paragraph__hit_item_pos(
+		const paragraph_content_t *content,
+		const paragraph_layout_item_t *item)
+{
+	return paragraph_content__offset(content, item->entry) + item->offset;
+}
+
+/**
+ * Get the paragraph text offset of the start of a line.
+ *
+ * \param[in]  content  The laid out content.
+ * \param[in]  line     The line.
+ * \return the offset of the start of the line in the paragraph text.
+ */
+static inline size_t paragraph__hit_line_pos(
+		const paragraph_content_t *content,
+		const paragraph_layout_line_t *line)
+{
+	return paragraph_content__offset(content, line->entry) + line->offset;
+}
+
+/**
+ * Get the length of the word part of a text piece, without trailing spaces.
+ *
+ * \param[in]  content  The laid out content.
+ * \param[in]  item     The text piece.
+ * \return the byte length of the piece's word.
+ */
+static size_t paragraph__hit_word_len(
+		const paragraph_content_t *content,
+		const paragraph_layout_item_t *item)
+{
+	const char *data = content->cold[item->entry].data + item->offset;
+	size_t word = item->len;
+
+	while (word > 0 && (data[word - 1] == ' ' || data[word - 1] == '\t' ||
+			data[word - 1] == '\n' || data[word - 1] == '\r' ||
+			data[word - 1] == '\f')) {
+		word--;
+	}
+
+	return word;
+}
+
+/**
+ * Get the length of a text piece, without any preserved newline it ends
+ * with.
+ *
+ * \param[in]  item  The text piece.
+ * \return the byte length of the piece up to the end of its line.
+ */
+static inline size_t paragraph__hit_item_len(
+		const paragraph_layout_item_t *item)
+{
+	return item->newline ? item->len - 1 : item->len;
+}
+
+/**
+ * Estimate the offset into a text piece at a horizontal position.
+ *
+ * Trailing spaces each have the same width.  The rest of the piece's width
+ * is shared evenly between its bytes, and the result is moved back to the
+ * start of a grapheme cluster.  A preserved newline has no width, so the
+ * offset is never after one.
+ *
+ * \param[in]  content  The laid out content.
+ * \param[in]  lb       The content's text analysis.
+ * \param[in]  item     The text piece.
+ * \param[in]  x        Position relative to the start of the piece.
+ * \return the byte offset into the piece.
+ */
+static size_t paragraph__hit_item_offset(
+		const paragraph_content_t *content,
+		const paragraph_linebreak_t *lb,
+		const paragraph_layout_item_t *item,
+		uint32_t x)
+{
+	size_t pos = paragraph__hit_item_pos(content, item);
+	size_t word = paragraph__hit_word_len(content, item);
+	size_t len = paragraph__hit_item_len(item);
+	uint32_t word_width = item->width - item->trailing;
+	size_t offset;
+
+	if (x >= item->width) {
+		return len;
+
+	} else if (x >= word_width) {
+		size_t spaces = len - word;
+
+		/* Round to the nearest space boundary. */
+		return word + ((uint64_t)(x - word_width) * spaces * 2 +
+				item->trailing) / (item->trailing * 2);
+	}
+
+	offset = ((uint64_t)x * word * 2 + word_width) / (word_width * 2);
+	while (offset > 0 && offset < word &&
+			!paragraph_linebreak__grapheme(lb, pos + offset)) {
+		offset--;
+	}
+
+	return offset;
+}
+
+/**
+ * Estimate the horizontal position of an offset into a text piece.
+ *
+ * This is the inverse of \ref paragraph__hit_item_offset.
+ *
+ * \param[in]  content  The laid out content.
+ * \param[in]  item     The text piece.
+ * \param[in]  offset   Byte offset into the piece.
+ * \return the position relative to the start of the piece.
+ */
+static uint32_t paragraph__hit_item_x(
+		const paragraph_content_t *content,
+		const paragraph_layout_item_t *item,
+		size_t offset)
+{
+	size_t word = paragraph__hit_word_len(content, item);
+	size_t len = paragraph__hit_item_len(item);
+	uint32_t word_width = item->width - item->trailing;
+
+	if (offset >= len) {
+		return item->width;
+
+	} else if (offset >= word) {
+		return word_width + (uint64_t)item->trailing *
+				(offset - word) / (len - word);
+	}
+
+	return (uint64_t)word_width * offset / word;
+}
+
+/**
+ * Get the horizontal position of a distance from the start of a piece.
+ *
+ * \param[in]  item  The piece.
+ * \param[in]  dx    Distance from the start of the piece, in text order.
+ * \return the position relative to the start of the line.
+ */
+static inline uint32_t paragraph__hit_item_edge(
+		const paragraph_layout_item_t *item,
+		uint32_t dx)
+{
+	if (item->level & 1) {
+		return item->x + item->width - dx;
+	}
+
+	return item->x + dx;
+}
+
+/**
+ * Find the piece at a horizontal position on a reordered line.
+ *
+ * The line's visual order is binary searched.
+ *
+ * \param[in]  lines  The laid out lines.
+ * \param[in]  line   The reordered line.
+ * \param[in]  x      Position relative to the start of the line.
+ * \return the index of the rightmost piece with width that starts at or
+ *         left of x, or 0 if there is none.
+ */
+static size_t paragraph__hit_visual(
+		const paragraph_layout_lines_t *lines,
+		const paragraph_layout_line_t *line,
+		uint32_t x)
+{
+	const paragraph_layout_item_t *items = lines->items + line->item;
+	const uint32_t *visual = lines->visual + line->visual;
+	size_t lo = 0;
+	size_t hi = line->item_count;
+
+	/* Find the first piece in visual order starting right of x. */
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (items[visual[mid]].x <= x) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	while (lo > 0) {
+		if (items[visual[--lo]].width > 0) {
+			return visual[lo];
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Get the position at the start of a line.
+ *
+ * \param[in]  content  The laid out content.
+ * \param[in]  line     The line.
+ * \param[out] hit_out  Returns the position on success.
+ * \return \ref PARAGRAPH_OK on success, or \ref PARAGRAPH_ERR_BAD_PARAM if
+ *         the paragraph has no content.
+ */
+static paragraph_err_t paragraph__hit_line_start(
+		const paragraph_content_t *content,
+		const paragraph_layout_line_t *line,
+		paragraph_content_offset_t *hit_out)
+{
+	uint32_t entry = line->entry;
+	size_t offset = line->offset;
+
+	if (entry >= content->count) {
+		/* The line starts at the end of the content. */
+		if (content->count == 0) {
+			return PARAGRAPH_ERR_BAD_PARAM;
+		}
+		entry = content->count - 1;
+		offset = content->text_len[entry];
+	}
+
+	hit_out->id = paragraph_content__id(content, entry);
+	hit_out->offset = offset;
+	return PARAGRAPH_OK;
+}
+
+/* Exported function, documented in `include/paragraph.h` */
+paragraph_err_t paragraph_hit_test(
+		paragraph_para_t *para,
+		uint32_t x,
+		uint32_t y,
+		paragraph_content_offset_t *hit_out)
+{
+	const paragraph_content_t *content = &para->content;
+	const paragraph_layout_lines_t *lines;
+	const paragraph_layout_line_t *line;
+	const paragraph_layout_item_t *items;
+	const paragraph_layout_item_t *item;
+	paragraph_err_t err;
+	size_t offset = 0;
+	size_t lo, hi;
+
+	if (hit_out == NULL) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	err = paragraph__hit_lines(para, &lines);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	/* Find the last line starting at or above y. */
+	lo = 0;
+	hi = lines->line_count;
+	while (hi - lo > 1) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (lines->lines[mid].y <= y) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+	line = &lines->lines[lo];
+
+	if (line->item_count == 0) {
+		return paragraph__hit_line_start(content, line, hit_out);
+	}
+	items = lines->items + line->item;
+
+	/* Find the last piece starting at or left of x. */
+	lo = 0;
+	hi = line->item_count;
+	if (line->reordered) {
+		lo = paragraph__hit_visual(lines, line, x);
+		hi = lo + 1;
+	}
+	while (hi - lo > 1) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (items[mid].x <= x) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+
+	/* Prefer content over the inline boundaries that may follow it. */
+	while (lo > 0 && items[lo].width == 0 &&
+			content->type[items[lo].entry] !=
+					PARAGRAPH_CONTENT_TEXT &&
+			content->type[items[lo].entry] !=
+					PARAGRAPH_CONTENT_REPLACED) {
+		lo--;
+	}
+	item = &items[lo];
+
+	if (content->type[item->entry] == PARAGRAPH_CONTENT_TEXT) {
+		uint32_t dx = x > item->x ? x - item->x : 0;
+
+		if (item->level & 1) {
+			dx = dx < item->width ? item->width - dx : 0;
+		}
+
+		offset = item->offset;
+		if (dx > 0) {
+			offset += paragraph__hit_item_offset(content,
+					&para->linebreak, item, dx);
+		}
+	}
+
+	hit_out->id = paragraph_content__id(content, item->entry);
+	hit_out->offset = offset;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Get the paragraph text offset of a position in a content entry.
+ *
+ * \param[in]  content  The laid out content.
+ * \param[in]  pos      The position in a content entry.
+ * \param[out] pos_out  Returns the paragraph text offset on success.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__hit_pos(
+		const paragraph_content_t *content,
+		const paragraph_content_offset_t *pos,
+		size_t *pos_out)
+{
+	paragraph_err_t err;
+	uint32_t index;
+
+	err = paragraph_content__index(content, pos->id, &index);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	if (pos->offset > content->text_len[index]) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	*pos_out = paragraph_content__offset(content, index) + pos->offset;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Get the horizontal position of a paragraph text offset on a line.
+ *
+ * Content that starts at the offset is to the right of the position.
+ *
+ * \param[in]  content  The laid out content.
+ * \param[in]  lines    The laid out lines.
+ * \param[in]  line     The line to find the position on.
+ * \param[in]  pos      Paragraph text offset.
+ * \return the position relative to the start of the line.
+ */
+static uint32_t paragraph__hit_line_x(
+		const paragraph_content_t *content,
+		const paragraph_layout_lines_t *lines,
+		const paragraph_layout_line_t *line,
+		size_t pos)
+{
+	const paragraph_layout_item_t *items = lines->items + line->item;
+	const paragraph_layout_item_t *item;
+	size_t lo = 0;
+	size_t hi = line->item_count;
+	size_t item_pos;
+
+	/* Find the first piece ending after pos, or starting at it. */
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		size_t start = paragraph__hit_item_pos(content, &items[mid]);
+
+		if (start >= pos || start + items[mid].len > pos) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+
+	if (lo == line->item_count) {
+		if (lo == 0) {
+			return 0;
+		}
+		item = &items[lo - 1];
+		return paragraph__hit_item_edge(item, item->width);
+	}
+
+	item = &items[lo];
+	item_pos = paragraph__hit_item_pos(content, item);
+	if (item_pos >= pos) {
+		return paragraph__hit_item_edge(item, 0);
+	}
+
+	return paragraph__hit_item_edge(item,
+			paragraph__hit_item_x(content, item, pos - item_pos));
+}
+
+/**
+ * Add a selection rectangle.
+ *
+ * \param[in]  rects      Array to return rectangles in, or NULL.
+ * \param[in]  rects_len  Number of entries in rects.
+ * \param[in]  count      Number of rectangles so far.
+ * \param[in]  line       The line the rectangle is on.
+ * \param[in]  x0         Left edge of rectangle.
+ * \param[in]  x1         Right edge of rectangle.
+ */
+static inline void paragraph__hit_rect(
+		paragraph_rect_t *rects,
+		size_t rects_len,
+		size_t count,
+		const paragraph_layout_line_t *line,
+		uint32_t x0,
+		uint32_t x1)
+{
+	if (rects != NULL && count < rects_len) {
+		rects[count] = (paragraph_rect_t) {
+			.x = x0,
+			.y = line->y,
+			.width = x1 - x0,
+			.height = line->height,
+		};
+	}
+}
+
+/**
+ * Add the selection rectangles for a range of a reordered line.
+ *
+ * Each piece the range covers gives a span, and spans that meet are joined.
+ *
+ * \param[in]  content    The laid out content.
+ * \param[in]  lines      The laid out lines.
+ * \param[in]  line       The line to find the rectangles on.
+ * \param[in]  from       Paragraph text offset of start of range.
+ * \param[in]  to         Paragraph text offset of end of range.
+ * \param[in]  rects      Array to return rectangles in, or NULL.
+ * \param[in]  rects_len  Number of entries in rects.
+ * \param[in]  count      Number of rectangles so far.
+ * \return the number of rectangles, including those so far.
+ */
+static size_t paragraph__hit_reordered_rects(
+		const paragraph_content_t *content,
+		const paragraph_layout_lines_t *lines,
+		const paragraph_layout_line_t *line,
+		size_t from,
+		size_t to,
+		paragraph_rect_t *rects,
+		size_t rects_len,
+		size_t count)
+{
+	const paragraph_layout_item_t *items = lines->items + line->item;
+	bool open = false;
+	uint32_t x0 = 0;
+	uint32_t x1 = 0;
+
+	for (size_t i = 0; i < line->item_count; i++) {
+		const paragraph_layout_item_t *item = &items[i];
+		size_t pos = paragraph__hit_item_pos(content, item);
+		uint32_t a = 0;
+		uint32_t b = item->width;
+		uint32_t l, r;
+
+		if (item->len == 0) {
+			if (pos < from || pos >= to || item->width == 0) {
+				continue;
+			}
+		} else {
+			if (pos + item->len <= from || pos >= to) {
+				continue;
+			}
+			if (from > pos) {
+				a = paragraph__hit_item_x(content, item,
+						from - pos);
+			}
+			if (to < pos + item->len) {
+				b = paragraph__hit_item_x(content, item,
+						to - pos);
+			}
+		}
+
+		l = paragraph__hit_item_edge(item, a);
+		r = paragraph__hit_item_edge(item, b);
+		if (l > r) {
+			uint32_t tmp = l;
+			l = r;
+			r = tmp;
+		}
+
+		if (open && (l == x1 || r == x0)) {
+			x0 = l < x0 ? l : x0;
+			x1 = r > x1 ? r : x1;
+			continue;
+		}
+
+		if (open) {
+			paragraph__hit_rect(rects, rects_len, count++,
+					line, x0, x1);
+		}
+		x0 = l;
+		x1 = r;
+		open = true;
+	}
+
+	if (open) {
+		paragraph__hit_rect(rects, rects_len, count++, line, x0, x1);
+	}
+
+	return count;
+}
+
+/* Exported function, documented in `include/paragraph.h` */
+paragraph_err_t paragraph_selection_rects(
+		paragraph_para_t *para,
+		const paragraph_content_offset_t *start,
+		const paragraph_content_offset_t *end,
+		paragraph_rect_t *rects,
+		size_t rects_len,
+		size_t *count_out)
+{
+	const paragraph_content_t *content = &para->content;
+	const paragraph_layout_lines_t *lines;
+	paragraph_err_t err;
+	size_t count = 0;
+	size_t from, to;
+	size_t lo, hi;
+
+	if (start == NULL || end == NULL || count_out == NULL) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	err = paragraph__hit_lines(para, &lines);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = paragraph__hit_pos(content, start, &from);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = paragraph__hit_pos(content, end, &to);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	if (from > to) {
+		size_t tmp = from;
+		from = to;
+		to = tmp;
+	} else if (from == to) {
+		*count_out = 0;
+		return PARAGRAPH_OK;
+	}
+
+	/* Find the first line ending after the start of the range. */
+	lo = 0;
+	hi = lines->line_count - 1;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (paragraph__hit_line_pos(content,
+				&lines->lines[mid + 1]) > from) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+
+	for (size_t l = lo; l < lines->line_count; l++) {
+		const paragraph_layout_line_t *line = &lines->lines[l];
+		size_t line_pos = paragraph__hit_line_pos(content, line);
+		uint32_t x0, x1;
+
+		if (line_pos >= to) {
+			break;
+		}
+
+		if (line->reordered) {
+			count = paragraph__hit_reordered_rects(content, lines,
+					line, from > line_pos ? from : line_pos,
+					to, rects, rects_len, count);
+			continue;
+		}
+
+		x0 = paragraph__hit_line_x(content, lines, line,
+				from > line_pos ? from : line_pos);
+		x1 = paragraph__hit_line_x(content, lines, line, to);
+
+		paragraph__hit_rect(rects, rects_len, count++, line, x0, x1);
+	}
+
+	*count_out = count;
+	return PARAGRAPH_OK;
+}
+
+/* Exported function, documented in `include/paragraph.h` */
+paragraph_err_t paragraph_text_boundary(
+		paragraph_para_t *para,
+		const paragraph_content_offset_t *from,
+		paragraph_boundary_t kind,
+		bool forwards,
+		paragraph_content_offset_t *boundary_out)
+{
+	paragraph_content_t *content = &para->content;
+	const paragraph_layout_lines_t *lines;
+	paragraph_err_t err;
+	uint32_t index, text;
+	size_t offset;
+	size_t start;
+	size_t pos;
+
+	if (from == NULL || boundary_out == NULL ||
+	    (kind != PARAGRAPH_BOUNDARY_GRAPHEME &&
+	     kind != PARAGRAPH_BOUNDARY_WORD)) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	err = paragraph__hit_lines(para, &lines);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = paragraph__hit_pos(content, from, &pos);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	pos = paragraph_linebreak__boundary(&para->linebreak, kind,
+			pos, forwards);
+
+	/* Stay in the entry the search started from, if it has the
+	 * boundary, and otherwise prefer text content. */
+	err = paragraph_content__index(content, from->id, &index);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+	start = paragraph_content__offset(content, index);
+	if (pos >= start && pos - start <= content->text_len[index]) {
+		boundary_out->id = from->id;
+		boundary_out->offset = pos - start;
+		return PARAGRAPH_OK;
+	}
+
+	err = paragraph_content__entry_at(content, pos, &index, &offset);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+	text = index;
+	while (text > 0 && content->type[text] != PARAGRAPH_CONTENT_TEXT) {
+		text--;
+	}
+	if (content->type[text] == PARAGRAPH_CONTENT_TEXT) {
+		index = text;
+	}
+
+	boundary_out->id = paragraph_content__id(content, index);
+	boundary_out->offset = pos - paragraph_content__offset(content, index);
+	return PARAGRAPH_OK;
+}
@@ -0,0 +1,360 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Hyphenation implementation.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <paragraph.h>
+
+#include "utf8.h"
+#include "hyphen.h"
+#include "transform.h"
+
+/** Pattern file format version supported. */
+#define PARAGRAPH_HYPHEN_VERSION 1
+
+/** Byte length of pattern file header. */
+#define PARAGRAPH_HYPHEN_HEADER 24
+
+/** Byte length of a trie node. */
+#define PARAGRAPH_HYPHEN_NODE 12
+
+/** Byte length of a trie edge. */
+#define PARAGRAPH_HYPHEN_EDGE 4
+
+/** Number of hyphenated words kept.  Must be a power of two. */
+#define PARAGRAPH_HYPHEN_WORDS 256
+
+/**
+ * Read a little-endian number.
+ *
+ * \param[in]  p  The number's first byte.
+ * \return the 32 bit number.
+ */
+static inline uint32_t paragraph__hyphen_u32(
+		const uint8_t *p)
+{
+	return (uint32_t)p[0] | (uint32_t)p[1] << 8 |
+			(uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+/**
+ * Check the trie in a mapped pattern file.
+ *
+ * \param[in]  hyph  The hyphenation, with the file mapped.
+ * \return true if the file is a pattern file that can be used.
+ */
+static bool paragraph__hyphen_check(
+		paragraph_hyphen_t *hyph)
+{
+	const uint8_t *data = hyph->map;
+	uint32_t node_count, edge_count, value_count;
+
+	if (hyph->map_len < PARAGRAPH_HYPHEN_HEADER ||
+			memcmp(data, "PHYP", 4) != 0 ||
+			paragraph__hyphen_u32(data + 4) !=
+					PARAGRAPH_HYPHEN_VERSION) {
+		return false;
+	}
+
+	node_count = paragraph__hyphen_u32(data + 8);
+	edge_count = paragraph__hyphen_u32(data + 12);
+	value_count = paragraph__hyphen_u32(data + 16);
+	if (node_count == 0 || (uint64_t)PARAGRAPH_HYPHEN_HEADER +
+			(uint64_t)node_count * PARAGRAPH_HYPHEN_NODE +
+			(uint64_t)edge_count * PARAGRAPH_HYPHEN_EDGE +
+			value_count > hyph->map_len) {
+		return false;
+	}
+
+	hyph->left = data[20] > 0 ? data[20] : 1;
+	hyph->right = data[21] > 0 ? data[21] : 1;
+	hyph->nodes = data + PARAGRAPH_HYPHEN_HEADER;
+	hyph->edges = hyph->nodes + (size_t)node_count * PARAGRAPH_HYPHEN_NODE;
+	hyph->values = hyph->edges + (size_t)edge_count * PARAGRAPH_HYPHEN_EDGE;
+
+	for (uint32_t i = 0; i < node_count; i++) {
+		const uint8_t *node = hyph->nodes + (size_t)i *
+				PARAGRAPH_HYPHEN_NODE;
+		uint32_t edge = paragraph__hyphen_u32(node);
+		uint32_t value = paragraph__hyphen_u32(node + 4);
+		uint32_t edges = node[8] | node[9] << 8;
+
+		if (edge > edge_count || edges > edge_count - edge ||
+				value > value_count ||
+				node[10] > value_count - value) {
+			return false;
+		}
+	}
+
+	for (uint32_t i = 0; i < edge_count; i++) {
+		if (paragraph__hyphen_u32(hyph->edges + (size_t)i *
+				PARAGRAPH_HYPHEN_EDGE) >> 8 >= node_count) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/* Internally exported function, documented in `src/hyphen.h` */
+paragraph_err_t paragraph_hyphen__init(
+		paragraph_hyphen_t *hyph,
+		const char *path)
+{
+	struct stat st;
+	void *map;
+	int fd;
+
+	*hyph = (paragraph_hyphen_t) { 0 };
+	if (path == NULL) {
+		return PARAGRAPH_OK;
+	}
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+	if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+		close(fd);
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+	hyph->map = map;
+	hyph->map_len = st.st_size;
+
+	if (!paragraph__hyphen_check(hyph)) {
+		paragraph_hyphen__fini(hyph);
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	hyph->words = calloc(PARAGRAPH_HYPHEN_WORDS, sizeof(*hyph->words));
+	if (hyph->words == NULL) {
+		paragraph_hyphen__fini(hyph);
+		return PARAGRAPH_ERR_OOM;
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/hyphen.h` */
+void paragraph_hyphen__fini(
+		paragraph_hyphen_t *hyph)
+{
+	if (hyph->map != NULL) {
+		munmap(hyph->map, hyph->map_len);
+	}
+	free(hyph->words);
+	*hyph = (paragraph_hyphen_t) { 0 };
+}
+
+/**
+ * Find the child of a trie node on an edge.
+ *
+ * \param[in]  hyph  The hyphenation.
+ * \param[in]  node  The trie node.
+ * \param[in]  byte  The byte on the edge.
+ * \return the child node, or NULL if there is no such edge.
+ */
+static inline const uint8_t *paragraph__hyphen_child(
+		const paragraph_hyphen_t *hyph,
+		const uint8_t *node,
+		uint8_t byte)
+{
+	const uint8_t *edges = hyph->edges + (size_t)paragraph__hyphen_u32(
+			node) * PARAGRAPH_HYPHEN_EDGE;
+	size_t lo = 0;
+	size_t hi = node[8] | node[9] << 8;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		uint32_t edge = paragraph__hyphen_u32(
+				edges + mid * PARAGRAPH_HYPHEN_EDGE);
+
+		if ((edge & 0xFF) < byte) {
+			lo = mid + 1;
+		} else if ((edge & 0xFF) > byte) {
+			hi = mid;
+		} else {
+			return hyph->nodes + (size_t)(edge >> 8) *
+					PARAGRAPH_HYPHEN_NODE;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Hyphenate a lowercase word with the patterns.
+ *
+ * \param[in]  hyph   The hyphenation.
+ * \param[in]  word   The word, between `.`s.
+ * \param[in]  len    Byte length of word, including the `.`s.
+ * \param[out] vals   Returns the highest pattern value at each byte offset
+ *                    in word.  Must have space for len + 1 values.
+ */
+static void paragraph__hyphen_match(
+		const paragraph_hyphen_t *hyph,
+		const uint8_t *word,
+		size_t len,
+		uint8_t *vals)
+{
+	memset(vals, 0, len + 1);
+
+	for (size_t i = 0; i < len; i++) {
+		const uint8_t *node = hyph->nodes;
+
+		for (size_t j = i; j < len; j++) {
+			const uint8_t *v;
+
+			node = paragraph__hyphen_child(hyph, node, word[j]);
+			if (node == NULL) {
+				break;
+			}
+
+			/* A node's values are within the pattern ending at
+			 * the node, unless the file is bad. */
+			v = hyph->values + paragraph__hyphen_u32(node + 4);
+			for (size_t k = 0; k < node[10] && i + k <= len; k++) {
+				if (v[k] > vals[i + k]) {
+					vals[i + k] = v[k];
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Find where a word may be hyphenated.
+ *
+ * \param[in]  hyph  The hyphenation.
+ * \param[in]  text  The word, made of letters, marks and numbers.
+ * \param[in]  len   Byte length of word.  At most
+ *                   \ref PARAGRAPH_HYPHEN_WORD_MAX.
+ * \return a bit for each byte offset in the word a hyphen may go before.
+ */
+static uint64_t paragraph__hyphen_word(
+		paragraph_hyphen_t *hyph,
+		const uint8_t *text,
+		size_t len)
+{
+	uint8_t word[PARAGRAPH_HYPHEN_WORD_MAX + 2];
+	uint8_t vals[PARAGRAPH_HYPHEN_WORD_MAX + 3];
+	paragraph_hyphen_word_t *entry;
+	uint32_t hash = 2166136261u;
+	size_t chars = 0;
+	size_t count = 0;
+	uint64_t points = 0;
+
+	/* Lowercase, keeping each character's byte length, so offsets in
+	 * the lowercase word are offsets in the text. */
+	word[0] = '.';
+	for (size_t i = 0; i < len; ) {
+		uint8_t lower[4];
+		uint32_t cp;
+		size_t n;
+
+		cp = paragraph_utf8__decode(text + i, len - i, &n);
+		if (paragraph_utf8__encode(paragraph_transform__lower(cp),
+				lower) == n) {
+			memcpy(word + 1 + i, lower, n);
+		} else {
+			memcpy(word + 1 + i, text + i, n);
+		}
+		i += n;
+		chars++;
+	}
+	word[len + 1] = '.';
+
+	for (size_t i = 1; i <= len; i++) {
+		hash = (hash ^ word[i]) * 16777619u;
+	}
+	entry = &hyph->words[hash & (PARAGRAPH_HYPHEN_WORDS - 1)];
+	if (entry->len == len && memcmp(entry->word, word + 1, len) == 0) {
+		return entry->points;
+	}
+
+	if (chars >= (size_t)hyph->left + hyph->right) {
+		paragraph__hyphen_match(hyph, word, len + 2, vals);
+
+		/* Only character boundaries have values. */
+		for (size_t i = 1; i < len; i++) {
+			if ((text[i] & 0xC0) == 0x80) {
+				continue;
+			}
+			count++;
+			if ((vals[i + 1] & 1) && count >= hyph->left &&
+					chars - count >= hyph->right) {
+				points |= (uint64_t)1 << i;
+			}
+		}
+	}
+
+	entry->len = len;
+	entry->points = points;
+	memcpy(entry->word, word + 1, len);
+	return points;
+}
+
+/* Internally exported function, documented in `src/hyphen.h` */
+size_t paragraph_hyphen__find(
+		paragraph_hyphen_t *hyph,
+		const char *text,
+		size_t len,
+		size_t *points,
+		size_t max)
+{
+	const uint8_t *s = (const uint8_t *)text;
+	size_t count = 0;
+	size_t start = 0;
+
+	for (size_t i = 0; i <= len; ) {
+		uint32_t cp = 0;
+		size_t n = 1;
+		uint64_t word;
+
+		if (i < len) {
+			cp = paragraph_utf8__decode(s + i, len - i, &n);
+			if (cp != PARAGRAPH_UTF8_REPLACEMENT &&
+					paragraph_transform__letter(cp)) {
+				i += n;
+				continue;
+			}
+		}
+
+		/* End of a run of word characters. */
+		if (i > start && i - start <= PARAGRAPH_HYPHEN_WORD_MAX) {
+			word = paragraph__hyphen_word(hyph, s + start,
+					i - start);
+			for (size_t b = 1; b < i - start && count < max; b++) {
+				if (word & (uint64_t)1 << b) {
+					points[count++] = start + b;
+				}
+			}
+		}
+
+		i += n;
+		start = i;
+	}
+
+	return count;
+}
@@ -0,0 +1,102 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Hyphenation interface.
+ */
+
+#ifndef PARAGRAPH__HYPHEN_H
+#define PARAGRAPH__HYPHEN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Longest word hyphenated, in bytes. */
+#define PARAGRAPH_HYPHEN_WORD_MAX 63
+
+/**
+ * A hyphenated word.
+ */
+typedef struct paragraph_hyphen_word_s {
+	/** Bit for each byte offset in the word a hyphen may go before. */
+	uint64_t points;
+	uint8_t len; /**< Byte length of word, or zero if unused. */
+	char word[PARAGRAPH_HYPHEN_WORD_MAX]; /**< The word, in lowercase. */
+} paragraph_hyphen_word_t;
+
+/**
+ * Hyphenation patterns, and words hyphenated with them.
+ */
+typedef struct paragraph_hyphen_s {
+	void *map;      /**< The memory-mapped pattern file, or NULL. */
+	size_t map_len; /**< Byte length of mapping. */
+
+	const uint8_t *nodes;  /**< Trie nodes, in the mapping. */
+	const uint8_t *edges;  /**< Trie edges, in the mapping. */
+	const uint8_t *values; /**< Pattern values, in the mapping. */
+
+	uint8_t left;  /**< Minimum number of characters before a hyphen. */
+	uint8_t right; /**< Minimum number of characters after a hyphen. */
+
+	/** Hyphenated words, indexed by hash. */
+	paragraph_hyphen_word_t *words;
+} paragraph_hyphen_t;
+
+/**
+ * Map a compiled hyphenation pattern file.
+ *
+ * \param[in]  hyph  The hyphenation to initialise.
+ * \param[in]  path  The pattern file to map, or NULL for no hyphenation.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_hyphen__init(
+		paragraph_hyphen_t *hyph,
+		const char *path);
+
+/**
+ * Unmap the hyphenation patterns and free the hyphenated words.
+ *
+ * \param[in]  hyph  The hyphenation to finalise.
+ */
+void paragraph_hyphen__fini(
+		paragraph_hyphen_t *hyph);
+
+/**
+ * Check whether there are hyphenation patterns.
+ *
+ * \param[in]  hyph  The hyphenation.
+ * \return true if words can be hyphenated.
+ */
+static inline bool paragraph_hyphen__active(
+		const paragraph_hyphen_t *hyph)
+{
+	return hyph->map != NULL;
+}
+
+/**
+ * Find where text may be hyphenated.
+ *
+ * Each run of letters, marks and numbers in the text is hyphenated as a
+ * word.  Words longer than \ref PARAGRAPH_HYPHEN_WORD_MAX are not.
+ *
+ * \param[in]  hyph    The hyphenation.  Must be active.
+ * \param[in]  text    The text to hyphenate.
+ * \param[in]  len     Byte length of text.
+ * \param[out] points  Returns the byte offsets in text a hyphen may go
+ *                     before, in order.
+ * \param[in]  max     Number of offsets points has space for.
+ * \return the number of offsets found, up to max.
+ */
+size_t paragraph_hyphen__find(
+		paragraph_hyphen_t *hyph,
+		const char *text,
+		size_t len,
+		size_t *points,
+		size_t max);
+
+#endif
@@ -10,11 +10,2507 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <paragraph.h>
 
-#include "content.h"
+#include "vec.h"
+#include "ctx.h"
+#include "para.h"
+#include "style.h"
 #include "layout.h"
+#include "content.h"
+#include "linebreak.h"
+#include "bidi.h"
+#include "script.h"
+#include "whitespace.h"
+#include "transform.h"
+#include "measure.h"
+
+static const vec_opts_t options = {
+	.sso_element_max = 0,
+};
+
+/**
+ * Free the lines and pieces from a layout pass.
+ *
+ * \param[in]  lines  The lines to free.
+ */
+static void paragraph__layout_lines_free(
+		paragraph_layout_lines_t *lines)
+{
+	vec_free((void **)&lines->items, &lines->item_alloc, options);
+	vec_free((void **)&lines->lines, &lines->line_alloc, options);
+	vec_free((void **)&lines->visual, &lines->visual_alloc, options);
+	lines->item_count = 0;
+	lines->line_count = 0;
+	lines->visual_count = 0;
+}
+
+/* Internally exported function, documented in `src/layout.h` */
+paragraph_err_t paragraph__layout_destroy(
+		paragraph_layout_t *layout)
+{
+	paragraph__layout_lines_free(&layout->cur);
+	paragraph__layout_lines_free(&layout->prev);
+	vec_free((void **)&layout->segs.items, &layout->segs.alloc, options);
+	vec_free((void **)&layout->old_segs.items, &layout->old_segs.alloc,
+			options);
+	vec_free((void **)&layout->order, &layout->order_alloc, options);
+	vec_free((void **)&layout->runs, &layout->run_alloc, options);
+	vec_free((void **)&layout->text, &layout->text_alloc, options);
+	vec_free((void **)&layout->pending, &layout->pending_alloc, options);
+	vec_free((void **)&layout->measure, &layout->measure_alloc, options);
+	vec_free((void **)&layout->metrics, &layout->metrics_alloc, options);
+	layout->run_count = 0;
+	layout->pending_count = 0;
+	layout->measure_count = 0;
+	layout->segs.count = 0;
+	layout->old_segs.count = 0;
+	layout->segs_valid = false;
+	layout->in_progress = false;
+
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/layout.h` */
+void paragraph__layout_reset(
+		paragraph_layout_t *layout)
+{
+	layout->cur.item_count = 0;
+	layout->cur.line_count = 0;
+	layout->cur.visual_count = 0;
+	layout->prev.item_count = 0;
+	layout->prev.line_count = 0;
+	layout->prev.visual_count = 0;
+	layout->segs.count = 0;
+	layout->old_segs.count = 0;
+	layout->run_count = 0;
+	layout->segs_valid = false;
+	layout->in_progress = false;
+	layout->count = 0;
+	layout->pending_count = 0;
+	layout->measure_count = 0;
+	layout->hyphen.style = NULL;
+	layout->strut.style = NULL;
+}
+
+/**
+ * Abandon a layout pass, and the lines from the previous pass.
+ *
+ * \param[in]  layout  The layout state to reset.
+ */
+static void paragraph__layout_discard(
+		paragraph_layout_t *layout)
+{
+	layout->cur.item_count = 0;
+	layout->cur.line_count = 0;
+	layout->cur.visual_count = 0;
+	layout->prev.item_count = 0;
+	layout->prev.line_count = 0;
+	layout->prev.visual_count = 0;
+	layout->in_progress = false;
+}
+
+/* Internally exported function, documented in `src/layout.h` */
+void paragraph__layout_share(
+		paragraph_layout_t *layout,
+		const paragraph_layout_t *src)
+{
+	vec_free((void **)&layout->segs.items, &layout->segs.alloc, options);
+	vec_free((void **)&layout->runs, &layout->run_alloc, options);
+	paragraph__layout_discard(layout);
+
+	layout->segs = src->segs;
+	layout->segs_valid = src->segs_valid;
+	layout->runs = src->runs;
+	layout->run_count = src->run_count;
+	layout->run_alloc = src->run_alloc;
+	layout->count = src->count;
+	layout->hyphen = src->hyphen;
+	layout->strut = src->strut;
+}
+
+/* Internally exported function, documented in `src/layout.h` */
+paragraph_err_t paragraph__layout_own(
+		paragraph_layout_t *layout)
+{
+	paragraph_layout_segments_t segs = layout->segs;
+	paragraph_layout_run_t *runs = layout->runs;
+	size_t run_alloc = layout->run_alloc;
+	paragraph_err_t err;
+
+	err = vec_dup((void **)&segs.items, sizeof(*segs.items),
+			segs.count, &segs.alloc);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = vec_dup((void **)&runs, sizeof(*runs),
+			layout->run_count, &run_alloc);
+	if (err != PARAGRAPH_OK) {
+		vec_free((void **)&segs.items, &segs.alloc, options);
+		return err;
+	}
+
+	layout->segs = segs;
+	layout->runs = runs;
+	layout->run_alloc = run_alloc;
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/layout.h` */
+void paragraph__layout_forget(
+		paragraph_layout_t *layout)
+{
+	layout->segs = (paragraph_layout_segments_t) { 0 };
+	layout->segs_valid = false;
+	layout->runs = NULL;
+	layout->run_count = 0;
+	layout->run_alloc = 0;
+	layout->count = 0;
+	paragraph__layout_discard(layout);
+}
+
+/**
+ * Get the index after the last piece on a set of lines.
+ *
+ * \param[in]  lines  The lines to get the end of.
+ * \return the index of the first piece not on a line.
+ */
+static inline size_t paragraph__layout_lines_end(
+		const paragraph_layout_lines_t *lines)
+{
+	const paragraph_layout_line_t *last;
+
+	if (lines->line_count == 0) {
+		return 0;
+	}
+
+	last = &lines->lines[lines->line_count - 1];
+	return last->item + last->item_count;
+}
+
+/**
+ * Test whether a byte is a space character, for the purposes of line breaking.
+ *
+ * \param[in]  c  Byte to test.
+ * \return true if c is a space, false otherwise.
+ */
+static inline bool paragraph__layout_is_space(char c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+/**
+ * Get the metrics of a character in the given style.
+ *
+ * Characters are measured once per style change, rather than per word.
+ *
+ * \param[in]  para   The paragraph being laid out.
+ * \param[in]  space  Character metrics cache to use.
+ * \param[in]  style  Style to get character metrics for.
+ * \param[in]  c      The character, which the cache must always be for.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_char(
+		paragraph_para_t *para,
+		paragraph_layout_space_t *space,
+		const paragraph_style_t *style,
+		const char *c)
+{
+	paragraph_err_t err;
+
+	if (space->style == style && style != NULL) {
+		return PARAGRAPH_OK;
+	}
+
+	err = paragraph_measure__text(para->ctx,
+			&(const paragraph_text_t) {
+				.text = NULL,
+				.offset = 0,
+				.len = 1,
+				.data = c,
+				.script = PARAGRAPH_SCRIPT_CODE_COMMON,
+			},
+			style, &space->width, &space->height, &space->baseline);
+	if (err != PARAGRAPH_OK) {
+		space->style = NULL;
+		return err;
+	}
+
+	space->style = style;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * State for splitting content into measured pieces.
+ */
+typedef struct paragraph_layout_split_s {
+	uint32_t entry; /**< Cursor: index of next content entry to consume. */
+	size_t offset;  /**< Cursor: byte offset into entry's text. */
+	size_t run;     /**< Cursor: index of style run containing entry. */
+	size_t word;    /**< Index of first piece of current word. */
+	size_t text;    /**< Index of word's last text piece, or SIZE_MAX. */
+
+	/** Pieces measured before the changes, to take measurements from. */
+	const paragraph_layout_segments_t *old;
+	size_t old_next; /**< Next piece in old to consider. */
+	uint32_t start;  /**< Index of first changed content entry. */
+	uint32_t end;    /**< Index after last changed content entry. */
+	int64_t shift;   /**< Content entry index shift after the changes. */
+
+	size_t text_len; /**< Bytes used of the layout's scratch text. */
+	/** Style of the most recently requested space measurement. */
+	const paragraph_style_t *space_style;
+	size_t space; /**< Index of that measurement, or SIZE_MAX. */
+} paragraph_layout_split_t;
+
+/**
+ * Take a piece's measurements from before the content changes, if possible.
+ *
+ * Pieces are looked up in document order, so each old piece is considered
+ * once per split.
+ *
+ * \param[in]  split  The splitting state.
+ * \param[in]  item   The piece to find measurements for.
+ * \return true if the piece's measurements were found.
+ */
+static bool paragraph__layout_old_segment(
+		paragraph_layout_split_t *split,
+		paragraph_layout_item_t *item)
+{
+	const paragraph_layout_segments_t *old = split->old;
+	const paragraph_layout_item_t *found;
+	uint32_t entry = item->entry;
+
+	if (entry >= split->start) {
+		if (entry < split->end) {
+			return false;
+		}
+		entry = (uint32_t)(entry - split->shift);
+	}
+
+	while (split->old_next < old->count &&
+			(old->items[split->old_next].entry < entry ||
+			(old->items[split->old_next].entry == entry &&
+			old->items[split->old_next].offset < item->offset))) {
+		split->old_next++;
+	}
+
+	if (split->old_next >= old->count) {
+		return false;
+	}
+
+	found = &old->items[split->old_next];
+	if (found->entry != entry || found->offset != item->offset ||
+			found->len != item->len ||
+			found->level != item->level ||
+			found->script != item->script ||
+			found->joined != item->joined) {
+		return false;
+	}
+
+	item->width = found->width;
+	item->trailing = found->trailing;
+	item->height = found->height;
+	item->baseline = found->baseline;
+	item->newline = found->newline;
+	return true;
+}
+
+/**
+ * Get the length of text without its trailing spaces.
+ *
+ * \param[in]  data  The text.
+ * \param[in]  len   Byte length of text.
+ * \return the byte length of the text before any trailing spaces.
+ */
+static inline size_t paragraph__layout_word_len(
+		const char *data,
+		size_t len)
+{
+	while (len > 0 && paragraph__layout_is_space(data[len - 1])) {
+		len--;
+	}
+
+	return len;
+}
+
+/**
+ * Count the trailing spaces of text that have width.
+ *
+ * \param[in]  data  The trailing spaces.
+ * \param[in]  len   Byte length of trailing spaces.
+ * \return the number of spaces, not counting preserved newlines.
+ */
+static inline size_t paragraph__layout_spaces(
+		const char *data,
+		size_t len)
+{
+	size_t count = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		if (data[i] != '\n') {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/**
+ * Get the width of a piece's trailing spaces that may hang past the end of
+ * its line.
+ *
+ * \param[in]  para  The paragraph being laid out.
+ * \param[in]  item  The piece.
+ * \return the width that doesn't need to fit on the line.
+ */
+static inline uint32_t paragraph__layout_hang(
+		const paragraph_para_t *para,
+		const paragraph_layout_item_t *item)
+{
+	/* Spaces take up room at the end of the line. */
+	if (paragraph_whitespace__mode(&para->whitespace, item->entry) ==
+			PARAGRAPH_WHITE_SPACE_BREAK_SPACES) {
+		return 0;
+	}
+
+	return item->trailing;
+}
+
+/**
+ * Get part of a content entry's text, after white space processing and
+ * text transform.
+ *
+ * The client string is given if processing didn't change the text.
+ *
+ * \param[in]  para      The paragraph being laid out.
+ * \param[in]  entry     Index of text content entry.
+ * \param[in]  offset    Byte offset of text in entry's text.
+ * \param[in]  len       Byte length of text in entry's text.
+ * \param[out] text_out  Returns the processed text.
+ */
+static void paragraph__layout_text(
+		const paragraph_para_t *para,
+		uint32_t entry,
+		size_t offset,
+		size_t len,
+		paragraph_text_t *text_out)
+{
+	const paragraph_whitespace_t *ws = &para->whitespace;
+	const paragraph_transform_t *tr = &para->transform;
+	const paragraph_content_t *content = &para->content;
+	const paragraph_content_cold_t *cold = &content->cold[entry];
+	size_t start = paragraph_content__offset(content, entry) + offset;
+	size_t end = start + len;
+	const char *data;
+
+	*text_out = (paragraph_text_t) {
+		.text = (paragraph_string_t *)cold->string,
+		.offset = offset,
+		.len = len,
+		.data = cold->data + offset,
+	};
+	data = text_out->data;
+
+	if (ws->active) {
+		start = paragraph_whitespace__map(ws, start);
+		end = paragraph_whitespace__map(ws, end);
+		data = ws->text + start;
+	}
+
+	if (end > start && paragraph_transform__mode(tr, entry) !=
+			PARAGRAPH_TEXT_TRANSFORM_NONE) {
+		size_t out = paragraph_transform__map(tr, start);
+
+		end = paragraph_transform__map(tr, end) - out + start;
+		data = tr->text + out;
+	}
+
+	if (data != text_out->data && (end - start != len || (len > 0 &&
+			memcmp(data, text_out->data, len) != 0))) {
+		*text_out = (paragraph_text_t) {
+			.text = NULL,
+			.offset = 0,
+			.len = end - start,
+			.data = data,
+		};
+	}
+}
+
+/**
+ * Add text to the batch measured once the paragraph is split.
+ *
+ * \param[in]  para       The paragraph being laid out.
+ * \param[in]  text       The text to measure.
+ * \param[in]  style      The style to measure the text in.
+ * \param[out] index_out  Returns the index of the text's measurement.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_request(
+		paragraph_para_t *para,
+		const paragraph_text_t *text,
+		const paragraph_style_t *style,
+		size_t *index_out)
+{
+	paragraph_layout_t *layout = &para->layout;
+	paragraph_err_t err;
+
+	err = vec_ensure((void **)&layout->measure, 1,
+			sizeof(*layout->measure),
+			layout->measure_count,
+			&layout->measure_alloc,
+			options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	layout->measure[layout->measure_count] = (paragraph_text_segment_t) {
+		.text = *text,
+		.style = style,
+	};
+	*index_out = layout->measure_count++;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Add a space to the batch measured once the paragraph is split.
+ *
+ * Spaces are measured once per style change, rather than per word.
+ *
+ * \param[in]  para       The paragraph being laid out.
+ * \param[in]  split      The splitting state.
+ * \param[in]  style      The style to measure the space in.
+ * \param[out] index_out  Returns the index of the space's measurement.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_request_space(
+		paragraph_para_t *para,
+		paragraph_layout_split_t *split,
+		const paragraph_style_t *style,
+		size_t *index_out)
+{
+	paragraph_err_t err;
+
+	if (split->space == SIZE_MAX || split->space_style != style) {
+		err = paragraph__layout_request(para,
+				&(const paragraph_text_t) {
+					.text = NULL,
+					.offset = 0,
+					.len = 1,
+					.data = " ",
+					.script = PARAGRAPH_SCRIPT_CODE_COMMON,
+				},
+				style, &split->space);
+		if (err != PARAGRAPH_OK) {
+			split->space = SIZE_MAX;
+			return err;
+		}
+		split->space_style = style;
+	}
+
+	*index_out = split->space;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Add text pieces to those measured once the paragraph is split.
+ *
+ * \param[in]  para     The paragraph being laid out.
+ * \param[in]  pending  The pieces, with their measurements requested.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_add_pending(
+		paragraph_para_t *para,
+		const paragraph_layout_pending_t *pending)
+{
+	paragraph_layout_t *layout = &para->layout;
+	paragraph_err_t err;
+
+	err = vec_ensure((void **)&layout->pending, 1,
+			sizeof(*layout->pending),
+			layout->pending_count,
+			&layout->pending_alloc,
+			options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	layout->pending[layout->pending_count++] = *pending;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Get a measurement from the batch measured once the paragraph is split.
+ *
+ * \param[in]  layout  The layout state, with the batch measured.
+ * \param[in]  index   Index of the measurement, or SIZE_MAX.
+ * \return the measurement, or zero measurements if index is SIZE_MAX.
+ */
+static inline const paragraph_text_metrics_t *paragraph__layout_metrics(
+		const paragraph_layout_t *layout,
+		size_t index)
+{
+	static const paragraph_text_metrics_t none;
+
+	return index != SIZE_MAX ? &layout->metrics[index] : &none;
+}
+
+/**
+ * Gather the text of a text piece to be measured on its own.
+ *
+ * \param[in]  para   The paragraph being laid out.
+ * \param[in]  split  The splitting state.
+ * \param[in]  index  Index of the piece.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_gather_piece(
+		paragraph_para_t *para,
+		paragraph_layout_split_t *split,
+		size_t index)
+{
+	const paragraph_content_t *content = &para->content;
+	const paragraph_layout_item_t *item = &para->layout.segs.items[index];
+	paragraph_style_t *style = paragraph_content__style(
+			content, item->entry);
+	paragraph_layout_pending_t pending = {
+		.first = index,
+		.last = index,
+		.word = SIZE_MAX,
+		.space = SIZE_MAX,
+	};
+	paragraph_text_t text;
+	paragraph_err_t err;
+	size_t word;
+
+	paragraph__layout_text(para, item->entry, item->offset, item->len,
+			&text);
+	word = paragraph__layout_word_len(text.data, text.len);
+
+	if (word < text.len) {
+		err = paragraph__layout_request_space(para, split, style,
+				&pending.space);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+	}
+
+	if (word > 0) {
+		text.len = word;
+		text.level = item->level;
+		text.script = paragraph_script__code(item->script);
+
+		err = paragraph__layout_request(para, &text, style,
+				&pending.word);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+	}
+
+	return paragraph__layout_add_pending(para, &pending);
+}
+
+/**
+ * Measure a text piece on its own, from the measured batch.
+ *
+ * \param[in]  para     The paragraph being laid out.
+ * \param[in]  pending  The piece, with its measurements.
+ */
+static void paragraph__layout_measure_piece(
+		paragraph_para_t *para,
+		const paragraph_layout_pending_t *pending)
+{
+	const paragraph_layout_t *layout = &para->layout;
+	paragraph_layout_item_t *item = &layout->segs.items[pending->first];
+	const paragraph_text_metrics_t *space;
+	paragraph_text_t text;
+	size_t word;
+
+	paragraph__layout_text(para, item->entry, item->offset, item->len,
+			&text);
+	word = paragraph__layout_word_len(text.data, text.len);
+	space = paragraph__layout_metrics(layout, pending->space);
+
+	item->width = 0;
+	item->trailing = 0;
+	item->height = 0;
+	item->baseline = 0;
+	item->newline = text.len > 0 && text.data[text.len - 1] == '\n';
+	if (word < text.len) {
+		item->trailing = paragraph__layout_spaces(text.data + word,
+				text.len - word) * space->width;
+		item->height = space->height;
+		item->baseline = space->baseline;
+	}
+
+	if (word > 0) {
+		const paragraph_text_metrics_t *m = paragraph__layout_metrics(
+				layout, pending->word);
+
+		item->width = m->width;
+		item->height = m->height;
+		item->baseline = m->baseline;
+	}
+
+	item->width += item->trailing;
+}
+
+/**
+ * Take the measurements of text pieces measured together from before the
+ * content changes, if possible.
+ *
+ * This only succeeds if the same pieces, and no others, were measured
+ * together before.
+ *
+ * \param[in]  para   The paragraph being laid out.
+ * \param[in]  split  The splitting state.
+ * \param[in]  first  Index of first text piece measured together.
+ * \param[in]  last   Index of last text piece measured together.
+ * \return true if the pieces' measurements were found.
+ */
+static bool paragraph__layout_old_text(
+		paragraph_para_t *para,
+		paragraph_layout_split_t *split,
+		size_t first,
+		size_t last)
+{
+	const paragraph_layout_segments_t *old = split->old;
+	paragraph_layout_item_t *items = para->layout.segs.items;
+	size_t next = SIZE_MAX;
+
+	/* Text pieces have length, and nothing else does.  The old text
+	 * pieces must have been next to each other too. */
+	for (size_t i = first; i <= last; i++) {
+		if (items[i].len == 0) {
+			continue;
+		}
+		if (!paragraph__layout_old_segment(split, &items[i])) {
+			return false;
+		}
+		for (; next < split->old_next; next++) {
+			if (old->items[next].len > 0) {
+				return false;
+			}
+		}
+		next = split->old_next + 1;
+	}
+
+	while (next < old->count && old->items[next].len == 0) {
+		next++;
+	}
+
+	return next >= old->count || !old->items[next].joined;
+}
+
+/**
+ * Gather the text of text pieces from consecutive content entries, to be
+ * measured together.
+ *
+ * The pieces' text is copied into one string in the layout's scratch text,
+ * to be measured as one.  If the client measures in batches, the text up
+ * to the end of each piece that ends within the word is measured too, in
+ * the same call, to place the pieces after it.  Otherwise that would cost
+ * a `measure_text` call per piece, so only the word is measured.
+ *
+ * \param[in]  para   The paragraph being laid out.
+ * \param[in]  split  The splitting state.
+ * \param[in]  first  Index of first text piece to measure together.
+ * \param[in]  last   Index of last text piece to measure together.
+ *                    Pieces in between that aren't text have no length.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_gather_joined(
+		paragraph_para_t *para,
+		paragraph_layout_split_t *split,
+		size_t first,
+		size_t last)
+{
+	const paragraph_content_t *content = &para->content;
+	paragraph_layout_t *layout = &para->layout;
+	const paragraph_layout_item_t *items = layout->segs.items;
+	paragraph_style_t *style = paragraph_content__style(
+			content, items[first].entry);
+	paragraph_layout_pending_t pending = {
+		.first = first,
+		.last = last,
+		.text = split->text_len,
+		.word = SIZE_MAX,
+		.space = SIZE_MAX,
+		.prefix = SIZE_MAX,
+	};
+	paragraph_text_t measure = {
+		.level = items[first].level,
+		.script = paragraph_script__code(items[first].script),
+	};
+	size_t pos = split->text_len;
+	size_t total, word, index, bytes = 0;
+	paragraph_err_t err;
+
+	for (size_t i = first; i <= last; i++) {
+		paragraph_text_t text;
+
+		if (items[i].len == 0) {
+			continue;
+		}
+
+		paragraph__layout_text(para, items[i].entry,
+				items[i].offset, items[i].len, &text);
+		if (text.len == 0) {
+			continue;
+		}
+
+		err = vec_ensure((void **)&layout->text, text.len,
+				sizeof(*layout->text), pos,
+				&layout->text_alloc, options);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+
+		memcpy(layout->text + pos, text.data, text.len);
+		bytes += paragraph__layout_word_len(layout->text + pos,
+				text.len);
+		pos += text.len;
+	}
+	total = pos - pending.text;
+	split->text_len = pos;
+
+	word = total > 0 ? paragraph__layout_word_len(
+			layout->text + pending.text, total) : 0;
+
+	if (bytes < total) {
+		err = paragraph__layout_request_space(para, split, style,
+				&pending.space);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+	}
+
+	if (word == 0) {
+		return paragraph__layout_add_pending(para, &pending);
+	}
+
+	/* The scratch text may move as it grows, so the text is found once
+	 * the paragraph is split. */
+	measure.len = word;
+	err = paragraph__layout_request(para, &measure, style, &pending.word);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	if (para->ctx->cb_text->measure_text_batch == NULL) {
+		return paragraph__layout_add_pending(para, &pending);
+	}
+
+	pos = 0;
+	for (size_t i = first; i <= last; i++) {
+		paragraph_text_t text;
+
+		if (items[i].len == 0) {
+			continue;
+		}
+
+		paragraph__layout_text(para, items[i].entry,
+				items[i].offset, items[i].len, &text);
+		pos += text.len;
+		if (text.len == 0 || pos >= word) {
+			continue;
+		}
+
+		measure.len = pos;
+		err = paragraph__layout_request(para, &measure, style, &index);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+		if (pending.prefixes++ == 0) {
+			pending.prefix = index;
+		}
+	}
+
+	return paragraph__layout_add_pending(para, &pending);
+}
+
+/**
+ * Count the characters of UTF-8 text.
+ *
+ * \param[in]  data  The text.
+ * \param[in]  len   Byte length of text.
+ * \return the number of bytes that aren't continuation bytes.
+ */
+static inline size_t paragraph__layout_chars(
+		const char *data,
+		size_t len)
+{
+	size_t count = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		if (((uint8_t)data[i] & 0xc0) != 0x80) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/**
+ * Get the offset of the end of a text piece from the start of the text
+ * pieces measured together with it.
+ *
+ * Ends within the measured word are found from the measurements of the
+ * text up to them, which are taken in order.  If there are none, the word's
+ * width is shared in proportion to the number of characters before the
+ * end.  Spaces after the word have the width of a space.
+ *
+ * \param[in]     layout   The layout state, with the batch measured.
+ * \param[in]     pending  The pieces, with their measurements.
+ * \param[in]     word     Byte length of the measured word.
+ * \param[in]     end      Byte offset of the piece's end in the pieces.
+ * \param[in]     before   Number of characters before end, if within word.
+ * \param[in]     chars    Number of characters in the word.
+ * \param[in,out] prefix   Index of the next measurement of text up to an
+ *                         end.  Updated if it is used.
+ * \return the offset of the piece's end.
+ */
+static uint32_t paragraph__layout_joined_end(
+		const paragraph_layout_t *layout,
+		const paragraph_layout_pending_t *pending,
+		size_t word,
+		size_t end,
+		size_t before,
+		size_t chars,
+		size_t *prefix)
+{
+	const paragraph_text_metrics_t *space = paragraph__layout_metrics(
+			layout, pending->space);
+	const paragraph_text_metrics_t *m = paragraph__layout_metrics(
+			layout, pending->word);
+
+	if (end < word) {
+		if (pending->prefixes > 0) {
+			return layout->metrics[(*prefix)++].width;
+		}
+		return chars > 0 ? (uint64_t)m->width * before / chars : 0;
+	}
+
+	return m->width + paragraph__layout_spaces(
+			layout->text + pending->text + word,
+			end - word) * space->width;
+}
+
+/**
+ * Measure text pieces from consecutive content entries together, from the
+ * measured batch.
+ *
+ * Each piece is as wide as the distance from its start to the start of the
+ * piece after it, so kerning and shaping across the pieces is kept.  Where
+ * the text up to each piece's end wasn't measured, the pieces share the
+ * word's width in proportion to their numbers of characters.  A piece's
+ * trailing spaces have the width of a space, as for a piece measured on
+ * its own.
+ *
+ * \param[in]  para     The paragraph being laid out.
+ * \param[in]  pending  The pieces, with their measurements.
+ */
+static void paragraph__layout_measure_joined(
+		paragraph_para_t *para,
+		const paragraph_layout_pending_t *pending)
+{
+	const paragraph_layout_t *layout = &para->layout;
+	paragraph_layout_item_t *items = layout->segs.items;
+	const paragraph_text_metrics_t *space = paragraph__layout_metrics(
+			layout, pending->space);
+	const paragraph_text_metrics_t *m = paragraph__layout_metrics(
+			layout, pending->word);
+	size_t word = pending->word != SIZE_MAX ?
+			layout->measure[pending->word].text.len : 0;
+	size_t prefix = pending->prefix;
+	size_t before = 0, chars = 0;
+	size_t pos = 0;
+	uint32_t x = 0;
+
+	if (pending->prefixes == 0) {
+		chars = paragraph__layout_chars(layout->text + pending->text,
+				word);
+	}
+
+	for (size_t i = pending->first; i <= pending->last; i++) {
+		const char *data = layout->text + pending->text + pos;
+		paragraph_text_t text;
+		size_t w, spaces;
+		uint32_t end;
+
+		if (items[i].len == 0) {
+			continue;
+		}
+
+		paragraph__layout_text(para, items[i].entry,
+				items[i].offset, items[i].len, &text);
+		if (text.len == 0) {
+			items[i].width = 0;
+			items[i].trailing = 0;
+			items[i].height = 0;
+			items[i].baseline = 0;
+			items[i].newline = false;
+			continue;
+		}
+
+		w = paragraph__layout_word_len(data, text.len);
+		spaces = paragraph__layout_spaces(data + w, text.len - w);
+		pos += text.len;
+		if (chars > 0 && pos < word) {
+			before += paragraph__layout_chars(data, text.len);
+		}
+
+		end = paragraph__layout_joined_end(layout, pending, word, pos,
+				before, chars, &prefix);
+		if (end < x) {
+			end = x;
+		}
+
+		items[i].width = end - x;
+		items[i].trailing = spaces * space->width;
+		if (items[i].trailing > items[i].width) {
+			items[i].trailing = items[i].width;
+		}
+		items[i].newline = data[text.len - 1] == '\n';
+		if (w > 0) {
+			items[i].height = m->height;
+			items[i].baseline = m->baseline;
+		} else {
+			items[i].height = space->height;
+			items[i].baseline = space->baseline;
+		}
+		x = end;
+	}
+}
+
+/**
+ * Add a piece of content to the layout's pieces.
+ *
+ * Replaced content is measured here.  Text is gathered for measuring once
+ * the rest of its word has been added, by \ref paragraph__layout_gather_word.
+ *
+ * \param[in]  para    The paragraph being laid out.
+ * \param[in]  split   The splitting state.
+ * \param[in]  entry   Index of content entry the piece comes from.
+ * \param[in]  offset  Byte offset of piece in entry's text.
+ * \param[in]  len     Byte length of piece.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_add_segment(
+		paragraph_para_t *para,
+		paragraph_layout_split_t *split,
+		uint32_t entry,
+		size_t offset,
+		size_t len)
+{
+	const paragraph_content_t *content = &para->content;
+	const paragraph_content_cold_t *cold = &content->cold[entry];
+	size_t pos = paragraph_content__offset(content, entry) + offset;
+	paragraph_layout_t *layout = &para->layout;
+	paragraph_layout_item_t *item;
+	paragraph_err_t err;
+
+	err = vec_ensure((void **)&layout->segs.items, 1,
+			sizeof(*layout->segs.items),
+			layout->segs.count,
+			&layout->segs.alloc,
+			options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	item = &layout->segs.items[layout->segs.count];
+	*item = (paragraph_layout_item_t) {
+		.entry = entry,
+		.offset = offset,
+		.len = len,
+		.level = content->type[entry] == PARAGRAPH_CONTENT_TEXT ?
+				paragraph_bidi__level(&para->bidi, pos) :
+				paragraph_bidi__entry_level(&para->bidi, entry),
+		.script = content->type[entry] == PARAGRAPH_CONTENT_TEXT ?
+				paragraph_script__at(&para->script, pos) :
+				0,
+	};
+
+	switch (content->type[entry]) {
+	case PARAGRAPH_CONTENT_TEXT: {
+		const paragraph_layout_run_t *runs = layout->runs;
+
+		/* Text is measured when the word is complete. */
+		while (split->run < layout->run_count &&
+				runs[split->run].end <= entry) {
+			split->run++;
+		}
+		if (split->text != SIZE_MAX) {
+			const paragraph_layout_item_t *prev =
+					&layout->segs.items[split->text];
+
+			item->joined = prev->entry != entry &&
+					prev->entry >= runs[split->run].start &&
+					prev->level == item->level &&
+					prev->script == item->script;
+		}
+		split->text = layout->segs.count;
+		break;
+	}
+
+	case PARAGRAPH_CONTENT_REPLACED:
+		item->width = cold->px_width;
+		item->height = cold->px_height;
+		item->baseline = cold->px_height;
+		break;
+
+	default:
+		break;
+	}
+
+	layout->segs.count++;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Find the next break opportunity where text may wrap.
+ *
+ * \param[in]  para  The paragraph being laid out.
+ * \param[in]  pos   Byte offset in paragraph text to search from.
+ * \return the byte offset of the first break opportunity at or after pos
+ *         where text wraps, or the length of the text if there is none.
+ */
+static size_t paragraph__layout_next_break(
+		paragraph_para_t *para,
+		size_t pos)
+{
+	size_t brk = paragraph_linebreak__next(&para->linebreak, pos);
+
+	while (!paragraph_whitespace__wraps(&para->whitespace,
+			&para->content, brk)) {
+		brk = paragraph_linebreak__next(&para->linebreak, brk + 1);
+	}
+
+	return brk;
+}
+
+/**
+ * Split content from the cursor up to the next break opportunity into
+ * measured pieces.
+ *
+ * There is also a break opportunity before replaced content.  The measured
+ * pieces of the word are appended to the layout's pieces, and the cursor is
+ * advanced past the word.  If the cursor is at the end of the paragraph, no
+ * pieces are added.
+ *
+ * \param[in]  para   The paragraph being laid out.
+ * \param[in]  split  The splitting state.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_split_word(
+		paragraph_para_t *para,
+		paragraph_layout_split_t *split)
+{
+	const paragraph_content_t *content = &para->content;
+	bool has_content = false;
+	paragraph_err_t err;
+	size_t base;
+	size_t brk;
+
+	if (split->entry >= content->count) {
+		return PARAGRAPH_OK;
+	}
+
+	base = paragraph_content__offset(content, split->entry);
+	brk = paragraph__layout_next_break(para, base + split->offset + 1);
+
+	while (split->entry < content->count) {
+		uint32_t entry = split->entry;
+		size_t start = split->offset;
+		size_t at = base + start;
+
+		if (at >= brk && has_content && content->type[entry] !=
+				PARAGRAPH_CONTENT_INLINE_END) {
+			return PARAGRAPH_OK;
+		}
+
+		switch (content->type[entry]) {
+		case PARAGRAPH_CONTENT_TEXT: {
+			size_t len = content->text_len[entry];
+			size_t end = brk - base;
+
+			if (end > len) {
+				end = len;
+			}
+
+			while (end > start) {
+				size_t run = paragraph_bidi__run_end(
+						&para->bidi, base + start,
+						base + end);
+
+				run = paragraph_script__run_end(
+						&para->script, base + start,
+						run) - base;
+
+				err = paragraph__layout_add_segment(para, split,
+						entry, start, run - start);
+				if (err != PARAGRAPH_OK) {
+					return err;
+				}
+				has_content = true;
+				start = run;
+			}
+
+			if (end < len) {
+				split->offset = end;
+				return PARAGRAPH_OK;
+			}
+			break;
+		}
+
+		case PARAGRAPH_CONTENT_INLINE_START:
+		case PARAGRAPH_CONTENT_INLINE_END:
+		case PARAGRAPH_CONTENT_FLOAT:
+			/* Floats are placed by the client, so they take no
+			 * room on the line. */
+			err = paragraph__layout_add_segment(para, split,
+					entry, 0, 0);
+			if (err != PARAGRAPH_OK) {
+				return err;
+			}
+			break;
+
+		case PARAGRAPH_CONTENT_REPLACED:
+			if (has_content) {
+				return PARAGRAPH_OK;
+			}
+			err = paragraph__layout_add_segment(para, split,
+					entry, 0, 0);
+			if (err != PARAGRAPH_OK) {
+				return err;
+			}
+			has_content = true;
+			brk = paragraph__layout_next_break(para, at);
+			break;
+
+		default:
+			/* Removed content. */
+			break;
+		}
+
+		split->entry++;
+		split->offset = 0;
+		base += content->text_len[entry];
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Gather the text of the text pieces of a word, for measuring once the
+ * paragraph is split.
+ *
+ * Text pieces joined to the text piece before them are measured with it.
+ * Pieces that take their measurements from before the content changes
+ * aren't measured.
+ *
+ * \param[in]  para   The paragraph being laid out.
+ * \param[in]  split  The splitting state.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_gather_word(
+		paragraph_para_t *para,
+		paragraph_layout_split_t *split)
+{
+	const paragraph_content_t *content = &para->content;
+	paragraph_layout_segments_t *segs = &para->layout.segs;
+
+	for (size_t i = split->word; i < segs->count; i++) {
+		paragraph_err_t err;
+		size_t last = i;
+
+		if (content->type[segs->items[i].entry] !=
+				PARAGRAPH_CONTENT_TEXT) {
+			continue;
+		}
+
+		for (size_t j = i + 1; j < segs->count; j++) {
+			if (segs->items[j].joined) {
+				last = j;
+			} else if (segs->items[j].len > 0) {
+				break;
+			}
+		}
+
+		if (paragraph__layout_old_text(para, split, i, last)) {
+			err = PARAGRAPH_OK;
+		} else if (last == i) {
+			err = paragraph__layout_gather_piece(para, split, i);
+		} else {
+			err = paragraph__layout_gather_joined(para, split,
+					i, last);
+		}
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+		i = last;
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Transform the text of the runs with a `text-transform`.
+ *
+ * \param[in]  para  The paragraph being laid out.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_transform(
+		paragraph_para_t *para)
+{
+	const paragraph_whitespace_t *ws = &para->whitespace;
+	const paragraph_content_t *content = &para->content;
+	const paragraph_layout_t *layout = &para->layout;
+	paragraph_transform_t *tr = &para->transform;
+
+	paragraph_transform__clear(tr);
+	if (!tr->active) {
+		return PARAGRAPH_OK;
+	}
+
+	for (size_t r = 0; r < layout->run_count; r++) {
+		const paragraph_layout_run_t *run = &layout->runs[r];
+		size_t next;
+
+		if (paragraph_transform__mode(tr, run->start) ==
+				PARAGRAPH_TEXT_TRANSFORM_NONE) {
+			continue;
+		}
+
+		next = paragraph_content__offset(content, run->start);
+		for (uint32_t e = run->start; e < run->end; e++) {
+			size_t start = next;
+			size_t end = start + content->text_len[e];
+			const char *data = content->cold[e].data;
+			paragraph_err_t err;
+
+			next = end;
+
+			if (content->type[e] != PARAGRAPH_CONTENT_TEXT) {
+				continue;
+			}
+
+			if (ws->active) {
+				start = paragraph_whitespace__map(ws, start);
+				end = paragraph_whitespace__map(ws, end);
+				data = ws->text + start;
+			}
+			if (end == start) {
+				continue;
+			}
+
+			err = paragraph_transform__add(tr, e, start,
+					data, end - start);
+			if (err != PARAGRAPH_OK) {
+				return err;
+			}
+		}
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Check whether text can continue a run of text.
+ *
+ * Text in the run's style continues it, as does text in a style the client
+ * says measures the same, if its white space and text transform are the
+ * same too.
+ *
+ * \param[in]  para   The paragraph being laid out.
+ * \param[in]  start  Index of the run's first content entry.
+ * \param[in]  entry  Index of the text content entry.
+ * \return true if the text continues the run.
+ */
+static bool paragraph__layout_continues_run(
+		const paragraph_para_t *para,
+		uint32_t start,
+		uint32_t entry)
+{
+	const paragraph_cb_text_t *cb = para->ctx->cb_text;
+	const paragraph_content_t *content = &para->content;
+	const paragraph_style_t *a = paragraph_content__style(content, start);
+	const paragraph_style_t *b = paragraph_content__style(content, entry);
+
+	if (a == b) {
+		return true;
+	}
+
+	if (cb->same_font == NULL ||
+			paragraph_whitespace__mode(&para->whitespace, start) !=
+			paragraph_whitespace__mode(&para->whitespace, entry) ||
+			paragraph_transform__mode(&para->transform, start) !=
+			paragraph_transform__mode(&para->transform, entry)) {
+		return false;
+	}
+
+	return cb->same_font(para->ctx->pw, a, b);
+}
+
+/**
+ * Find the runs of text measured the same way.
+ *
+ * Empty text doesn't end a run, and nor do inline starts and ends.  Runs
+ * are ended by text that doesn't continue them, as found by
+ * \ref paragraph__layout_continues_run, and by any other content.  Runs
+ * with a `text-transform` have their text transformed.
+ *
+ * \param[in]  para  The paragraph being laid out.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_runs(
+		paragraph_para_t *para)
+{
+	const paragraph_content_t *content = &para->content;
+	paragraph_layout_t *layout = &para->layout;
+	paragraph_layout_run_t *run = NULL;
+
+	layout->run_count = 0;
+
+	for (uint32_t e = 0; e < content->count; e++) {
+		paragraph_err_t err;
+
+		switch (content->type[e]) {
+		case PARAGRAPH_CONTENT_TEXT:
+			if (content->text_len[e] == 0) {
+				break;
+			}
+			if (run != NULL && paragraph__layout_continues_run(
+					para, run->start, e)) {
+				run->end = e + 1;
+				break;
+			}
+
+			err = vec_ensure((void **)&layout->runs, 1,
+					sizeof(*layout->runs),
+					layout->run_count,
+					&layout->run_alloc,
+					options);
+			if (err != PARAGRAPH_OK) {
+				return err;
+			}
+
+			run = &layout->runs[layout->run_count++];
+			run->start = e;
+			run->end = e + 1;
+			break;
+
+		case PARAGRAPH_CONTENT_INLINE_START:
+		case PARAGRAPH_CONTENT_INLINE_END:
+			break;
+
+		default:
+			run = NULL;
+			break;
+		}
+	}
+
+	return paragraph__layout_transform(para);
+}
+
+/**
+ * Measure the text pieces gathered while splitting, in one batch.
+ *
+ * \param[in]  para  The paragraph being laid out.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_measure_pending(
+		paragraph_para_t *para)
+{
+	paragraph_layout_t *layout = &para->layout;
+	paragraph_err_t err;
+
+	for (size_t i = 0; i < layout->pending_count; i++) {
+		const paragraph_layout_pending_t *pending = &layout->pending[i];
+
+		if (pending->first == pending->last ||
+				pending->word == SIZE_MAX) {
+			continue;
+		}
+
+		layout->measure[pending->word].text.data =
+				layout->text + pending->text;
+		for (size_t j = 0; j < pending->prefixes; j++) {
+			layout->measure[pending->prefix + j].text.data =
+					layout->text + pending->text;
+		}
+	}
+
+	err = vec_ensure((void **)&layout->metrics, layout->measure_count,
+			sizeof(*layout->metrics), 0,
+			&layout->metrics_alloc, options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = paragraph_measure__batch(para->ctx, layout->measure,
+			layout->metrics, layout->measure_count);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	for (size_t i = 0; i < layout->pending_count; i++) {
+		const paragraph_layout_pending_t *pending = &layout->pending[i];
+
+		if (pending->first == pending->last) {
+			paragraph__layout_measure_piece(para, pending);
+		} else {
+			paragraph__layout_measure_joined(para, pending);
+		}
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Split all the content into words of measured pieces.
+ *
+ * Pieces from content entries outside the changed range take their
+ * measurements from the previous split, rather than being measured again.
+ *
+ * \param[in]  para   The paragraph being laid out.
+ * \param[in]  start  Index of first changed content entry.
+ * \param[in]  end    Index after last changed content entry.
+ * \param[in]  shift  Content entry index shift after the changes.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_split(
+		paragraph_para_t *para,
+		uint32_t start,
+		uint32_t end,
+		int64_t shift)
+{
+	paragraph_layout_t *layout = &para->layout;
+	paragraph_layout_segments_t segs = layout->old_segs;
+	paragraph_layout_split_t split = {
+		.old = &layout->old_segs,
+		.start = start,
+		.end = end,
+		.shift = shift,
+		.space = SIZE_MAX,
+	};
+	paragraph_err_t err;
+
+	layout->old_segs = layout->segs;
+	layout->segs = segs;
+	layout->segs.count = 0;
+	if (!layout->segs_valid) {
+		layout->old_segs.count = 0;
+	}
+	layout->segs_valid = false;
+	layout->hyphen.style = NULL;
+	layout->pending_count = 0;
+	layout->measure_count = 0;
+
+	err = paragraph__layout_runs(para);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	while (split.entry < para->content.count) {
+		size_t first = layout->segs.count;
+
+		split.word = first;
+		split.text = SIZE_MAX;
+		err = paragraph__layout_split_word(para, &split);
+		if (err == PARAGRAPH_OK) {
+			err = paragraph__layout_gather_word(para, &split);
+		}
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+
+		if (first < layout->segs.count) {
+			layout->segs.items[first].start = true;
+		}
+	}
+
+	err = paragraph__layout_measure_pending(para);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	layout->segs_valid = true;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Find the piece a line from the previous pass starts with.
+ *
+ * \param[in]  layout  The layout state.
+ * \param[in]  entry   Index of content entry the line starts in.
+ * \param[in]  offset  Byte offset of line start in entry's text.
+ * \return the index of the first piece at or after the line start.
+ */
+static size_t paragraph__layout_find_segment(
+		const paragraph_layout_t *layout,
+		uint32_t entry,
+		size_t offset)
+{
+	const paragraph_layout_item_t *items = layout->segs.items;
+	size_t lo = 0;
+	size_t hi = layout->segs.count;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (items[mid].entry < entry || (items[mid].entry == entry &&
+				items[mid].offset < offset)) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/**
+ * Take the next word's pieces for the line being filled.
+ *
+ * The word's pieces are appended to the layout items, and the cursor is
+ * advanced past the word.  If the cursor is at the end of the paragraph, no
+ * items are added.
+ *
+ * \param[in]  para  The paragraph being laid out.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_next_word(
+		paragraph_para_t *para)
+{
+	paragraph_layout_t *layout = &para->layout;
+	size_t end = layout->seg;
+	paragraph_err_t err;
+
+	if (end >= layout->segs.count) {
+		return PARAGRAPH_OK;
+	}
+
+	do {
+		end++;
+	} while (end < layout->segs.count && !layout->segs.items[end].start);
+
+	err = vec_ensure((void **)&layout->cur.items, end - layout->seg,
+			sizeof(*layout->cur.items),
+			layout->cur.item_count,
+			&layout->cur.item_alloc,
+			options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	memcpy(layout->cur.items + layout->cur.item_count,
+			layout->segs.items + layout->seg,
+			(end - layout->seg) * sizeof(*layout->cur.items));
+	layout->cur.item_count += end - layout->seg;
+	layout->seg = end;
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Start a layout pass over a paragraph.
+ *
+ * Works out which of the previous pass's lines are unaffected by content
+ * changes since.
+ *
+ * \param[in]  para  The paragraph to start laying out.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_start(
+		paragraph_para_t *para)
+{
+	paragraph_content_t *content = &para->content;
+	paragraph_layout_t *layout = &para->layout;
+	const paragraph_layout_line_t *lines = layout->prev.lines;
+	size_t count = layout->prev.line_count;
+	paragraph_err_t err;
+
+	paragraph_content__settle(para->ctx, content);
+
+	if (content->dirty.dirty || !layout->segs_valid) {
+		err = paragraph__para_own(para);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+	}
+
+	err = paragraph__layout_char(para, &layout->strut,
+			para->styles.array[0], " ");
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = paragraph_linebreak__update(&para->linebreak, content);
+	if (err == PARAGRAPH_OK) {
+		err = paragraph_bidi__update(&para->bidi, content);
+	}
+	if (err == PARAGRAPH_OK) {
+		err = paragraph_script__update(&para->script, content);
+	}
+	if (err == PARAGRAPH_OK) {
+		err = paragraph_whitespace__update(&para->whitespace,
+				content, para->ctx);
+	}
+	if (err == PARAGRAPH_OK) {
+		err = paragraph_transform__update(&para->transform,
+				content, para->ctx);
+	}
+	if (err != PARAGRAPH_OK) {
+		/* The previous lines can't be checked against changes. */
+		paragraph__layout_discard(layout);
+		return err;
+	}
+
+	if (content->dirty.dirty || !layout->segs_valid) {
+		err = paragraph__layout_split(para,
+				content->dirty.start, content->dirty.end,
+				(int64_t)content->count - layout->count);
+		if (err != PARAGRAPH_OK) {
+			paragraph__layout_discard(layout);
+			return err;
+		}
+	}
+
+	layout->reuse_end = count;
+	layout->reuse_start = count;
+	layout->reuse_shift = 0;
+	layout->reuse_next = 0;
+
+	if (content->dirty.dirty) {
+		int64_t shift = (int64_t)content->count - layout->count;
+		int64_t old_end = content->dirty.end - shift;
+		uint32_t start = content->dirty.start;
+		size_t pos = start < content->count ?
+				paragraph_content__offset(content, start) :
+				content->len;
+		size_t l = 0;
+
+		/* Lines up to the one containing the first change are
+		 * affected, and so is the line before, since content from the
+		 * changed line may now fit on it.  A line starting at the
+		 * text offset of the first change may start at a break
+		 * opportunity that has changed, even if its entry hasn't. */
+		while (l < count && lines[l].entry < start &&
+				paragraph_content__offset(content,
+					lines[l].entry) +
+				lines[l].offset < pos) {
+			l++;
+		}
+		layout->reuse_end = l > 2 ? l - 2 : 0;
+
+		/* Lines starting after the changes are unaffected. */
+		while (l < count && lines[l].entry < old_end) {
+			l++;
+		}
+		layout->reuse_start = l;
+		layout->reuse_shift = shift;
+
+		content->dirty = (paragraph_content_dirty_t) { 0 };
+	}
+	layout->count = content->count;
+
+	layout->seg = 0;
+	layout->cur.item_count = 0;
+	layout->cur.line_count = 0;
+	layout->cur.visual_count = 0;
+	layout->in_progress = true;
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Get the position the next line starts at.
+ *
+ * This is the start of any word carried over from the previous line, or
+ * otherwise the layout cursor's piece.
+ *
+ * \param[in]  layout      The layout state.
+ * \param[out] entry_out   Returns index of content entry line starts in.
+ * \param[out] offset_out  Returns byte offset of line start in entry's text.
+ */
+static void paragraph__layout_line_start(
+		const paragraph_layout_t *layout,
+		uint32_t *entry_out,
+		size_t *offset_out)
+{
+	size_t first = paragraph__layout_lines_end(&layout->cur);
+
+	if (first < layout->cur.item_count) {
+		*entry_out = layout->cur.items[first].entry;
+		*offset_out = layout->cur.items[first].offset;
+	} else if (layout->seg < layout->segs.count) {
+		*entry_out = layout->segs.items[layout->seg].entry;
+		*offset_out = layout->segs.items[layout->seg].offset;
+	} else {
+		*entry_out = layout->count;
+		*offset_out = 0;
+	}
+}
+
+/**
+ * Position a line's pieces in visual order.
+ *
+ * Runs of pieces are reversed as described by rule L2 of UAX #9.  First,
+ * pieces of whitespace at the end of the line are reset to the paragraph
+ * level, by rule L1.  Pieces include their trailing spaces, so only pieces
+ * with nothing but spaces are reset.
+ *
+ * \param[in]  para           The paragraph being laid out.
+ * \param[in]  items          The line's pieces.
+ * \param[in]  count          Number of pieces on line.
+ * \param[out] reordered_out  Returns whether the pieces were positioned.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_reorder(
+		paragraph_para_t *para,
+		paragraph_layout_item_t *items,
+		size_t count,
+		bool *reordered_out)
+{
+	const paragraph_content_t *content = &para->content;
+	paragraph_layout_t *layout = &para->layout;
+	uint8_t lowest = UINT8_MAX;
+	uint8_t highest = 0;
+	paragraph_err_t err;
+	size_t end = count;
+	uint32_t *order;
+	uint32_t x = 0;
+
+	*reordered_out = false;
+
+	while (end > 0 && items[end - 1].width == items[end - 1].trailing &&
+			content->type[items[end - 1].entry] !=
+					PARAGRAPH_CONTENT_REPLACED) {
+		items[--end].level = para->bidi.level;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (items[i].level > highest) {
+			highest = items[i].level;
+		}
+		if (items[i].level < lowest) {
+			lowest = items[i].level;
+		}
+	}
+
+	/* Nothing is reversed unless there is an odd level. */
+	lowest |= 1;
+	if (count == 0 || highest < lowest) {
+		return PARAGRAPH_OK;
+	}
+
+	err = vec_ensure((void **)&layout->order, count,
+			sizeof(*layout->order), 0,
+			&layout->order_alloc,
+			options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+	order = layout->order;
+
+	for (size_t i = 0; i < count; i++) {
+		order[i] = i;
+	}
+
+	for (uint8_t level = highest; level >= lowest; level--) {
+		size_t i = 0;
+
+		while (i < count) {
+			size_t j = i;
+
+			while (j < count && items[order[j]].level >= level) {
+				j++;
+			}
+
+			for (size_t a = i, b = j; a + 1 < b; a++, b--) {
+				uint32_t tmp = order[a];
+				order[a] = order[b - 1];
+				order[b - 1] = tmp;
+			}
+
+			i = (j > i) ? j : i + 1;
+		}
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		items[order[i]].x = x;
+		x += items[order[i]].width;
+	}
+
+	*reordered_out = true;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Add a line to the current pass's lines.
+ *
+ * \param[in]  para             The paragraph being laid out.
+ * \param[in]  entry            Index of content entry line starts in.
+ * \param[in]  offset           Byte offset of line start in entry's text.
+ * \param[in]  item             Index of line's first piece.
+ * \param[in]  item_count       Number of pieces on line.
+ * \param[in]  available_width  Available width the line was filled to.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_add_line(
+		paragraph_para_t *para,
+		uint32_t entry,
+		size_t offset,
+		size_t item,
+		size_t item_count,
+		uint32_t available_width)
+{
+	paragraph_layout_t *layout = &para->layout;
+	paragraph_layout_line_t *line;
+	bool reordered = false;
+	paragraph_err_t err;
+	uint32_t x = 0;
+
+	if (para->bidi.active) {
+		err = paragraph__layout_reorder(para, layout->cur.items + item,
+				item_count, &reordered);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+	}
+
+	err = vec_ensure((void **)&layout->cur.lines, 1,
+			sizeof(*layout->cur.lines),
+			layout->cur.line_count,
+			&layout->cur.line_alloc,
+			options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	if (reordered) {
+		/* Keep the visual order, for hit testing. */
+		err = vec_ensure((void **)&layout->cur.visual, item_count,
+				sizeof(*layout->cur.visual),
+				layout->cur.visual_count,
+				&layout->cur.visual_alloc,
+				options);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+		memcpy(layout->cur.visual + layout->cur.visual_count,
+				layout->order,
+				item_count * sizeof(*layout->cur.visual));
+	}
+
+	line = &layout->cur.lines[layout->cur.line_count++];
+	*line = (paragraph_layout_line_t) {
+		.entry = entry,
+		.offset = offset,
+		.item = item,
+		.item_count = item_count,
+		.available_width = available_width,
+		.reordered = reordered,
+		.visual = layout->cur.visual_count,
+	};
+	if (reordered) {
+		layout->cur.visual_count += item_count;
+	}
+
+	for (size_t i = item; i < item + item_count && !reordered; i++) {
+		layout->cur.items[i].x = x;
+		x += layout->cur.items[i].width;
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Get the start of a line from the previous pass, in current entry indices.
+ *
+ * \param[in]  layout  The layout state.
+ * \param[in]  index   Index of the previous pass's line.
+ * \return the index of the content entry the line starts in.
+ */
+static inline uint32_t paragraph__layout_prev_entry(
+		const paragraph_layout_t *layout,
+		size_t index)
+{
+	uint32_t entry = layout->prev.lines[index].entry;
+
+	if (index >= layout->reuse_start) {
+		entry = (uint32_t)(entry + layout->reuse_shift);
+	}
+
+	return entry;
+}
+
+/**
+ * Lay out the next line by reusing a line from the previous pass.
+ *
+ * A line can be reused if it is unaffected by content changes, starts where
+ * the next line starts, and was filled to the same available width.
+ *
+ * \param[in]  para             The paragraph being laid out.
+ * \param[in]  available_width  The available width for the line.
+ * \param[out] reused_out       Returns whether a line was reused.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_reuse_line(
+		paragraph_para_t *para,
+		uint32_t available_width,
+		bool *reused_out)
+{
+	paragraph_layout_t *layout = &para->layout;
+	const paragraph_layout_line_t *line;
+	size_t count = layout->prev.line_count;
+	paragraph_err_t err;
+	size_t first;
+	uint32_t entry;
+	size_t offset;
+	size_t index;
+
+	*reused_out = false;
+
+	paragraph__layout_line_start(layout, &entry, &offset);
+
+	/* Skip lines that start before the next line, or are affected. */
+	while (layout->reuse_next < count) {
+		uint32_t e;
+
+		index = layout->reuse_next;
+		if (index >= layout->reuse_end &&
+				index < layout->reuse_start) {
+			layout->reuse_next = layout->reuse_start;
+			continue;
+		}
+
+		e = paragraph__layout_prev_entry(layout, index);
+		if (e > entry || (e == entry &&
+				layout->prev.lines[index].offset >= offset)) {
+			break;
+		}
+		layout->reuse_next++;
+	}
+
+	if (layout->reuse_next >= count) {
+		return PARAGRAPH_OK;
+	}
+
+	index = layout->reuse_next;
+	line = &layout->prev.lines[index];
+	if (paragraph__layout_prev_entry(layout, index) != entry ||
+			line->offset != offset ||
+			line->available_width != available_width) {
+		return PARAGRAPH_OK;
+	}
+
+	/* A hyphenated line ends part way through a piece, which the
+	 * cursor can't continue from, so it is filled again. */
+	if (line->item_count > 0 && layout->prev.items[
+			line->item + line->item_count - 1].hyphen) {
+		return PARAGRAPH_OK;
+	}
+
+	/* Any carried over word is on the reused line. */
+	first = paragraph__layout_lines_end(&layout->cur);
+	layout->cur.item_count = first;
+
+	err = vec_ensure((void **)&layout->cur.items, line->item_count,
+			sizeof(*layout->cur.items),
+			layout->cur.item_count,
+			&layout->cur.item_alloc,
+			options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	for (size_t i = 0; i < line->item_count; i++) {
+		paragraph_layout_item_t *item = &layout->cur.items[first + i];
+
+		*item = layout->prev.items[line->item + i];
+		if (index >= layout->reuse_start) {
+			item->entry = (uint32_t)(item->entry +
+					layout->reuse_shift);
+		}
+	}
+	layout->cur.item_count += line->item_count;
+
+	err = paragraph__layout_add_line(para, entry, offset,
+			first, line->item_count, available_width);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	/* Continue from where the following line started. */
+	layout->reuse_next++;
+	if (layout->reuse_next < count) {
+		layout->seg = paragraph__layout_find_segment(layout,
+				paragraph__layout_prev_entry(layout,
+						layout->reuse_next),
+				layout->prev.lines[layout->reuse_next].offset);
+	} else {
+		layout->seg = layout->segs.count;
+	}
+
+	*reused_out = true;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Check whether a content entry's text may wrap.
+ *
+ * \param[in]  para   The paragraph being laid out.
+ * \param[in]  entry  Index of text content entry.
+ * \return true unless the entry's white space is processed as `nowrap` or
+ *         `pre`.
+ */
+static inline bool paragraph__layout_wraps(
+		const paragraph_para_t *para,
+		uint32_t entry)
+{
+	paragraph_white_space_t mode = paragraph_whitespace__mode(
+			&para->whitespace, entry);
+
+	return mode != PARAGRAPH_WHITE_SPACE_NOWRAP &&
+			mode != PARAGRAPH_WHITE_SPACE_PRE;
+}
+
+/**
+ * Split a text piece to end a line with a hyphen, if part of it fits.
+ *
+ * The piece is split at the last of its hyphenation points where the text
+ * before it, and a hyphen, fit in the room given.  The part before ends
+ * the line, and the rest of the piece is carried over to the next line.
+ *
+ * \param[in]  para      The paragraph being laid out.
+ * \param[in]  index     Index of the piece in the current pass's pieces.
+ * \param[in]  room      Width available for the piece and a hyphen.
+ * \param[out] split_out Returns whether the piece was split.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_hyphenate_piece(
+		paragraph_para_t *para,
+		size_t index,
+		uint32_t room,
+		bool *split_out)
+{
+	const paragraph_content_t *content = &para->content;
+	paragraph_layout_t *layout = &para->layout;
+	paragraph_layout_item_t item = layout->cur.items[index];
+	paragraph_style_t *style = paragraph_content__style(
+			content, item.entry);
+	const char *data = content->cold[item.entry].data + item.offset;
+	size_t points[PARAGRAPH_HYPHEN_WORD_MAX];
+	paragraph_err_t err;
+	size_t count;
+
+	*split_out = false;
+
+	count = paragraph_hyphen__find(&para->ctx->hyphen, data,
+			paragraph__layout_word_len(data, item.len),
+			points, PARAGRAPH_ARRAY_LEN(points));
+	if (count == 0) {
+		return PARAGRAPH_OK;
+	}
+
+	err = paragraph__layout_char(para, &layout->hyphen, style, "-");
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	while (count-- > 0) {
+		uint32_t width, height, baseline;
+		paragraph_layout_item_t *items;
+		paragraph_text_t text;
+
+		if (layout->hyphen.width >= room) {
+			return PARAGRAPH_OK;
+		}
+
+		paragraph__layout_text(para, item.entry, item.offset,
+				points[count], &text);
+		text.level = item.level;
+		text.script = paragraph_script__code(item.script);
+
+		err = paragraph_measure__text(para->ctx, &text,
+				style, &width, &height, &baseline);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+		if (width > room - layout->hyphen.width) {
+			continue;
+		}
+
+		err = vec_ensure((void **)&layout->cur.items, 1,
+				sizeof(*layout->cur.items),
+				layout->cur.item_count,
+				&layout->cur.item_alloc,
+				options);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+
+		items = layout->cur.items;
+		memmove(items + index + 2, items + index + 1,
+				(layout->cur.item_count - index - 1) *
+				sizeof(*items));
+		layout->cur.item_count++;
+
+		items[index + 1] = item;
+		items[index].len = points[count];
+		items[index].width = width + layout->hyphen.width;
+		items[index].trailing = 0;
+		items[index].newline = false;
+		items[index].hyphen = true;
+
+		items[index + 1].offset = item.offset + points[count];
+		items[index + 1].len = item.len - points[count];
+		items[index + 1].width = item.width > width + item.trailing ?
+				item.width - width : item.trailing;
+		items[index + 1].start = false;
+		items[index + 1].joined = false;
+
+		*split_out = true;
+		return PARAGRAPH_OK;
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Hyphenate a word that doesn't fit on the line, if part of it fits.
+ *
+ * Only text with `hyphens: auto` is hyphenated.  The word's pieces are
+ * tried from the last, so as much of the word as fits ends the line.
+ *
+ * \param[in]  para     The paragraph being laid out.
+ * \param[in]  word     Index of the word's first piece.
+ * \param[in]  room     Width available for the word.
+ * \param[out] end_out  Returns the index after the line's last piece, or
+ *                      word if the word wasn't hyphenated.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_hyphenate(
+		paragraph_para_t *para,
+		size_t word,
+		uint32_t room,
+		size_t *end_out)
+{
+	const paragraph_content_t *content = &para->content;
+	const paragraph_cb_text_t *cb = para->ctx->cb_text;
+	paragraph_layout_t *layout = &para->layout;
+	uint32_t before = 0;
+
+	*end_out = word;
+
+	if (cb->hyphens == NULL ||
+			!paragraph_hyphen__active(&para->ctx->hyphen)) {
+		return PARAGRAPH_OK;
+	}
+
+	for (size_t i = word; i < layout->cur.item_count; i++) {
+		before += layout->cur.items[i].width;
+	}
+
+	for (size_t i = layout->cur.item_count; i-- > word; ) {
+		const paragraph_layout_item_t *item = &layout->cur.items[i];
+		paragraph_err_t err;
+		bool split;
+
+		before -= item->width;
+		if (before >= room || item->len == 0 ||
+				!paragraph__layout_wraps(para, item->entry) ||
+				cb->hyphens(para->ctx->pw,
+						paragraph_content__style(
+						content, item->entry)) !=
+				PARAGRAPH_HYPHENS_AUTO) {
+			continue;
+		}
+
+		err = paragraph__layout_hyphenate_piece(para, i,
+				room - before, &split);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+		if (split) {
+			*end_out = i + 1;
+			return PARAGRAPH_OK;
+		}
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Lay out the next line by filling it with words.
+ *
+ * \param[in]  para             The paragraph being laid out.
+ * \param[in]  available_width  The available width for the line.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_fill_line(
+		paragraph_para_t *para,
+		uint32_t available_width)
+{
+	paragraph_layout_t *layout = &para->layout;
+	size_t first = paragraph__layout_lines_end(&layout->cur);
+	paragraph_err_t err;
+	size_t line_end;
+	uint32_t entry;
+	size_t offset;
+	uint32_t x = 0;
+
+	paragraph__layout_line_start(layout, &entry, &offset);
+
+	/* Any word carried over from the previous line starts this one. */
+	for (size_t i = first; i < layout->cur.item_count; i++) {
+		x += layout->cur.items[i].width;
+	}
+
+	/* A carried over word that doesn't fit on a line of its own may
+	 * be hyphenated again. */
+	if (first < layout->cur.item_count && x - paragraph__layout_hang(para,
+			&layout->cur.items[layout->cur.item_count - 1]) >
+			available_width) {
+		err = paragraph__layout_hyphenate(para, first,
+				available_width, &line_end);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+		if (line_end > first) {
+			return paragraph__layout_add_line(para, entry, offset,
+					first, line_end - first,
+					available_width);
+		}
+	}
+
+	while (true) {
+		size_t word = layout->cur.item_count;
+		uint32_t width = 0;
+
+		if (word > first && layout->cur.items[word - 1].newline) {
+			/* Preserved newline. */
+			line_end = word;
+			break;
+		}
+
+		err = paragraph__layout_next_word(para);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+
+		if (word == layout->cur.item_count) {
+			/* End of content. */
+			line_end = word;
+			break;
+		}
+
+		for (size_t i = word; i < layout->cur.item_count; i++) {
+			width += layout->cur.items[i].width;
+		}
+
+		if (x + width - paragraph__layout_hang(para,
+				&layout->cur.items[layout->cur.item_count - 1]) >
+				available_width) {
+			err = paragraph__layout_hyphenate(para, word,
+					x < available_width ?
+					available_width - x : 0,
+					&line_end);
+			if (err != PARAGRAPH_OK) {
+				return err;
+			}
+			if (line_end > word) {
+				break;
+			}
+			if (word > first) {
+				line_end = word;
+				break;
+			}
+		}
+
+		x += width;
+	}
+
+	return paragraph__layout_add_line(para, entry, offset,
+			first, line_end - first, available_width);
+}
+
+/**
+ * Issue the client callback for the hyphen ending a line.
+ *
+ * The hyphen is at the end of the line's last text piece, which is its
+ * left edge if the piece is right-to-left.
+ *
+ * \param[in]  para     The paragraph being laid out.
+ * \param[in]  item     The hyphenated piece.
+ * \param[in]  style    The piece's style.  The hyphen must have been
+ *                      measured in it.
+ * \param[in]  ascent   The line's ascent.
+ * \param[in]  text_fn  Callback for providing layout info for text.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_emit_hyphen(
+		paragraph_para_t *para,
+		const paragraph_layout_item_t *item,
+		paragraph_style_t *style,
+		uint32_t ascent,
+		paragraph_layout_text_fn text_fn)
+{
+	const paragraph_layout_space_t *hyphen = &para->layout.hyphen;
+	paragraph_position_t at = {
+		.x = item->x + item->width - hyphen->width,
+		.y = ascent > hyphen->baseline ? ascent - hyphen->baseline : 0,
+	};
+
+	if (item->level & 1) {
+		at.x = item->x;
+	}
+
+	return text_fn(para->pw, para->content.cold[item->entry].pw, style,
+			&(const paragraph_text_t) {
+				.text = NULL,
+				.offset = 0,
+				.len = 1,
+				.data = "-",
+				.level = item->level,
+				.script = paragraph_script__code(
+					item->script),
+			},
+			&at);
+}
+
+/**
+ * Issue the client callbacks for the pieces on a line.
+ *
+ * Adjacent text pieces from the same content entry, embedding level and
+ * script are emitted as a single run.
+ *
+ * \param[in]  para         The paragraph being laid out.
+ * \param[in]  line         The line to emit.
+ * \param[in]  text_fn      Callback for providing layout info for text.
+ * \param[in]  replaced_fn  Callback for providing layout info for replaced.
+ * \param[out] height_out   Returns the line height on success.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__layout_emit(
+		paragraph_para_t *para,
+		const paragraph_layout_line_t *line,
+		paragraph_layout_text_fn text_fn,
+		paragraph_layout_replaced_fn replaced_fn,
+		uint32_t *height_out)
+{
+	const paragraph_content_t *content = &para->content;
+	const paragraph_layout_t *layout = &para->layout;
+	const paragraph_layout_item_t *items = layout->cur.items + line->item;
+	size_t count = line->item_count;
+	uint32_t ascent = layout->strut.baseline;
+	uint32_t descent = layout->strut.height - layout->strut.baseline;
+
+	for (size_t i = 0; i < count; i++) {
+		const paragraph_layout_item_t *item = &items[i];
+
+		if (item->baseline > ascent) {
+			ascent = item->baseline;
+		}
+		if (item->height - item->baseline > descent) {
+			descent = item->height - item->baseline;
+		}
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		const paragraph_layout_item_t *item = &items[i];
+		const paragraph_content_cold_t *cold =
+				&content->cold[item->entry];
+		paragraph_style_t *style = paragraph_content__style(
+				content, item->entry);
+		paragraph_position_t pos = {
+			.x = item->x,
+			.y = ascent - item->baseline,
+		};
+		paragraph_err_t err;
+
+		switch (content->type[item->entry]) {
+		case PARAGRAPH_CONTENT_TEXT: {
+			size_t len = item->len;
+			paragraph_text_t text;
+
+			/* Right-to-left runs start at their last piece. */
+			while (i + 1 < count &&
+					items[i + 1].entry == item->entry &&
+					items[i + 1].level == item->level &&
+					items[i + 1].script == item->script) {
+				i++;
+				len += items[i].len;
+				if (items[i].x < pos.x) {
+					pos.x = items[i].x;
+				}
+				/* Pieces emptied by white space processing
+				 * have no baseline. */
+				if (ascent - items[i].baseline < pos.y) {
+					pos.y = ascent - items[i].baseline;
+				}
+			}
+
+			paragraph__layout_text(para, item->entry,
+					item->offset, len, &text);
+			if (text.len > 0 && text.data[text.len - 1] == '\n') {
+				/* A preserved newline ends the line, and isn't
+				 * given to the client. */
+				text.len--;
+			}
+			if (text.len == 0) {
+				/* All removed by white space processing. */
+				err = PARAGRAPH_OK;
+				break;
+			}
+			text.level = item->level;
+			text.script = paragraph_script__code(item->script);
+
+			if (items[i].hyphen) {
+				/* Right-to-left text starts after its
+				 * hyphen. */
+				err = paragraph__layout_char(para,
+						&para->layout.hyphen,
+						style, "-");
+				if (err != PARAGRAPH_OK) {
+					break;
+				}
+				if (item->level & 1) {
+					pos.x += para->layout.hyphen.width;
+				}
+			}
+
+			err = text_fn(para->pw, cold->pw, style, &text, &pos);
+			if (err == PARAGRAPH_OK && items[i].hyphen) {
+				err = paragraph__layout_emit_hyphen(para,
+						&items[i], style, ascent,
+						text_fn);
+			}
+			break;
+		}
+
+		case PARAGRAPH_CONTENT_REPLACED:
+			err = replaced_fn(para->pw, cold->pw, style, &pos);
+			break;
+
+		default:
+			err = PARAGRAPH_OK;
+			break;
+		}
+
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+	}
+
+	*height_out = ascent + descent;
+	return PARAGRAPH_OK;
+}
 
 /* Exported function, documented in `include/paragraph.h` */
 paragraph_err_t paragraph_layout_line(
@@ -24,17 +2520,62 @@ paragraph_err_t paragraph_layout_line(
 		paragraph_layout_replaced_fn replaced_fn,
 		uint32_t *line_height_out)
 {
+	paragraph_layout_line_t *line;
+	paragraph_layout_lines_t lines;
+	paragraph_layout_t *layout;
 	paragraph_err_t err;
-	const char *text;
-	size_t len;
+	bool reused;
+
+	if (para == NULL || text_fn == NULL || replaced_fn == NULL ||
+			line_height_out == NULL) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	layout = &para->layout;
+	if (layout->in_progress && para->content.dirty.dirty) {
+		/* Content changed part way through the pass. */
+		paragraph__layout_discard(layout);
+	}
+
+	if (!layout->in_progress) {
+		err = paragraph__layout_start(para);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+	}
+
+	err = paragraph__layout_reuse_line(para, available_width, &reused);
+	if (err == PARAGRAPH_OK && !reused) {
+		err = paragraph__layout_fill_line(para, available_width);
+	}
+	if (err != PARAGRAPH_OK) {
+		paragraph__layout_discard(layout);
+		return err;
+	}
 
-	err = paragraph_content__get_text(para, &text, &len);
+	line = &layout->cur.lines[layout->cur.line_count - 1];
+	err = paragraph__layout_emit(para, line,
+			text_fn, replaced_fn, line_height_out);
 	if (err != PARAGRAPH_OK) {
+		paragraph__layout_discard(layout);
 		return err;
 	}
 
-	/* Get runs from content (same style) */
-	/* Split runs for  */
+	line->height = *line_height_out;
+	if (layout->cur.line_count > 1) {
+		line->y = line[-1].y + line[-1].height;
+	}
 
-	return PARAGRAPH_OK;
+	if (paragraph__layout_lines_end(&layout->cur) ==
+			layout->cur.item_count &&
+			layout->seg == layout->segs.count) {
+		/* Keep this pass's lines for reuse by the next. */
+		lines = layout->prev;
+		layout->prev = layout->cur;
+		layout->cur = lines;
+		layout->in_progress = false;
+		return PARAGRAPH_OK;
+	}
+
+	return PARAGRAPH_END_OF_LINE;
 }
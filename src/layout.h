@@ -12,9 +12,223 @@
 #ifndef PARAGRAPH__LAYOUT_H
 #define PARAGRAPH__LAYOUT_H
 
+#include <stdbool.h>
+
+#include "content.h"
+
+/**
+ * A measured piece of content.
+ *
+ * Pieces never span content entries, embedding levels or scripts, so each
+ * has a single style, direction and script.  Where a word continues from
+ * one content entry's text into the next in the same style, or one that
+ * measures the same, the pieces either side are measured together.  Each
+ * is placed where the text before it ends, measured in the same batch if
+ * the client measures in batches, or else found by sharing the word's width
+ * between the pieces by their numbers of characters.
+ */
+typedef struct paragraph_layout_item_s {
+	/** Index of content entry this piece comes from. */
+	uint32_t entry;
+	size_t offset;     /**< Byte offset of piece in entry's text. */
+	size_t len;        /**< Byte length of piece. */
+	uint32_t x;        /**< Offset of piece from start of line. */
+	uint32_t width;    /**< Width of piece, including trailing spaces. */
+	uint32_t trailing; /**< Width of piece's trailing spaces. */
+	uint32_t height;   /**< Height of piece. */
+	uint32_t baseline; /**< Baseline offset from top of piece. */
+	uint8_t level;     /**< Bidirectional embedding level of piece. */
+	uint8_t script;    /**< Script of piece, if text. */
+	bool start;        /**< Whether piece starts a word. */
+	/** Whether piece was measured together with the text piece before. */
+	bool joined;
+	bool newline;      /**< Whether piece ends with a preserved newline. */
+	bool hyphen;       /**< Whether piece ends its line with a hyphen. */
+} paragraph_layout_item_t;
+
+/**
+ * A run of content entries whose text has the same style.
+ *
+ * Runs continue across inline starts and ends, as long as the text either
+ * side of them has the same style.
+ */
+typedef struct paragraph_layout_run_s {
+	uint32_t start; /**< Index of first content entry in run. */
+	uint32_t end;   /**< Index after last content entry in run. */
+} paragraph_layout_run_t;
+
+/**
+ * All of a paragraph's measured pieces, in document order.
+ */
+typedef struct paragraph_layout_segments_s {
+	paragraph_layout_item_t *items; /**< Measured pieces. */
+	size_t count; /**< Number of pieces in items. */
+	size_t alloc; /**< Number of pieces items has space for. */
+} paragraph_layout_segments_t;
+
+/**
+ * Text pieces that are measured together, once the paragraph is split.
+ *
+ * A single text piece, or text pieces from consecutive content entries
+ * measured as one.  Their words, and a space in their style, are measured
+ * in one batch with those of the other pieces.  If the client measures in
+ * batches, joined pieces also have the text up to the end of each piece but
+ * the last measured, to find where the pieces after them start.
+ */
+typedef struct paragraph_layout_pending_s {
+	size_t first; /**< Index of first piece. */
+	size_t last;  /**< Index of last piece. */
+	/** Byte offset of joined pieces' text in the layout's scratch text. */
+	size_t text;
+	size_t word;  /**< Index of words' measurement, or SIZE_MAX. */
+	size_t space; /**< Index of space's measurement, or SIZE_MAX. */
+	/** Index of first measurement of text up to a piece's end. */
+	size_t prefix;
+	size_t prefixes; /**< Number of measurements of text up to an end. */
+} paragraph_layout_pending_t;
+
+/**
+ * Cached measurement of a space or hyphen character in a given style.
+ */
+typedef struct paragraph_layout_space_s {
+	/** Style the character was measured in. */
+	const paragraph_style_t *style;
+	uint32_t width;    /**< Width of the character. */
+	uint32_t height;   /**< Height of the character. */
+	uint32_t baseline; /**< Baseline of the character. */
+} paragraph_layout_space_t;
+
+/**
+ * A laid out line.
+ */
+typedef struct paragraph_layout_line_s {
+	/** Index of content entry the line starts in. */
+	uint32_t entry;
+	size_t offset;     /**< Byte offset of line start in entry's text. */
+	size_t item;       /**< Index of line's first piece. */
+	size_t item_count; /**< Number of pieces on line. */
+	/** Available width the line was filled to. */
+	uint32_t available_width;
+	/** Offset of line from top of first line, if lines are stacked. */
+	uint32_t y;
+	uint32_t height; /**< Height of line. */
+	/** Whether the line's pieces are reordered for right-to-left text. */
+	bool reordered;
+	/** Index of the line's visual order in `visual`, if reordered. */
+	size_t visual;
+} paragraph_layout_line_t;
+
+/**
+ * The lines from a layout pass, and their pieces.
+ */
+typedef struct paragraph_layout_lines_s {
+	paragraph_layout_item_t *items; /**< Measured pieces. */
+	size_t item_count; /**< Number of pieces in items. */
+	size_t item_alloc; /**< Number of pieces items has space for. */
+
+	paragraph_layout_line_t *lines; /**< Lines. */
+	size_t line_count; /**< Number of lines in lines. */
+	size_t line_alloc; /**< Number of lines lines has space for. */
+
+	/**
+	 * Pieces of the reordered lines, in visual order, as indices from
+	 * each line's first piece.
+	 */
+	uint32_t *visual;
+	size_t visual_count; /**< Number of entries in visual. */
+	size_t visual_alloc; /**< Number of entries visual has space for. */
+} paragraph_layout_lines_t;
+
+/**
+ * Line layout state.
+ *
+ * Layout of a paragraph is performed one line per call.  This is the cursor
+ * that lets each call resume where the previous one stopped, so a complete
+ * pass over the paragraph visits each content entry once.
+ *
+ * The content is split into words and measured without regard to the
+ * available width, so the measured pieces are kept until the content they
+ * come from changes.  Lines are filled from them.
+ *
+ * The lines from the previous complete pass are kept.  Content changes
+ * since then affect a range of those lines, and the lines either side of
+ * that range are reused by the next pass, when it reaches them with the
+ * same available width.
+ */
 typedef struct paragraph_layout_s {
+	/** Whether a layout pass is underway. */
+	bool in_progress;
+
+	/** Cursor: index of next piece in `segs` to consume. */
+	size_t seg;
+
+	/** Measured pieces of all the content. */
+	paragraph_layout_segments_t segs;
+	/** Measured pieces from before the latest content change. */
+	paragraph_layout_segments_t old_segs;
+	/** Whether `segs` are for the content when the pass started. */
+	bool segs_valid;
+
+	/** Runs of text with the same style, found when `segs` were split. */
+	paragraph_layout_run_t *runs;
+	size_t run_count; /**< Number of runs in runs. */
+	size_t run_alloc; /**< Number of runs runs has space for. */
+
+	/** Scratch space for text measured across content entries. */
+	char *text;
+	size_t text_alloc; /**< Number of bytes text has space for. */
+
+	/** Text pieces split, but not yet measured. */
+	paragraph_layout_pending_t *pending;
+	size_t pending_count; /**< Number of entries in pending. */
+	size_t pending_alloc; /**< Number of entries pending has space for. */
+
+	/** Text to measure for the pending pieces, as one batch. */
+	paragraph_text_segment_t *measure;
+	size_t measure_count; /**< Number of pieces of text in measure. */
+	size_t measure_alloc; /**< Number of pieces measure has space for. */
+
+	/** Measurements of the text in measure. */
+	paragraph_text_metrics_t *metrics;
+	size_t metrics_alloc; /**< Number of entries metrics has space for. */
+
+	/**
+	 * Lines laid out so far in the current pass.  Pieces measured for a
+	 * word that did not fit on the last line follow the lines' pieces.
+	 */
+	paragraph_layout_lines_t cur;
+
+	/** Lines from the previous complete pass. */
+	paragraph_layout_lines_t prev;
+
+	/** Previous lines before this index are unaffected by changes. */
+	size_t reuse_end;
+	/**
+	 * Previous lines from this index are unaffected by changes, but the
+	 * indices of their content entries are shifted by `reuse_shift`.
+	 */
+	size_t reuse_start;
+	int64_t reuse_shift; /**< Content entry index shift for reuse. */
+	size_t reuse_next;   /**< Next previous line to consider for reuse. */
+
+	/** Number of content entries when `segs` were last updated. */
+	uint32_t count;
+
+	uint32_t *order;    /**< Scratch space for reordering a line. */
+	size_t order_alloc; /**< Number of pieces order has space for. */
+
+	paragraph_layout_space_t hyphen; /**< Most recent hyphen measurement. */
+	paragraph_layout_space_t strut; /**< Container style space metrics. */
 } paragraph_layout_t;
 
+/**
+ * Discard all layout, keeping allocations for reuse.
+ *
+ * \param[in]  layout  The layout object to reset.
+ */
+void paragraph__layout_reset(
+		paragraph_layout_t *layout);
+
 /**
  * Destroy all layout.
  *
@@ -27,4 +241,37 @@ typedef struct paragraph_layout_s {
 paragraph_err_t paragraph__layout_destroy(
 		paragraph_layout_t *layout);
 
+/**
+ * Use another paragraph's measured pieces, without copying them.
+ *
+ * Any pieces layout has are freed.  The pieces and style runs are then
+ * shared, until \ref paragraph__layout_own or \ref paragraph__layout_forget
+ * is called.  Lines aren't shared, so layout has none until it is laid out.
+ *
+ * \param[in]  layout  The layout to share into.
+ * \param[in]  src     The layout to share the pieces of.
+ */
+void paragraph__layout_share(
+		paragraph_layout_t *layout,
+		const paragraph_layout_t *src);
+
+/**
+ * Take a copy of shared measured pieces, so they can be changed.
+ *
+ * \param[in]  layout  The layout with shared pieces.  Unchanged on failure.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph__layout_own(
+		paragraph_layout_t *layout);
+
+/**
+ * Stop using shared measured pieces, without freeing them.
+ *
+ * Any lines laid out from them are discarded.
+ *
+ * \param[in]  layout  The layout with shared pieces.
+ */
+void paragraph__layout_forget(
+		paragraph_layout_t *layout);
+
 #endif
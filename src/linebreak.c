@@ -0,0 +1,1219 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Line break opportunity implementation.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <paragraph.h>
+
+#include "vec.h"
+#include "linebreak.h"
+#include "linebreak_data.h"
+#include "segment_data.h"
+#include "prop.h"
+#include "utf8.h"
+
+/** Number of bytes handled by each fast path step. */
+#define PARAGRAPH_LINEBREAK_CHUNK 16
+
+/**
+ * Line break analysis state.
+ */
+typedef struct paragraph_linebreak_state_s {
+	uint8_t prev;  /**< Class of the previous non-space character. */
+	uint8_t prev2; /**< Class before prev, if adjacent, otherwise WJ. */
+	bool spaces;   /**< Whether spaces follow prev. */
+	bool zwj;      /**< Whether the previous character was a ZWJ. */
+	bool sot;      /**< Whether nothing has been seen yet. */
+	uint32_t ri;   /**< Number of adjacent regional indicators to prev. */
+	uint8_t num;   /**< Progress through an LB25 number, ending at prev. */
+	bool op_pending; /**< Whether the break at op_pos is held back. */
+	size_t op_pos;   /**< Offset of an OP after PR or PO. */
+
+	uint8_t gcb;       /**< Grapheme cluster break class of previous. */
+	uint8_t gcb_emoji; /**< Progress through a GB11 emoji sequence. */
+	uint32_t gcb_ri;   /**< Number of adjacent RIs ending at previous. */
+
+	uint8_t wb;       /**< Word break class of previous, ignoring WB4. */
+	uint8_t wb_prev2; /**< Word break class before wb, ignoring WB4. */
+	uint8_t wb_lit;   /**< Word break class of the previous character. */
+	uint32_t wb_ri;   /**< Number of adjacent RIs ending at wb. */
+	bool wb_pending;  /**< Whether the boundary at wb_pos is held back. */
+	size_t wb_pos;    /**< Offset of the last character that isn't WB4's. */
+} paragraph_linebreak_state_t;
+
+/** GB11 emoji sequence progress: an Extended_Pictographic, and Extends. */
+#define PARAGRAPH_LINEBREAK_EMOJI 1
+
+/** GB11 emoji sequence progress: the sequence, and a ZWJ. */
+#define PARAGRAPH_LINEBREAK_EMOJI_ZWJ 2
+
+/** LB25 number progress: NU, then any of NU, SY and IS. */
+#define PARAGRAPH_LINEBREAK_NUMBER 1
+
+/** LB25 number progress: the number, and a CL or CP. */
+#define PARAGRAPH_LINEBREAK_NUMBER_CLOSE 2
+
+/** Mask of a word break class. */
+#define PARAGRAPH_LINEBREAK_WB(_wb) (1u << PARAGRAPH_WB_##_wb)
+
+/** Word break classes for AHLetter. */
+#define PARAGRAPH_LINEBREAK_WB_AH \
+	(PARAGRAPH_LINEBREAK_WB(LE) | PARAGRAPH_LINEBREAK_WB(HL))
+
+/** Word break classes for MidLetter and MidNumLetQ. */
+#define PARAGRAPH_LINEBREAK_WB_MQ (PARAGRAPH_LINEBREAK_WB(ML) | \
+	PARAGRAPH_LINEBREAK_WB(MB) | PARAGRAPH_LINEBREAK_WB(SQ))
+
+/** Word break classes for MidNum and MidNumLetQ. */
+#define PARAGRAPH_LINEBREAK_WB_NQ (PARAGRAPH_LINEBREAK_WB(MN) | \
+	PARAGRAPH_LINEBREAK_WB(MB) | PARAGRAPH_LINEBREAK_WB(SQ))
+
+/** Word break classes of hard line breaks. */
+#define PARAGRAPH_LINEBREAK_WB_HARD (PARAGRAPH_LINEBREAK_WB(CR) | \
+	PARAGRAPH_LINEBREAK_WB(LF) | PARAGRAPH_LINEBREAK_WB(NL))
+
+/** Word break classes that WB4 ignores. */
+#define PARAGRAPH_LINEBREAK_WB_IGNORE (PARAGRAPH_LINEBREAK_WB(EXTEND) | \
+	PARAGRAPH_LINEBREAK_WB(FO) | PARAGRAPH_LINEBREAK_WB(ZWJ))
+
+/**
+ * Check whether a word break class is in a set.
+ *
+ * \param[in]  wb   The word break class.
+ * \param[in]  set  Mask of word break classes.
+ * \return true if the class is in the set.
+ */
+static inline bool paragraph__linebreak_wb_in(
+		uint8_t wb,
+		unsigned set)
+{
+	return (set >> wb) & 1;
+}
+
+/**
+ * Set a bit in a bitset.
+ *
+ * \param[in]  bits  The bitset to update.
+ * \param[in]  pos   Index of the bit to set.
+ */
+static inline void paragraph__linebreak_set_bit(
+		uint64_t *bits,
+		size_t pos)
+{
+	bits[pos / 64] |= (uint64_t)1 << (pos % 64);
+}
+
+/**
+ * Advance the grapheme cluster analysis over a character.
+ *
+ * \param[in]  st   The analysis state.
+ * \param[in]  gcb  The character's grapheme cluster break class.
+ * \return true if a grapheme cluster starts at the character.
+ */
+static inline bool paragraph__linebreak_grapheme_step(
+		paragraph_linebreak_state_t *st,
+		uint8_t gcb)
+{
+	uint8_t prev = st->gcb;
+	bool brk = paragraph_gcb_pair[prev][gcb];
+
+	/* GB11: Don't break within emoji ZWJ sequences. */
+	if (prev == PARAGRAPH_GCB_ZWJ && gcb == PARAGRAPH_GCB_EP &&
+			st->gcb_emoji == PARAGRAPH_LINEBREAK_EMOJI_ZWJ) {
+		brk = false;
+	}
+
+	/* GB12, GB13: Break between pairs of regional indicators. */
+	if (prev == PARAGRAPH_GCB_RI && gcb == PARAGRAPH_GCB_RI) {
+		brk = (st->gcb_ri % 2 == 0);
+	}
+
+	if (gcb == PARAGRAPH_GCB_EP) {
+		st->gcb_emoji = PARAGRAPH_LINEBREAK_EMOJI;
+	} else if (gcb == PARAGRAPH_GCB_ZWJ &&
+			st->gcb_emoji == PARAGRAPH_LINEBREAK_EMOJI) {
+		st->gcb_emoji = PARAGRAPH_LINEBREAK_EMOJI_ZWJ;
+	} else if (gcb != PARAGRAPH_GCB_EX ||
+			st->gcb_emoji != PARAGRAPH_LINEBREAK_EMOJI) {
+		st->gcb_emoji = 0;
+	}
+	st->gcb_ri = (gcb == PARAGRAPH_GCB_RI) ?
+			(prev == PARAGRAPH_GCB_RI ? st->gcb_ri + 1 : 1) : 0;
+	st->gcb = gcb;
+
+	return brk;
+}
+
+/**
+ * Check whether characters either side of a word break class join.
+ *
+ * This is WB7, WB7c and WB11, for a character after one that may join.
+ *
+ * \param[in]  st  The analysis state.
+ * \param[in]  wb  The word break class of the character after.
+ * \return true if there is no word boundary before the previous character
+ *         or this one.
+ */
+static inline bool paragraph__linebreak_word_joined(
+		const paragraph_linebreak_state_t *st,
+		uint8_t wb)
+{
+	uint8_t prev = st->wb;
+	uint8_t prev2 = st->wb_prev2;
+
+	if (paragraph__linebreak_wb_in(prev2, PARAGRAPH_LINEBREAK_WB_AH) &&
+	    paragraph__linebreak_wb_in(prev, PARAGRAPH_LINEBREAK_WB_MQ) &&
+	    paragraph__linebreak_wb_in(wb, PARAGRAPH_LINEBREAK_WB_AH)) {
+		return true;
+	}
+	if (prev2 == PARAGRAPH_WB_HL && prev == PARAGRAPH_WB_DQ &&
+			wb == PARAGRAPH_WB_HL) {
+		return true;
+	}
+	return prev2 == PARAGRAPH_WB_NU &&
+			paragraph__linebreak_wb_in(prev,
+					PARAGRAPH_LINEBREAK_WB_NQ) &&
+			wb == PARAGRAPH_WB_NU;
+}
+
+/**
+ * Check whether a word boundary depends on the next character.
+ *
+ * This is WB6, WB7b and WB12, which apply if the next character joins.
+ *
+ * \param[in]  prev  Word break class of the character before the boundary.
+ * \param[in]  wb    Word break class of the character after it.
+ * \return true if the boundary may be removed by the next character.
+ */
+static inline bool paragraph__linebreak_word_joins(
+		uint8_t prev,
+		uint8_t wb)
+{
+	if (paragraph__linebreak_wb_in(prev, PARAGRAPH_LINEBREAK_WB_AH) &&
+	    paragraph__linebreak_wb_in(wb, PARAGRAPH_LINEBREAK_WB_MQ)) {
+		return true;
+	}
+	if (prev == PARAGRAPH_WB_HL && wb == PARAGRAPH_WB_DQ) {
+		return true;
+	}
+	return prev == PARAGRAPH_WB_NU && paragraph__linebreak_wb_in(wb,
+			PARAGRAPH_LINEBREAK_WB_NQ);
+}
+
+/**
+ * Advance the word analysis over a character.
+ *
+ * A boundary held back from a previous character is set in the bitset
+ * if the character shows that there is one.
+ *
+ * \param[in]  st    The analysis state.
+ * \param[in]  wb    The character's word break class.
+ * \param[in]  ep    Whether the character is Extended_Pictographic.
+ * \param[in]  pos   Byte offset of the character in the paragraph text.
+ * \param[in]  bits  The word boundary bitset.
+ * \return true if there is a word boundary before the character.
+ */
+static inline bool paragraph__linebreak_word_step(
+		paragraph_linebreak_state_t *st,
+		uint8_t wb,
+		bool ep,
+		size_t pos,
+		uint64_t *bits)
+{
+	uint8_t lit = st->wb_lit;
+	uint8_t prev = st->wb;
+	bool joined;
+	bool brk;
+
+	st->wb_lit = wb;
+
+	/* WB3, WB3a, WB3b: Hard line breaks are words of their own. */
+	if (paragraph__linebreak_wb_in(lit, PARAGRAPH_LINEBREAK_WB_HARD) ||
+	    paragraph__linebreak_wb_in(wb, PARAGRAPH_LINEBREAK_WB_HARD)) {
+		if (st->wb_pending) {
+			paragraph__linebreak_set_bit(bits, st->wb_pos);
+			st->wb_pending = false;
+		}
+		st->wb = wb;
+		st->wb_prev2 = PARAGRAPH_WB_XX;
+		st->wb_ri = (wb == PARAGRAPH_WB_RI);
+		st->wb_pos = pos;
+		return lit != PARAGRAPH_WB_CR || wb != PARAGRAPH_WB_LF;
+	}
+
+	/* WB4: Extend, Format and ZWJ belong to the character before. */
+	if (paragraph__linebreak_wb_in(wb, PARAGRAPH_LINEBREAK_WB_IGNORE)) {
+		return false;
+	}
+
+	joined = paragraph__linebreak_word_joined(st, wb);
+	if (st->wb_pending) {
+		if (!joined) {
+			paragraph__linebreak_set_bit(bits, st->wb_pos);
+		}
+		st->wb_pending = false;
+	}
+
+	brk = !joined && paragraph_wb_pair[prev][wb];
+
+	/* WB15, WB16: Break between pairs of regional indicators. */
+	if (prev == PARAGRAPH_WB_RI && wb == PARAGRAPH_WB_RI) {
+		brk = (st->wb_ri % 2 == 0);
+	}
+
+	/* WB3c: Don't break within emoji ZWJ sequences.  WB3d: Keep
+	 * horizontal white space together. */
+	if ((lit == PARAGRAPH_WB_ZWJ && ep) ||
+	    (lit == PARAGRAPH_WB_WSEGSPACE && wb == PARAGRAPH_WB_WSEGSPACE)) {
+		brk = false;
+	}
+
+	/* WB6, WB7b, WB12: Hold the boundary back until the next character
+	 * shows whether the characters either side of this one join. */
+	if (brk && paragraph__linebreak_word_joins(prev, wb)) {
+		st->wb_pending = true;
+		brk = false;
+	}
+
+	st->wb_ri = (wb == PARAGRAPH_WB_RI) ?
+			(prev == PARAGRAPH_WB_RI ? st->wb_ri + 1 : 1) : 0;
+	st->wb_prev2 = prev;
+	st->wb = wb;
+	st->wb_pos = pos;
+
+	return brk;
+}
+
+/**
+ * Advance the grapheme cluster and word analysis over a character.
+ *
+ * \param[in]  st   The analysis state.
+ * \param[in]  gcb  The character's grapheme cluster break class.
+ * \param[in]  wb   The character's word break class.
+ * \param[in]  pos  Byte offset of the character in the paragraph text.
+ * \param[in]  lb   The analysis to set boundaries in.
+ */
+static inline void paragraph__linebreak_segment(
+		paragraph_linebreak_state_t *st,
+		uint8_t gcb,
+		uint8_t wb,
+		size_t pos,
+		paragraph_linebreak_t *lb)
+{
+	if (paragraph__linebreak_grapheme_step(st, gcb)) {
+		paragraph__linebreak_set_bit(lb->grapheme_bits, pos);
+	}
+	if (paragraph__linebreak_word_step(st, wb, gcb == PARAGRAPH_GCB_EP,
+			pos, lb->word_bits)) {
+		paragraph__linebreak_set_bit(lb->word_bits, pos);
+	}
+}
+
+/**
+ * Advance the analysis over a character.
+ *
+ * A break held back from a previous character is set in the bitset if
+ * the character shows that there is one.
+ *
+ * \param[in]  st    The analysis state.
+ * \param[in]  cls   The character's line break class.
+ * \param[in]  pos   Byte offset of the character in the paragraph text.
+ * \param[in]  bits  The break opportunity bitset.
+ * \return true if there is a break opportunity before the character.
+ */
+static inline bool paragraph__linebreak_step(
+		paragraph_linebreak_state_t *st,
+		uint8_t cls,
+		size_t pos,
+		uint64_t *bits)
+{
+	uint8_t prev = st->prev;
+	bool zwj = st->zwj;
+	uint8_t num;
+	bool brk;
+
+	/* LB25: PR and PO join an OP that is followed by a number.  LB9:
+	 * Combining marks take the class of the OP. */
+	if (st->op_pending && cls != PARAGRAPH_LB_CM &&
+			cls != PARAGRAPH_LB_ZWJ) {
+		if (cls != PARAGRAPH_LB_NU) {
+			paragraph__linebreak_set_bit(bits, st->op_pos);
+		}
+		st->op_pending = false;
+	}
+
+	st->zwj = (cls == PARAGRAPH_LB_ZWJ);
+
+	/* LB4, LB5: Always break after hard line breaks. */
+	if (prev == PARAGRAPH_LB_BK || prev == PARAGRAPH_LB_LF ||
+	    prev == PARAGRAPH_LB_NL ||
+	    (prev == PARAGRAPH_LB_CR && cls != PARAGRAPH_LB_LF)) {
+		st->sot = true;
+		st->spaces = false;
+		brk = true;
+	} else {
+		brk = false;
+	}
+
+	switch (cls) {
+	case PARAGRAPH_LB_BK:
+	case PARAGRAPH_LB_CR:
+	case PARAGRAPH_LB_LF:
+	case PARAGRAPH_LB_NL:
+		/* LB6: Don't break before hard line breaks. */
+		st->prev = cls;
+		st->spaces = false;
+		st->sot = false;
+		return brk;
+
+	case PARAGRAPH_LB_SP:
+		/* LB7: Don't break before spaces. */
+		if (brk) {
+			st->prev = PARAGRAPH_LB_WJ;
+		}
+		st->spaces = true;
+		return brk;
+
+	case PARAGRAPH_LB_CM:
+	case PARAGRAPH_LB_ZWJ:
+		/* LB9: Combining marks take the class of their base.  LB10:
+		 * Otherwise, treat them as AL. */
+		if (!st->sot && !st->spaces && prev != PARAGRAPH_LB_ZW) {
+			return false;
+		}
+		cls = PARAGRAPH_LB_AL;
+		break;
+
+	default:
+		break;
+	}
+
+	if (brk || st->sot) {
+		/* LB2: Never break at the start of text. */
+		st->prev2 = PARAGRAPH_LB_WJ;
+		st->ri = 0;
+		st->num = 0;
+		prev = PARAGRAPH_LB_WJ;
+	}
+
+	if (!brk) {
+		brk = paragraph_lb_pair[prev][cls] & (st->spaces ?
+				PARAGRAPH_LB_SPACED : PARAGRAPH_LB_DIRECT);
+
+		if (!st->spaces) {
+			/* LB8a: Don't break after ZWJ. */
+			if (zwj) {
+				brk = false;
+			}
+
+			/* LB21a: Don't break after Hebrew + hyphen. */
+			if ((prev == PARAGRAPH_LB_HY ||
+			     prev == PARAGRAPH_LB_BA) &&
+			    st->prev2 == PARAGRAPH_LB_HL) {
+				brk = false;
+			}
+
+			/* LB25: Don't break within numbers. */
+			if (st->num == PARAGRAPH_LINEBREAK_NUMBER &&
+					cls == PARAGRAPH_LB_NU) {
+				brk = false;
+			}
+			if (st->num != 0 && (cls == PARAGRAPH_LB_PR ||
+					cls == PARAGRAPH_LB_PO)) {
+				brk = false;
+			}
+			if (brk && (prev == PARAGRAPH_LB_PR ||
+					prev == PARAGRAPH_LB_PO) &&
+					(cls == PARAGRAPH_LB_OP ||
+					 cls == PARAGRAPH_LB_OP_EA)) {
+				st->op_pending = true;
+				st->op_pos = pos;
+				brk = false;
+			}
+
+			/* LB30a: Break between pairs of regional indicators. */
+			if (prev == PARAGRAPH_LB_RI && cls == PARAGRAPH_LB_RI) {
+				brk = (st->ri % 2 == 0);
+			}
+		}
+	}
+
+	num = st->spaces ? 0 : st->num;
+	if (cls == PARAGRAPH_LB_NU) {
+		st->num = PARAGRAPH_LINEBREAK_NUMBER;
+	} else if (num == PARAGRAPH_LINEBREAK_NUMBER &&
+			(cls == PARAGRAPH_LB_SY || cls == PARAGRAPH_LB_IS)) {
+		st->num = PARAGRAPH_LINEBREAK_NUMBER;
+	} else if (num == PARAGRAPH_LINEBREAK_NUMBER &&
+			(cls == PARAGRAPH_LB_CL || cls == PARAGRAPH_LB_CP ||
+			 cls == PARAGRAPH_LB_CP_EA)) {
+		st->num = PARAGRAPH_LINEBREAK_NUMBER_CLOSE;
+	} else {
+		st->num = 0;
+	}
+
+	if (cls == PARAGRAPH_LB_RI) {
+		st->ri = (prev == PARAGRAPH_LB_RI && !st->spaces) ?
+				st->ri + 1 : 1;
+	}
+	st->prev2 = st->spaces ? PARAGRAPH_LB_WJ : prev;
+	st->prev = cls;
+	st->spaces = false;
+	st->sot = false;
+
+	return brk;
+}
+
+/**
+ * Set break opportunity bits.
+ *
+ * \param[in]  bits  The bitset to update.
+ * \param[in]  pos   Bit index to set mask at.
+ * \param[in]  mask  Bits to set, from pos onwards.
+ */
+static inline void paragraph__linebreak_set(
+		uint64_t *bits,
+		size_t pos,
+		uint64_t mask)
+{
+	unsigned shift = pos % 64;
+
+	bits[pos / 64] |= mask << shift;
+	if (shift != 0) {
+		bits[pos / 64 + 1] |= mask >> (64 - shift);
+	}
+}
+
+#ifdef __SSE2__
+/**
+ * Get a mask of bytes in a range.
+ *
+ * \param[in]  x      The bytes to test.
+ * \param[in]  first  The first byte in the range.
+ * \param[in]  count  The number of bytes in the range.
+ * \return mask with a bit set for each byte in the range.
+ */
+static inline unsigned paragraph__linebreak_range(
+		__m128i x,
+		uint8_t first,
+		uint8_t count)
+{
+	/* Bias, so an unsigned range check is a signed comparison. */
+	__m128i t = _mm_sub_epi8(x, _mm_set1_epi8((char)(first + 0x80)));
+
+	return _mm_movemask_epi8(_mm_cmplt_epi8(t,
+			_mm_set1_epi8((char)(count - 0x80))));
+}
+
+/**
+ * Get a mask of bytes with a given value.
+ *
+ * \param[in]  x  The bytes to test.
+ * \param[in]  c  The byte value to test for.
+ * \return mask with a bit set for each byte equal to c.
+ */
+static inline unsigned paragraph__linebreak_eq(
+		__m128i x,
+		uint8_t c)
+{
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8((char)c)));
+}
+
+/**
+ * Get a mask of the simple bytes in 16 bytes of text.
+ *
+ * Simple text is made of spaces, and characters of classes AL, NU, QU and
+ * IS.  Of these, only ASCII and Latin-1 letters are detected.
+ *
+ * \param[in]  x       The bytes to classify.
+ * \param[out] sp_out  Returns mask of spaces.
+ * \param[out] is_out  Returns mask of IS characters.
+ * \return mask of simple bytes.
+ */
+static inline unsigned paragraph__linebreak_classify(
+		__m128i x,
+		unsigned *sp_out,
+		unsigned *is_out)
+{
+	unsigned sp = paragraph__linebreak_eq(x, ' ');
+	unsigned is = paragraph__linebreak_eq(x, ',') |
+			paragraph__linebreak_eq(x, '.') |
+			paragraph__linebreak_range(x, ':', 2);
+	unsigned al = paragraph__linebreak_range(x, '@', 27) |
+			paragraph__linebreak_range(x, '^', 29) |
+			paragraph__linebreak_range(x, '<', 3) |
+			paragraph__linebreak_eq(x, '#') |
+			paragraph__linebreak_eq(x, '&') |
+			paragraph__linebreak_eq(x, '*') |
+			paragraph__linebreak_eq(x, '~');
+	unsigned nu = paragraph__linebreak_range(x, '0', 10);
+	unsigned qu = paragraph__linebreak_eq(x, '"') |
+			paragraph__linebreak_eq(x, '\'');
+	unsigned lead = paragraph__linebreak_eq(x, 0xC3);
+	unsigned cont = paragraph__linebreak_range(x, 0x80, 0x40);
+
+	/* Latin-1 letters are U+00C0 to U+00FF: 0xC3 followed by a
+	 * continuation byte.  Only count continuation bytes that follow
+	 * 0xC3, and lead bytes that are followed by a continuation byte. */
+	cont &= lead << 1;
+	lead &= cont >> 1;
+
+	*sp_out = sp;
+	*is_out = is;
+	return sp | is | al | nu | qu | lead | cont;
+}
+
+/**
+ * Get the word break class of the simple character ending at a byte.
+ *
+ * \param[in]  s    The text.
+ * \param[in]  end  Byte offset after the character.
+ * \return the character's word break class.
+ */
+static inline uint8_t paragraph__linebreak_simple_wb(
+		const uint8_t *s,
+		size_t end)
+{
+	uint32_t cp = s[end - 1];
+
+	if (cp >= 0x80) {
+		cp = (uint32_t)(s[end - 2] & 0x1F) << 6 | (cp & 0x3F);
+	}
+
+	return paragraph_prop__get(cp)->wb;
+}
+
+/**
+ * Find word boundaries in simple text.
+ *
+ * Letters, digits and underscores join, as do spaces.  So do letters
+ * either side of a MidLetter or MidNumLetQ, and digits either side of a
+ * MidNum or MidNumLetQ.  Everything else is a word of its own.  The caller
+ * makes sure the last character doesn't depend on what follows.
+ *
+ * \param[in]  st     The analysis state, for the characters before.
+ * \param[in]  x      The bytes to find word boundaries in.
+ * \param[in]  valid  Mask of the simple bytes.
+ * \param[in]  cont   Mask of Latin-1 continuation bytes.
+ * \return mask of the bytes with a word boundary before them.
+ */
+static inline unsigned paragraph__linebreak_simple_words(
+		const paragraph_linebreak_state_t *st,
+		__m128i x,
+		unsigned valid,
+		unsigned cont)
+{
+	unsigned sign = paragraph__linebreak_eq(x, 0x97) |
+			paragraph__linebreak_eq(x, 0xB7);
+	unsigned letter = paragraph__linebreak_range(x, 'A', 26) |
+			paragraph__linebreak_range(x, 'a', 26) |
+			cont | cont >> 1;
+	unsigned digit = paragraph__linebreak_range(x, '0', 10) & valid;
+	unsigned space = paragraph__linebreak_eq(x, ' ') & valid;
+	unsigned mb = (paragraph__linebreak_eq(x, '.') |
+			paragraph__linebreak_eq(x, '\'')) & valid;
+	unsigned mq = mb | (paragraph__linebreak_eq(x, ':') & valid);
+	unsigned nq = mb | ((paragraph__linebreak_eq(x, ',') |
+			paragraph__linebreak_eq(x, ';')) & valid);
+	unsigned word, joined;
+	unsigned p_ah = paragraph__linebreak_wb_in(st->wb,
+			PARAGRAPH_LINEBREAK_WB_AH);
+	unsigned p2_ah = paragraph__linebreak_wb_in(st->wb_prev2,
+			PARAGRAPH_LINEBREAK_WB_AH);
+	unsigned p_nu = (st->wb == PARAGRAPH_WB_NU);
+	unsigned p2_nu = (st->wb_prev2 == PARAGRAPH_WB_NU);
+
+	/* U+00D7 and U+00F7 are the Latin-1 characters that aren't letters. */
+	sign &= cont;
+	letter &= ~(sign | sign >> 1) & valid;
+	word = letter | digit | (paragraph__linebreak_eq(x, '_') & valid);
+
+	joined = (((word << 1) |
+			paragraph__linebreak_wb_in(st->wb,
+					PARAGRAPH_LINEBREAK_WB_AH |
+					PARAGRAPH_LINEBREAK_WB(NU) |
+					PARAGRAPH_LINEBREAK_WB(EX))) & word) |
+		(((space << 1) |
+			(st->wb_lit == PARAGRAPH_WB_WSEGSPACE)) & space) |
+		(((letter << 1) | p_ah) & mq & letter >> 1) |
+		(((letter << 2) | p_ah << 1 | p2_ah) &
+			((mq << 1) | paragraph__linebreak_wb_in(st->wb,
+					PARAGRAPH_LINEBREAK_WB_MQ)) & letter) |
+		(((digit << 2) | p_nu << 1 | p2_nu) &
+			((nq << 1) | paragraph__linebreak_wb_in(st->wb,
+					PARAGRAPH_LINEBREAK_WB_NQ)) & digit) |
+		(((digit << 1) | p_nu) & nq & digit >> 1);
+
+	/* WB7a, WB13a: After a Hebrew letter or Katakana. */
+	if (st->wb == PARAGRAPH_WB_HL) {
+		joined |= paragraph__linebreak_eq(x, '\'') & 1;
+	} else if (st->wb == PARAGRAPH_WB_KA) {
+		joined |= paragraph__linebreak_eq(x, '_') & 1;
+	}
+
+	return valid & ~cont & ~joined;
+}
+
+/**
+ * Find the breaks between IS and digits in simple text.
+ *
+ * In simple text, LB25 numbers are digits followed by any digits and IS.
+ * There is a break between IS and a digit, unless the IS is in a number.
+ *
+ * \param[in]  st       The analysis state, for the characters before.
+ * \param[in]  x        The bytes to find breaks in.
+ * \param[in]  valid    Mask of the simple bytes.
+ * \param[in]  is       Mask of IS characters.
+ * \param[out] num_out  Returns mask of the characters in numbers.
+ * \return mask of the digits with a break before them.
+ */
+static inline unsigned paragraph__linebreak_simple_numbers(
+		const paragraph_linebreak_state_t *st,
+		__m128i x,
+		unsigned valid,
+		unsigned is,
+		unsigned *num_out)
+{
+	unsigned digit = paragraph__linebreak_range(x, '0', 10) & valid;
+	unsigned in = (st->num == PARAGRAPH_LINEBREAK_NUMBER && !st->spaces);
+	unsigned after_is = (is << 1) |
+			(st->prev == PARAGRAPH_LB_IS && !st->spaces);
+	unsigned num = digit;
+	unsigned prev;
+
+	/* Extend the numbers over the IS that follow them, one character
+	 * at a time.  Runs of IS are short. */
+	do {
+		prev = num;
+		num |= is & ((num << 1) | in);
+	} while (num != prev);
+
+	*num_out = num;
+	return digit & after_is & ~((num << 1) | in);
+}
+
+/**
+ * Find break opportunities in simple text, 16 bytes at a time.
+ *
+ * None of the classes in simple text prevent a break after spaces, except
+ * that there is no break before IS.  And none allow a break between them
+ * when they are adjacent, except between IS and a digit that isn't part
+ * of a number.  So there are break opportunities only before each
+ * non-space, non-IS character that follows a space, and before those
+ * digits.
+ *
+ * Each character in simple text is a grapheme cluster of its own.
+ *
+ * Stops at the first character that isn't simple, and before any final
+ * punctuation whose word boundaries depend on what follows.
+ *
+ * \param[in]  st   The analysis state.
+ * \param[in]  s    The text to analyse.
+ * \param[in]  len  Number of bytes at s.
+ * \param[in]  pos  Byte offset of s in the paragraph text.
+ * \param[in]  lb   The analysis to set break opportunities in.
+ * \return the number of bytes analysed.
+ */
+static size_t paragraph__linebreak_simple(
+		paragraph_linebreak_state_t *st,
+		const uint8_t *s,
+		size_t len,
+		size_t pos,
+		paragraph_linebreak_t *lb)
+{
+	size_t i = 0;
+
+	if (st->zwj || st->wb_pending || (st->prev != PARAGRAPH_LB_AL &&
+			st->prev != PARAGRAPH_LB_NU &&
+			st->prev != PARAGRAPH_LB_QU &&
+			st->prev != PARAGRAPH_LB_IS)) {
+		return 0;
+	}
+
+	while (len - i >= PARAGRAPH_LINEBREAK_CHUNK) {
+		__m128i x = _mm_loadu_si128((const __m128i *)(s + i));
+		unsigned sp, is, ns, valid, last, cont, starts, num, brk;
+		unsigned simple = paragraph__linebreak_classify(x, &sp, &is);
+		unsigned n = __builtin_ctz(~simple);
+		size_t end;
+
+		if (n == 0) {
+			break;
+		}
+
+		/* Don't split a Latin-1 letter at the end of the chunk. */
+		if (s[i + n - 1] == 0xC3) {
+			if (--n == 0) {
+				break;
+			}
+		}
+
+		/* Leave punctuation that may join the characters either side
+		 * of it for the next chunk, which can see what follows. */
+		if (strchr(":.',;\"", s[i + n - 1]) != NULL) {
+			if (--n == 0) {
+				break;
+			}
+		}
+
+		valid = (1u << n) - 1;
+		sp &= valid;
+		is &= valid;
+		ns = ~sp & valid;
+		cont = paragraph__linebreak_range(x, 0x80, 0x40) & valid;
+		starts = valid & ~cont;
+
+		brk = paragraph__linebreak_simple_numbers(st, x,
+				valid, is, &num);
+		paragraph__linebreak_set(lb->bits, pos + i,
+				(ns & ~is & ((sp << 1) | st->spaces)) | brk);
+
+		if (!paragraph_gcb_pair[st->gcb][PARAGRAPH_GCB_XX]) {
+			starts &= ~1u;
+		}
+		paragraph__linebreak_set(lb->grapheme_bits, pos + i, starts);
+		paragraph__linebreak_set(lb->word_bits, pos + i,
+				paragraph__linebreak_simple_words(st, x,
+						valid, cont));
+
+		if (ns == 0) {
+			st->spaces = true;
+		} else {
+			last = 31 - __builtin_clz(ns);
+			st->spaces = (sp >> last) != 0;
+			st->prev = s[i + last] < 0x80 ?
+					paragraph_prop__get(s[i + last])->lb :
+					PARAGRAPH_LB_AL;
+			st->prev2 = PARAGRAPH_LB_WJ;
+			st->ri = 0;
+			st->num = ((num >> last) & 1) ?
+					PARAGRAPH_LINEBREAK_NUMBER : 0;
+		}
+
+		last = 31 - __builtin_clz(valid & ~cont);
+		end = i + n;
+		st->wb_prev2 = last > 0 ?
+				paragraph__linebreak_simple_wb(s, i + last) :
+				st->wb;
+		st->wb = paragraph__linebreak_simple_wb(s, end);
+		st->wb_lit = st->wb;
+		st->wb_ri = 0;
+		st->gcb = PARAGRAPH_GCB_XX;
+		st->gcb_emoji = 0;
+		st->gcb_ri = 0;
+
+		i = end;
+		if (n < PARAGRAPH_LINEBREAK_CHUNK) {
+			break;
+		}
+	}
+
+	return i;
+}
+#endif
+
+/**
+ * Find break opportunities and boundaries in a content entry's text.
+ *
+ * \param[in]  st    The analysis state.
+ * \param[in]  s     The entry's text.
+ * \param[in]  len   Byte length of the entry's text.
+ * \param[in]  utf8  The entry text's \ref paragraph_utf8_e.
+ * \param[in]  pos   Byte offset of the entry's text in the paragraph text.
+ * \param[in]  lb    The analysis to set break opportunities in.
+ */
+static void paragraph__linebreak_text(
+		paragraph_linebreak_state_t *st,
+		const uint8_t *s,
+		size_t len,
+		uint8_t utf8,
+		size_t pos,
+		paragraph_linebreak_t *lb)
+{
+	size_t simple = 0;
+	size_t i = 0;
+
+	while (i < len) {
+		const paragraph_prop_t *prop;
+		uint32_t cp;
+		size_t n;
+
+#ifdef __SSE2__
+		if (i >= simple) {
+			size_t done = paragraph__linebreak_simple(st,
+					s + i, len - i, pos + i, lb);
+
+			i += done;
+			if (i == len) {
+				break;
+			}
+
+			/* Back off while the text isn't simple. */
+			simple = done > 0 ? i :
+					i + PARAGRAPH_LINEBREAK_CHUNK / 2;
+		}
+#else
+		(void)(simple);
+#endif
+
+		if (s[i] < 0x80) {
+			cp = s[i];
+			n = 1;
+		} else if (utf8 == PARAGRAPH_UTF8_VALID) {
+			cp = paragraph_utf8__decode_valid(s + i, &n);
+		} else {
+			cp = paragraph_utf8__decode(s + i, len - i, &n);
+		}
+		prop = paragraph_prop__get(cp);
+		if (paragraph__linebreak_step(st, prop->lb,
+				pos + i, lb->bits)) {
+			paragraph__linebreak_set(lb->bits, pos + i, 1);
+		}
+		paragraph__linebreak_segment(st, prop->gcb, prop->wb,
+				pos + i, lb);
+		i += n;
+	}
+}
+
+/**
+ * Ensure a bitset has space for a given length of text.
+ *
+ * There is always an extra word, so any 64 bits can be read.
+ *
+ * \param[in]  bits   The bitset to grow.
+ * \param[in]  alloc  The number of words the bitset has space for.
+ * \param[in]  len    The byte length of the text.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__linebreak_ensure(
+		uint64_t **bits,
+		size_t *alloc,
+		size_t len)
+{
+	size_t words = len / 64 + 2;
+	uint64_t *grown;
+
+	if (words <= *alloc) {
+		return PARAGRAPH_OK;
+	}
+
+	grown = realloc(*bits, words * sizeof(*grown));
+	if (grown == NULL) {
+		return PARAGRAPH_ERR_OOM;
+	}
+
+	*bits = grown;
+	*alloc = words;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Get 64 bits from a bitset.
+ *
+ * \param[in]  bits  The bitset.
+ * \param[in]  pos   Index of the first bit to get.
+ * \return the bits from pos onwards.
+ */
+static inline uint64_t paragraph__linebreak_get(
+		const uint64_t *bits,
+		size_t pos)
+{
+	unsigned shift = pos % 64;
+	uint64_t v = bits[pos / 64] >> shift;
+
+	if (shift != 0) {
+		v |= bits[pos / 64 + 1] << (64 - shift);
+	}
+
+	return v;
+}
+
+/**
+ * Find the last break opportunity that changed in unchanged text.
+ *
+ * \param[in]  lb       The line break opportunities.
+ * \param[in]  from     Byte offset of the unchanged text that ends the
+ *                      paragraph.
+ * \param[out] pos_out  Returns the offset of the last changed break
+ *                      opportunity, if any.
+ * \return true if a break opportunity changed, false otherwise.
+ */
+static bool paragraph__linebreak_changed(
+		const paragraph_linebreak_t *lb,
+		size_t from,
+		size_t *pos_out)
+{
+	size_t old_from = lb->old_len - (lb->len - from);
+	size_t end = lb->len;
+
+	while (end > from) {
+		size_t start = end - from > 64 ? end - 64 : from;
+		uint64_t diff = paragraph__linebreak_get(lb->bits, start) ^
+				paragraph__linebreak_get(lb->old,
+						old_from + (start - from));
+
+		if (end - start < 64) {
+			diff &= ((uint64_t)1 << (end - start)) - 1;
+		}
+		if (diff != 0) {
+			*pos_out = start + 63 - __builtin_clzll(diff);
+			return true;
+		}
+		end = start;
+	}
+
+	return false;
+}
+
+/* Internally exported function, documented in `src/linebreak.h` */
+paragraph_err_t paragraph_linebreak__update(
+		paragraph_linebreak_t *lb,
+		paragraph_content_t *content)
+{
+	paragraph_linebreak_state_t st = {
+		.prev = PARAGRAPH_LB_WJ,
+		.prev2 = PARAGRAPH_LB_WJ,
+		.sot = true,
+		.gcb = PARAGRAPH_GCB_CN,
+		.wb = PARAGRAPH_WB_LF,
+		.wb_prev2 = PARAGRAPH_WB_XX,
+		.wb_lit = PARAGRAPH_WB_LF,
+	};
+	bool compare = lb->valid;
+	paragraph_err_t err;
+	uint64_t *swap;
+	size_t at = 0;
+	size_t pos;
+
+	if (lb->valid && !content->dirty.dirty) {
+		return PARAGRAPH_OK;
+	}
+
+	/* Keep the previous analysis to compare with. */
+	swap = lb->old;
+	lb->old = lb->bits;
+	lb->bits = swap;
+	pos = lb->old_alloc;
+	lb->old_alloc = lb->alloc;
+	lb->alloc = pos;
+	lb->old_len = lb->len;
+	lb->valid = false;
+
+	err = paragraph__linebreak_ensure(&lb->bits, &lb->alloc,
+			content->len);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+	err = paragraph__linebreak_ensure(&lb->grapheme_bits,
+			&lb->grapheme_alloc, content->len);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+	err = paragraph__linebreak_ensure(&lb->word_bits,
+			&lb->word_alloc, content->len);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+	memset(lb->bits, 0, (content->len / 64 + 2) * sizeof(*lb->bits));
+	memset(lb->grapheme_bits, 0, (content->len / 64 + 2) *
+			sizeof(*lb->grapheme_bits));
+	memset(lb->word_bits, 0, (content->len / 64 + 2) *
+			sizeof(*lb->word_bits));
+	lb->len = content->len;
+
+	for (uint32_t i = 0; i < content->count; i++) {
+		switch (content->type[i]) {
+		case PARAGRAPH_CONTENT_TEXT:
+			paragraph__linebreak_text(&st,
+					(const uint8_t *)content->cold[i].data,
+					content->text_len[i],
+					content->cold[i].utf8,
+					at, lb);
+			break;
+
+		case PARAGRAPH_CONTENT_REPLACED:
+			(void) paragraph__linebreak_step(&st,
+					PARAGRAPH_LB_CB, at, lb->bits);
+			paragraph__linebreak_segment(&st, PARAGRAPH_GCB_CN,
+					PARAGRAPH_WB_XX, at, lb);
+			break;
+
+		default:
+			break;
+		}
+		at += content->text_len[i];
+	}
+	if (st.op_pending) {
+		paragraph__linebreak_set_bit(lb->bits, st.op_pos);
+	}
+	if (st.wb_pending) {
+		paragraph__linebreak_set_bit(lb->word_bits, st.wb_pos);
+	}
+
+	/* The start and end of the text are always boundaries. */
+	lb->grapheme_bits[0] &= ~(uint64_t)1;
+	lb->word_bits[0] &= ~(uint64_t)1;
+	lb->grapheme_bits[lb->len / 64] &= ~((uint64_t)1 << (lb->len % 64));
+	lb->word_bits[lb->len / 64] &= ~((uint64_t)1 << (lb->len % 64));
+	lb->valid = true;
+
+	if (compare && content->dirty.dirty &&
+			content->dirty.end < content->count) {
+		uint32_t index;
+		size_t offset;
+
+		if (paragraph__linebreak_changed(lb,
+				paragraph_content__offset(content,
+					content->dirty.end),
+				&pos) &&
+		    paragraph_content__entry_at(content, pos,
+				&index, &offset) == PARAGRAPH_OK &&
+		    index >= content->dirty.end) {
+			content->dirty.end = index + 1;
+		}
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/linebreak.h` */
+size_t paragraph_linebreak__boundary(
+		const paragraph_linebreak_t *lb,
+		paragraph_boundary_t kind,
+		size_t pos,
+		bool forwards)
+{
+	const uint64_t *bits = (kind == PARAGRAPH_BOUNDARY_WORD) ?
+			lb->word_bits : lb->grapheme_bits;
+	size_t word;
+	uint64_t b;
+
+	if (forwards) {
+		if (pos + 1 >= lb->len) {
+			return lb->len;
+		}
+		pos++;
+		word = pos / 64;
+		b = bits[word] & (~(uint64_t)0 << (pos % 64));
+		while (b == 0) {
+			if (++word > lb->len / 64) {
+				return lb->len;
+			}
+			b = bits[word];
+		}
+		return word * 64 + __builtin_ctzll(b);
+	}
+
+	if (pos == 0) {
+		return 0;
+	}
+	pos = (pos > lb->len ? lb->len : pos) - 1;
+	word = pos / 64;
+	b = bits[word] & (~(uint64_t)0 >> (63 - pos % 64));
+	while (b == 0) {
+		if (word == 0) {
+			return 0;
+		}
+		b = bits[--word];
+	}
+	return word * 64 + 63 - __builtin_clzll(b);
+}
+
+/* Internally exported function, documented in `src/linebreak.h` */
+void paragraph_linebreak__reset(
+		paragraph_linebreak_t *lb)
+{
+	lb->len = 0;
+	lb->old_len = 0;
+	lb->valid = false;
+}
+
+/* Internally exported function, documented in `src/linebreak.h` */
+void paragraph_linebreak__destroy(
+		paragraph_linebreak_t *lb)
+{
+	free(lb->bits);
+	free(lb->old);
+	free(lb->grapheme_bits);
+	free(lb->word_bits);
+	*lb = (paragraph_linebreak_t) { 0 };
+}
+
+/* Internally exported function, documented in `src/linebreak.h` */
+void paragraph_linebreak__share(
+		paragraph_linebreak_t *lb,
+		const paragraph_linebreak_t *src)
+{
+	free(lb->bits);
+	free(lb->grapheme_bits);
+	free(lb->word_bits);
+
+	lb->bits = src->bits;
+	lb->alloc = src->alloc;
+	lb->grapheme_bits = src->grapheme_bits;
+	lb->grapheme_alloc = src->grapheme_alloc;
+	lb->word_bits = src->word_bits;
+	lb->word_alloc = src->word_alloc;
+	lb->len = src->len;
+	lb->valid = src->valid;
+}
+
+/* Internally exported function, documented in `src/linebreak.h` */
+paragraph_err_t paragraph_linebreak__own(
+		paragraph_linebreak_t *lb)
+{
+	paragraph_linebreak_t own = *lb;
+	size_t words = lb->len / 64 + 2;
+	paragraph_err_t err;
+
+	err = vec_dup((void **)&own.bits, sizeof(*own.bits), words,
+			&own.alloc);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = vec_dup((void **)&own.grapheme_bits, sizeof(*own.grapheme_bits),
+			words, &own.grapheme_alloc);
+	if (err != PARAGRAPH_OK) {
+		free(own.bits);
+		return err;
+	}
+
+	err = vec_dup((void **)&own.word_bits, sizeof(*own.word_bits), words,
+			&own.word_alloc);
+	if (err != PARAGRAPH_OK) {
+		free(own.bits);
+		free(own.grapheme_bits);
+		return err;
+	}
+
+	*lb = own;
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/linebreak.h` */
+void paragraph_linebreak__forget(
+		paragraph_linebreak_t *lb)
+{
+	lb->bits = NULL;
+	lb->alloc = 0;
+	lb->grapheme_bits = NULL;
+	lb->grapheme_alloc = 0;
+	lb->word_bits = NULL;
+	lb->word_alloc = 0;
+	lb->len = 0;
+	lb->valid = false;
+}
@@ -0,0 +1,169 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Line break opportunity interface.
+ */
+
+#ifndef PARAGRAPH__LINEBREAK_H
+#define PARAGRAPH__LINEBREAK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "content.h"
+
+/**
+ * Line break opportunities in a paragraph's text.
+ */
+typedef struct paragraph_linebreak_s {
+	uint64_t *bits; /**< Bit for each text byte; set if a line can start. */
+	size_t len;     /**< Byte length of the text the bits are for. */
+	size_t alloc;   /**< Number of words bits has space for. */
+
+	uint64_t *old;    /**< Bits from the previous analysis. */
+	size_t old_len;   /**< Byte length of the text old is for. */
+	size_t old_alloc; /**< Number of words old has space for. */
+
+	uint64_t *grapheme_bits; /**< Bit for each grapheme cluster start. */
+	size_t grapheme_alloc;   /**< Number of words grapheme_bits holds. */
+
+	uint64_t *word_bits; /**< Bit for each word boundary. */
+	size_t word_alloc;   /**< Number of words word_bits holds. */
+
+	bool valid; /**< Whether bits are for the current content. */
+} paragraph_linebreak_t;
+
+/**
+ * Find the line break opportunities in changed content.
+ *
+ * Does nothing unless the content has changed since the last call.
+ *
+ * A change can affect break opportunities in the unchanged content that
+ * follows it.  The content's changed entry range is extended to cover any
+ * that differ from the previous analysis.  Grapheme cluster and word
+ * boundaries aren't used by layout, so they don't extend it.
+ *
+ * \param[in]  lb       The line break opportunities to update.
+ * \param[in]  content  The content to analyse.  Must be settled.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_linebreak__update(
+		paragraph_linebreak_t *lb,
+		paragraph_content_t *content);
+
+/**
+ * Forget all line break opportunities, keeping allocations for reuse.
+ *
+ * \param[in]  lb  The line break opportunities to reset.
+ */
+void paragraph_linebreak__reset(
+		paragraph_linebreak_t *lb);
+
+/**
+ * Free all line break opportunities.
+ *
+ * \param[in]  lb  The line break opportunities to destroy.
+ */
+void paragraph_linebreak__destroy(
+		paragraph_linebreak_t *lb);
+
+/**
+ * Use another paragraph's analysis, without copying it.
+ *
+ * Any analysis lb has is freed.  The line break opportunities, and grapheme
+ * cluster and word boundaries, are then shared, until
+ * \ref paragraph_linebreak__own or \ref paragraph_linebreak__forget is
+ * called.
+ *
+ * \param[in]  lb   The analysis to share into.
+ * \param[in]  src  The analysis to share.
+ */
+void paragraph_linebreak__share(
+		paragraph_linebreak_t *lb,
+		const paragraph_linebreak_t *src);
+
+/**
+ * Take a copy of a shared analysis, so it can be changed.
+ *
+ * \param[in]  lb  The shared analysis.  Unchanged on failure.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_linebreak__own(
+		paragraph_linebreak_t *lb);
+
+/**
+ * Stop using a shared analysis, without freeing it.
+ *
+ * \param[in]  lb  The shared analysis.
+ */
+void paragraph_linebreak__forget(
+		paragraph_linebreak_t *lb);
+
+/**
+ * Find the next line break opportunity.
+ *
+ * \param[in]  lb   The line break opportunities to search.
+ * \param[in]  pos  Byte offset in paragraph text to search from.
+ * \return the byte offset of the first break opportunity at or after pos,
+ *         or the length of the text if there is none.
+ */
+static inline size_t paragraph_linebreak__next(
+		const paragraph_linebreak_t *lb,
+		size_t pos)
+{
+	size_t word = pos / 64;
+	uint64_t bits;
+
+	if (pos >= lb->len) {
+		return lb->len;
+	}
+
+	bits = lb->bits[word] & (~(uint64_t)0 << (pos % 64));
+	while (bits == 0) {
+		if (++word > lb->len / 64) {
+			return lb->len;
+		}
+		bits = lb->bits[word];
+	}
+
+	return word * 64 + __builtin_ctzll(bits);
+}
+
+/**
+ * Find the nearest text boundary before or after a position.
+ *
+ * \param[in]  lb        The analysis to search.
+ * \param[in]  kind      The kind of boundary to find.
+ * \param[in]  pos       Byte offset in paragraph text to search from.
+ * \param[in]  forwards  Whether to search forwards, or backwards.
+ * \return the byte offset of the first boundary after pos, or the length of
+ *         the text if there is none, when searching forwards.  Otherwise,
+ *         the byte offset of the last boundary before pos, or 0.
+ */
+size_t paragraph_linebreak__boundary(
+		const paragraph_linebreak_t *lb,
+		paragraph_boundary_t kind,
+		size_t pos,
+		bool forwards);
+
+/**
+ * Check whether a grapheme cluster starts at a position.
+ *
+ * \param[in]  lb   The analysis.
+ * \param[in]  pos  Byte offset in paragraph text, after its start and before
+ *                  its end.
+ * \return true if a grapheme cluster starts at pos.
+ */
+static inline bool paragraph_linebreak__grapheme(
+		const paragraph_linebreak_t *lb,
+		size_t pos)
+{
+	return (lb->grapheme_bits[pos / 64] >> (pos % 64)) & 1;
+}
+
+#endif
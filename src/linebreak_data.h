@@ -0,0 +1,274 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Line break tables.
+ *
+ * Generated by `tools/linebreak_gen.c` from LineBreak-14.0.0.txt.
+ * Do not edit.
+ */
+
+#ifndef PARAGRAPH__LINEBREAK_DATA_H
+#define PARAGRAPH__LINEBREAK_DATA_H
+
+#include <stdint.h>
+
+/** Line break classes, resolved by rule LB1. */
+enum paragraph_lb_e {
+	PARAGRAPH_LB_OP,
+	PARAGRAPH_LB_CL,
+	PARAGRAPH_LB_CP,
+	PARAGRAPH_LB_QU,
+	PARAGRAPH_LB_GL,
+	PARAGRAPH_LB_NS,
+	PARAGRAPH_LB_EX,
+	PARAGRAPH_LB_SY,
+	PARAGRAPH_LB_IS,
+	PARAGRAPH_LB_PR,
+	PARAGRAPH_LB_PO,
+	PARAGRAPH_LB_NU,
+	PARAGRAPH_LB_AL,
+	PARAGRAPH_LB_HL,
+	PARAGRAPH_LB_ID,
+	PARAGRAPH_LB_IN,
+	PARAGRAPH_LB_HY,
+	PARAGRAPH_LB_BA,
+	PARAGRAPH_LB_BB,
+	PARAGRAPH_LB_B2,
+	PARAGRAPH_LB_ZW,
+	PARAGRAPH_LB_CM,
+	PARAGRAPH_LB_WJ,
+	PARAGRAPH_LB_H2,
+	PARAGRAPH_LB_H3,
+	PARAGRAPH_LB_JL,
+	PARAGRAPH_LB_JV,
+	PARAGRAPH_LB_JT,
+	PARAGRAPH_LB_RI,
+	PARAGRAPH_LB_EB,
+	PARAGRAPH_LB_EM,
+	PARAGRAPH_LB_ZWJ,
+	PARAGRAPH_LB_CB,
+	PARAGRAPH_LB_OP_EA,
+	PARAGRAPH_LB_CP_EA,
+	PARAGRAPH_LB_SP,
+	PARAGRAPH_LB_BK,
+	PARAGRAPH_LB_CR,
+	PARAGRAPH_LB_LF,
+	PARAGRAPH_LB_NL,
+	PARAGRAPH_LB__COUNT,
+};
+
+/** Pair table flag: break allowed between adjacent classes. */
+#define PARAGRAPH_LB_DIRECT (1 << 0)
+/** Pair table flag: break allowed after spaces between classes. */
+#define PARAGRAPH_LB_SPACED (1 << 1)
+
+/** Break opportunities between pairs of classes. */
+static const uint8_t paragraph_lb_pair[40][40] = {
+	[PARAGRAPH_LB_OP] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	[PARAGRAPH_LB_CL] = {
+		3, 0, 0, 2, 2, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_CP] = {
+		3, 0, 0, 2, 2, 0, 0, 0, 0, 3, 3, 2, 2, 2, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_QU] = {
+		0, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 0, 0, 2, 2, 2, 2, 2,
+	},
+	[PARAGRAPH_LB_GL] = {
+		2, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 0, 2, 2, 2, 2, 2,
+	},
+	[PARAGRAPH_LB_NS] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_EX] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_SY] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 2, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_IS] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 2, 2, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_PR] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 2, 2, 2, 2, 2,
+		2, 2, 3, 3, 0, 2, 0, 2, 2, 2, 2, 2, 3, 2, 2, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_PO] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 2, 2, 2, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_NU] = {
+		2, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_AL] = {
+		2, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_HL] = {
+		2, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_ID] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 2, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_IN] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_HY] = {
+		3, 0, 0, 2, 3, 2, 0, 0, 0, 3, 3, 2, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_BA] = {
+		3, 0, 0, 2, 3, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_BB] = {
+		2, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		3, 2, 0, 2, 2, 2, 2, 2,
+	},
+	[PARAGRAPH_LB_B2] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 0, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_ZW] = {
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_CM] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_WJ] = {
+		2, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 0, 2, 2, 2, 2, 2,
+	},
+	[PARAGRAPH_LB_H2] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 2, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 2, 2, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_H3] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 2, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 2, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_JL] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 2, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 2, 2, 2, 2, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_JV] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 2, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 2, 2, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_JT] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 2, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 2, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_RI] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 2, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_EB] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 2, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 2, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_EM] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 2, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_ZWJ] = {
+		2, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 0, 2, 2, 2, 2, 2,
+	},
+	[PARAGRAPH_LB_CB] = {
+		3, 0, 0, 2, 2, 3, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_OP_EA] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	[PARAGRAPH_LB_CP_EA] = {
+		3, 0, 0, 2, 2, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_SP] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_BK] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_CR] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_LF] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+	[PARAGRAPH_LB_NL] = {
+		3, 0, 0, 2, 2, 2, 0, 0, 0, 3, 3, 3, 3, 3, 3, 2,
+		2, 2, 3, 3, 0, 2, 0, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		3, 3, 0, 3, 3, 3, 3, 3,
+	},
+};
+
+#endif
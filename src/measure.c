@@ -0,0 +1,606 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Text measurement cache implementation.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <paragraph.h>
+
+#include "ctx.h"
+#include "measure.h"
+
+/** Number of chains in a cache's first hash table. */
+#define PARAGRAPH_MEASURE_TABLE_MIN 64
+
+/**
+ * Smallest budget of a cache that is in use.  Enough for the first hash
+ * table and some entries, since nothing can be cached without the table.
+ */
+#define PARAGRAPH_MEASURE_BUDGET_MIN 4096
+
+struct paragraph_measure_entry_s {
+	paragraph_measure_entry_t *next_hash; /**< Next entry in chain. */
+	paragraph_measure_entry_t *newer; /**< Next more recently used. */
+	paragraph_measure_entry_t *older; /**< Next less recently used. */
+
+	const paragraph_style_t *style; /**< Style text was measured in. */
+	uint32_t script; /**< Script of the text. */
+	uint8_t level;   /**< Embedding level of the text. */
+	uint32_t hash;   /**< Hash of the key. */
+
+	uint32_t width;    /**< Measured width. */
+	uint32_t height;   /**< Measured height. */
+	uint32_t baseline; /**< Measured baseline. */
+
+	size_t len;  /**< Byte length of text. */
+	char data[]; /**< The text. */
+};
+
+/**
+ * Get the number of bytes an entry for some text uses.
+ *
+ * \param[in]  len  Byte length of the text.
+ * \return the entry's size.
+ */
+static inline size_t paragraph__measure_size(
+		size_t len)
+{
+	return sizeof(paragraph_measure_entry_t) + len;
+}
+
+/**
+ * Hash a measurement's key.
+ *
+ * \param[in]  text   The text.
+ * \param[in]  style  The style.
+ * \return the hash.
+ */
+static uint32_t paragraph__measure_hash(
+		const paragraph_text_t *text,
+		const paragraph_style_t *style)
+{
+	uintptr_t s = (uintptr_t)style;
+	uint32_t hash = 2166136261u;
+
+	for (size_t i = 0; i < text->len; i++) {
+		hash = (hash ^ (uint8_t)text->data[i]) * 16777619u;
+	}
+	for (size_t i = 0; i < sizeof(s); i++) {
+		hash = (hash ^ (uint8_t)(s >> (i * 8))) * 16777619u;
+	}
+	hash = (hash ^ text->level) * 16777619u;
+	return (hash ^ text->script) * 16777619u;
+}
+
+/**
+ * Check whether two pieces of text have the same key.
+ *
+ * \param[in]  a  The first piece.
+ * \param[in]  b  The second piece.
+ * \return true if their measurements are the same.
+ */
+static inline bool paragraph__measure_same(
+		const paragraph_text_segment_t *a,
+		const paragraph_text_segment_t *b)
+{
+	return a->style == b->style &&
+			a->text.level == b->text.level &&
+			a->text.script == b->text.script &&
+			a->text.len == b->text.len &&
+			memcmp(a->text.data, b->text.data, a->text.len) == 0;
+}
+
+/**
+ * Remove an entry from the list of entries in order of use.
+ *
+ * \param[in]  cache  The cache.
+ * \param[in]  entry  The entry to remove.
+ */
+static void paragraph__measure_unlink(
+		paragraph_measure_t *cache,
+		paragraph_measure_entry_t *entry)
+{
+	if (entry->newer != NULL) {
+		entry->newer->older = entry->older;
+	} else {
+		cache->newest = entry->older;
+	}
+	if (entry->older != NULL) {
+		entry->older->newer = entry->newer;
+	} else {
+		cache->oldest = entry->newer;
+	}
+}
+
+/**
+ * Add an entry to the list of entries, as the most recently used.
+ *
+ * \param[in]  cache  The cache.
+ * \param[in]  entry  The entry to add.
+ */
+static void paragraph__measure_push(
+		paragraph_measure_t *cache,
+		paragraph_measure_entry_t *entry)
+{
+	entry->newer = NULL;
+	entry->older = cache->newest;
+	if (cache->newest != NULL) {
+		cache->newest->newer = entry;
+	} else {
+		cache->oldest = entry;
+	}
+	cache->newest = entry;
+}
+
+/**
+ * Evict the least recently used entry.
+ *
+ * \param[in]  cache  The cache.  Must have an entry.
+ */
+static void paragraph__measure_evict(
+		paragraph_measure_t *cache)
+{
+	paragraph_measure_entry_t *entry = cache->oldest;
+	paragraph_measure_entry_t **link;
+
+	link = &cache->table[entry->hash & (cache->table_len - 1)];
+	while (*link != entry) {
+		link = &(*link)->next_hash;
+	}
+	*link = entry->next_hash;
+
+	paragraph__measure_unlink(cache, entry);
+	cache->bytes -= paragraph__measure_size(entry->len);
+	cache->count--;
+	cache->evictions++;
+	free(entry);
+}
+
+/**
+ * Double the length of the hash table, if it is full and that fits in the
+ * budget.
+ *
+ * \param[in]  cache  The cache.
+ * \param[in]  extra  Bytes needed for an entry that is being added.
+ */
+static void paragraph__measure_grow(
+		paragraph_measure_t *cache,
+		size_t extra)
+{
+	paragraph_measure_entry_t **table;
+	size_t len;
+
+	if (cache->count < cache->table_len) {
+		return;
+	}
+
+	len = cache->table_len > 0 ?
+			cache->table_len * 2 : PARAGRAPH_MEASURE_TABLE_MIN;
+	if (cache->bytes + extra + (len - cache->table_len) *
+			sizeof(*table) > cache->budget) {
+		return;
+	}
+
+	table = calloc(len, sizeof(*table));
+	if (table == NULL) {
+		return;
+	}
+
+	for (size_t i = 0; i < cache->table_len; i++) {
+		paragraph_measure_entry_t *entry = cache->table[i];
+
+		while (entry != NULL) {
+			paragraph_measure_entry_t *next = entry->next_hash;
+			size_t chain = entry->hash & (len - 1);
+
+			entry->next_hash = table[chain];
+			table[chain] = entry;
+			entry = next;
+		}
+	}
+
+	cache->bytes += (len - cache->table_len) * sizeof(*table);
+	free(cache->table);
+	cache->table = table;
+	cache->table_len = len;
+}
+
+/**
+ * Find a cached measurement.
+ *
+ * \param[in]  cache  The cache.
+ * \param[in]  hash   Hash of the measurement's key.
+ * \param[in]  text   The text.
+ * \param[in]  style  The style.
+ * \return the entry, or NULL if the measurement isn't cached.
+ */
+static paragraph_measure_entry_t *paragraph__measure_find(
+		const paragraph_measure_t *cache,
+		uint32_t hash,
+		const paragraph_text_t *text,
+		const paragraph_style_t *style)
+{
+	paragraph_measure_entry_t *entry;
+
+	if (cache->table_len == 0) {
+		return NULL;
+	}
+
+	entry = cache->table[hash & (cache->table_len - 1)];
+	while (entry != NULL) {
+		if (entry->hash == hash &&
+				entry->style == style &&
+				entry->level == text->level &&
+				entry->script == text->script &&
+				entry->len == text->len &&
+				memcmp(entry->data, text->data,
+						text->len) == 0) {
+			return entry;
+		}
+		entry = entry->next_hash;
+	}
+
+	return NULL;
+}
+
+/**
+ * Cache a measurement, if it fits in the budget.
+ *
+ * \param[in]  cache     The cache.
+ * \param[in]  hash      Hash of the measurement's key.
+ * \param[in]  text      The text.
+ * \param[in]  style     The style.
+ * \param[in]  width     The text's width.
+ * \param[in]  height    The text's height.
+ * \param[in]  baseline  The text's baseline.
+ */
+static void paragraph__measure_add(
+		paragraph_measure_t *cache,
+		uint32_t hash,
+		const paragraph_text_t *text,
+		const paragraph_style_t *style,
+		uint32_t width,
+		uint32_t height,
+		uint32_t baseline)
+{
+	size_t size = paragraph__measure_size(text->len);
+	paragraph_measure_entry_t *entry;
+	size_t chain;
+
+	if (size > cache->budget) {
+		return;
+	}
+
+	while (cache->bytes + size > cache->budget && cache->oldest != NULL) {
+		paragraph__measure_evict(cache);
+	}
+
+	paragraph__measure_grow(cache, size);
+	if (cache->table_len == 0 || cache->bytes + size > cache->budget) {
+		return;
+	}
+
+	entry = malloc(size);
+	if (entry == NULL) {
+		return;
+	}
+
+	entry->style = style;
+	entry->script = text->script;
+	entry->level = text->level;
+	entry->hash = hash;
+	entry->width = width;
+	entry->height = height;
+	entry->baseline = baseline;
+	entry->len = text->len;
+	memcpy(entry->data, text->data, text->len);
+
+	chain = hash & (cache->table_len - 1);
+	entry->next_hash = cache->table[chain];
+	cache->table[chain] = entry;
+	paragraph__measure_push(cache, entry);
+
+	cache->bytes += size;
+	cache->count++;
+}
+
+/* Internally exported function, documented in `src/measure.h` */
+void paragraph_measure__init(
+		paragraph_measure_t *cache,
+		size_t budget)
+{
+	memset(cache, 0, sizeof(*cache));
+	cache->budget = budget;
+	if (budget > 0 && budget < PARAGRAPH_MEASURE_BUDGET_MIN) {
+		cache->budget = PARAGRAPH_MEASURE_BUDGET_MIN;
+	}
+}
+
+/* Internally exported function, documented in `src/measure.h` */
+void paragraph_measure__clear(
+		paragraph_measure_t *cache)
+{
+	paragraph_measure_entry_t *entry = cache->newest;
+
+	while (entry != NULL) {
+		paragraph_measure_entry_t *older = entry->older;
+
+		free(entry);
+		entry = older;
+	}
+	free(cache->table);
+
+	cache->table = NULL;
+	cache->table_len = 0;
+	cache->newest = NULL;
+	cache->oldest = NULL;
+	cache->count = 0;
+	cache->bytes = 0;
+}
+
+/* Internally exported function, documented in `src/measure.h` */
+void paragraph_measure__fini(
+		paragraph_measure_t *cache)
+{
+	paragraph_measure__clear(cache);
+
+	free(cache->batch);
+	free(cache->batch_metrics);
+	free(cache->batch_hash);
+	free(cache->batch_index);
+	free(cache->batch_table);
+}
+
+/* Internally exported function, documented in `src/measure.h` */
+paragraph_err_t paragraph_measure__text(
+		paragraph_ctx_t *ctx,
+		const paragraph_text_t *text,
+		const paragraph_style_t *style,
+		uint32_t *width_out,
+		uint32_t *height_out,
+		uint32_t *baseline_out)
+{
+	paragraph_measure_t *cache = &ctx->measure;
+	paragraph_measure_entry_t *entry;
+	paragraph_err_t err;
+	uint32_t hash = 0;
+
+	if (cache->budget > 0) {
+		hash = paragraph__measure_hash(text, style);
+		entry = paragraph__measure_find(cache, hash, text, style);
+		if (entry != NULL) {
+			paragraph__measure_unlink(cache, entry);
+			paragraph__measure_push(cache, entry);
+			cache->hits++;
+
+			*width_out = entry->width;
+			*height_out = entry->height;
+			*baseline_out = entry->baseline;
+			return PARAGRAPH_OK;
+		}
+		cache->misses++;
+	}
+
+	err = ctx->cb_text->measure_text(ctx->pw, text, style,
+			width_out, height_out, baseline_out);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	if (cache->budget > 0) {
+		paragraph__measure_add(cache, hash, text, style,
+				*width_out, *height_out, *baseline_out);
+	}
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Make sure the scratch space can hold a batch.
+ *
+ * \param[in]  cache  The cache.
+ * \param[in]  count  Number of pieces in the batch.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__measure_batch_ensure(
+		paragraph_measure_t *cache,
+		size_t count)
+{
+	size_t table_len = cache->batch_table_len > 0 ?
+			cache->batch_table_len : PARAGRAPH_MEASURE_TABLE_MIN;
+	void *temp;
+
+	if (count > cache->batch_alloc) {
+		temp = realloc(cache->batch, count * sizeof(*cache->batch));
+		if (temp == NULL) {
+			return PARAGRAPH_ERR_OOM;
+		}
+		cache->batch = temp;
+
+		temp = realloc(cache->batch_metrics,
+				count * sizeof(*cache->batch_metrics));
+		if (temp == NULL) {
+			return PARAGRAPH_ERR_OOM;
+		}
+		cache->batch_metrics = temp;
+
+		temp = realloc(cache->batch_hash,
+				count * sizeof(*cache->batch_hash));
+		if (temp == NULL) {
+			return PARAGRAPH_ERR_OOM;
+		}
+		cache->batch_hash = temp;
+
+		temp = realloc(cache->batch_index,
+				count * sizeof(*cache->batch_index));
+		if (temp == NULL) {
+			return PARAGRAPH_ERR_OOM;
+		}
+		cache->batch_index = temp;
+
+		cache->batch_alloc = count;
+	}
+
+	/* Keep the table at most half full. */
+	while (table_len < count * 2) {
+		table_len *= 2;
+	}
+	if (table_len > cache->batch_table_len) {
+		temp = realloc(cache->batch_table,
+				table_len * sizeof(*cache->batch_table));
+		if (temp == NULL) {
+			return PARAGRAPH_ERR_OOM;
+		}
+		cache->batch_table = temp;
+		cache->batch_table_len = table_len;
+	}
+
+	/* Every byte of SIZE_MAX is 0xff. */
+	memset(cache->batch_table, 0xff,
+			cache->batch_table_len * sizeof(*cache->batch_table));
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Gather a piece of a batch into the scratch space, unless the cache is in
+ * use and the same piece has already been gathered.
+ *
+ * \param[in]  cache    The cache.
+ * \param[in]  segment  The piece.
+ * \param[in]  hash     Hash of the piece's key.
+ * \param[in]  count    Number of pieces gathered so far.
+ * \return the index of the piece in the scratch space.
+ */
+static size_t paragraph__measure_gather(
+		paragraph_measure_t *cache,
+		const paragraph_text_segment_t *segment,
+		uint32_t hash,
+		size_t count)
+{
+	size_t mask = cache->batch_table_len - 1;
+	size_t slot = hash & mask;
+
+	if (cache->budget > 0) {
+		while (cache->batch_table[slot] != SIZE_MAX) {
+			size_t index = cache->batch_table[slot];
+
+			if (cache->batch_hash[index] == hash &&
+					paragraph__measure_same(
+						&cache->batch[index],
+						segment)) {
+				return index;
+			}
+			slot = (slot + 1) & mask;
+		}
+		cache->batch_table[slot] = count;
+	}
+
+	cache->batch[count] = *segment;
+	cache->batch_hash[count] = hash;
+	return count;
+}
+
+/* Internally exported function, documented in `src/measure.h` */
+paragraph_err_t paragraph_measure__batch(
+		paragraph_ctx_t *ctx,
+		const paragraph_text_segment_t *segments,
+		paragraph_text_metrics_t *metrics_out,
+		size_t count)
+{
+	paragraph_measure_t *cache = &ctx->measure;
+	paragraph_err_t err;
+	size_t gathered = 0;
+
+	if (ctx->cb_text->measure_text_batch == NULL) {
+		for (size_t i = 0; i < count; i++) {
+			err = paragraph_measure__text(ctx,
+					&segments[i].text, segments[i].style,
+					&metrics_out[i].width,
+					&metrics_out[i].height,
+					&metrics_out[i].baseline);
+			if (err != PARAGRAPH_OK) {
+				return err;
+			}
+		}
+		return PARAGRAPH_OK;
+	}
+
+	if (count == 0) {
+		return PARAGRAPH_OK;
+	}
+
+	err = paragraph__measure_batch_ensure(cache, count);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		const paragraph_text_segment_t *segment = &segments[i];
+		paragraph_measure_entry_t *entry;
+		uint32_t hash;
+		size_t index;
+
+		hash = paragraph__measure_hash(&segment->text, segment->style);
+		entry = paragraph__measure_find(cache, hash,
+				&segment->text, segment->style);
+		if (entry != NULL) {
+			paragraph__measure_unlink(cache, entry);
+			paragraph__measure_push(cache, entry);
+			cache->hits++;
+
+			metrics_out[i].width = entry->width;
+			metrics_out[i].height = entry->height;
+			metrics_out[i].baseline = entry->baseline;
+			cache->batch_index[i] = SIZE_MAX;
+			continue;
+		}
+
+		index = paragraph__measure_gather(cache, segment,
+				hash, gathered);
+		if (index == gathered) {
+			gathered++;
+			if (cache->budget > 0) {
+				cache->misses++;
+			}
+		} else {
+			cache->hits++;
+		}
+		cache->batch_index[i] = index;
+	}
+
+	if (gathered > 0) {
+		err = ctx->cb_text->measure_text_batch(ctx->pw, cache->batch,
+				cache->batch_metrics, gathered);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (cache->batch_index[i] != SIZE_MAX) {
+			metrics_out[i] = cache->batch_metrics[
+					cache->batch_index[i]];
+		}
+	}
+
+	if (cache->budget > 0) {
+		for (size_t i = 0; i < gathered; i++) {
+			const paragraph_text_metrics_t *m =
+					&cache->batch_metrics[i];
+
+			paragraph__measure_add(cache, cache->batch_hash[i],
+					&cache->batch[i].text,
+					cache->batch[i].style,
+					m->width, m->height, m->baseline);
+		}
+	}
+	return PARAGRAPH_OK;
+}
@@ -0,0 +1,128 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Text measurement cache interface.
+ */
+
+#ifndef PARAGRAPH__MEASURE_H
+#define PARAGRAPH__MEASURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A cached measurement.
+ */
+typedef struct paragraph_measure_entry_s paragraph_measure_entry_t;
+
+/**
+ * Cache of text measurements.
+ */
+typedef struct paragraph_measure_s {
+	/** Hash table of entries, chained through their next_hash. */
+	paragraph_measure_entry_t **table;
+	size_t table_len; /**< Number of chains in table; a power of two. */
+
+	paragraph_measure_entry_t *newest; /**< Most recently used entry. */
+	paragraph_measure_entry_t *oldest; /**< Least recently used entry. */
+
+	size_t count;  /**< Number of entries. */
+	size_t bytes;  /**< Bytes used by the entries and table. */
+	size_t budget; /**< Most bytes to use, or zero for no caching. */
+
+	uint64_t hits;      /**< Number of measurements found. */
+	uint64_t misses;    /**< Number of measurements made by the client. */
+	uint64_t evictions; /**< Number of entries evicted. */
+
+	/**
+	 * Scratch space for measuring a batch, which isn't counted in the
+	 * budget.  The pieces the client measures, their measurements and
+	 * their hashes.
+	 */
+	paragraph_text_segment_t *batch;
+	paragraph_text_metrics_t *batch_metrics;
+	uint32_t *batch_hash;
+	/** For each piece of a batch, its index in batch, or SIZE_MAX. */
+	size_t *batch_index;
+	size_t batch_alloc; /**< Number of pieces the scratch has space for. */
+
+	/** Hash table of indices in batch, with linear probing. */
+	size_t *batch_table;
+	size_t batch_table_len; /**< Number of slots; a power of two. */
+} paragraph_measure_t;
+
+/**
+ * Initialise a measurement cache.
+ *
+ * \param[in]  cache   The cache to initialise.
+ * \param[in]  budget  Most bytes the cache may use, or zero for no caching.
+ *                     Small budgets are raised to a minimum.
+ */
+void paragraph_measure__init(
+		paragraph_measure_t *cache,
+		size_t budget);
+
+/**
+ * Forget all cached measurements.
+ *
+ * \param[in]  cache  The cache to clear.
+ */
+void paragraph_measure__clear(
+		paragraph_measure_t *cache);
+
+/**
+ * Free a measurement cache.
+ *
+ * \param[in]  cache  The cache to finalise.
+ */
+void paragraph_measure__fini(
+		paragraph_measure_t *cache);
+
+/**
+ * Measure text, with the context's cache.
+ *
+ * Takes the same parameters as the client's `measure_text` callback, which
+ * is called if the measurement isn't cached.  Failing to cache a
+ * measurement isn't an error.
+ *
+ * \param[in]  ctx           The context, with the cache to use.
+ * \param[in]  text          The text to measure.
+ * \param[in]  style         The style to measure the text in.
+ * \param[out] width_out     Returns the text's width.
+ * \param[out] height_out    Returns the text's height.
+ * \param[out] baseline_out  Returns the text's baseline.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_measure__text(
+		paragraph_ctx_t *ctx,
+		const paragraph_text_t *text,
+		const paragraph_style_t *style,
+		uint32_t *width_out,
+		uint32_t *height_out,
+		uint32_t *baseline_out);
+
+/**
+ * Measure a batch of text pieces, with the context's cache.
+ *
+ * If the client has a `measure_text_batch` callback, the pieces that aren't
+ * cached are measured in one call to it.  Otherwise, each piece is measured
+ * with \ref paragraph_measure__text.
+ *
+ * \param[in]  ctx          The context, with the cache to use.
+ * \param[in]  segments     The pieces of text to measure.
+ * \param[out] metrics_out  Returns the measurements of each piece.
+ * \param[in]  count        Number of pieces in segments.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_measure__batch(
+		paragraph_ctx_t *ctx,
+		const paragraph_text_segment_t *segments,
+		paragraph_text_metrics_t *metrics_out,
+		size_t count);
+
+#endif
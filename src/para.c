@@ -13,9 +13,132 @@
 
 #include <paragraph.h>
 
+#include "ctx.h"
 #include "content.h"
 #include "style.h"
 #include "para.h"
+#include "layout.h"
+#include "linebreak.h"
+#include "bidi.h"
+#include "script.h"
+#include "whitespace.h"
+#include "transform.h"
+
+/**
+ * Stop sharing a paragraph's analysis with its clones.
+ *
+ * If other paragraphs still use the analysis, it is left to them.
+ *
+ * \param[in]  para  The paragraph to stop sharing the analysis of.
+ */
+static void paragraph__para_unshare(
+		paragraph_para_t *para)
+{
+	if (para->share == NULL) {
+		return;
+	}
+
+	if (--para->share->refs > 0) {
+		paragraph__layout_forget(&para->layout);
+		paragraph_transform__forget(&para->transform);
+		paragraph_whitespace__forget(&para->whitespace);
+		paragraph_script__forget(&para->script);
+		paragraph_bidi__forget(&para->bidi);
+		paragraph_linebreak__forget(&para->linebreak);
+	} else {
+		free(para->share);
+	}
+	para->share = NULL;
+}
+
+/**
+ * Share a paragraph's analysis with a new clone of it.
+ *
+ * The analysis is only shared if it is for the paragraph's current content.
+ * Otherwise, or if the reference count can't be allocated, the clone finds
+ * its own when it is laid out.
+ *
+ * \param[in]  clone  The new clone, with no analysis.
+ * \param[in]  para   The paragraph it is a clone of.
+ */
+static void paragraph__para_share(
+		paragraph_para_t *clone,
+		paragraph_para_t *para)
+{
+	if (para->content.dirty.dirty || !para->layout.segs_valid) {
+		return;
+	}
+
+	if (para->share == NULL) {
+		para->share = malloc(sizeof(*para->share));
+		if (para->share == NULL) {
+			return;
+		}
+		para->share->refs = 1;
+	}
+	para->share->refs++;
+	clone->share = para->share;
+
+	paragraph_linebreak__share(&clone->linebreak, &para->linebreak);
+	paragraph_bidi__share(&clone->bidi, &para->bidi);
+	paragraph_script__share(&clone->script, &para->script);
+	paragraph_whitespace__share(&clone->whitespace, &para->whitespace);
+	paragraph_transform__share(&clone->transform, &para->transform);
+	paragraph__layout_share(&clone->layout, &para->layout);
+}
+
+/* Internally exported function, documented in `src/para.h` */
+paragraph_err_t paragraph__para_own(
+		paragraph_para_t *para)
+{
+	paragraph_err_t err;
+
+	if (para->share == NULL || para->share->refs == 1) {
+		paragraph__para_unshare(para);
+		return PARAGRAPH_OK;
+	}
+
+	/* Once a copy fails, the rest are forgotten rather than copied. */
+	err = paragraph_linebreak__own(&para->linebreak);
+	if (err != PARAGRAPH_OK) {
+		paragraph_linebreak__forget(&para->linebreak);
+	}
+	if (err == PARAGRAPH_OK) {
+		err = paragraph_bidi__own(&para->bidi);
+	}
+	if (err != PARAGRAPH_OK) {
+		paragraph_bidi__forget(&para->bidi);
+	}
+	if (err == PARAGRAPH_OK) {
+		err = paragraph_script__own(&para->script);
+	}
+	if (err != PARAGRAPH_OK) {
+		paragraph_script__forget(&para->script);
+	}
+	if (err == PARAGRAPH_OK) {
+		err = paragraph_whitespace__own(&para->whitespace);
+	}
+	if (err != PARAGRAPH_OK) {
+		paragraph_whitespace__forget(&para->whitespace);
+	}
+	if (err == PARAGRAPH_OK) {
+		err = paragraph_transform__own(&para->transform);
+	}
+	if (err != PARAGRAPH_OK) {
+		paragraph_transform__forget(&para->transform);
+	}
+	if (err == PARAGRAPH_OK) {
+		err = paragraph__layout_own(&para->layout);
+	}
+	if (err != PARAGRAPH_OK) {
+		paragraph__layout_forget(&para->layout);
+	}
+
+	para->share->refs--;
+	para->share = NULL;
+
+	return err;
+}
 
 /**
  * Destroy the contents of a paragraph context.
@@ -26,14 +149,54 @@ static void paragraph__ctx_destroy_internals(
 		paragraph_para_t *para)
 {
 	/* Destroy the stuff we own. */
-	paragraph__content_destroy(&para->content);
-	paragraph_style__fini(&para->styles);
+	paragraph__para_unshare(para);
+	paragraph__layout_destroy(&para->layout);
+	paragraph_whitespace__destroy(&para->whitespace);
+	paragraph_transform__destroy(&para->transform);
+	paragraph_script__destroy(&para->script);
+	paragraph_bidi__destroy(&para->bidi);
+	paragraph_linebreak__destroy(&para->linebreak);
+	paragraph__content_destroy(para->ctx, &para->content);
+	paragraph_style__fini(para->ctx, &para->styles);
 
 	/* Invalidate the pointers to the things we don't own. */
 	para->pw = NULL;
 	para->ctx = NULL;
 }
 
+/**
+ * Clear a paragraph's content and style stack, keeping its allocations.
+ *
+ * \param[in]  para  The paragraph to clear.
+ */
+static void paragraph__para_clear(
+		paragraph_para_t *para)
+{
+	paragraph__para_unshare(para);
+	paragraph__layout_reset(&para->layout);
+	paragraph_whitespace__reset(&para->whitespace);
+	paragraph_transform__reset(&para->transform);
+	paragraph_script__reset(&para->script);
+	paragraph_bidi__reset(&para->bidi);
+	paragraph_linebreak__reset(&para->linebreak);
+	paragraph__content_reset(para->ctx, &para->content);
+	paragraph_style__clear(para->ctx, &para->styles);
+}
+
+/* Internally exported function, documented in `src/para.h` */
+void paragraph__para_pool_fini(
+		paragraph_ctx_t *ctx)
+{
+	while (ctx->pool != NULL) {
+		paragraph_para_t *para = ctx->pool;
+
+		ctx->pool = para->next;
+		paragraph__ctx_destroy_internals(para);
+		free(para);
+	}
+	ctx->pool_count = 0;
+}
+
 /* Exported function, documented in `include/paragraph.h` */
 paragraph_err_t paragraph_create(
 		void *pw,
@@ -48,16 +211,23 @@ paragraph_err_t paragraph_create(
 		return PARAGRAPH_ERR_BAD_PARAM;
 	}
 
-	para = calloc(1, sizeof(*para));
-	if (para == NULL) {
-		return PARAGRAPH_ERR_OOM;
+	if (ctx->pool != NULL) {
+		para = ctx->pool;
+		ctx->pool = para->next;
+		ctx->pool_count--;
+		para->next = NULL;
+	} else {
+		para = calloc(1, sizeof(*para));
+		if (para == NULL) {
+			return PARAGRAPH_ERR_OOM;
+		}
+		paragraph_style__init(&para->styles);
 	}
 
 	para->pw = pw;
 	para->ctx = ctx;
 
-	paragraph_style__init(&para->styles);
-	err = paragraph_style__push(&para->styles, container_style);
+	err = paragraph_style__push(ctx, &para->styles, container_style);
 	if (err != PARAGRAPH_OK) {
 		paragraph_destroy(para);
 		return err;
@@ -67,10 +237,81 @@ paragraph_err_t paragraph_create(
 	return PARAGRAPH_OK;
 }
 
+/* Exported function, documented in `include/paragraph.h` */
+paragraph_err_t paragraph_reset(
+		paragraph_para_t *para,
+		paragraph_style_t *container_style)
+{
+	if (para == NULL || container_style == NULL) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	paragraph__para_clear(para);
+
+	return paragraph_style__push(para->ctx, &para->styles,
+			container_style);
+}
+
+/* Exported function, documented in `include/paragraph.h` */
+paragraph_err_t paragraph_clone(
+		void *pw,
+		paragraph_para_t *para,
+		paragraph_para_t **clone_out)
+{
+	paragraph_para_t *clone;
+	paragraph_err_t err;
+
+	if (para == NULL || clone_out == NULL) {
+		return PARAGRAPH_ERR_BAD_PARAM;
+	}
+
+	err = paragraph_create(pw, para->ctx, &clone, para->styles.array[0]);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	for (size_t i = 1; i < para->styles.count; i++) {
+		err = paragraph_style__push(clone->ctx, &clone->styles,
+				para->styles.array[i]);
+		if (err != PARAGRAPH_OK) {
+			paragraph_destroy(clone);
+			return err;
+		}
+	}
+
+	/* Only compacted content is shared, so neither paragraph has to
+	 * copy the arrays just to tidy them. */
+	paragraph_content__settle(para->ctx, &para->content);
+
+	err = paragraph__content_clone(clone->ctx, &clone->content,
+			&para->content);
+	if (err != PARAGRAPH_OK) {
+		paragraph_destroy(clone);
+		return err;
+	}
+
+	paragraph__para_share(clone, para);
+
+	*clone_out = clone;
+	return PARAGRAPH_OK;
+}
+
 /* Exported function, documented in `include/paragraph.h` */
 paragraph_para_t *paragraph_destroy(
 		paragraph_para_t *para)
 {
+	paragraph_ctx_t *ctx = para->ctx;
+
+	if (ctx->pool_count < PARAGRAPH_CTX_POOL_MAX) {
+		paragraph__para_clear(para);
+		para->pw = NULL;
+		para->next = ctx->pool;
+		ctx->pool = para;
+		ctx->pool_count++;
+
+		return NULL;
+	}
+
 	paragraph__ctx_destroy_internals(para);
 	free(para);
 
@@ -14,13 +14,64 @@
 
 #include "content.h"
 #include "style.h"
+#include "layout.h"
+#include "linebreak.h"
+#include "bidi.h"
+#include "script.h"
+#include "whitespace.h"
+#include "transform.h"
+
+/**
+ * Reference count of analysis shared by cloned paragraphs.
+ *
+ * A clone of a paragraph that has been laid out shares its line break
+ * opportunities, embedding levels, scripts, white space processing, text
+ * transform and measured pieces, since none of them depend on the available
+ * width.  Whichever paragraph first changes them takes its own copy.
+ */
+typedef struct paragraph_para_share_s {
+	uint32_t refs; /**< Number of paragraphs sharing the analysis. */
+} paragraph_para_share_t;
 
 struct paragraph_para_s {
 	void *pw;
 	paragraph_ctx_t *ctx;
 
+	/** Next paragraph in context's pool of destroyed paragraphs. */
+	paragraph_para_t *next;
+
+	/** Analysis shared with clones, or NULL if it isn't shared. */
+	paragraph_para_share_t *share;
+
 	paragraph_styles_t styles;
 	paragraph_content_t content;
+	paragraph_linebreak_t linebreak;
+	paragraph_bidi_t bidi;
+	paragraph_script_t script;
+	paragraph_whitespace_t whitespace;
+	paragraph_transform_t transform;
+	paragraph_layout_t layout;
 };
 
+/**
+ * Take a paragraph's own copy of any analysis it shares with clones.
+ *
+ * This must be called before the analysis is changed.  On failure, the
+ * analysis that couldn't be copied is forgotten, along with any lines laid
+ * out, and is found again by the next layout pass.
+ *
+ * \param[in]  para  The paragraph to copy the analysis of.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph__para_own(
+		paragraph_para_t *para);
+
+/**
+ * Free the pool of destroyed paragraphs kept by a context.
+ *
+ * \param[in]  ctx  The context to free the paragraph pool of.
+ */
+void paragraph__para_pool_fini(
+		paragraph_ctx_t *ctx);
+
 #endif
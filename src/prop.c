@@ -0,0 +1,14 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Unicode character property tables.
+ */
+
+#define PARAGRAPH_PROP_DATA
+
+#include "prop.h"
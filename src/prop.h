@@ -0,0 +1,35 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Unicode character property interface.
+ */
+
+#ifndef PARAGRAPH__PROP_H
+#define PARAGRAPH__PROP_H
+
+#include <stdint.h>
+
+#include "prop_data.h"
+
+/**
+ * Get the Unicode properties of a code point.
+ *
+ * \param[in]  cp  The code point to look up.  Must be at most U+10FFFF.
+ * \return the code point's properties.
+ */
+static inline const paragraph_prop_t *paragraph_prop__get(
+		uint32_t cp)
+{
+	uint8_t block = paragraph_prop_stage1[cp / PARAGRAPH_PROP_BLOCK_SIZE];
+
+	return &paragraph_props[paragraph_prop_stage2[
+			block * PARAGRAPH_PROP_BLOCK_SIZE +
+			cp % PARAGRAPH_PROP_BLOCK_SIZE]];
+}
+
+#endif
@@ -0,0 +1,4618 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Combined Unicode property tables.
+ *
+ * Generated by `tools/prop_gen.c` from EastAsianWidth-14.0.0.txt and the other generators' tables.
+ * Do not edit.
+ */
+
+#ifndef PARAGRAPH__PROP_DATA_H
+#define PARAGRAPH__PROP_DATA_H
+
+#include <stdint.h>
+
+/** East Asian Width values. */
+enum paragraph_ea_e {
+	PARAGRAPH_EA_N, /**< Neutral */
+	PARAGRAPH_EA_A, /**< Ambiguous */
+	PARAGRAPH_EA_H, /**< Halfwidth */
+	PARAGRAPH_EA_NA, /**< Narrow */
+	PARAGRAPH_EA_W, /**< Wide */
+	PARAGRAPH_EA_F, /**< Fullwidth */
+	PARAGRAPH_EA__COUNT,
+};
+
+/** Properties of a code point. */
+typedef struct paragraph_prop_s {
+	uint8_t lb; /**< Line break class, \ref paragraph_lb_e. */
+	uint8_t bidi; /**< Bidirectional class, \ref paragraph_bidi_e. */
+	uint8_t script; /**< Script, \ref paragraph_script_e. */
+	uint8_t gcb; /**< Grapheme cluster break class, \ref paragraph_gcb_e. */
+	uint8_t wb; /**< Word break class, \ref paragraph_wb_e. */
+	uint8_t ea; /**< East Asian Width, \ref paragraph_ea_e. */
+} paragraph_prop_t;
+
+/** Number of code points in each property block. */
+#define PARAGRAPH_PROP_BLOCK_SIZE 256
+
+/** Property block index for each block of code points. */
+extern const uint8_t paragraph_prop_stage1[4352];
+
+/** Index in paragraph_props of each code point in each block. */
+extern const uint16_t paragraph_prop_stage2[48128];
+
+/** Distinct combinations of properties. */
+extern const paragraph_prop_t paragraph_props[806];
+
+#ifdef PARAGRAPH_PROP_DATA
+
+const uint8_t paragraph_prop_stage1[4352] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	48, 49, 50, 51, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 53, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	54, 55, 55, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+	68, 69, 70, 64, 65, 66, 67, 68, 69, 70, 64, 65, 66, 67, 68, 69,
+	70, 64, 65, 66, 67, 68, 69, 70, 64, 65, 66, 67, 68, 69, 70, 64,
+	65, 66, 67, 68, 69, 70, 64, 71, 72, 72, 72, 72, 72, 72, 72, 72,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 52, 74, 75, 76, 77, 78, 79,
+	80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+	96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 72, 107, 108, 109, 110,
+	111, 111, 111, 112, 113, 114, 72, 72, 72, 72, 72, 72, 72, 72, 72, 115,
+	116, 116, 117, 118, 119, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 120, 121, 122, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 123, 123, 124, 125, 72, 72, 126, 127,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 129, 128, 128, 128, 130, 131, 132, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 133,
+	134, 135, 136, 72, 72, 72, 72, 72, 72, 72, 72, 72, 137, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 138,
+	139, 140, 141, 142, 143, 144, 145, 146, 147, 147, 148, 72, 72, 72, 72, 149,
+	150, 151, 152, 72, 72, 72, 72, 153, 154, 155, 156, 156, 157, 158, 159, 156,
+	160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 172, 172, 173,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 174, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 175, 176, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 177, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 178, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 52, 52, 180, 179, 179, 179, 179, 181,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 182, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 181,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 183,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 183,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 183,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 183,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 183,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 183,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 183,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 183,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 183,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 183,
+	184, 185, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 183,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 187,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 187,
+};
+
+const uint16_t paragraph_prop_stage2[48128] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3,
+	4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 7, 8, 9, 10, 11,
+	12, 13, 14, 15, 16, 17, 14, 18, 19, 20, 21, 22,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 25,
+	14, 14, 14, 9, 14, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 16, 27, 17, 14, 28,
+	14, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 16, 29, 30, 14, 0, 0, 0, 0, 0,
+	0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 32, 33, 13, 12, 34, 12, 14, 35,
+	35, 36, 37, 38, 14, 39, 40, 14, 41, 34, 42, 42,
+	43, 44, 35, 45, 35, 42, 37, 38, 35, 35, 35, 33,
+	46, 46, 46, 46, 46, 46, 37, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 37, 46, 46, 46, 46, 46, 46, 35,
+	37, 46, 46, 46, 46, 46, 37, 37, 37, 37, 46, 46,
+	46, 46, 37, 46, 37, 37, 37, 46, 37, 37, 46, 46,
+	37, 46, 37, 37, 46, 46, 46, 35, 37, 37, 37, 46,
+	37, 46, 37, 46, 46, 37, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 37, 46, 37,
+	46, 46, 46, 46, 46, 46, 46, 37, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 37, 37, 46, 46, 46, 37,
+	46, 46, 46, 46, 46, 37, 37, 37, 46, 46, 46, 46,
+	37, 46, 46, 46, 46, 46, 46, 37, 37, 37, 37, 46,
+	37, 46, 46, 46, 37, 37, 37, 37, 46, 37, 46, 46,
+	46, 46, 37, 37, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 37, 37,
+	46, 46, 46, 37, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 37, 46, 37, 46, 37, 46,
+	37, 46, 37, 46, 37, 46, 37, 46, 37, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 37, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 37, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 47, 47, 44, 44, 44, 44, 44, 44, 44, 47, 47,
+	48, 47, 47, 48, 49, 48, 48, 48, 49, 48, 47, 47,
+	50, 44, 47, 47, 47, 47, 47, 47, 35, 35, 35, 35,
+	51, 35, 47, 52, 46, 46, 46, 46, 46, 47, 47, 47,
+	47, 47, 53, 53, 47, 47, 44, 47, 47, 47, 47, 47,
+	47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 55, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55,
+	55, 55, 55, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 56, 56, 56, 56, 47, 57, 56, 56,
+	58, 58, 56, 56, 56, 56, 59, 56, 58, 58, 58, 58,
+	57, 51, 56, 60, 56, 56, 56, 58, 56, 58, 56, 56,
+	56, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 58, 61, 61, 61, 61, 61,
+	61, 61, 56, 56, 56, 56, 56, 56, 56, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 56, 61, 61, 61, 61, 61, 61, 61, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+	56, 56, 56, 56, 56, 56, 57, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 63, 64, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	63, 64, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 65, 66, 66, 67, 67, 66, 66, 66, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 58, 68, 68, 68,
+	68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 58,
+	58, 68, 68, 68, 68, 69, 68, 70, 68, 68, 68, 68,
+	68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	68, 71, 72, 58, 58, 73, 73, 74, 75, 76, 76, 76,
+	76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+	76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+	76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+	76, 76, 76, 76, 76, 76, 77, 76, 78, 76, 76, 78,
+	76, 76, 79, 76, 75, 75, 75, 75, 75, 75, 75, 75,
+	80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+	80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+	80, 80, 80, 75, 75, 75, 75, 80, 80, 80, 80, 81,
+	82, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	83, 83, 83, 83, 83, 84, 85, 85, 86, 87, 87, 88,
+	89, 90, 85, 85, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 92, 93, 94, 94, 92, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 96, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 87, 97,
+	98, 86, 95, 95, 67, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 94, 95, 91, 91,
+	91, 91, 91, 91, 91, 84, 85, 91, 91, 91, 91, 91,
+	91, 95, 95, 91, 91, 85, 91, 91, 91, 91, 95, 95,
+	99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 95, 95,
+	95, 86, 86, 95, 100, 100, 100, 100, 100, 100, 100, 100,
+	100, 100, 100, 100, 100, 100, 101, 102, 103, 104, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 104, 104, 104, 101, 101, 103, 103, 103,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+	105, 105, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+	106, 105, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101, 101, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 109,
+	109, 109, 109, 109, 109, 109, 109, 109, 108, 108, 110, 110,
+	111, 112, 108, 75, 75, 109, 113, 113, 114, 114, 114, 114,
+	114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+	114, 114, 114, 114, 114, 114, 115, 115, 115, 115, 114, 115,
+	115, 115, 115, 115, 115, 115, 115, 115, 114, 115, 115, 115,
+	114, 115, 115, 115, 115, 115, 75, 75, 116, 116, 116, 116,
+	116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 75,
+	117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+	117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+	117, 118, 118, 118, 75, 75, 119, 75, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 101, 101, 101, 101, 101,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	86, 95, 95, 95, 95, 95, 95, 101, 83, 83, 101, 101,
+	101, 101, 101, 101, 91, 91, 91, 91, 91, 91, 91, 91,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 84, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	120, 120, 120, 121, 122, 122, 122, 122, 122, 122, 122, 122,
+	122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+	122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+	122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+	122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 120, 121,
+	120, 122, 121, 121, 121, 120, 120, 120, 120, 120, 120, 120,
+	120, 121, 121, 121, 121, 120, 121, 121, 122, 67, 67, 67,
+	67, 120, 120, 120, 122, 122, 122, 122, 122, 122, 122, 122,
+	122, 122, 120, 120, 123, 123, 124, 124, 124, 124, 124, 124,
+	124, 124, 124, 124, 125, 122, 122, 122, 122, 122, 122, 122,
+	122, 122, 122, 122, 122, 122, 122, 122, 126, 127, 128, 128,
+	58, 126, 126, 126, 126, 126, 126, 126, 126, 58, 58, 126,
+	126, 58, 58, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+	126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+	126, 58, 126, 126, 126, 126, 126, 126, 126, 58, 126, 58,
+	58, 58, 126, 126, 126, 126, 58, 58, 127, 126, 129, 128,
+	128, 127, 127, 127, 127, 58, 58, 128, 128, 58, 58, 128,
+	128, 127, 126, 58, 58, 58, 58, 58, 58, 58, 58, 129,
+	58, 58, 58, 58, 126, 126, 58, 126, 126, 126, 127, 127,
+	58, 58, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+	126, 126, 131, 131, 132, 132, 132, 132, 132, 133, 132, 134,
+	126, 132, 127, 58, 58, 135, 135, 136, 58, 137, 137, 137,
+	137, 137, 137, 58, 58, 58, 58, 137, 137, 58, 58, 137,
+	137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+	137, 137, 137, 137, 137, 137, 137, 137, 137, 58, 137, 137,
+	137, 137, 137, 137, 137, 58, 137, 137, 58, 137, 137, 58,
+	137, 137, 58, 58, 135, 58, 136, 136, 136, 135, 135, 58,
+	58, 58, 58, 135, 135, 58, 58, 135, 135, 135, 58, 58,
+	58, 135, 58, 58, 58, 58, 58, 58, 58, 137, 137, 137,
+	137, 58, 137, 58, 58, 58, 58, 58, 58, 58, 138, 138,
+	138, 138, 138, 138, 138, 138, 138, 138, 135, 135, 137, 137,
+	137, 135, 139, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 140, 140, 141, 58, 142, 142, 142, 142, 142, 142, 142,
+	142, 142, 58, 142, 142, 142, 58, 142, 142, 142, 142, 142,
+	142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+	142, 142, 142, 142, 142, 58, 142, 142, 142, 142, 142, 142,
+	142, 58, 142, 142, 58, 142, 142, 142, 142, 142, 58, 58,
+	140, 142, 141, 141, 141, 140, 140, 140, 140, 140, 58, 140,
+	140, 141, 58, 141, 141, 140, 58, 58, 142, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	142, 142, 140, 140, 58, 58, 143, 143, 143, 143, 143, 143,
+	143, 143, 143, 143, 144, 145, 58, 58, 58, 58, 58, 58,
+	58, 142, 140, 140, 140, 140, 140, 140, 58, 146, 147, 147,
+	58, 148, 148, 148, 148, 148, 148, 148, 148, 58, 58, 148,
+	148, 58, 58, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+	148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+	148, 58, 148, 148, 148, 148, 148, 148, 148, 58, 148, 148,
+	58, 148, 148, 148, 148, 148, 58, 58, 146, 148, 149, 146,
+	147, 146, 146, 146, 146, 58, 58, 147, 147, 58, 58, 147,
+	147, 146, 58, 58, 58, 58, 58, 58, 58, 146, 146, 149,
+	58, 58, 58, 58, 148, 148, 58, 148, 148, 148, 146, 146,
+	58, 58, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+	151, 148, 151, 151, 151, 151, 151, 151, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 152, 153, 58, 153, 153, 153,
+	153, 153, 153, 58, 58, 58, 153, 153, 153, 58, 153, 153,
+	153, 153, 58, 58, 58, 153, 153, 58, 153, 58, 153, 153,
+	58, 58, 58, 153, 153, 58, 58, 58, 153, 153, 153, 58,
+	58, 58, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+	153, 153, 58, 58, 58, 58, 154, 155, 152, 155, 155, 58,
+	58, 58, 155, 155, 155, 58, 155, 155, 155, 152, 58, 58,
+	153, 58, 58, 58, 58, 58, 58, 154, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 156, 156,
+	156, 156, 156, 156, 156, 156, 156, 156, 157, 157, 157, 158,
+	158, 158, 158, 158, 158, 159, 158, 58, 58, 58, 58, 58,
+	160, 161, 161, 161, 160, 162, 162, 162, 162, 162, 162, 162,
+	162, 58, 162, 162, 162, 58, 162, 162, 162, 162, 162, 162,
+	162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+	162, 162, 162, 162, 162, 58, 162, 162, 162, 162, 162, 162,
+	162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 58, 58,
+	160, 162, 160, 160, 160, 161, 161, 161, 161, 58, 160, 160,
+	160, 58, 160, 160, 160, 160, 58, 58, 58, 58, 58, 58,
+	58, 160, 160, 58, 162, 162, 162, 58, 58, 162, 58, 58,
+	162, 162, 160, 160, 58, 58, 163, 163, 163, 163, 163, 163,
+	163, 163, 163, 163, 58, 58, 58, 58, 58, 58, 58, 164,
+	165, 165, 165, 165, 165, 165, 165, 166, 167, 168, 169, 169,
+	170, 167, 167, 167, 167, 167, 167, 167, 167, 58, 167, 167,
+	167, 58, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+	167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+	167, 58, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+	58, 167, 167, 167, 167, 167, 58, 58, 168, 167, 169, 171,
+	169, 169, 171, 169, 169, 58, 171, 169, 169, 58, 169, 169,
+	168, 168, 58, 58, 58, 58, 58, 58, 58, 171, 171, 58,
+	58, 58, 58, 58, 58, 167, 167, 58, 167, 167, 168, 168,
+	58, 58, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+	58, 167, 167, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 173, 173, 174, 174, 175, 175, 175, 175,
+	175, 175, 175, 175, 175, 58, 175, 175, 175, 58, 175, 175,
+	175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+	175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+	175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+	175, 175, 175, 173, 173, 175, 176, 174, 174, 173, 173, 173,
+	173, 58, 174, 174, 174, 58, 174, 174, 174, 173, 177, 178,
+	58, 58, 58, 58, 175, 175, 175, 176, 178, 178, 178, 178,
+	178, 178, 178, 175, 175, 175, 173, 173, 58, 58, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 178, 178, 178, 178,
+	178, 178, 178, 178, 178, 180, 175, 175, 175, 175, 175, 175,
+	58, 181, 182, 182, 58, 183, 183, 183, 183, 183, 183, 183,
+	183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 58,
+	58, 58, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+	183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+	183, 183, 58, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+	58, 183, 58, 58, 183, 183, 183, 183, 183, 183, 183, 58,
+	58, 58, 181, 58, 58, 58, 58, 184, 182, 182, 181, 181,
+	181, 58, 181, 58, 182, 182, 182, 182, 182, 182, 182, 184,
+	58, 58, 58, 58, 58, 58, 185, 185, 185, 185, 185, 185,
+	185, 185, 185, 185, 58, 58, 182, 182, 186, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 187, 187, 187,
+	187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+	187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+	187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+	187, 187, 187, 187, 187, 187, 187, 187, 187, 188, 187, 189,
+	188, 188, 188, 188, 188, 188, 188, 58, 58, 58, 58, 190,
+	187, 187, 187, 187, 187, 187, 187, 188, 188, 188, 188, 188,
+	188, 188, 188, 187, 191, 191, 191, 191, 191, 191, 191, 191,
+	191, 191, 192, 192, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 193, 193, 58, 193, 58, 193, 193,
+	193, 193, 193, 58, 193, 193, 193, 193, 193, 193, 193, 193,
+	193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+	193, 193, 193, 193, 58, 193, 58, 193, 193, 193, 193, 193,
+	193, 193, 193, 193, 193, 194, 193, 195, 194, 194, 194, 194,
+	194, 194, 194, 194, 194, 193, 58, 58, 193, 193, 193, 193,
+	193, 58, 193, 58, 194, 194, 194, 194, 194, 194, 58, 58,
+	196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 58, 58,
+	193, 193, 193, 193, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	197, 198, 198, 198, 198, 199, 198, 198, 200, 198, 198, 201,
+	200, 202, 202, 202, 202, 202, 200, 199, 202, 199, 199, 199,
+	203, 203, 199, 199, 199, 199, 199, 199, 204, 204, 204, 204,
+	204, 204, 204, 204, 204, 204, 199, 199, 199, 199, 199, 199,
+	199, 199, 199, 199, 201, 203, 199, 203, 199, 203, 205, 206,
+	205, 206, 207, 207, 197, 197, 197, 197, 197, 197, 197, 197,
+	58, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197,
+	197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197,
+	197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197,
+	197, 58, 58, 58, 58, 203, 203, 203, 203, 203, 203, 203,
+	203, 203, 203, 203, 203, 203, 203, 208, 203, 203, 203, 203,
+	203, 201, 203, 203, 197, 197, 197, 197, 197, 203, 203, 203,
+	203, 203, 203, 203, 203, 203, 203, 203, 58, 203, 203, 203,
+	203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+	203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+	203, 203, 203, 203, 203, 203, 203, 203, 203, 58, 201, 201,
+	199, 199, 199, 199, 199, 199, 203, 199, 199, 199, 199, 199,
+	199, 58, 199, 199, 198, 198, 201, 198, 199, 209, 209, 209,
+	209, 200, 200, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 210, 210, 210, 210, 210, 210, 210, 210,
+	210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+	210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+	210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 211,
+	211, 212, 212, 212, 212, 213, 212, 212, 212, 212, 212, 212,
+	211, 212, 212, 213, 213, 212, 212, 210, 214, 214, 214, 214,
+	214, 214, 214, 214, 214, 214, 215, 215, 210, 210, 210, 210,
+	210, 210, 210, 210, 210, 210, 213, 213, 212, 212, 210, 210,
+	210, 210, 212, 212, 212, 210, 211, 211, 211, 210, 210, 211,
+	211, 211, 211, 211, 211, 211, 210, 210, 210, 212, 212, 212,
+	212, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+	210, 210, 212, 211, 213, 212, 212, 211, 211, 211, 211, 211,
+	211, 212, 210, 211, 214, 214, 214, 214, 214, 214, 214, 214,
+	214, 214, 211, 211, 211, 212, 210, 210, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 58, 216,
+	58, 58, 58, 58, 58, 216, 58, 58, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 216, 209, 216, 216, 216, 216, 217, 217, 217, 217,
+	217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+	217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+	217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+	217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+	217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+	217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+	217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+	217, 217, 217, 217, 217, 217, 217, 217, 218, 218, 218, 218,
+	218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+	218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+	218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+	218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+	218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+	218, 218, 218, 218, 218, 218, 218, 218, 219, 219, 219, 219,
+	219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+	219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+	219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+	219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+	219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+	219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+	219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 58, 220, 220, 220, 220, 58, 58, 220, 220, 220, 220,
+	220, 220, 220, 58, 220, 58, 220, 220, 220, 220, 58, 58,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 58, 220, 220, 220, 220, 58, 58,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 58, 220, 220,
+	220, 220, 58, 58, 220, 220, 220, 220, 220, 220, 220, 58,
+	220, 58, 220, 220, 220, 220, 58, 58, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 58,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 58, 220, 220,
+	220, 220, 58, 58, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 58,
+	58, 221, 221, 221, 222, 223, 222, 222, 222, 222, 222, 222,
+	222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+	222, 222, 222, 222, 222, 222, 222, 222, 222, 58, 58, 58,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 224, 224, 224, 224, 224, 224, 224, 224,
+	224, 224, 58, 58, 58, 58, 58, 58, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 58, 58,
+	225, 225, 225, 225, 225, 225, 58, 58, 226, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 228, 228, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	229, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 231, 232, 58, 58, 58, 233, 233, 233, 233,
+	233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+	233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+	233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+	233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+	233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+	233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 123,
+	123, 123, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+	233, 58, 58, 58, 58, 58, 58, 58, 234, 234, 234, 234,
+	234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+	234, 234, 235, 235, 235, 236, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 234, 237, 237, 237, 237, 237, 237, 237, 237,
+	237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 238, 238,
+	239, 123, 123, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+	240, 240, 240, 240, 240, 240, 241, 241, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 242, 242, 242, 242,
+	242, 242, 242, 242, 242, 242, 242, 242, 242, 58, 242, 242,
+	242, 58, 243, 243, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 244, 244, 244, 244, 244, 244, 244, 244,
+	244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+	244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+	244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+	244, 244, 244, 244, 244, 244, 244, 244, 245, 245, 246, 245,
+	245, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246,
+	246, 246, 245, 246, 246, 245, 245, 245, 245, 245, 245, 245,
+	245, 245, 245, 245, 247, 247, 248, 244, 247, 244, 247, 249,
+	244, 245, 58, 58, 250, 250, 250, 250, 250, 250, 250, 250,
+	250, 250, 58, 58, 58, 58, 58, 58, 251, 251, 251, 251,
+	251, 251, 251, 251, 251, 251, 58, 58, 58, 58, 58, 58,
+	252, 252, 253, 253, 254, 255, 256, 252, 257, 257, 252, 258,
+	258, 258, 259, 258, 260, 260, 260, 260, 260, 260, 260, 260,
+	260, 260, 58, 58, 58, 58, 58, 58, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 58, 58, 58, 58, 58, 58, 58, 261, 261, 261, 261,
+	261, 258, 258, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 258, 261, 58, 58, 58, 58, 58, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 227, 227, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 262, 262, 262, 262, 262, 262, 262, 262,
+	262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262,
+	262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 58,
+	263, 263, 263, 264, 264, 264, 264, 263, 263, 264, 264, 264,
+	58, 58, 58, 58, 264, 264, 263, 264, 264, 264, 264, 264,
+	264, 263, 263, 263, 58, 58, 58, 58, 265, 58, 58, 58,
+	266, 266, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267,
+	268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268,
+	268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268,
+	268, 268, 268, 268, 268, 268, 58, 58, 268, 268, 268, 268,
+	268, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269,
+	269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269,
+	269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269,
+	269, 269, 269, 269, 269, 269, 269, 269, 58, 58, 58, 58,
+	269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269,
+	269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269,
+	269, 269, 58, 58, 58, 58, 58, 58, 270, 270, 270, 270,
+	270, 270, 270, 270, 270, 270, 269, 58, 58, 58, 271, 271,
+	251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+	251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+	251, 251, 251, 251, 251, 251, 251, 251, 272, 272, 272, 272,
+	272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272,
+	272, 272, 272, 272, 272, 272, 272, 273, 273, 274, 274, 273,
+	58, 58, 275, 275, 276, 276, 276, 276, 276, 276, 276, 276,
+	276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+	276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+	276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+	276, 276, 276, 276, 276, 276, 276, 276, 276, 277, 278, 277,
+	278, 278, 278, 278, 278, 278, 278, 58, 278, 279, 278, 279,
+	279, 278, 278, 278, 278, 278, 278, 278, 278, 277, 277, 277,
+	277, 277, 277, 278, 278, 278, 278, 278, 278, 278, 278, 278,
+	278, 58, 58, 278, 280, 280, 280, 280, 280, 280, 280, 280,
+	280, 280, 58, 58, 58, 58, 58, 58, 280, 280, 280, 280,
+	280, 280, 280, 280, 280, 280, 58, 58, 58, 58, 58, 58,
+	276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+	276, 276, 58, 58, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	281, 281, 281, 281, 282, 283, 283, 283, 283, 283, 283, 283,
+	283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+	283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+	283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+	283, 283, 283, 283, 281, 284, 281, 281, 281, 281, 281, 282,
+	281, 282, 282, 282, 282, 282, 281, 282, 282, 283, 283, 283,
+	283, 283, 283, 283, 283, 58, 58, 58, 285, 285, 285, 285,
+	285, 285, 285, 285, 285, 285, 286, 286, 287, 286, 286, 286,
+	286, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 281,
+	281, 281, 281, 281, 281, 281, 281, 281, 287, 287, 287, 287,
+	287, 287, 287, 287, 287, 286, 286, 58, 288, 288, 289, 290,
+	290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290,
+	290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290,
+	290, 290, 290, 290, 290, 289, 288, 288, 288, 288, 289, 289,
+	288, 288, 289, 288, 288, 288, 290, 290, 291, 291, 291, 291,
+	291, 291, 291, 291, 291, 291, 290, 290, 290, 290, 290, 290,
+	292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292,
+	292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292,
+	292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292,
+	292, 292, 293, 294, 293, 293, 294, 294, 294, 293, 294, 293,
+	293, 293, 294, 294, 58, 58, 58, 58, 58, 58, 58, 58,
+	295, 295, 295, 295, 296, 296, 296, 296, 296, 296, 296, 296,
+	296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296,
+	296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296,
+	296, 296, 296, 296, 297, 297, 297, 297, 297, 297, 297, 297,
+	298, 298, 298, 298, 298, 298, 298, 298, 297, 297, 298, 298,
+	58, 58, 58, 299, 299, 299, 299, 299, 300, 300, 300, 300,
+	300, 300, 300, 300, 300, 300, 58, 58, 58, 296, 296, 296,
+	301, 301, 301, 301, 301, 301, 301, 301, 301, 301, 302, 302,
+	302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302,
+	302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302,
+	302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 303, 303,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 58, 58, 58,
+	58, 58, 58, 58, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 58,
+	58, 216, 216, 216, 304, 304, 304, 304, 304, 304, 304, 304,
+	58, 58, 58, 58, 58, 58, 58, 58, 67, 67, 67, 209,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 305, 67, 67, 67, 67, 67, 67, 67, 44, 44, 44,
+	44, 67, 44, 44, 44, 44, 44, 44, 67, 44, 44, 305,
+	67, 67, 44, 58, 58, 58, 58, 58, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 56, 56,
+	56, 56, 56, 63, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 56, 56, 56, 56, 56, 46, 46,
+	46, 46, 56, 56, 56, 56, 56, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 63, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 56, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 58, 58, 56, 56, 56, 56, 56, 56, 58, 58,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 58, 58, 56, 56, 56, 56, 56, 56, 58, 58,
+	56, 56, 56, 56, 56, 56, 56, 56, 58, 56, 58, 56,
+	58, 56, 58, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 58, 58,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 56, 58, 56, 56, 56, 56, 56, 56,
+	56, 57, 56, 57, 57, 57, 56, 56, 56, 58, 56, 56,
+	56, 56, 56, 56, 56, 57, 57, 57, 56, 56, 56, 56,
+	58, 58, 56, 56, 56, 56, 56, 56, 58, 57, 57, 57,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 57, 57, 57, 58, 58, 56, 56, 56, 58, 56, 56,
+	56, 56, 56, 56, 56, 306, 57, 58, 307, 307, 307, 307,
+	307, 307, 307, 308, 307, 307, 307, 309, 310, 311, 312, 313,
+	314, 315, 255, 314, 316, 35, 35, 51, 317, 317, 318, 38,
+	319, 319, 318, 38, 35, 35, 35, 51, 320, 321, 321, 322,
+	4, 323, 324, 325, 326, 327, 328, 329, 41, 330, 41, 41,
+	330, 331, 332, 332, 51, 38, 38, 35, 333, 334, 35, 335,
+	335, 51, 51, 51, 89, 318, 336, 334, 334, 333, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 335, 51, 255, 51,
+	255, 255, 255, 255, 51, 255, 255, 307, 337, 338, 338, 338,
+	338, 339, 340, 341, 342, 343, 344, 344, 344, 344, 344, 344,
+	345, 46, 58, 58, 42, 345, 345, 345, 345, 345, 346, 346,
+	51, 318, 336, 37, 345, 42, 42, 42, 42, 345, 345, 345,
+	345, 345, 346, 346, 51, 318, 336, 58, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 58, 58, 58,
+	190, 190, 190, 190, 190, 190, 190, 330, 190, 347, 190, 190,
+	34, 190, 190, 190, 190, 190, 190, 190, 190, 190, 330, 190,
+	190, 190, 190, 330, 190, 190, 330, 190, 330, 348, 348, 348,
+	348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	51, 51, 44, 331, 51, 35, 51, 44, 51, 331, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 50, 51, 44, 349, 51,
+	51, 44, 44, 44, 44, 44, 51, 51, 51, 35, 40, 51,
+	44, 51, 61, 51, 44, 51, 46, 37, 44, 44, 350, 44,
+	44, 44, 46, 44, 44, 44, 44, 44, 44, 351, 51, 51,
+	44, 44, 44, 44, 51, 51, 51, 51, 51, 44, 44, 44,
+	44, 44, 51, 51, 51, 51, 46, 209, 51, 51, 51, 35,
+	35, 51, 51, 51, 51, 51, 51, 35, 35, 35, 35, 51,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	46, 46, 46, 46, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 35, 51, 51, 58, 58, 58, 58,
+	35, 35, 35, 35, 40, 40, 40, 40, 40, 40, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 36, 36, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 35, 35, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 35, 51, 35, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 35, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 35, 51, 35, 35, 51, 51, 51, 35,
+	35, 51, 51, 35, 51, 51, 51, 35, 51, 35, 352, 190,
+	51, 35, 51, 51, 51, 51, 35, 51, 51, 35, 35, 35,
+	35, 51, 51, 35, 51, 35, 51, 35, 35, 35, 35, 35,
+	35, 51, 35, 51, 51, 51, 51, 51, 35, 35, 35, 35,
+	51, 51, 51, 51, 35, 35, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 35, 51, 51, 51, 35, 51, 51, 51,
+	51, 51, 35, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 35, 35, 51, 51, 35, 35, 35, 35,
+	51, 51, 35, 35, 51, 51, 35, 35, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 35, 35, 51, 51, 35, 35, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 51, 51,
+	51, 35, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 35, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 35, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 353, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 318, 336, 318, 336, 51, 51, 51, 51,
+	51, 51, 35, 51, 51, 51, 51, 51, 51, 51, 354, 354,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	36, 355, 356, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	36, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 209, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 36,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 357, 357, 357, 357, 36, 36, 36, 354, 358, 358, 354,
+	51, 51, 51, 51, 36, 36, 36, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 42, 42, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+	359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359,
+	359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359,
+	359, 359, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 360, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 51, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 51, 51, 51, 51,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 51, 51, 35, 35, 35, 35, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 35, 35, 51, 35,
+	35, 35, 35, 35, 35, 35, 36, 36, 51, 51, 51, 51,
+	51, 51, 35, 35, 51, 51, 40, 35, 51, 51, 51, 51,
+	35, 35, 51, 51, 40, 35, 51, 51, 51, 51, 35, 35,
+	35, 51, 51, 35, 51, 51, 35, 35, 35, 35, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 35, 35, 35, 35, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 35, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 36, 36, 357, 357, 51, 358, 358, 358, 358,
+	36, 40, 35, 36, 36, 40, 36, 36, 36, 36, 40, 40,
+	36, 36, 36, 51, 354, 354, 36, 36, 358, 36, 358, 358,
+	361, 362, 361, 358, 36, 36, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 358, 358, 358, 36, 36, 36, 36,
+	40, 36, 40, 36, 36, 36, 36, 36, 357, 357, 357, 357,
+	357, 357, 357, 357, 357, 357, 357, 357, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 36, 36, 36, 40, 40, 36, 40,
+	40, 40, 36, 40, 361, 40, 40, 36, 40, 40, 36, 40,
+	36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 354, 36, 36, 36, 36, 36, 36, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 36, 36, 36, 357,
+	36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 40, 40,
+	36, 357, 36, 36, 36, 36, 36, 36, 36, 36, 357, 357,
+	363, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 354, 354, 361, 358, 358, 358, 358,
+	354, 354, 361, 361, 361, 40, 40, 40, 40, 361, 357, 361,
+	361, 361, 40, 361, 354, 40, 40, 40, 361, 361, 40, 40,
+	361, 40, 40, 361, 361, 361, 36, 40, 36, 36, 36, 36,
+	40, 40, 354, 40, 40, 40, 40, 40, 40, 361, 354, 354,
+	361, 354, 40, 361, 361, 364, 354, 40, 40, 354, 361, 361,
+	358, 358, 358, 358, 358, 357, 51, 51, 358, 358, 365, 365,
+	362, 362, 36, 36, 36, 36, 36, 51, 36, 51, 36, 51,
+	51, 51, 51, 51, 51, 36, 51, 51, 51, 36, 51, 51,
+	51, 51, 51, 51, 357, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 36, 36, 51, 51, 51, 51, 51, 51, 51,
+	51, 35, 51, 51, 51, 51, 51, 51, 36, 51, 51, 36,
+	51, 51, 51, 51, 357, 51, 357, 51, 51, 51, 51, 357,
+	357, 357, 51, 357, 51, 51, 51, 38, 38, 38, 38, 38,
+	38, 51, 253, 366, 358, 36, 36, 36, 318, 336, 318, 336,
+	318, 336, 318, 336, 318, 336, 318, 336, 318, 336, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 357, 357, 357, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 36, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 357, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 357,
+	51, 51, 51, 51, 51, 318, 336, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 16, 30, 16, 30, 16, 30, 16, 30, 318, 336,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 367, 367, 367, 367, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	36, 36, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 318, 336, 16, 30, 318,
+	336, 318, 336, 318, 336, 318, 336, 318, 336, 318, 336, 318,
+	336, 318, 336, 318, 336, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 318, 336, 318, 336,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 318, 336, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 36, 36, 36,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 357, 357, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	357, 51, 51, 51, 51, 357, 35, 35, 35, 35, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	58, 58, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 58, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 368, 368, 368, 368,
+	368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368,
+	368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368,
+	368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368,
+	368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368,
+	368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368,
+	368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368,
+	368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368,
+	368, 368, 368, 368, 368, 368, 368, 368, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 62, 62, 369, 369, 369,
+	369, 369, 369, 62, 62, 62, 62, 370, 370, 370, 62, 62,
+	58, 58, 58, 58, 58, 371, 372, 372, 372, 369, 371, 372,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 58, 216, 58, 58, 58, 58, 58, 216, 58, 58,
+	373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+	373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+	373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+	373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+	373, 373, 373, 373, 373, 373, 373, 373, 58, 58, 58, 58,
+	58, 58, 58, 373, 374, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 375, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 220, 220, 220, 220, 220, 220, 220, 58,
+	220, 220, 220, 220, 220, 220, 220, 58, 220, 220, 220, 220,
+	220, 220, 220, 58, 220, 220, 220, 220, 220, 220, 220, 58,
+	220, 220, 220, 220, 220, 220, 220, 58, 220, 220, 220, 220,
+	220, 220, 220, 58, 220, 220, 220, 220, 220, 220, 220, 58,
+	220, 220, 220, 220, 220, 220, 220, 58, 66, 66, 66, 66,
+	66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+	66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+	66, 66, 66, 66, 38, 38, 38, 38, 38, 38, 38, 38,
+	38, 38, 38, 38, 38, 38, 255, 255, 255, 255, 255, 255,
+	255, 255, 51, 255, 318, 255, 51, 51, 38, 38, 51, 51,
+	38, 38, 318, 336, 318, 336, 318, 336, 318, 336, 255, 255,
+	255, 255, 253, 47, 255, 255, 51, 255, 255, 51, 51, 51,
+	51, 51, 376, 376, 255, 255, 255, 51, 255, 255, 318, 255,
+	255, 255, 255, 255, 255, 255, 255, 51, 255, 51, 255, 255,
+	51, 51, 51, 253, 253, 318, 336, 318, 336, 318, 336, 318,
+	336, 255, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 58, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 377, 377, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 378, 378, 378, 378,
+	378, 378, 378, 378, 378, 378, 378, 378, 58, 58, 58, 58,
+	379, 356, 356, 378, 378, 380, 381, 382, 355, 356, 355, 356,
+	355, 356, 355, 356, 355, 356, 378, 378, 355, 356, 355, 356,
+	355, 356, 355, 356, 383, 355, 356, 356, 378, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 384, 384, 384, 384, 385, 385,
+	354, 386, 386, 386, 386, 387, 378, 378, 382, 382, 382, 380,
+	388, 354, 378, 389, 58, 390, 391, 390, 391, 390, 391, 390,
+	391, 390, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 390, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 390,
+	391, 390, 391, 390, 391, 391, 391, 391, 391, 391, 390, 391,
+	391, 391, 391, 391, 391, 390, 390, 58, 58, 384, 384, 392,
+	392, 390, 390, 391, 392, 393, 394, 393, 394, 393, 394, 393,
+	394, 393, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 393, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 393,
+	394, 393, 394, 393, 394, 394, 394, 394, 394, 394, 393, 394,
+	394, 394, 394, 394, 394, 393, 393, 394, 394, 394, 394, 383,
+	395, 393, 393, 394, 58, 58, 58, 58, 58, 396, 396, 396,
+	396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+	396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+	396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+	396, 396, 396, 396, 58, 397, 397, 397, 397, 397, 397, 397,
+	397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397,
+	397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397,
+	397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397,
+	397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397,
+	397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397,
+	397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397,
+	397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397,
+	397, 397, 397, 58, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 396, 396, 396, 396,
+	396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+	396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+	396, 396, 396, 396, 378, 378, 378, 378, 378, 378, 378, 378,
+	378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378,
+	378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378,
+	378, 378, 378, 378, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 393, 393, 393, 393, 393, 393, 393, 393,
+	393, 393, 393, 393, 393, 393, 393, 393, 398, 398, 398, 398,
+	398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+	398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+	398, 399, 399, 58, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 359, 359, 359, 359,
+	359, 359, 359, 359, 378, 378, 378, 378, 378, 378, 378, 378,
+	378, 378, 378, 378, 378, 378, 378, 378, 398, 398, 398, 398,
+	398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+	398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+	399, 399, 399, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 400, 381, 400, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 378, 378, 378, 378, 378, 378, 378,
+	378, 378, 378, 378, 378, 378, 378, 378, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 378, 378, 378, 378,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 381,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+	394, 394, 394, 394, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 378,
+	378, 378, 378, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 378, 378, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 378, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 402, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 58, 58, 58, 403, 403, 403, 403,
+	403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403,
+	403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403,
+	403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403,
+	403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403,
+	403, 403, 403, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404,
+	404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404,
+	404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404,
+	404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 405, 405,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 407, 408, 407, 406, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406,
+	409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 406, 406,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 66, 66, 66, 66, 410,
+	66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 410, 411,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	63, 63, 63, 63, 63, 63, 66, 66, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 413, 413, 414, 415, 415, 415, 415, 415,
+	58, 58, 58, 58, 58, 58, 58, 58, 51, 51, 51, 51,
+	51, 51, 51, 51, 47, 47, 47, 47, 47, 47, 47, 47,
+	47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+	47, 47, 47, 47, 47, 47, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	47, 44, 44, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 58, 58, 58, 58, 58,
+	46, 46, 58, 46, 58, 46, 46, 46, 46, 46, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	416, 416, 417, 416, 416, 416, 417, 416, 416, 416, 416, 417,
+	416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416,
+	416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 418,
+	418, 417, 417, 418, 419, 419, 419, 419, 417, 58, 58, 58,
+	209, 209, 209, 209, 209, 209, 209, 209, 330, 350, 58, 58,
+	58, 58, 58, 58, 420, 420, 420, 420, 420, 420, 420, 420,
+	420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420,
+	420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420,
+	420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420,
+	420, 420, 420, 420, 420, 420, 420, 420, 421, 421, 422, 422,
+	58, 58, 58, 58, 58, 58, 58, 58, 423, 423, 424, 424,
+	424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424,
+	424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424,
+	424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424,
+	424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424,
+	423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423,
+	423, 423, 423, 423, 425, 425, 58, 58, 58, 58, 58, 58,
+	58, 58, 426, 426, 427, 427, 427, 427, 427, 427, 427, 427,
+	427, 427, 58, 58, 58, 58, 58, 58, 120, 120, 120, 120,
+	120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+	120, 120, 122, 122, 122, 122, 122, 122, 125, 125, 125, 122,
+	428, 122, 122, 120, 429, 429, 429, 429, 429, 429, 429, 429,
+	429, 429, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430,
+	430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430,
+	430, 430, 430, 430, 430, 430, 431, 431, 431, 431, 431, 431,
+	431, 431, 123, 432, 433, 433, 433, 433, 433, 433, 433, 433,
+	433, 433, 433, 433, 433, 433, 433, 433, 433, 433, 433, 433,
+	433, 433, 433, 434, 434, 434, 434, 434, 434, 434, 434, 434,
+	434, 434, 435, 435, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 436, 217, 217, 217, 217, 217, 217, 217, 217,
+	217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+	217, 217, 217, 217, 217, 217, 217, 217, 217, 58, 58, 58,
+	437, 437, 437, 438, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 437, 438, 438, 437, 437, 437, 437, 438, 438,
+	437, 437, 438, 438, 438, 440, 440, 440, 440, 440, 440, 441,
+	441, 441, 440, 440, 440, 440, 58, 44, 442, 442, 442, 442,
+	442, 442, 442, 442, 442, 442, 58, 58, 58, 58, 440, 440,
+	210, 210, 210, 210, 210, 212, 210, 210, 210, 210, 210, 210,
+	210, 210, 210, 210, 214, 214, 214, 214, 214, 214, 214, 214,
+	214, 214, 210, 210, 210, 210, 210, 58, 443, 443, 443, 443,
+	443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443,
+	443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443,
+	443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443,
+	443, 444, 444, 444, 444, 444, 444, 445, 445, 444, 444, 445,
+	445, 444, 444, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	443, 443, 443, 444, 443, 443, 443, 443, 443, 443, 443, 443,
+	444, 445, 58, 58, 446, 446, 446, 446, 446, 446, 446, 446,
+	446, 446, 58, 58, 447, 448, 448, 448, 210, 210, 210, 210,
+	210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+	210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 211,
+	212, 211, 210, 210, 449, 449, 449, 449, 449, 449, 449, 449,
+	449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449,
+	449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449,
+	449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449,
+	449, 449, 449, 449, 450, 449, 450, 450, 450, 449, 449, 450,
+	450, 449, 449, 449, 449, 449, 450, 450, 449, 450, 449, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 449,
+	449, 449, 449, 449, 451, 451, 451, 451, 451, 451, 451, 451,
+	451, 451, 451, 452, 453, 453, 452, 452, 454, 454, 451, 451,
+	451, 452, 453, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 220, 220, 220, 220, 220, 220, 58, 58, 220, 220, 220,
+	220, 220, 220, 58, 58, 220, 220, 220, 220, 220, 220, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 220, 220, 220, 220,
+	220, 220, 220, 58, 220, 220, 220, 220, 220, 220, 220, 58,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 44, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 56, 46, 46, 46, 46, 51, 51,
+	58, 58, 58, 58, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+	451, 451, 451, 451, 451, 451, 451, 451, 451, 451, 451, 451,
+	451, 451, 451, 451, 451, 451, 451, 451, 451, 451, 451, 451,
+	451, 451, 451, 451, 451, 451, 451, 451, 451, 451, 451, 452,
+	452, 453, 452, 452, 453, 452, 452, 454, 452, 453, 58, 58,
+	455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 58, 58,
+	58, 58, 58, 58, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 456, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	456, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 218, 218, 218, 218, 218, 218, 218, 218,
+	218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+	218, 218, 218, 58, 58, 58, 58, 219, 219, 219, 219, 219,
+	219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+	219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+	219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+	219, 219, 219, 219, 219, 219, 219, 219, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 459, 459,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	46, 46, 46, 46, 46, 46, 46, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 68, 68, 68, 68, 68,
+	58, 58, 58, 58, 58, 80, 76, 80, 80, 80, 80, 80,
+	80, 80, 80, 80, 80, 460, 80, 80, 80, 80, 80, 80,
+	80, 80, 80, 80, 80, 80, 80, 75, 80, 80, 80, 80,
+	80, 75, 80, 75, 80, 80, 75, 80, 80, 75, 80, 80,
+	80, 80, 80, 80, 80, 80, 80, 80, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 86, 86,
+	86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101, 101, 101, 101, 101, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 336, 318,
+	85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+	85, 85, 85, 85, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 101, 101, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 101, 101, 101, 101, 101, 101, 101, 85,
+	461, 461, 461, 461, 461, 461, 461, 461, 461, 461, 461, 461,
+	461, 461, 461, 461, 461, 461, 461, 461, 461, 461, 461, 461,
+	461, 461, 461, 461, 461, 461, 461, 461, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 88, 85, 85, 85,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 462, 356, 356, 463, 462, 464, 464, 355,
+	356, 465, 58, 58, 58, 58, 58, 58, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 66, 66,
+	378, 378, 378, 466, 466, 355, 356, 355, 356, 355, 356, 355,
+	356, 355, 356, 355, 356, 355, 356, 355, 356, 378, 378, 355,
+	356, 378, 378, 378, 378, 466, 466, 466, 467, 378, 468, 58,
+	469, 470, 464, 464, 378, 355, 356, 355, 356, 355, 356, 471,
+	378, 378, 472, 472, 378, 378, 378, 58, 378, 473, 474, 378,
+	58, 58, 58, 58, 95, 95, 95, 95, 95, 101, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 101, 101, 337, 58, 475, 476, 477, 478, 479, 476, 480,
+	481, 482, 476, 483, 484, 483, 485, 486, 487, 487, 487, 487,
+	487, 487, 487, 487, 487, 487, 488, 489, 476, 476, 476, 475,
+	476, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490,
+	490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490,
+	490, 490, 490, 481, 476, 482, 476, 491, 476, 490, 490, 490,
+	490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490,
+	490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 481,
+	476, 482, 476, 481, 482, 492, 493, 492, 492, 494, 495, 496,
+	496, 496, 496, 496, 496, 496, 496, 496, 497, 495, 495, 495,
+	495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495,
+	495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495,
+	495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495,
+	495, 495, 495, 495, 495, 495, 498, 498, 499, 499, 499, 499,
+	499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499,
+	499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499,
+	499, 499, 499, 58, 58, 58, 499, 499, 499, 499, 499, 499,
+	58, 58, 499, 499, 499, 499, 499, 499, 58, 58, 499, 499,
+	499, 499, 499, 499, 58, 58, 499, 499, 499, 58, 58, 58,
+	479, 478, 476, 476, 476, 478, 478, 58, 500, 500, 500, 500,
+	500, 500, 500, 58, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 501, 501, 501, 502, 35, 461, 461, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 58, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 58,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 58, 503, 503, 58, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 58, 58, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+	503, 503, 503, 503, 503, 503, 503, 58, 58, 58, 58, 58,
+	123, 255, 123, 58, 58, 58, 58, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 58, 58, 58, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 504, 504, 504, 504, 504, 504, 504, 504,
+	504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+	504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+	504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+	504, 504, 504, 504, 504, 504, 504, 504, 504, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 505, 505, 58,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 58, 58, 58, 57, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 67, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	506, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506,
+	506, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506,
+	506, 506, 506, 506, 506, 58, 58, 58, 507, 507, 507, 507,
+	507, 507, 507, 507, 507, 507, 507, 507, 507, 507, 507, 507,
+	507, 507, 507, 507, 507, 507, 507, 507, 507, 507, 507, 507,
+	507, 507, 507, 507, 507, 507, 507, 507, 507, 507, 507, 507,
+	507, 507, 507, 507, 507, 507, 507, 507, 507, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	67, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345,
+	345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345,
+	345, 345, 345, 345, 58, 58, 58, 58, 508, 508, 508, 508,
+	508, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508,
+	508, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508,
+	508, 508, 508, 508, 509, 509, 509, 509, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 508, 508, 508, 510, 510, 510, 510,
+	510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510,
+	510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 58,
+	58, 58, 58, 58, 511, 511, 511, 511, 511, 511, 511, 511,
+	511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511,
+	511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511,
+	511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 58,
+	58, 58, 58, 58, 513, 513, 513, 513, 513, 513, 513, 513,
+	513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+	513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 58, 514,
+	515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515,
+	515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515,
+	515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515,
+	58, 58, 58, 58, 515, 515, 515, 515, 515, 515, 515, 515,
+	516, 515, 515, 515, 515, 515, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+	517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+	517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+	517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+	517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+	517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+	517, 517, 517, 517, 517, 517, 517, 517, 518, 518, 518, 518,
+	518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518,
+	518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518,
+	518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518,
+	518, 518, 518, 518, 518, 518, 518, 518, 519, 519, 519, 519,
+	519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519,
+	519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519,
+	519, 519, 58, 58, 520, 520, 520, 520, 520, 520, 520, 520,
+	520, 520, 58, 58, 58, 58, 58, 58, 521, 521, 521, 521,
+	521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 521,
+	521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 521,
+	521, 521, 521, 521, 521, 521, 521, 521, 58, 58, 58, 58,
+	521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 521,
+	521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 521,
+	521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 521,
+	58, 58, 58, 58, 522, 522, 522, 522, 522, 522, 522, 522,
+	522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522,
+	522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522,
+	522, 522, 522, 522, 522, 522, 522, 522, 58, 58, 58, 58,
+	58, 58, 58, 58, 523, 523, 523, 523, 523, 523, 523, 523,
+	523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523,
+	523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523,
+	523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523,
+	523, 523, 523, 523, 523, 523, 523, 523, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 524, 525, 525, 525, 525,
+	525, 525, 525, 525, 525, 525, 525, 58, 525, 525, 525, 525,
+	525, 525, 525, 525, 525, 525, 525, 525, 525, 525, 525, 58,
+	525, 525, 525, 525, 525, 525, 525, 58, 525, 525, 58, 525,
+	525, 525, 525, 525, 525, 525, 525, 525, 525, 525, 58, 525,
+	525, 525, 525, 525, 525, 525, 525, 525, 525, 525, 525, 525,
+	525, 525, 58, 525, 525, 525, 525, 525, 525, 525, 58, 525,
+	525, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526,
+	526, 526, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	526, 526, 526, 526, 526, 526, 526, 526, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 46, 46, 46, 46,
+	46, 46, 58, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 58, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 527, 527, 527, 527, 527, 527, 75, 75,
+	527, 75, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+	527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+	527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+	527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 75, 527,
+	527, 75, 75, 75, 527, 75, 75, 527, 528, 528, 528, 528,
+	528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528,
+	528, 528, 528, 528, 528, 528, 75, 529, 530, 530, 530, 530,
+	530, 530, 530, 530, 531, 531, 531, 531, 531, 531, 531, 531,
+	531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531,
+	531, 531, 531, 532, 532, 532, 532, 532, 532, 532, 532, 532,
+	533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533,
+	533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533,
+	533, 533, 533, 533, 533, 533, 533, 75, 75, 75, 75, 75,
+	75, 75, 75, 534, 534, 534, 534, 534, 534, 534, 534, 534,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	535, 535, 535, 535, 535, 535, 535, 535, 535, 535, 535, 535,
+	535, 535, 535, 535, 535, 535, 535, 75, 535, 535, 75, 75,
+	75, 75, 75, 536, 536, 536, 536, 536, 537, 537, 537, 537,
+	537, 537, 537, 537, 537, 537, 537, 537, 537, 537, 537, 537,
+	537, 537, 537, 537, 537, 537, 538, 538, 538, 538, 538, 538,
+	75, 75, 75, 539, 540, 540, 540, 540, 540, 540, 540, 540,
+	540, 540, 540, 540, 540, 540, 540, 540, 540, 540, 540, 540,
+	540, 540, 540, 540, 540, 540, 75, 75, 75, 75, 75, 541,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 542, 542, 542, 542, 542, 542, 542, 542,
+	542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+	542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+	543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543,
+	543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543,
+	75, 75, 75, 75, 544, 544, 543, 543, 544, 544, 544, 544,
+	544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+	75, 75, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+	544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+	544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+	544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+	545, 546, 546, 546, 75, 546, 546, 75, 75, 75, 75, 75,
+	546, 546, 546, 546, 545, 545, 545, 545, 75, 545, 545, 545,
+	75, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545,
+	545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545,
+	545, 545, 545, 545, 545, 545, 75, 75, 546, 546, 546, 75,
+	75, 75, 75, 546, 547, 547, 547, 547, 547, 547, 547, 547,
+	547, 75, 75, 75, 75, 75, 75, 75, 548, 548, 548, 548,
+	548, 548, 548, 548, 547, 75, 75, 75, 75, 75, 75, 75,
+	549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 549,
+	549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 549,
+	549, 549, 549, 549, 549, 550, 550, 550, 551, 551, 551, 551,
+	551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551,
+	551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551,
+	551, 552, 552, 552, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	553, 553, 553, 553, 553, 553, 553, 553, 554, 553, 553, 553,
+	553, 553, 553, 553, 553, 553, 553, 553, 553, 553, 553, 553,
+	553, 553, 553, 553, 553, 553, 553, 553, 553, 553, 553, 553,
+	553, 555, 555, 75, 75, 75, 75, 554, 554, 554, 554, 554,
+	556, 556, 556, 556, 556, 556, 557, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 558, 558, 558, 558, 558, 558, 558, 558,
+	558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+	558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+	558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+	558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 75, 75,
+	75, 559, 559, 559, 559, 559, 559, 559, 560, 560, 560, 560,
+	560, 560, 560, 560, 560, 560, 560, 560, 560, 560, 560, 560,
+	560, 560, 560, 560, 560, 560, 75, 75, 561, 561, 561, 561,
+	561, 561, 561, 561, 562, 562, 562, 562, 562, 562, 562, 562,
+	562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 75,
+	75, 75, 75, 75, 563, 563, 563, 563, 563, 563, 563, 563,
+	564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564,
+	564, 564, 564, 564, 564, 564, 75, 75, 75, 75, 75, 75,
+	75, 565, 565, 565, 565, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 565, 565, 565, 565, 565, 565, 565,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 566, 566, 566, 566,
+	566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566,
+	566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566,
+	566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566,
+	566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566,
+	566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566,
+	566, 566, 566, 566, 566, 566, 566, 566, 566, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 567, 567, 567, 567, 567, 567, 567, 567,
+	567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+	567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+	567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+	567, 567, 567, 567, 567, 567, 567, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 567, 567, 567, 567,
+	567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+	567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+	567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+	567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 75,
+	75, 75, 75, 75, 75, 75, 568, 568, 568, 568, 568, 568,
+	569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+	569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+	569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+	570, 570, 570, 570, 101, 101, 101, 101, 101, 101, 101, 101,
+	571, 571, 571, 571, 571, 571, 571, 571, 571, 571, 101, 101,
+	101, 101, 101, 101, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 572, 572, 572, 572, 572, 572, 572, 572,
+	572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572,
+	572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 75,
+	573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573,
+	573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573,
+	573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573,
+	573, 573, 573, 573, 573, 573, 75, 574, 574, 575, 75, 75,
+	573, 573, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 576, 576, 576, 576,
+	576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576,
+	576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576,
+	576, 577, 577, 577, 577, 577, 577, 577, 577, 577, 577, 576,
+	75, 75, 75, 75, 75, 75, 75, 75, 578, 578, 578, 578,
+	578, 578, 578, 578, 578, 578, 578, 578, 578, 578, 578, 578,
+	578, 578, 578, 578, 578, 578, 579, 579, 579, 579, 579, 579,
+	579, 579, 579, 579, 579, 580, 580, 580, 580, 580, 580, 580,
+	580, 580, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581,
+	581, 581, 581, 581, 581, 581, 582, 582, 582, 582, 583, 583,
+	583, 583, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 584, 584, 584, 584, 584, 584, 584, 584,
+	584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584,
+	584, 585, 585, 585, 585, 585, 585, 585, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	587, 588, 587, 589, 589, 589, 589, 589, 589, 589, 589, 589,
+	589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589,
+	589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589,
+	589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589,
+	589, 589, 589, 589, 589, 589, 589, 589, 588, 588, 588, 588,
+	588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 590,
+	590, 591, 591, 591, 591, 591, 58, 58, 58, 58, 592, 592,
+	592, 592, 592, 592, 592, 592, 592, 592, 592, 592, 592, 592,
+	592, 592, 592, 592, 592, 592, 593, 593, 593, 593, 593, 593,
+	593, 593, 593, 593, 588, 589, 589, 588, 588, 589, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 588, 594, 594, 595, 596,
+	596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+	596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+	596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+	596, 596, 596, 596, 596, 596, 596, 596, 595, 595, 595, 594,
+	594, 594, 594, 595, 595, 594, 594, 597, 597, 598, 599, 599,
+	599, 599, 594, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 598, 58, 58, 600, 600, 600, 600, 600, 600, 600, 600,
+	600, 600, 600, 600, 600, 600, 600, 600, 600, 600, 600, 600,
+	600, 600, 600, 600, 600, 58, 58, 58, 58, 58, 58, 58,
+	601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 58, 58,
+	58, 58, 58, 58, 602, 602, 602, 603, 603, 603, 603, 603,
+	603, 603, 603, 603, 603, 603, 603, 603, 603, 603, 603, 603,
+	603, 603, 603, 603, 603, 603, 603, 603, 603, 603, 603, 603,
+	603, 603, 603, 603, 603, 603, 603, 602, 602, 602, 602, 602,
+	604, 602, 602, 602, 602, 602, 602, 602, 602, 58, 605, 605,
+	605, 605, 605, 605, 605, 605, 605, 605, 606, 606, 606, 606,
+	603, 604, 604, 603, 58, 58, 58, 58, 58, 58, 58, 58,
+	607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607,
+	607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607,
+	607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 608,
+	609, 610, 607, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	611, 611, 612, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+	613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+	613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+	613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+	613, 613, 613, 612, 612, 612, 611, 611, 611, 611, 611, 611,
+	611, 611, 611, 612, 612, 613, 614, 614, 613, 615, 615, 616,
+	615, 611, 611, 611, 611, 616, 612, 611, 617, 617, 617, 617,
+	617, 617, 617, 617, 617, 617, 613, 618, 613, 615, 615, 615,
+	58, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+	186, 186, 186, 186, 186, 186, 186, 186, 186, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 619, 619, 619, 619,
+	619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619,
+	619, 619, 58, 619, 619, 619, 619, 619, 619, 619, 619, 619,
+	619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619,
+	619, 619, 619, 619, 620, 620, 620, 621, 621, 621, 620, 620,
+	621, 620, 621, 621, 622, 622, 623, 622, 622, 623, 621, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 624, 624, 624, 624, 624, 624, 624, 58,
+	624, 58, 624, 624, 624, 624, 58, 624, 624, 624, 624, 624,
+	624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 58, 624,
+	624, 624, 624, 624, 624, 624, 624, 624, 624, 625, 58, 58,
+	58, 58, 58, 58, 626, 626, 626, 626, 626, 626, 626, 626,
+	626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626,
+	626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626,
+	626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626,
+	626, 626, 626, 627, 628, 628, 628, 627, 627, 627, 627, 627,
+	627, 627, 627, 58, 58, 58, 58, 58, 629, 629, 629, 629,
+	629, 629, 629, 629, 629, 629, 58, 58, 58, 58, 58, 58,
+	630, 630, 631, 631, 58, 632, 632, 632, 632, 632, 632, 632,
+	632, 58, 58, 632, 632, 58, 58, 632, 632, 632, 632, 632,
+	632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+	632, 632, 632, 632, 632, 58, 632, 632, 632, 632, 632, 632,
+	632, 58, 632, 632, 58, 632, 632, 632, 632, 632, 58, 67,
+	630, 632, 633, 631, 630, 631, 631, 631, 631, 58, 58, 631,
+	631, 58, 58, 631, 631, 631, 58, 58, 632, 58, 58, 58,
+	58, 58, 58, 633, 58, 58, 58, 58, 58, 632, 632, 632,
+	632, 632, 631, 631, 58, 58, 630, 630, 630, 630, 630, 630,
+	630, 58, 58, 58, 630, 630, 630, 630, 630, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 634, 634, 634, 634, 634, 634, 634, 634,
+	634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634,
+	634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634,
+	634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634,
+	634, 634, 634, 634, 634, 634, 634, 634, 634, 635, 635, 635,
+	636, 636, 636, 636, 636, 636, 636, 636, 635, 635, 636, 636,
+	636, 635, 636, 634, 634, 634, 634, 637, 637, 637, 637, 638,
+	639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 637, 637,
+	58, 638, 636, 634, 634, 634, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640,
+	640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640,
+	640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640,
+	640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640,
+	641, 642, 642, 643, 643, 643, 643, 643, 643, 642, 643, 642,
+	642, 641, 642, 643, 643, 642, 643, 643, 640, 640, 644, 640,
+	58, 58, 58, 58, 58, 58, 58, 58, 645, 645, 645, 645,
+	645, 645, 645, 645, 645, 645, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 646, 646, 646, 646, 646, 646, 646, 646,
+	646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646,
+	646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646,
+	646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646,
+	646, 646, 646, 647, 648, 648, 649, 649, 649, 649, 58, 58,
+	648, 648, 648, 648, 649, 649, 648, 649, 649, 650, 651, 651,
+	652, 652, 653, 653, 653, 651, 651, 651, 651, 651, 651, 651,
+	651, 651, 651, 651, 651, 651, 651, 651, 646, 646, 646, 646,
+	649, 649, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654,
+	654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654,
+	654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654,
+	654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654,
+	655, 655, 655, 656, 656, 656, 656, 656, 656, 656, 656, 655,
+	655, 656, 655, 656, 656, 657, 657, 658, 654, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 659, 659, 659, 659,
+	659, 659, 659, 659, 659, 659, 58, 58, 58, 58, 58, 58,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 660, 660, 660, 660,
+	660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660,
+	660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660,
+	660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660,
+	660, 660, 660, 661, 662, 661, 662, 662, 661, 661, 661, 661,
+	661, 661, 662, 661, 660, 663, 58, 58, 58, 58, 58, 58,
+	664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 665, 665, 665, 665, 665, 665, 665, 665,
+	665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+	665, 665, 665, 665, 665, 665, 665, 58, 58, 666, 666, 666,
+	667, 667, 666, 666, 666, 666, 668, 666, 666, 666, 666, 666,
+	58, 58, 58, 58, 669, 669, 669, 669, 669, 669, 669, 669,
+	669, 669, 665, 665, 670, 670, 670, 665, 665, 665, 665, 665,
+	665, 665, 665, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 671, 671, 671, 671,
+	671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671,
+	671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671,
+	671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671,
+	671, 671, 671, 671, 672, 672, 672, 673, 673, 673, 673, 673,
+	673, 673, 673, 673, 672, 673, 673, 674, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	675, 675, 675, 675, 675, 675, 675, 675, 675, 675, 675, 675,
+	675, 675, 675, 675, 675, 675, 675, 675, 675, 675, 675, 675,
+	675, 675, 675, 675, 675, 675, 675, 675, 675, 675, 675, 675,
+	675, 675, 675, 675, 675, 675, 675, 675, 675, 675, 675, 675,
+	675, 675, 675, 675, 675, 675, 675, 675, 675, 675, 675, 675,
+	675, 675, 675, 675, 676, 676, 676, 676, 676, 676, 676, 676,
+	676, 676, 677, 677, 677, 677, 677, 677, 677, 677, 677, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 675,
+	678, 678, 678, 678, 678, 678, 678, 58, 58, 678, 58, 58,
+	678, 678, 678, 678, 678, 678, 678, 678, 58, 678, 678, 58,
+	678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678,
+	678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678,
+	679, 680, 680, 680, 680, 680, 58, 680, 680, 58, 58, 681,
+	681, 680, 681, 682, 680, 682, 680, 681, 683, 683, 683, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 684, 684, 684, 684,
+	684, 684, 684, 684, 684, 684, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 685, 685, 685, 685, 685, 685, 685, 685,
+	58, 58, 685, 685, 685, 685, 685, 685, 685, 685, 685, 685,
+	685, 685, 685, 685, 685, 685, 685, 685, 685, 685, 685, 685,
+	685, 685, 685, 685, 685, 685, 685, 685, 685, 685, 685, 685,
+	685, 685, 685, 685, 685, 686, 686, 686, 687, 687, 687, 687,
+	58, 58, 687, 687, 686, 686, 686, 686, 687, 685, 688, 685,
+	686, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 689, 690, 690, 690, 690, 690, 690, 691,
+	691, 690, 690, 689, 689, 689, 689, 689, 689, 689, 689, 689,
+	689, 689, 689, 689, 689, 689, 689, 689, 689, 689, 689, 689,
+	689, 689, 689, 689, 689, 689, 689, 689, 689, 689, 689, 689,
+	689, 689, 689, 689, 689, 689, 689, 690, 690, 690, 690, 690,
+	690, 692, 693, 690, 690, 690, 690, 694, 695, 696, 696, 696,
+	696, 694, 695, 690, 58, 58, 58, 58, 58, 58, 58, 58,
+	697, 698, 698, 698, 698, 698, 698, 699, 699, 698, 698, 698,
+	697, 697, 697, 697, 697, 697, 697, 697, 697, 697, 697, 697,
+	697, 697, 697, 697, 697, 697, 697, 697, 697, 697, 697, 697,
+	697, 697, 697, 697, 697, 697, 697, 697, 697, 697, 697, 697,
+	697, 697, 697, 697, 700, 700, 700, 700, 700, 700, 698, 698,
+	698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 699,
+	698, 698, 701, 701, 701, 697, 702, 702, 702, 701, 701, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+	227, 227, 227, 227, 703, 703, 703, 703, 703, 703, 703, 703,
+	703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703,
+	703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703,
+	703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703,
+	703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703,
+	703, 58, 58, 58, 58, 58, 58, 58, 704, 704, 704, 704,
+	704, 704, 704, 704, 704, 58, 704, 704, 704, 704, 704, 704,
+	704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704,
+	704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704,
+	704, 704, 704, 704, 704, 704, 704, 705, 706, 706, 706, 706,
+	706, 706, 706, 58, 706, 706, 706, 706, 706, 706, 705, 707,
+	704, 708, 708, 708, 708, 708, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 709, 709, 709, 709, 709, 709, 709, 709,
+	709, 709, 710, 710, 710, 710, 710, 710, 710, 710, 710, 710,
+	710, 710, 710, 710, 710, 710, 710, 710, 710, 58, 58, 58,
+	711, 712, 713, 713, 713, 713, 713, 713, 713, 713, 713, 713,
+	713, 713, 713, 713, 713, 713, 713, 713, 713, 713, 713, 713,
+	713, 713, 713, 713, 713, 713, 713, 713, 58, 58, 714, 714,
+	714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714,
+	714, 714, 714, 714, 714, 714, 714, 714, 58, 715, 714, 714,
+	714, 714, 714, 714, 714, 715, 714, 714, 715, 714, 714, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	716, 716, 716, 716, 716, 716, 716, 58, 716, 716, 58, 716,
+	716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716,
+	716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716,
+	716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716,
+	716, 717, 717, 717, 717, 717, 717, 58, 58, 58, 717, 58,
+	717, 717, 58, 717, 717, 717, 717, 717, 717, 717, 718, 717,
+	58, 58, 58, 58, 58, 58, 58, 58, 719, 719, 719, 719,
+	719, 719, 719, 719, 719, 719, 58, 58, 58, 58, 58, 58,
+	720, 720, 720, 720, 720, 720, 58, 720, 720, 58, 720, 720,
+	720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+	720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+	720, 720, 720, 720, 720, 720, 721, 721, 721, 721, 721, 58,
+	722, 722, 58, 721, 721, 722, 721, 722, 720, 58, 58, 58,
+	58, 58, 58, 58, 723, 723, 723, 723, 723, 723, 723, 723,
+	723, 723, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	724, 724, 724, 724, 724, 724, 724, 724, 724, 724, 724, 724,
+	724, 724, 724, 724, 724, 724, 724, 725, 725, 726, 726, 727,
+	727, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 404, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 157, 157, 157, 157,
+	157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+	157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 158, 158,
+	158, 728, 728, 728, 728, 158, 158, 158, 158, 158, 158, 158,
+	158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 729,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 58,
+	731, 731, 731, 731, 731, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+	730, 730, 730, 730, 730, 730, 730, 730, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 732, 732, 732, 732, 732, 732, 732, 732,
+	732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732,
+	732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732,
+	732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732,
+	732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732,
+	732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732,
+	732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732,
+	732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732,
+	732, 732, 732, 732, 732, 733, 733, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 735, 735, 735, 736, 736, 736, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 736, 734,
+	734, 734, 735, 736, 735, 736, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 735, 736, 736, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734,
+	734, 734, 734, 734, 734, 734, 734, 58, 737, 737, 737, 737,
+	737, 737, 737, 738, 739, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 741, 742, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740,
+	740, 740, 740, 740, 740, 740, 740, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 58, 58, 58, 58, 58, 58, 58, 743, 743, 743, 743,
+	743, 743, 743, 743, 743, 743, 743, 743, 743, 743, 743, 743,
+	743, 743, 743, 743, 743, 743, 743, 743, 743, 743, 743, 743,
+	743, 743, 743, 58, 744, 744, 744, 744, 744, 744, 744, 744,
+	744, 744, 58, 58, 58, 58, 745, 745, 746, 746, 746, 746,
+	746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746,
+	746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746,
+	746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746,
+	746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746,
+	746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746,
+	746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746,
+	746, 746, 746, 58, 747, 747, 747, 747, 747, 747, 747, 747,
+	747, 747, 58, 58, 58, 58, 58, 58, 748, 748, 748, 748,
+	748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748,
+	748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748,
+	748, 748, 58, 58, 749, 749, 749, 749, 749, 750, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 751, 751, 751, 751,
+	751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751,
+	751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751,
+	751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751,
+	751, 751, 751, 751, 751, 751, 751, 751, 752, 752, 752, 752,
+	752, 752, 752, 753, 753, 753, 754, 754, 754, 754, 754, 754,
+	751, 751, 751, 751, 753, 754, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 755, 755, 755, 755, 755, 755, 755, 755,
+	755, 755, 58, 754, 754, 754, 754, 754, 754, 754, 58, 751,
+	751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751,
+	751, 751, 751, 751, 751, 751, 751, 751, 58, 58, 58, 58,
+	58, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751,
+	751, 751, 751, 751, 751, 751, 751, 751, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 756, 756, 756, 756, 756, 756, 756, 756,
+	756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756,
+	756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756,
+	756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756,
+	756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756,
+	756, 756, 756, 756, 756, 756, 756, 756, 757, 757, 757, 757,
+	757, 757, 757, 757, 757, 757, 757, 757, 757, 757, 757, 757,
+	757, 757, 757, 757, 757, 757, 757, 758, 758, 757, 757, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 759, 759, 759, 759, 759, 759, 759, 759,
+	759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759,
+	759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759,
+	759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759,
+	759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759,
+	759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759,
+	759, 759, 759, 759, 759, 759, 759, 58, 58, 58, 58, 760,
+	759, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761,
+	761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761,
+	761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761,
+	761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761,
+	761, 761, 761, 761, 761, 761, 761, 761, 58, 58, 58, 58,
+	58, 58, 58, 760, 760, 760, 760, 759, 759, 759, 759, 759,
+	759, 759, 759, 759, 759, 759, 759, 759, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	762, 763, 764, 380, 765, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 766, 766, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+	767, 767, 767, 767, 767, 767, 767, 767, 58, 58, 58, 58,
+	58, 58, 58, 58, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+	768, 768, 768, 768, 768, 768, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	767, 767, 767, 767, 767, 767, 767, 767, 767, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 769, 769, 769, 769, 58, 769, 769, 769,
+	769, 769, 769, 769, 58, 769, 769, 58, 394, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 394, 394, 394, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 390, 390, 390, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 393, 393, 393, 393, 58, 58, 58, 58,
+	58, 58, 58, 58, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+	770, 770, 770, 770, 58, 58, 58, 58, 771, 771, 771, 771,
+	771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771,
+	771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771,
+	771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771,
+	771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771,
+	771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771,
+	771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771,
+	771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771,
+	771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771,
+	771, 771, 771, 771, 771, 771, 771, 58, 58, 58, 58, 58,
+	771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771,
+	771, 58, 58, 58, 771, 771, 771, 771, 771, 771, 771, 771,
+	771, 58, 58, 58, 58, 58, 58, 58, 771, 771, 771, 771,
+	771, 771, 771, 771, 771, 771, 58, 58, 772, 773, 773, 774,
+	344, 344, 344, 344, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 58, 58,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 58,
+	58, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 775, 305, 67, 67, 67, 209, 209, 209, 305, 775, 775,
+	775, 775, 775, 344, 344, 344, 344, 344, 344, 344, 344, 67,
+	67, 67, 67, 67, 67, 67, 67, 209, 209, 67, 67, 67,
+	67, 67, 67, 67, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 67, 67,
+	67, 67, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 51, 51, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 776, 776, 776, 57, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 209, 209, 209, 209, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 58, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 58, 44, 44,
+	58, 58, 44, 58, 58, 44, 44, 58, 58, 44, 44, 44,
+	44, 58, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 58, 44, 58, 44, 44, 44, 44, 44, 44, 44,
+	58, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 58, 44, 44, 44, 44, 58,
+	58, 44, 44, 44, 44, 44, 44, 44, 44, 58, 44, 44,
+	44, 44, 44, 44, 44, 58, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 58, 44,
+	44, 44, 44, 58, 44, 44, 44, 44, 44, 58, 44, 58,
+	58, 58, 44, 44, 44, 44, 44, 44, 44, 58, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 58, 58, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 209, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 51, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 209, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 51, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 209, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 51, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 209,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 51, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 209, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 51,
+	44, 44, 44, 44, 44, 44, 44, 44, 58, 58, 777, 777,
+	777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777,
+	777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777,
+	777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777,
+	777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 779, 779, 779, 779, 779, 779, 779, 779,
+	779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+	779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+	779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+	779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 778,
+	778, 778, 778, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+	779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+	779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+	779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+	779, 779, 779, 779, 779, 778, 778, 778, 778, 778, 778, 778,
+	778, 779, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+	778, 778, 778, 778, 779, 778, 778, 780, 780, 780, 780, 778,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 779, 779, 779, 779, 779, 58, 779, 779, 779,
+	779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	46, 46, 46, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	781, 781, 781, 781, 781, 781, 781, 58, 781, 781, 781, 781,
+	781, 781, 781, 781, 781, 781, 781, 781, 781, 781, 781, 781,
+	781, 58, 58, 781, 781, 781, 781, 781, 781, 781, 58, 781,
+	781, 58, 781, 781, 781, 781, 781, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 782, 782, 782, 782, 782, 782, 782, 782,
+	782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782,
+	782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782,
+	782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782,
+	782, 58, 58, 58, 783, 783, 783, 783, 783, 783, 783, 782,
+	782, 782, 782, 782, 782, 782, 58, 58, 784, 784, 784, 784,
+	784, 784, 784, 784, 784, 784, 58, 58, 58, 58, 782, 785,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 786, 786, 786, 786,
+	786, 786, 786, 786, 786, 786, 786, 786, 786, 786, 786, 786,
+	786, 786, 786, 786, 786, 786, 786, 786, 786, 786, 786, 786,
+	786, 786, 787, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 788, 788, 788, 788,
+	788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788,
+	788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788,
+	788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788,
+	788, 788, 788, 788, 789, 789, 789, 789, 790, 790, 790, 790,
+	790, 790, 790, 790, 790, 790, 58, 58, 58, 58, 58, 791,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 220, 220, 220, 220,
+	220, 220, 220, 58, 220, 220, 220, 220, 58, 220, 220, 58,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 58, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+	792, 792, 792, 792, 792, 792, 792, 792, 792, 75, 75, 793,
+	793, 793, 793, 793, 793, 793, 793, 793, 794, 794, 794, 794,
+	794, 794, 794, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 795, 795, 795, 795,
+	795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795,
+	795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795,
+	795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795,
+	795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795,
+	795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795,
+	795, 795, 795, 795, 796, 796, 796, 796, 796, 796, 796, 795,
+	75, 75, 75, 75, 797, 797, 797, 797, 797, 797, 797, 797,
+	797, 797, 75, 75, 75, 75, 798, 798, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 101, 799, 799, 799,
+	799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799,
+	799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799,
+	799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799,
+	799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799,
+	799, 799, 799, 799, 799, 799, 799, 799, 800, 799, 799, 799,
+	800, 799, 799, 799, 799, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101, 101, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 101, 799, 799, 799,
+	799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799,
+	799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799,
+	799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799,
+	799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 799,
+	799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 101, 101,
+	101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101, 101, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	95, 95, 95, 95, 101, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 101, 95, 95, 101,
+	95, 101, 101, 95, 101, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 101, 95, 95, 95, 95, 101, 95, 101, 95,
+	101, 101, 101, 101, 101, 101, 95, 101, 101, 101, 101, 95,
+	101, 95, 101, 95, 101, 95, 95, 95, 101, 95, 95, 101,
+	95, 101, 101, 95, 101, 95, 101, 95, 101, 95, 101, 95,
+	101, 95, 95, 101, 95, 101, 101, 95, 95, 95, 95, 101,
+	95, 95, 95, 95, 95, 95, 95, 101, 95, 95, 95, 95,
+	101, 95, 95, 95, 95, 101, 95, 101, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 101, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	101, 101, 101, 101, 101, 95, 95, 95, 101, 95, 95, 95,
+	95, 95, 101, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 101, 101, 101, 101,
+	101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	85, 85, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101, 101, 358, 358, 358, 358, 354, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	801, 801, 801, 801, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 801,
+	801, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 801, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 354, 801, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 51, 51, 358, 358, 358,
+	359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359,
+	359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359,
+	359, 359, 359, 359, 359, 359, 209, 36, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 359, 359,
+	359, 359, 359, 359, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 51, 51, 36, 358, 358, 358,
+	360, 360, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 360, 360, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 359, 359, 359, 359, 802, 359, 359, 802, 802, 802,
+	802, 802, 802, 802, 802, 802, 802, 359, 359, 359, 359, 359,
+	359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359,
+	359, 358, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 803, 803,
+	803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803,
+	803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803,
+	391, 400, 400, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 400, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 400,
+	381, 381, 400, 400, 400, 400, 400, 400, 400, 400, 400, 381,
+	801, 801, 801, 801, 381, 381, 381, 381, 381, 381, 381, 381,
+	381, 801, 801, 801, 801, 801, 801, 801, 400, 400, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	354, 354, 354, 354, 354, 354, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 354, 354, 354, 354, 354, 354, 354, 354, 354, 358, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 358, 354, 354,
+	354, 354, 354, 354, 354, 365, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 358, 358, 358, 358,
+	358, 358, 358, 358, 36, 36, 358, 358, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 357, 357, 354, 354, 354, 354, 354,
+	357, 354, 354, 354, 354, 354, 365, 365, 365, 354, 354, 365,
+	354, 354, 365, 362, 362, 358, 358, 354, 354, 354, 354, 354,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 358, 358, 358, 354, 358, 358, 358,
+	354, 354, 354, 804, 804, 804, 804, 804, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 358,
+	354, 358, 365, 365, 354, 354, 365, 365, 365, 365, 365, 365,
+	365, 365, 365, 365, 365, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+	365, 365, 365, 365, 365, 365, 365, 365, 365, 354, 354, 354,
+	365, 354, 354, 354, 354, 365, 365, 365, 354, 365, 365, 365,
+	354, 354, 354, 354, 354, 354, 354, 365, 354, 365, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	357, 354, 357, 354, 357, 354, 354, 354, 354, 354, 365, 354,
+	354, 354, 354, 357, 354, 357, 357, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 358, 358, 354,
+	357, 357, 357, 357, 357, 357, 357, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 357,
+	357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357,
+	357, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357,
+	357, 357, 51, 51, 51, 51, 51, 51, 51, 51, 36, 36,
+	36, 36, 358, 354, 354, 354, 354, 358, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 362, 362, 358, 358,
+	358, 358, 365, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	362, 358, 358, 358, 358, 365, 365, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 354, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 36, 36, 36, 36,
+	36, 36, 36, 36, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 36, 36, 36, 36, 36, 36, 358, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 365, 365, 365, 354, 354, 354, 365, 365, 365, 365, 365,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 38, 38, 38, 334, 334, 334, 51, 51, 51, 51,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 365,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 365, 365, 365, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 365, 354, 354, 354, 354, 354, 358, 358,
+	358, 358, 358, 358, 365, 358, 358, 358, 354, 354, 354, 358,
+	358, 354, 354, 354, 801, 801, 801, 801, 801, 354, 354, 354,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 354,
+	354, 801, 801, 801, 358, 358, 358, 358, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 801, 801, 801, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 358, 358, 358, 358, 801, 801, 801,
+	801, 801, 801, 801, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 801, 801, 801, 801, 354, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	801, 801, 801, 801, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	801, 801, 801, 801, 801, 801, 801, 801, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 801, 801, 801, 801, 801, 801,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 801, 801, 801, 801, 801, 801, 801, 801,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 801, 801, 358, 358, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 365, 354, 354, 365, 354, 354, 354, 354,
+	354, 354, 354, 354, 365, 365, 365, 365, 365, 365, 365, 365,
+	354, 354, 354, 354, 354, 354, 365, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 365, 365, 365, 365, 365, 365, 365, 365,
+	365, 365, 354, 389, 365, 365, 365, 354, 354, 354, 354, 354,
+	354, 354, 389, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 365, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 365, 365, 354, 365, 365, 354, 365,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 365, 365, 365, 354, 365, 365, 365,
+	365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 36, 36, 36, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 801, 801,
+	354, 354, 354, 354, 354, 801, 801, 801, 354, 354, 354, 354,
+	354, 801, 801, 801, 354, 354, 354, 354, 354, 354, 354, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 801, 801, 801, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 801, 801, 801, 801, 801, 354, 354, 354, 365,
+	365, 365, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 801, 801,
+	801, 801, 801, 801, 354, 354, 354, 354, 354, 354, 354, 354,
+	801, 801, 801, 801, 801, 801, 801, 801, 365, 365, 365, 365,
+	365, 365, 365, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 58, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 58, 58,
+	58, 58, 58, 58, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+	801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 461, 461,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 459, 459, 459, 459, 459, 459, 459, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 459, 459, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 461, 461, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 461, 461, 339, 344, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805,
+	805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805,
+	805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805,
+	805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805,
+	805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805,
+	805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805,
+	805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805,
+	805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	54, 54, 54, 54, 54, 54, 54, 54, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+	339, 339, 339, 339, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458,
+	458, 458, 458, 458, 458, 458, 461, 461,
+};
+
+const paragraph_prop_t paragraph_props[806] = {
+	{ 21, 9, 0, 3, 0, 0, }, { 17, 11, 0, 3, 0, 0, }, { 38, 10, 0, 2, 2, 0, },
+	{ 36, 11, 0, 3, 3, 0, }, { 36, 12, 0, 3, 3, 0, }, { 37, 10, 0, 1, 1, 0, },
+	{ 21, 10, 0, 3, 0, 0, }, { 21, 11, 0, 3, 0, 0, }, { 35, 12, 0, 0, 18, 3, },
+	{ 6, 13, 0, 0, 0, 3, }, { 3, 13, 0, 0, 12, 3, }, { 12, 5, 0, 0, 0, 3, },
+	{ 9, 5, 0, 0, 0, 3, }, { 10, 5, 0, 0, 0, 3, }, { 12, 13, 0, 0, 0, 3, },
+	{ 3, 13, 0, 0, 11, 3, }, { 0, 13, 0, 0, 0, 3, }, { 2, 13, 0, 0, 0, 3, },
+	{ 9, 4, 0, 0, 0, 3, }, { 8, 7, 0, 0, 15, 3, }, { 16, 4, 0, 0, 0, 3, },
+	{ 8, 7, 0, 0, 13, 3, }, { 7, 7, 0, 0, 0, 3, }, { 11, 3, 0, 0, 16, 3, },
+	{ 8, 7, 0, 0, 14, 3, }, { 8, 13, 0, 0, 15, 3, }, { 12, 0, 71, 0, 10, 3, },
+	{ 9, 13, 0, 0, 0, 3, }, { 12, 13, 0, 0, 17, 3, }, { 17, 13, 0, 0, 0, 3, },
+	{ 1, 13, 0, 0, 0, 3, }, { 39, 10, 0, 3, 3, 0, }, { 4, 7, 0, 0, 0, 0, },
+	{ 0, 13, 0, 0, 0, 1, }, { 9, 5, 0, 0, 0, 1, }, { 12, 13, 0, 0, 0, 1, },
+	{ 12, 13, 0, 14, 0, 0, }, { 12, 0, 71, 0, 10, 1, }, { 3, 13, 0, 0, 0, 0, },
+	{ 17, 9, 0, 3, 7, 1, }, { 12, 13, 0, 14, 0, 1, }, { 10, 5, 0, 0, 0, 1, },
+	{ 12, 3, 0, 0, 0, 1, }, { 18, 13, 0, 0, 0, 1, }, { 12, 0, 0, 0, 10, 0, },
+	{ 12, 13, 0, 0, 14, 1, }, { 12, 0, 71, 0, 10, 0, }, { 12, 13, 0, 0, 10, 0, },
+	{ 12, 13, 0, 0, 10, 1, }, { 18, 13, 0, 0, 10, 0, }, { 12, 0, 0, 0, 10, 1, },
+	{ 12, 13, 0, 0, 0, 0, }, { 18, 13, 0, 0, 10, 1, }, { 12, 13, 16, 0, 10, 0, },
+	{ 21, 8, 1, 4, 4, 1, }, { 4, 8, 1, 4, 4, 1, }, { 12, 0, 46, 0, 10, 0, },
+	{ 12, 13, 46, 0, 0, 0, }, { 12, 0, 2, 0, 0, 0, }, { 8, 13, 0, 0, 15, 0, },
+	{ 12, 13, 0, 0, 14, 0, }, { 12, 0, 46, 0, 10, 1, }, { 12, 0, 27, 0, 10, 0, },
+	{ 12, 0, 30, 0, 10, 0, }, { 12, 0, 30, 0, 10, 1, }, { 12, 0, 30, 0, 0, 0, },
+	{ 21, 8, 30, 4, 4, 0, }, { 21, 8, 1, 4, 4, 0, }, { 12, 0, 8, 0, 10, 0, },
+	{ 12, 0, 8, 0, 0, 0, }, { 12, 0, 8, 0, 14, 0, }, { 8, 0, 8, 0, 15, 0, },
+	{ 17, 13, 8, 0, 10, 0, }, { 12, 13, 8, 0, 0, 0, }, { 9, 5, 8, 0, 0, 0, },
+	{ 12, 1, 2, 0, 0, 0, }, { 21, 8, 53, 4, 4, 0, }, { 17, 1, 53, 0, 0, 0, },
+	{ 12, 1, 53, 0, 0, 0, }, { 6, 1, 53, 0, 0, 0, }, { 13, 1, 53, 0, 9, 0, },
+	{ 12, 1, 53, 0, 10, 0, }, { 12, 1, 53, 0, 14, 0, }, { 12, 6, 6, 7, 7, 0, },
+	{ 12, 6, 0, 7, 7, 0, }, { 12, 13, 6, 0, 0, 0, }, { 12, 2, 6, 0, 0, 0, },
+	{ 10, 5, 6, 0, 0, 0, }, { 10, 2, 6, 0, 0, 0, }, { 8, 7, 0, 0, 15, 0, },
+	{ 8, 2, 6, 0, 15, 0, }, { 21, 8, 6, 4, 4, 0, }, { 6, 2, 0, 0, 0, 0, },
+	{ 21, 2, 6, 3, 7, 0, }, { 6, 2, 6, 0, 0, 0, }, { 12, 2, 6, 0, 10, 0, },
+	{ 12, 2, 0, 0, 10, 0, }, { 11, 6, 6, 0, 16, 0, }, { 11, 6, 6, 0, 15, 0, },
+	{ 11, 3, 6, 0, 16, 0, }, { 12, 2, 135, 0, 0, 0, }, { 12, 2, 2, 0, 0, 0, },
+	{ 12, 2, 135, 7, 7, 0, }, { 12, 2, 135, 0, 10, 0, }, { 21, 8, 135, 4, 4, 0, },
+	{ 12, 2, 146, 0, 10, 0, }, { 21, 8, 146, 4, 4, 0, }, { 11, 1, 99, 0, 16, 0, },
+	{ 12, 1, 99, 0, 10, 0, }, { 21, 8, 99, 4, 4, 0, }, { 12, 13, 99, 0, 0, 0, },
+	{ 8, 13, 99, 0, 15, 0, }, { 6, 13, 99, 0, 0, 0, }, { 9, 1, 99, 0, 0, 0, },
+	{ 12, 1, 120, 0, 10, 0, }, { 21, 8, 120, 4, 4, 0, }, { 12, 1, 120, 0, 0, 0, },
+	{ 12, 1, 81, 0, 10, 0, }, { 21, 8, 81, 4, 4, 0, }, { 12, 1, 81, 0, 0, 0, },
+	{ 21, 8, 31, 4, 4, 0, }, { 21, 0, 31, 8, 4, 0, }, { 12, 0, 31, 0, 10, 0, },
+	{ 17, 0, 0, 0, 0, 0, }, { 11, 0, 31, 0, 16, 0, }, { 12, 0, 31, 0, 0, 0, },
+	{ 12, 0, 14, 0, 10, 0, }, { 21, 8, 14, 4, 4, 0, }, { 21, 0, 14, 8, 4, 0, },
+	{ 21, 0, 14, 4, 4, 0, }, { 11, 0, 14, 0, 16, 0, }, { 10, 5, 14, 0, 0, 0, },
+	{ 12, 0, 14, 0, 0, 0, }, { 10, 0, 14, 0, 0, 0, }, { 9, 5, 14, 0, 0, 0, },
+	{ 21, 8, 48, 4, 4, 0, }, { 21, 0, 48, 8, 4, 0, }, { 12, 0, 48, 0, 10, 0, },
+	{ 11, 0, 48, 0, 16, 0, }, { 12, 0, 48, 0, 0, 0, }, { 21, 8, 47, 4, 4, 0, },
+	{ 21, 0, 47, 8, 4, 0, }, { 12, 0, 47, 0, 10, 0, }, { 11, 0, 47, 0, 16, 0, },
+	{ 12, 0, 47, 0, 0, 0, }, { 9, 5, 47, 0, 0, 0, }, { 21, 8, 104, 4, 4, 0, },
+	{ 21, 0, 104, 8, 4, 0, }, { 12, 0, 104, 0, 10, 0, }, { 21, 0, 104, 4, 4, 0, },
+	{ 11, 0, 104, 0, 16, 0, }, { 12, 0, 104, 0, 0, 0, }, { 21, 8, 140, 4, 4, 0, },
+	{ 12, 0, 140, 0, 10, 0, }, { 21, 0, 140, 4, 4, 0, }, { 21, 0, 140, 8, 4, 0, },
+	{ 11, 0, 140, 0, 16, 0, }, { 12, 0, 140, 0, 0, 0, }, { 12, 13, 140, 0, 0, 0, },
+	{ 9, 5, 140, 0, 0, 0, }, { 21, 8, 143, 4, 4, 0, }, { 21, 0, 143, 8, 4, 0, },
+	{ 12, 0, 143, 0, 10, 0, }, { 11, 0, 143, 0, 16, 0, }, { 18, 0, 143, 0, 0, 0, },
+	{ 12, 13, 143, 0, 0, 0, }, { 12, 0, 143, 0, 0, 0, }, { 12, 0, 67, 0, 10, 0, },
+	{ 21, 8, 67, 4, 4, 0, }, { 21, 0, 67, 8, 4, 0, }, { 18, 0, 67, 0, 0, 0, },
+	{ 21, 0, 67, 4, 4, 0, }, { 11, 0, 67, 0, 16, 0, }, { 21, 8, 88, 4, 4, 0, },
+	{ 21, 0, 88, 8, 4, 0, }, { 12, 0, 88, 0, 10, 0, }, { 21, 0, 88, 4, 4, 0, },
+	{ 12, 0, 88, 7, 10, 0, }, { 12, 0, 88, 0, 0, 0, }, { 11, 0, 88, 0, 16, 0, },
+	{ 10, 0, 88, 0, 0, 0, }, { 21, 8, 128, 4, 4, 0, }, { 21, 0, 128, 8, 4, 0, },
+	{ 12, 0, 128, 0, 10, 0, }, { 21, 0, 128, 4, 4, 0, }, { 11, 0, 128, 0, 16, 0, },
+	{ 12, 0, 128, 0, 0, 0, }, { 12, 0, 147, 0, 0, 0, }, { 21, 8, 147, 4, 4, 0, },
+	{ 12, 0, 147, 8, 0, 0, }, { 9, 5, 0, 0, 0, 0, }, { 11, 0, 147, 0, 16, 0, },
+	{ 17, 0, 147, 0, 0, 0, }, { 12, 0, 70, 0, 0, 0, }, { 21, 8, 70, 4, 4, 0, },
+	{ 12, 0, 70, 8, 0, 0, }, { 11, 0, 70, 0, 16, 0, }, { 12, 0, 148, 0, 10, 0, },
+	{ 18, 0, 148, 0, 0, 0, }, { 12, 0, 148, 0, 0, 0, }, { 4, 0, 148, 0, 0, 0, },
+	{ 17, 0, 148, 0, 0, 0, }, { 6, 0, 148, 0, 0, 0, }, { 21, 8, 148, 4, 4, 0, },
+	{ 11, 0, 148, 0, 16, 0, }, { 0, 13, 148, 0, 0, 0, }, { 1, 13, 148, 0, 0, 0, },
+	{ 21, 0, 148, 8, 4, 0, }, { 17, 0, 148, 8, 4, 0, }, { 12, 0, 0, 0, 0, 0, },
+	{ 12, 0, 94, 0, 0, 0, }, { 21, 0, 94, 0, 4, 0, }, { 21, 8, 94, 4, 4, 0, },
+	{ 21, 0, 94, 8, 4, 0, }, { 11, 0, 94, 0, 16, 0, }, { 17, 0, 94, 0, 0, 0, },
+	{ 12, 0, 40, 0, 10, 0, }, { 25, 0, 49, 9, 10, 4, }, { 26, 0, 49, 10, 10, 0, },
+	{ 27, 0, 49, 11, 10, 0, }, { 12, 0, 39, 0, 10, 0, }, { 21, 8, 39, 4, 4, 0, },
+	{ 12, 0, 39, 0, 0, 0, }, { 17, 0, 39, 0, 0, 0, }, { 12, 13, 39, 0, 0, 0, },
+	{ 12, 0, 25, 0, 10, 0, }, { 17, 13, 22, 0, 0, 0, }, { 12, 0, 22, 0, 10, 0, },
+	{ 12, 0, 22, 0, 0, 0, }, { 17, 12, 101, 0, 18, 0, }, { 12, 0, 101, 0, 10, 0, },
+	{ 0, 13, 101, 0, 0, 0, }, { 1, 13, 101, 0, 0, 0, }, { 12, 0, 119, 0, 10, 0, },
+	{ 12, 0, 145, 0, 10, 0, }, { 21, 8, 145, 4, 4, 0, }, { 21, 0, 145, 8, 4, 0, },
+	{ 12, 0, 51, 0, 10, 0, }, { 21, 8, 51, 4, 4, 0, }, { 21, 0, 51, 8, 4, 0, },
+	{ 12, 0, 20, 0, 10, 0, }, { 21, 8, 20, 4, 4, 0, }, { 12, 0, 136, 0, 10, 0, },
+	{ 21, 8, 136, 4, 4, 0, }, { 12, 0, 64, 0, 0, 0, }, { 21, 8, 64, 4, 4, 0, },
+	{ 21, 0, 64, 8, 4, 0, }, { 17, 0, 64, 0, 0, 0, }, { 5, 0, 64, 0, 0, 0, },
+	{ 9, 5, 64, 0, 0, 0, }, { 11, 0, 64, 0, 16, 0, }, { 12, 13, 64, 0, 0, 0, },
+	{ 12, 13, 90, 0, 0, 0, }, { 6, 13, 0, 0, 0, 0, }, { 17, 13, 90, 0, 0, 0, },
+	{ 17, 13, 0, 0, 0, 0, }, { 18, 13, 90, 0, 0, 0, }, { 6, 13, 90, 0, 0, 0, },
+	{ 21, 8, 90, 4, 4, 0, }, { 4, 9, 90, 3, 7, 0, }, { 11, 0, 90, 0, 16, 0, },
+	{ 12, 0, 90, 0, 10, 0, }, { 12, 0, 73, 0, 10, 0, }, { 21, 8, 73, 4, 4, 0, },
+	{ 21, 0, 73, 8, 4, 0, }, { 12, 13, 73, 0, 0, 0, }, { 6, 13, 73, 0, 0, 0, },
+	{ 11, 0, 73, 0, 16, 0, }, { 12, 0, 138, 0, 0, 0, }, { 12, 0, 139, 0, 0, 0, },
+	{ 11, 0, 139, 0, 16, 0, }, { 12, 13, 139, 0, 0, 0, }, { 12, 0, 19, 0, 10, 0, },
+	{ 21, 8, 19, 4, 4, 0, }, { 21, 0, 19, 8, 4, 0, }, { 12, 0, 19, 0, 0, 0, },
+	{ 12, 0, 69, 0, 0, 0, }, { 21, 0, 69, 8, 4, 0, }, { 21, 8, 69, 4, 4, 0, },
+	{ 21, 0, 69, 0, 4, 0, }, { 11, 0, 69, 0, 16, 0, }, { 21, 8, 10, 4, 4, 0, },
+	{ 21, 0, 10, 8, 4, 0, }, { 12, 0, 10, 0, 10, 0, }, { 21, 0, 10, 4, 4, 0, },
+	{ 11, 0, 10, 0, 16, 0, }, { 17, 0, 10, 0, 0, 0, }, { 12, 0, 10, 0, 0, 0, },
+	{ 21, 8, 133, 4, 4, 0, }, { 21, 0, 133, 8, 4, 0, }, { 12, 0, 133, 0, 10, 0, },
+	{ 11, 0, 133, 0, 16, 0, }, { 12, 0, 13, 0, 10, 0, }, { 21, 8, 13, 4, 4, 0, },
+	{ 21, 0, 13, 8, 4, 0, }, { 12, 0, 13, 0, 0, 0, }, { 12, 0, 72, 0, 10, 0, },
+	{ 21, 0, 72, 8, 4, 0, }, { 21, 8, 72, 4, 4, 0, }, { 17, 0, 72, 0, 0, 0, },
+	{ 11, 0, 72, 0, 16, 0, }, { 11, 0, 102, 0, 16, 0, }, { 12, 0, 102, 0, 10, 0, },
+	{ 17, 0, 102, 0, 0, 0, }, { 12, 0, 133, 0, 0, 0, }, { 21, 0, 0, 8, 4, 0, },
+	{ 18, 13, 46, 0, 0, 0, }, { 17, 12, 0, 0, 18, 0, }, { 4, 12, 0, 0, 0, 0, },
+	{ 20, 9, 0, 3, 0, 0, }, { 21, 9, 1, 4, 4, 0, }, { 31, 9, 1, 5, 5, 0, },
+	{ 21, 0, 0, 3, 7, 0, }, { 21, 1, 0, 3, 7, 0, }, { 17, 13, 0, 0, 0, 1, },
+	{ 4, 13, 0, 0, 0, 0, }, { 19, 13, 0, 0, 0, 1, }, { 3, 13, 0, 0, 13, 1, },
+	{ 0, 13, 0, 0, 0, 0, }, { 3, 13, 0, 0, 0, 1, }, { 15, 13, 0, 0, 13, 1, },
+	{ 15, 13, 0, 0, 0, 1, }, { 17, 13, 0, 0, 14, 1, }, { 36, 10, 0, 3, 3, 0, },
+	{ 21, 14, 0, 3, 7, 0, }, { 21, 16, 0, 3, 7, 0, }, { 21, 18, 0, 3, 7, 0, },
+	{ 21, 15, 0, 3, 7, 0, }, { 21, 17, 0, 3, 7, 0, }, { 4, 7, 0, 0, 17, 0, },
+	{ 10, 5, 0, 0, 0, 0, }, { 10, 13, 0, 0, 0, 1, }, { 10, 13, 0, 0, 0, 0, },
+	{ 5, 13, 0, 14, 0, 0, }, { 5, 13, 0, 0, 0, 0, }, { 12, 13, 0, 0, 17, 0, },
+	{ 1, 13, 0, 0, 0, 0, }, { 22, 9, 0, 3, 7, 0, }, { 12, 9, 0, 3, 7, 0, },
+	{ 12, 9, 2, 3, 0, 0, }, { 21, 19, 0, 3, 7, 0, }, { 21, 20, 0, 3, 7, 0, },
+	{ 21, 21, 0, 3, 7, 0, }, { 21, 22, 0, 3, 7, 0, }, { 21, 9, 0, 3, 7, 0, },
+	{ 12, 3, 0, 0, 0, 0, }, { 12, 4, 0, 0, 0, 0, }, { 9, 5, 0, 0, 0, 2, },
+	{ 9, 5, 2, 0, 0, 0, }, { 9, 13, 0, 0, 0, 1, }, { 12, 5, 0, 0, 0, 0, },
+	{ 12, 0, 0, 14, 10, 0, }, { 9, 4, 0, 0, 0, 0, }, { 15, 13, 0, 0, 0, 0, },
+	{ 14, 13, 0, 14, 0, 4, }, { 33, 13, 0, 0, 0, 4, }, { 1, 13, 0, 0, 0, 4, },
+	{ 12, 13, 0, 14, 0, 4, }, { 14, 13, 0, 14, 0, 0, }, { 12, 0, 0, 0, 0, 1, },
+	{ 12, 0, 0, 14, 10, 1, }, { 14, 13, 0, 14, 0, 1, }, { 29, 13, 0, 14, 0, 0, },
+	{ 12, 0, 0, 14, 0, 0, }, { 29, 13, 0, 14, 0, 1, }, { 29, 13, 0, 14, 0, 4, },
+	{ 6, 13, 0, 14, 0, 0, }, { 12, 0, 18, 0, 0, 0, }, { 12, 0, 41, 0, 10, 0, },
+	{ 12, 13, 27, 0, 0, 0, }, { 21, 8, 27, 4, 4, 0, }, { 6, 13, 27, 0, 0, 0, },
+	{ 17, 13, 27, 0, 0, 0, }, { 12, 0, 144, 0, 10, 0, }, { 17, 0, 144, 0, 0, 0, },
+	{ 21, 8, 144, 4, 4, 0, }, { 19, 13, 0, 0, 0, 0, }, { 14, 13, 50, 0, 0, 4, },
+	{ 14, 13, 0, 0, 0, 4, }, { 17, 12, 0, 0, 18, 5, }, { 5, 0, 50, 0, 10, 4, },
+	{ 14, 0, 0, 0, 0, 4, }, { 14, 0, 50, 0, 0, 4, }, { 5, 13, 0, 0, 0, 4, },
+	{ 21, 8, 1, 4, 4, 4, }, { 21, 0, 49, 4, 4, 4, }, { 14, 0, 0, 0, 8, 4, },
+	{ 21, 0, 0, 0, 8, 4, }, { 5, 0, 0, 0, 10, 4, }, { 14, 13, 0, 0, 0, 0, },
+	{ 5, 0, 54, 0, 0, 4, }, { 14, 0, 54, 0, 0, 4, }, { 5, 13, 0, 0, 8, 4, },
+	{ 5, 0, 62, 0, 8, 4, }, { 14, 0, 62, 0, 8, 4, }, { 5, 0, 0, 0, 8, 4, },
+	{ 14, 0, 16, 0, 10, 4, }, { 14, 0, 49, 0, 10, 4, }, { 14, 0, 49, 0, 0, 4, },
+	{ 14, 13, 49, 0, 0, 4, }, { 14, 0, 0, 14, 0, 4, }, { 14, 0, 160, 0, 10, 4, },
+	{ 5, 0, 160, 0, 10, 4, }, { 14, 13, 160, 0, 0, 4, }, { 12, 0, 76, 0, 10, 0, },
+	{ 17, 0, 76, 0, 0, 0, }, { 12, 0, 153, 0, 10, 0, }, { 17, 13, 153, 0, 0, 0, },
+	{ 6, 13, 153, 0, 0, 0, }, { 11, 0, 153, 0, 16, 0, }, { 12, 13, 30, 0, 0, 0, },
+	{ 12, 13, 30, 0, 10, 0, }, { 12, 0, 11, 0, 10, 0, }, { 21, 8, 11, 4, 4, 0, },
+	{ 12, 0, 11, 0, 0, 0, }, { 17, 0, 11, 0, 0, 0, }, { 12, 0, 134, 0, 10, 0, },
+	{ 21, 8, 134, 4, 4, 0, }, { 21, 0, 134, 8, 4, 0, }, { 12, 13, 134, 0, 0, 0, },
+	{ 12, 0, 111, 0, 10, 0, }, { 18, 13, 111, 0, 0, 0, }, { 6, 13, 111, 0, 0, 0, },
+	{ 21, 0, 122, 8, 4, 0, }, { 12, 0, 122, 0, 10, 0, }, { 21, 8, 122, 4, 4, 0, },
+	{ 17, 0, 122, 0, 0, 0, }, { 11, 0, 122, 0, 16, 0, }, { 18, 0, 31, 0, 0, 0, },
+	{ 11, 0, 61, 0, 16, 0, }, { 12, 0, 61, 0, 10, 0, }, { 21, 8, 61, 4, 4, 0, },
+	{ 17, 0, 61, 0, 0, 0, }, { 12, 0, 117, 0, 10, 0, }, { 21, 8, 117, 4, 4, 0, },
+	{ 21, 0, 117, 8, 4, 0, }, { 12, 0, 117, 0, 0, 0, }, { 21, 8, 60, 4, 4, 0, },
+	{ 21, 0, 60, 8, 4, 0, }, { 12, 0, 60, 0, 10, 0, }, { 12, 0, 60, 0, 0, 0, },
+	{ 17, 0, 60, 0, 0, 0, }, { 11, 0, 60, 0, 16, 0, }, { 12, 0, 24, 0, 10, 0, },
+	{ 21, 8, 24, 4, 4, 0, }, { 21, 0, 24, 8, 4, 0, }, { 11, 0, 24, 0, 16, 0, },
+	{ 12, 0, 24, 0, 0, 0, }, { 17, 0, 24, 0, 0, 0, }, { 12, 0, 142, 0, 0, 0, },
+	{ 21, 8, 142, 4, 4, 0, }, { 12, 0, 92, 0, 10, 0, }, { 21, 0, 92, 8, 4, 0, },
+	{ 21, 8, 92, 4, 4, 0, }, { 17, 0, 92, 0, 0, 0, }, { 11, 0, 92, 0, 16, 0, },
+	{ 23, 0, 49, 12, 10, 4, }, { 24, 0, 49, 13, 10, 4, }, { 12, 0, 2, 0, 0, 1, },
+	{ 14, 0, 2, 0, 0, 4, }, { 12, 4, 53, 0, 0, 0, }, { 12, 9, 2, 0, 0, 0, },
+	{ 8, 13, 0, 0, 15, 4, }, { 8, 13, 0, 0, 14, 4, }, { 6, 13, 0, 0, 0, 4, },
+	{ 15, 13, 0, 0, 0, 4, }, { 14, 13, 0, 0, 17, 4, }, { 1, 7, 0, 0, 15, 4, },
+	{ 1, 7, 0, 0, 13, 4, }, { 5, 13, 0, 0, 15, 4, }, { 5, 7, 0, 0, 14, 4, },
+	{ 14, 5, 0, 0, 0, 4, }, { 14, 4, 0, 0, 0, 4, }, { 9, 5, 0, 0, 0, 4, },
+	{ 10, 5, 0, 0, 0, 4, }, { 6, 13, 0, 0, 0, 5, }, { 14, 13, 0, 0, 0, 5, },
+	{ 14, 5, 0, 0, 0, 5, }, { 9, 5, 0, 0, 0, 5, }, { 10, 5, 0, 0, 0, 5, },
+	{ 14, 13, 0, 0, 13, 5, }, { 33, 13, 0, 0, 0, 5, }, { 1, 13, 0, 0, 0, 5, },
+	{ 14, 4, 0, 0, 0, 5, }, { 1, 7, 0, 0, 15, 5, }, { 1, 7, 0, 0, 13, 5, },
+	{ 14, 7, 0, 0, 0, 5, }, { 14, 3, 0, 0, 16, 5, }, { 5, 7, 0, 0, 14, 5, },
+	{ 5, 13, 0, 0, 15, 5, }, { 14, 0, 71, 0, 10, 5, }, { 14, 13, 0, 0, 17, 5, },
+	{ 1, 13, 0, 0, 0, 2, }, { 33, 13, 0, 0, 0, 2, }, { 5, 13, 0, 0, 0, 2, },
+	{ 14, 0, 62, 0, 8, 2, }, { 5, 0, 62, 0, 8, 2, }, { 5, 0, 0, 0, 8, 2, },
+	{ 5, 0, 0, 4, 4, 2, }, { 14, 0, 49, 0, 10, 2, }, { 12, 13, 0, 0, 0, 2, },
+	{ 21, 13, 0, 3, 7, 0, }, { 32, 13, 0, 0, 0, 0, }, { 12, 0, 75, 0, 10, 0, },
+	{ 12, 13, 46, 0, 10, 0, }, { 12, 0, 46, 0, 0, 0, }, { 12, 0, 77, 0, 10, 0, },
+	{ 12, 0, 23, 0, 10, 0, }, { 12, 0, 59, 0, 10, 0, }, { 12, 0, 59, 0, 0, 0, },
+	{ 12, 0, 44, 0, 10, 0, }, { 12, 0, 110, 0, 10, 0, }, { 21, 8, 110, 4, 4, 0, },
+	{ 12, 0, 152, 0, 10, 0, }, { 17, 0, 152, 0, 0, 0, }, { 12, 0, 157, 0, 10, 0, },
+	{ 17, 0, 157, 0, 0, 0, }, { 12, 0, 34, 0, 10, 0, }, { 12, 0, 124, 0, 10, 0, },
+	{ 12, 0, 106, 0, 10, 0, }, { 11, 0, 106, 0, 16, 0, }, { 12, 0, 105, 0, 10, 0, },
+	{ 12, 0, 37, 0, 10, 0, }, { 12, 0, 4, 0, 10, 0, }, { 12, 0, 4, 0, 0, 0, },
+	{ 12, 0, 154, 0, 10, 0, }, { 12, 0, 74, 0, 10, 0, }, { 12, 1, 29, 0, 10, 0, },
+	{ 12, 1, 7, 0, 10, 0, }, { 17, 1, 7, 0, 0, 0, }, { 12, 1, 7, 0, 0, 0, },
+	{ 12, 1, 108, 0, 10, 0, }, { 12, 1, 108, 0, 0, 0, }, { 12, 1, 97, 0, 10, 0, },
+	{ 12, 1, 97, 0, 0, 0, }, { 12, 1, 52, 0, 10, 0, }, { 12, 1, 52, 0, 0, 0, },
+	{ 12, 1, 114, 0, 10, 0, }, { 12, 1, 114, 0, 0, 0, }, { 17, 13, 114, 0, 0, 0, },
+	{ 12, 1, 78, 0, 10, 0, }, { 12, 1, 78, 0, 0, 0, }, { 12, 1, 87, 0, 10, 0, },
+	{ 12, 1, 86, 0, 10, 0, }, { 12, 1, 86, 0, 0, 0, }, { 12, 1, 63, 0, 10, 0, },
+	{ 21, 8, 63, 4, 4, 0, }, { 12, 1, 63, 0, 0, 0, }, { 17, 1, 63, 0, 0, 0, },
+	{ 12, 1, 121, 0, 10, 0, }, { 12, 1, 121, 0, 0, 0, }, { 12, 1, 96, 0, 10, 0, },
+	{ 12, 1, 96, 0, 0, 0, }, { 12, 1, 82, 0, 10, 0, }, { 12, 1, 82, 0, 0, 0, },
+	{ 21, 8, 82, 4, 4, 0, }, { 17, 1, 82, 0, 0, 0, }, { 15, 1, 82, 0, 0, 0, },
+	{ 12, 1, 9, 0, 10, 0, }, { 17, 13, 9, 0, 0, 0, }, { 12, 1, 116, 0, 10, 0, },
+	{ 12, 1, 116, 0, 0, 0, }, { 12, 1, 112, 0, 10, 0, }, { 12, 1, 112, 0, 0, 0, },
+	{ 12, 1, 113, 0, 10, 0, }, { 12, 1, 113, 0, 0, 0, }, { 12, 1, 103, 0, 10, 0, },
+	{ 12, 1, 58, 0, 10, 0, }, { 12, 1, 58, 0, 0, 0, }, { 12, 2, 118, 0, 10, 0, },
+	{ 21, 8, 118, 4, 4, 0, }, { 11, 6, 118, 0, 16, 0, }, { 12, 6, 6, 0, 0, 0, },
+	{ 12, 1, 159, 0, 10, 0, }, { 21, 8, 159, 4, 4, 0, }, { 17, 1, 159, 0, 0, 0, },
+	{ 12, 1, 130, 0, 10, 0, }, { 12, 1, 130, 0, 0, 0, }, { 12, 2, 129, 0, 10, 0, },
+	{ 21, 8, 129, 4, 4, 0, }, { 12, 2, 129, 0, 0, 0, }, { 12, 1, 107, 0, 10, 0, },
+	{ 21, 8, 107, 4, 4, 0, }, { 12, 1, 107, 0, 0, 0, }, { 12, 1, 26, 0, 10, 0, },
+	{ 12, 1, 26, 0, 0, 0, }, { 12, 1, 38, 0, 10, 0, }, { 21, 0, 17, 8, 4, 0, },
+	{ 21, 8, 17, 4, 4, 0, }, { 12, 0, 17, 0, 10, 0, }, { 17, 0, 17, 0, 0, 0, },
+	{ 12, 0, 17, 0, 0, 0, }, { 12, 13, 17, 0, 0, 0, }, { 11, 0, 17, 0, 16, 0, },
+	{ 21, 8, 68, 4, 4, 0, }, { 21, 0, 68, 8, 4, 0, }, { 12, 0, 68, 0, 10, 0, },
+	{ 12, 0, 68, 0, 0, 0, }, { 12, 0, 68, 7, 7, 0, }, { 17, 0, 68, 0, 0, 0, },
+	{ 12, 0, 131, 0, 10, 0, }, { 11, 0, 131, 0, 16, 0, }, { 21, 8, 21, 4, 4, 0, },
+	{ 12, 0, 21, 0, 10, 0, }, { 21, 0, 21, 8, 4, 0, }, { 11, 0, 21, 0, 16, 0, },
+	{ 17, 0, 21, 0, 0, 0, }, { 12, 0, 79, 0, 10, 0, }, { 21, 8, 79, 4, 4, 0, },
+	{ 12, 0, 79, 0, 0, 0, }, { 18, 0, 79, 0, 0, 0, }, { 21, 8, 125, 4, 4, 0, },
+	{ 21, 0, 125, 8, 4, 0, }, { 12, 0, 125, 0, 10, 0, }, { 12, 0, 125, 7, 10, 0, },
+	{ 17, 0, 125, 0, 0, 0, }, { 12, 0, 125, 0, 0, 0, }, { 11, 0, 125, 0, 16, 0, },
+	{ 18, 0, 125, 0, 0, 0, }, { 12, 0, 65, 0, 10, 0, }, { 21, 0, 65, 8, 4, 0, },
+	{ 21, 8, 65, 4, 4, 0, }, { 17, 0, 65, 0, 0, 0, }, { 12, 0, 65, 0, 0, 0, },
+	{ 12, 0, 93, 0, 10, 0, }, { 17, 0, 93, 0, 0, 0, }, { 12, 0, 127, 0, 10, 0, },
+	{ 21, 8, 127, 4, 4, 0, }, { 21, 0, 127, 8, 4, 0, }, { 11, 0, 127, 0, 16, 0, },
+	{ 21, 8, 45, 4, 4, 0, }, { 21, 0, 45, 8, 4, 0, }, { 12, 0, 45, 0, 10, 0, },
+	{ 21, 0, 45, 4, 4, 0, }, { 12, 0, 98, 0, 10, 0, }, { 21, 0, 98, 8, 4, 0, },
+	{ 21, 8, 98, 4, 4, 0, }, { 17, 0, 98, 0, 0, 0, }, { 12, 0, 98, 0, 0, 0, },
+	{ 11, 0, 98, 0, 16, 0, }, { 12, 0, 149, 0, 10, 0, }, { 21, 0, 149, 4, 4, 0, },
+	{ 21, 0, 149, 8, 4, 0, }, { 21, 8, 149, 4, 4, 0, }, { 12, 0, 149, 0, 0, 0, },
+	{ 11, 0, 149, 0, 16, 0, }, { 12, 0, 126, 0, 10, 0, }, { 21, 0, 126, 4, 4, 0, },
+	{ 21, 0, 126, 8, 4, 0, }, { 21, 8, 126, 4, 4, 0, }, { 18, 0, 126, 0, 0, 0, },
+	{ 17, 0, 126, 0, 0, 0, }, { 6, 0, 126, 0, 0, 0, }, { 12, 0, 126, 0, 0, 0, },
+	{ 12, 0, 89, 0, 10, 0, }, { 21, 0, 89, 8, 4, 0, }, { 21, 8, 89, 4, 4, 0, },
+	{ 17, 0, 89, 0, 0, 0, }, { 12, 0, 89, 0, 0, 0, }, { 11, 0, 89, 0, 16, 0, },
+	{ 12, 0, 137, 0, 10, 0, }, { 21, 8, 137, 4, 4, 0, }, { 21, 0, 137, 8, 4, 0, },
+	{ 12, 0, 137, 0, 0, 0, }, { 11, 0, 137, 0, 16, 0, }, { 12, 0, 5, 0, 0, 0, },
+	{ 21, 8, 5, 4, 4, 0, }, { 21, 0, 5, 0, 4, 0, }, { 21, 0, 5, 8, 4, 0, },
+	{ 11, 0, 5, 0, 16, 0, }, { 17, 0, 5, 0, 0, 0, }, { 12, 0, 33, 0, 10, 0, },
+	{ 21, 0, 33, 8, 4, 0, }, { 21, 8, 33, 4, 4, 0, }, { 12, 0, 33, 0, 0, 0, },
+	{ 12, 0, 155, 0, 10, 0, }, { 11, 0, 155, 0, 16, 0, }, { 12, 0, 155, 0, 0, 0, },
+	{ 12, 0, 32, 0, 10, 0, }, { 21, 0, 32, 4, 4, 0, }, { 21, 0, 32, 8, 4, 0, },
+	{ 21, 8, 32, 4, 4, 0, }, { 12, 0, 32, 7, 10, 0, }, { 17, 0, 32, 0, 0, 0, },
+	{ 11, 0, 32, 0, 16, 0, }, { 12, 0, 95, 0, 10, 0, }, { 21, 0, 95, 8, 4, 0, },
+	{ 21, 8, 95, 4, 4, 0, }, { 18, 0, 95, 0, 0, 0, }, { 12, 0, 161, 0, 10, 0, },
+	{ 21, 8, 161, 4, 4, 0, }, { 21, 0, 161, 4, 4, 0, }, { 21, 0, 161, 8, 4, 0, },
+	{ 12, 0, 161, 7, 10, 0, }, { 18, 0, 161, 0, 0, 0, }, { 12, 0, 161, 0, 0, 0, },
+	{ 17, 0, 161, 0, 0, 0, }, { 12, 0, 132, 0, 10, 0, }, { 21, 8, 132, 4, 4, 0, },
+	{ 21, 0, 132, 8, 4, 0, }, { 12, 0, 132, 7, 10, 0, }, { 17, 0, 132, 0, 0, 0, },
+	{ 18, 0, 132, 0, 0, 0, }, { 12, 0, 109, 0, 10, 0, }, { 12, 0, 15, 0, 10, 0, },
+	{ 21, 0, 15, 8, 4, 0, }, { 21, 8, 15, 4, 4, 0, }, { 21, 0, 15, 4, 4, 0, },
+	{ 17, 0, 15, 0, 0, 0, }, { 11, 0, 15, 0, 16, 0, }, { 12, 0, 15, 0, 0, 0, },
+	{ 18, 0, 83, 0, 0, 0, }, { 6, 0, 83, 0, 0, 0, }, { 12, 0, 83, 0, 10, 0, },
+	{ 21, 8, 83, 4, 4, 0, }, { 21, 0, 83, 8, 4, 0, }, { 12, 0, 43, 0, 10, 0, },
+	{ 21, 8, 43, 4, 4, 0, }, { 12, 0, 43, 7, 10, 0, }, { 11, 0, 43, 0, 16, 0, },
+	{ 12, 0, 42, 0, 10, 0, }, { 21, 0, 42, 8, 4, 0, }, { 21, 8, 42, 4, 4, 0, },
+	{ 11, 0, 42, 0, 16, 0, }, { 12, 0, 80, 0, 10, 0, }, { 21, 8, 80, 4, 4, 0, },
+	{ 21, 0, 80, 8, 4, 0, }, { 12, 0, 80, 0, 0, 0, }, { 10, 5, 140, 0, 0, 0, },
+	{ 17, 0, 140, 0, 0, 0, }, { 12, 0, 158, 0, 10, 0, }, { 17, 0, 158, 0, 0, 0, },
+	{ 12, 0, 28, 0, 10, 0, }, { 12, 0, 28, 0, 0, 0, }, { 12, 0, 36, 0, 10, 0, },
+	{ 0, 0, 36, 0, 10, 0, }, { 1, 0, 36, 0, 10, 0, }, { 4, 0, 36, 3, 7, 0, },
+	{ 0, 0, 36, 3, 7, 0, }, { 1, 0, 36, 3, 7, 0, }, { 12, 0, 55, 0, 10, 0, },
+	{ 0, 0, 55, 0, 10, 0, }, { 1, 0, 55, 0, 10, 0, }, { 12, 0, 91, 0, 10, 0, },
+	{ 11, 0, 91, 0, 16, 0, }, { 17, 0, 91, 0, 0, 0, }, { 12, 0, 150, 0, 10, 0, },
+	{ 11, 0, 150, 0, 16, 0, }, { 12, 0, 12, 0, 10, 0, }, { 21, 8, 12, 4, 4, 0, },
+	{ 17, 0, 12, 0, 0, 0, }, { 12, 0, 56, 0, 10, 0, }, { 21, 8, 56, 4, 4, 0, },
+	{ 17, 0, 56, 0, 0, 0, }, { 12, 0, 56, 0, 0, 0, }, { 11, 0, 56, 0, 16, 0, },
+	{ 12, 0, 84, 0, 10, 0, }, { 12, 0, 84, 0, 0, 0, }, { 17, 0, 84, 0, 0, 0, },
+	{ 12, 0, 115, 0, 10, 0, }, { 21, 8, 115, 4, 4, 0, }, { 21, 0, 115, 8, 4, 0, },
+	{ 5, 0, 141, 0, 10, 4, }, { 5, 0, 100, 0, 10, 4, }, { 5, 13, 50, 0, 0, 4, },
+	{ 4, 8, 66, 4, 4, 4, }, { 21, 0, 50, 8, 4, 4, }, { 14, 0, 141, 0, 0, 4, },
+	{ 12, 0, 66, 0, 0, 4, }, { 12, 0, 62, 0, 8, 4, }, { 14, 0, 100, 0, 0, 4, },
+	{ 12, 0, 35, 0, 10, 0, }, { 12, 0, 35, 0, 0, 0, }, { 21, 8, 35, 4, 4, 0, },
+	{ 17, 0, 35, 0, 0, 0, }, { 21, 0, 0, 4, 4, 0, }, { 21, 8, 46, 4, 4, 0, },
+	{ 11, 3, 0, 0, 16, 0, }, { 12, 0, 123, 0, 0, 0, }, { 21, 8, 123, 4, 4, 0, },
+	{ 17, 0, 123, 0, 0, 0, }, { 21, 8, 41, 4, 4, 0, }, { 12, 0, 57, 0, 10, 0, },
+	{ 21, 8, 57, 4, 4, 0, }, { 11, 0, 57, 0, 16, 0, }, { 12, 0, 57, 0, 0, 0, },
+	{ 12, 0, 151, 0, 10, 0, }, { 21, 8, 151, 4, 4, 0, }, { 12, 0, 156, 0, 10, 0, },
+	{ 21, 8, 156, 4, 4, 0, }, { 11, 0, 156, 0, 16, 0, }, { 9, 5, 156, 0, 0, 0, },
+	{ 12, 1, 85, 0, 10, 0, }, { 12, 1, 85, 0, 0, 0, }, { 21, 8, 85, 4, 4, 0, },
+	{ 12, 1, 3, 0, 10, 0, }, { 21, 8, 3, 4, 4, 0, }, { 11, 1, 3, 0, 16, 0, },
+	{ 0, 1, 3, 0, 0, 0, }, { 12, 2, 0, 0, 0, 0, }, { 10, 2, 0, 0, 0, 0, },
+	{ 29, 0, 2, 14, 0, 0, }, { 12, 0, 0, 14, 0, 4, }, { 28, 0, 0, 6, 6, 0, },
+	{ 30, 13, 0, 4, 4, 4, }, { 21, 9, 0, 4, 4, 0, },
+};
+
+#endif
+
+#endif
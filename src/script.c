@@ -0,0 +1,346 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Script itemization implementation.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <paragraph.h>
+
+#include "vec.h"
+#include "util.h"
+#include "script.h"
+#include "script_data.h"
+#include "prop.h"
+#include "utf8.h"
+
+static const vec_opts_t options = {
+	.sso_element_max = 0,
+};
+
+/**
+ * Get the Script property value of a code point.
+ *
+ * \param[in]  cp  The code point to look up.
+ * \return the code point's \ref paragraph_script_e.
+ */
+static inline uint8_t paragraph__script_of(
+		uint32_t cp)
+{
+	return paragraph_prop__get(cp)->script;
+}
+
+/**
+ * Get the script of text that is all ASCII.
+ *
+ * \param[in]  content  The content.  All its text must be ASCII.
+ * \return \ref PARAGRAPH_SCRIPT_LATN if there are any letters, or
+ *         \ref PARAGRAPH_SCRIPT_ZYYY otherwise.
+ */
+static uint8_t paragraph__script_ascii(
+		const paragraph_content_t *content)
+{
+	for (uint32_t e = 0; e < content->count; e++) {
+		const uint8_t *s = (const uint8_t *)content->cold[e].data;
+
+		if (content->type[e] != PARAGRAPH_CONTENT_TEXT) {
+			continue;
+		}
+
+		for (size_t i = 0; i < content->text_len[e]; i++) {
+			if ((uint8_t)((s[i] | 0x20) - 'a') < 26) {
+				return PARAGRAPH_SCRIPT_LATN;
+			}
+		}
+	}
+
+	return PARAGRAPH_SCRIPT_ZYYY;
+}
+
+/**
+ * Resolve the script of every byte of the content's text.
+ *
+ * \param[in]  script   The scripts.  Must have space for the text.
+ * \param[in]  content  The content to resolve.
+ */
+static void paragraph__script_resolve(
+		paragraph_script_t *script,
+		const paragraph_content_t *content)
+{
+	uint8_t *scripts = script->scripts;
+	uint8_t prev = PARAGRAPH_SCRIPT_ZYYY;
+	bool resolved = false;
+	size_t offset = 0;
+
+	for (uint32_t e = 0; e < content->count; e++) {
+		const uint8_t *s = (const uint8_t *)content->cold[e].data;
+		uint8_t utf8 = content->cold[e].utf8;
+		size_t len = content->text_len[e];
+		size_t pos = offset;
+
+		offset += len;
+
+		if (content->type[e] != PARAGRAPH_CONTENT_TEXT) {
+			continue;
+		}
+
+		for (size_t i = 0; i < len; ) {
+			uint8_t sc;
+			uint32_t cp;
+			size_t n;
+
+			if (s[i] < 0x80) {
+				cp = s[i];
+				n = 1;
+			} else if (utf8 == PARAGRAPH_UTF8_VALID) {
+				cp = paragraph_utf8__decode_valid(s + i, &n);
+			} else {
+				cp = paragraph_utf8__decode(s + i, len - i, &n);
+			}
+
+			sc = paragraph__script_of(cp);
+			if (sc == PARAGRAPH_SCRIPT_ZYYY ||
+					sc == PARAGRAPH_SCRIPT_ZINH) {
+				sc = prev;
+			} else if (!resolved) {
+				/* Leading text takes the first script. */
+				memset(scripts, sc, pos + i);
+				resolved = true;
+			}
+
+			memset(scripts + pos + i, sc, n);
+			prev = sc;
+			i += n;
+		}
+	}
+}
+
+/**
+ * Find where two sets of scripts differ.
+ *
+ * \param[in]  a         Scripts, or NULL if they are all a_script.
+ * \param[in]  a_script  Script of all of a, if a is NULL.
+ * \param[in]  b         Scripts to compare with, or NULL if all b_script.
+ * \param[in]  b_script  Script of all of b, if b is NULL.
+ * \param[in]  len       Number of scripts to compare.
+ * \param[in]  last      Whether to find the last difference, not the first.
+ * \param[out] pos_out   Returns the index of the difference, if any.
+ * \return true if the scripts differ, false otherwise.
+ */
+static bool paragraph__script_diff(
+		const uint8_t *a,
+		uint8_t a_script,
+		const uint8_t *b,
+		uint8_t b_script,
+		size_t len,
+		bool last,
+		size_t *pos_out)
+{
+	if (a == NULL && b == NULL) {
+		if (a_script == b_script || len == 0) {
+			return false;
+		}
+		*pos_out = last ? len - 1 : 0;
+		return true;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		size_t pos = last ? len - 1 - i : i;
+
+		if ((a != NULL ? a[pos] : a_script) !=
+		    (b != NULL ? b[pos] : b_script)) {
+			*pos_out = pos;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Extend the changed entry range to cover changed scripts.
+ *
+ * \param[in]  script   The scripts.
+ * \param[in]  content  The resolved content.
+ */
+static void paragraph__script_extend(
+		const paragraph_script_t *script,
+		paragraph_content_t *content)
+{
+	const uint8_t *scripts = script->active ? script->scripts : NULL;
+	const uint8_t *old = script->old_active ? script->old : NULL;
+	paragraph_content_dirty_t *dirty = &content->dirty;
+	uint32_t index;
+	size_t offset;
+	size_t pos;
+
+	/* Unchanged text before the changes is at the same offsets. */
+	pos = dirty->start < content->count ?
+			paragraph_content__offset(content, dirty->start) :
+			content->len;
+	if (paragraph__script_diff(scripts, script->script,
+			old, script->old_script, pos, false, &pos) &&
+	    paragraph_content__entry_at(content, pos,
+			&index, &offset) == PARAGRAPH_OK &&
+	    index < dirty->start) {
+		dirty->start = index;
+	}
+
+	if (dirty->end >= content->count) {
+		return;
+	}
+
+	/* Unchanged text after the changes is at the end of both. */
+	pos = paragraph_content__offset(content, dirty->end);
+	if (paragraph__script_diff(
+			scripts != NULL ? scripts + pos : NULL,
+			script->script,
+			old != NULL ? old + script->old_len -
+					(content->len - pos) : NULL,
+			script->old_script,
+			content->len - pos, true, &offset) &&
+	    paragraph_content__entry_at(content, pos + offset,
+			&index, &offset) == PARAGRAPH_OK &&
+	    index >= dirty->end) {
+		dirty->end = index + 1;
+	}
+}
+
+/* Internally exported function, documented in `src/script.h` */
+paragraph_err_t paragraph_script__update(
+		paragraph_script_t *script,
+		paragraph_content_t *content)
+{
+	bool compare = script->valid;
+	bool ascii = true;
+	paragraph_err_t err;
+	uint8_t *swap;
+	size_t alloc;
+
+	if (script->valid && !content->dirty.dirty) {
+		return PARAGRAPH_OK;
+	}
+
+	/* Keep the previous scripts to compare with. */
+	swap = script->old;
+	script->old = script->scripts;
+	script->scripts = swap;
+	alloc = script->old_alloc;
+	script->old_alloc = script->alloc;
+	script->alloc = alloc;
+	script->old_len = script->len;
+	script->old_script = script->script;
+	script->old_active = script->active;
+	script->valid = false;
+
+	for (uint32_t i = 0; i < content->count; i++) {
+		if (content->type[i] == PARAGRAPH_CONTENT_TEXT &&
+				content->cold[i].utf8 != PARAGRAPH_UTF8_ASCII) {
+			ascii = false;
+			break;
+		}
+	}
+
+	script->active = false;
+	script->len = content->len;
+	if (ascii) {
+		/* ASCII letters are all Latin, and the rest Common. */
+		script->script = paragraph__script_ascii(content);
+	} else {
+		err = vec_ensure((void **)&script->scripts, content->len,
+				sizeof(*script->scripts), 0,
+				&script->alloc, options);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+
+		paragraph__script_resolve(script, content);
+
+		script->script = content->len > 0 ?
+				script->scripts[0] : PARAGRAPH_SCRIPT_ZYYY;
+		for (size_t i = 1; i < content->len; i++) {
+			if (script->scripts[i] != script->script) {
+				script->active = true;
+				break;
+			}
+		}
+	}
+	script->valid = true;
+
+	if (compare && content->dirty.dirty) {
+		paragraph__script_extend(script, content);
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/script.h` */
+void paragraph_script__reset(
+		paragraph_script_t *script)
+{
+	script->len = 0;
+	script->old_len = 0;
+	script->script = PARAGRAPH_SCRIPT_ZYYY;
+	script->old_script = PARAGRAPH_SCRIPT_ZYYY;
+	script->active = false;
+	script->old_active = false;
+	script->valid = false;
+}
+
+/* Internally exported function, documented in `src/script.h` */
+void paragraph_script__destroy(
+		paragraph_script_t *script)
+{
+	vec_free((void **)&script->scripts, &script->alloc, options);
+	vec_free((void **)&script->old, &script->old_alloc, options);
+	*script = (paragraph_script_t) { 0 };
+}
+
+/* Internally exported function, documented in `src/script.h` */
+void paragraph_script__share(
+		paragraph_script_t *script,
+		const paragraph_script_t *src)
+{
+	vec_free((void **)&script->scripts, &script->alloc, options);
+
+	script->scripts = src->scripts;
+	script->alloc = src->alloc;
+	script->len = src->len;
+	script->script = src->script;
+	script->active = src->active;
+	script->valid = src->valid;
+}
+
+/* Internally exported function, documented in `src/script.h` */
+paragraph_err_t paragraph_script__own(
+		paragraph_script_t *script)
+{
+	return vec_dup((void **)&script->scripts, sizeof(*script->scripts),
+			script->len, &script->alloc);
+}
+
+/* Internally exported function, documented in `src/script.h` */
+void paragraph_script__forget(
+		paragraph_script_t *script)
+{
+	script->scripts = NULL;
+	script->alloc = 0;
+	script->len = 0;
+	script->script = PARAGRAPH_SCRIPT_ZYYY;
+	script->active = false;
+	script->valid = false;
+}
+
+/* Internally exported function, documented in `src/script.h` */
+uint32_t paragraph_script__code(
+		uint8_t script)
+{
+	return paragraph_script_codes[script];
+}
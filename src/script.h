@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Script itemization interface.
+ */
+
+#ifndef PARAGRAPH__SCRIPT_H
+#define PARAGRAPH__SCRIPT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "content.h"
+
+/**
+ * ISO 15924 code of the Common script, 'Zyyy', packed big-endian.  This is
+ * the script of text measured apart from the content, such as spaces.
+ */
+#define PARAGRAPH_SCRIPT_CODE_COMMON 0x5A797979
+
+/**
+ * Scripts of a paragraph's text.
+ */
+typedef struct paragraph_script_s {
+	uint8_t *scripts; /**< Script of each text byte, if active. */
+	size_t len;       /**< Byte length of the text the scripts are for. */
+	size_t alloc;     /**< Number of bytes scripts has space for. */
+
+	/** Scripts from the previous resolution, to compare with. */
+	uint8_t *old;
+	size_t old_len;     /**< Byte length of the text old is for. */
+	size_t old_alloc;   /**< Number of bytes old has space for. */
+	uint8_t old_script; /**< Previous script of all text, if not active. */
+	bool old_active;    /**< Whether the previous scripts were active. */
+
+	uint8_t script; /**< Script of all the text, if not active. */
+	bool active;    /**< Whether there is more than one script. */
+	bool valid;     /**< Whether scripts are for the current content. */
+} paragraph_script_t;
+
+/**
+ * Resolve the scripts of changed content.
+ *
+ * Does nothing unless the content has changed since the last call.
+ *
+ * A change can affect the scripts of unchanged content either side of it.
+ * The content's changed entry range is extended to cover any that differ
+ * from the previous resolution.
+ *
+ * \param[in]  script   The scripts to update.
+ * \param[in]  content  The content to resolve.  Must be settled.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_script__update(
+		paragraph_script_t *script,
+		paragraph_content_t *content);
+
+/**
+ * Forget all scripts, keeping allocations for reuse.
+ *
+ * \param[in]  script  The scripts to reset.
+ */
+void paragraph_script__reset(
+		paragraph_script_t *script);
+
+/**
+ * Free all scripts.
+ *
+ * \param[in]  script  The scripts to destroy.
+ */
+void paragraph_script__destroy(
+		paragraph_script_t *script);
+
+/**
+ * Use another paragraph's scripts, without copying them.
+ *
+ * Any scripts script has are freed.  The scripts are then shared, until
+ * \ref paragraph_script__own or \ref paragraph_script__forget is called.
+ *
+ * \param[in]  script  The scripts to share into.
+ * \param[in]  src     The scripts to share.
+ */
+void paragraph_script__share(
+		paragraph_script_t *script,
+		const paragraph_script_t *src);
+
+/**
+ * Take a copy of shared scripts, so they can be changed.
+ *
+ * \param[in]  script  The shared scripts.  Unchanged on failure.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_script__own(
+		paragraph_script_t *script);
+
+/**
+ * Stop using shared scripts, without freeing them.
+ *
+ * \param[in]  script  The shared scripts.
+ */
+void paragraph_script__forget(
+		paragraph_script_t *script);
+
+/**
+ * Get the ISO 15924 code of a script.
+ *
+ * \param[in]  script  The script, as returned by \ref paragraph_script__at.
+ * \return the script's four letter code, packed big-endian.
+ */
+uint32_t paragraph_script__code(
+		uint8_t script);
+
+/**
+ * Get the script of a text byte.
+ *
+ * \param[in]  script  The scripts.
+ * \param[in]  pos     Byte offset in paragraph text.
+ * \return the script.
+ */
+static inline uint8_t paragraph_script__at(
+		const paragraph_script_t *script,
+		size_t pos)
+{
+	return script->active ? script->scripts[pos] : script->script;
+}
+
+/**
+ * Find where the script next changes.
+ *
+ * \param[in]  script  The scripts.
+ * \param[in]  pos     Byte offset in paragraph text to search from.
+ * \param[in]  end     Byte offset in paragraph text to search to.
+ * \return the offset of the first byte after pos with a different script
+ *         to the byte at pos, or end if there is none.
+ */
+static inline size_t paragraph_script__run_end(
+		const paragraph_script_t *script,
+		size_t pos,
+		size_t end)
+{
+	if (script->active && pos < end) {
+		uint8_t s = script->scripts[pos];
+
+		while (++pos < end && script->scripts[pos] == s) {
+		}
+		return pos;
+	}
+
+	return end;
+}
+
+#endif
@@ -0,0 +1,353 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Script tables.
+ *
+ * Generated by `tools/script_gen.c` from Scripts-14.0.0.txt and PropertyValueAliases-14.0.0.txt.
+ * Do not edit.
+ */
+
+#ifndef PARAGRAPH__SCRIPT_DATA_H
+#define PARAGRAPH__SCRIPT_DATA_H
+
+#include <stdint.h>
+
+/** Scripts. */
+enum paragraph_script_e {
+	PARAGRAPH_SCRIPT_ZYYY, /**< Common */
+	PARAGRAPH_SCRIPT_ZINH, /**< Inherited */
+	PARAGRAPH_SCRIPT_ZZZZ, /**< Unknown */
+	PARAGRAPH_SCRIPT_ADLM, /**< Adlam */
+	PARAGRAPH_SCRIPT_AGHB, /**< Caucasian_Albanian */
+	PARAGRAPH_SCRIPT_AHOM, /**< Ahom */
+	PARAGRAPH_SCRIPT_ARAB, /**< Arabic */
+	PARAGRAPH_SCRIPT_ARMI, /**< Imperial_Aramaic */
+	PARAGRAPH_SCRIPT_ARMN, /**< Armenian */
+	PARAGRAPH_SCRIPT_AVST, /**< Avestan */
+	PARAGRAPH_SCRIPT_BALI, /**< Balinese */
+	PARAGRAPH_SCRIPT_BAMU, /**< Bamum */
+	PARAGRAPH_SCRIPT_BASS, /**< Bassa_Vah */
+	PARAGRAPH_SCRIPT_BATK, /**< Batak */
+	PARAGRAPH_SCRIPT_BENG, /**< Bengali */
+	PARAGRAPH_SCRIPT_BHKS, /**< Bhaiksuki */
+	PARAGRAPH_SCRIPT_BOPO, /**< Bopomofo */
+	PARAGRAPH_SCRIPT_BRAH, /**< Brahmi */
+	PARAGRAPH_SCRIPT_BRAI, /**< Braille */
+	PARAGRAPH_SCRIPT_BUGI, /**< Buginese */
+	PARAGRAPH_SCRIPT_BUHD, /**< Buhid */
+	PARAGRAPH_SCRIPT_CAKM, /**< Chakma */
+	PARAGRAPH_SCRIPT_CANS, /**< Canadian_Aboriginal */
+	PARAGRAPH_SCRIPT_CARI, /**< Carian */
+	PARAGRAPH_SCRIPT_CHAM, /**< Cham */
+	PARAGRAPH_SCRIPT_CHER, /**< Cherokee */
+	PARAGRAPH_SCRIPT_CHRS, /**< Chorasmian */
+	PARAGRAPH_SCRIPT_COPT, /**< Coptic */
+	PARAGRAPH_SCRIPT_CPMN, /**< Cypro_Minoan */
+	PARAGRAPH_SCRIPT_CPRT, /**< Cypriot */
+	PARAGRAPH_SCRIPT_CYRL, /**< Cyrillic */
+	PARAGRAPH_SCRIPT_DEVA, /**< Devanagari */
+	PARAGRAPH_SCRIPT_DIAK, /**< Dives_Akuru */
+	PARAGRAPH_SCRIPT_DOGR, /**< Dogra */
+	PARAGRAPH_SCRIPT_DSRT, /**< Deseret */
+	PARAGRAPH_SCRIPT_DUPL, /**< Duployan */
+	PARAGRAPH_SCRIPT_EGYP, /**< Egyptian_Hieroglyphs */
+	PARAGRAPH_SCRIPT_ELBA, /**< Elbasan */
+	PARAGRAPH_SCRIPT_ELYM, /**< Elymaic */
+	PARAGRAPH_SCRIPT_ETHI, /**< Ethiopic */
+	PARAGRAPH_SCRIPT_GEOR, /**< Georgian */
+	PARAGRAPH_SCRIPT_GLAG, /**< Glagolitic */
+	PARAGRAPH_SCRIPT_GONG, /**< Gunjala_Gondi */
+	PARAGRAPH_SCRIPT_GONM, /**< Masaram_Gondi */
+	PARAGRAPH_SCRIPT_GOTH, /**< Gothic */
+	PARAGRAPH_SCRIPT_GRAN, /**< Grantha */
+	PARAGRAPH_SCRIPT_GREK, /**< Greek */
+	PARAGRAPH_SCRIPT_GUJR, /**< Gujarati */
+	PARAGRAPH_SCRIPT_GURU, /**< Gurmukhi */
+	PARAGRAPH_SCRIPT_HANG, /**< Hangul */
+	PARAGRAPH_SCRIPT_HANI, /**< Han */
+	PARAGRAPH_SCRIPT_HANO, /**< Hanunoo */
+	PARAGRAPH_SCRIPT_HATR, /**< Hatran */
+	PARAGRAPH_SCRIPT_HEBR, /**< Hebrew */
+	PARAGRAPH_SCRIPT_HIRA, /**< Hiragana */
+	PARAGRAPH_SCRIPT_HLUW, /**< Anatolian_Hieroglyphs */
+	PARAGRAPH_SCRIPT_HMNG, /**< Pahawh_Hmong */
+	PARAGRAPH_SCRIPT_HMNP, /**< Nyiakeng_Puachue_Hmong */
+	PARAGRAPH_SCRIPT_HUNG, /**< Old_Hungarian */
+	PARAGRAPH_SCRIPT_ITAL, /**< Old_Italic */
+	PARAGRAPH_SCRIPT_JAVA, /**< Javanese */
+	PARAGRAPH_SCRIPT_KALI, /**< Kayah_Li */
+	PARAGRAPH_SCRIPT_KANA, /**< Katakana */
+	PARAGRAPH_SCRIPT_KHAR, /**< Kharoshthi */
+	PARAGRAPH_SCRIPT_KHMR, /**< Khmer */
+	PARAGRAPH_SCRIPT_KHOJ, /**< Khojki */
+	PARAGRAPH_SCRIPT_KITS, /**< Khitan_Small_Script */
+	PARAGRAPH_SCRIPT_KNDA, /**< Kannada */
+	PARAGRAPH_SCRIPT_KTHI, /**< Kaithi */
+	PARAGRAPH_SCRIPT_LANA, /**< Tai_Tham */
+	PARAGRAPH_SCRIPT_LAOO, /**< Lao */
+	PARAGRAPH_SCRIPT_LATN, /**< Latin */
+	PARAGRAPH_SCRIPT_LEPC, /**< Lepcha */
+	PARAGRAPH_SCRIPT_LIMB, /**< Limbu */
+	PARAGRAPH_SCRIPT_LINA, /**< Linear_A */
+	PARAGRAPH_SCRIPT_LINB, /**< Linear_B */
+	PARAGRAPH_SCRIPT_LISU, /**< Lisu */
+	PARAGRAPH_SCRIPT_LYCI, /**< Lycian */
+	PARAGRAPH_SCRIPT_LYDI, /**< Lydian */
+	PARAGRAPH_SCRIPT_MAHJ, /**< Mahajani */
+	PARAGRAPH_SCRIPT_MAKA, /**< Makasar */
+	PARAGRAPH_SCRIPT_MAND, /**< Mandaic */
+	PARAGRAPH_SCRIPT_MANI, /**< Manichaean */
+	PARAGRAPH_SCRIPT_MARC, /**< Marchen */
+	PARAGRAPH_SCRIPT_MEDF, /**< Medefaidrin */
+	PARAGRAPH_SCRIPT_MEND, /**< Mende_Kikakui */
+	PARAGRAPH_SCRIPT_MERC, /**< Meroitic_Cursive */
+	PARAGRAPH_SCRIPT_MERO, /**< Meroitic_Hieroglyphs */
+	PARAGRAPH_SCRIPT_MLYM, /**< Malayalam */
+	PARAGRAPH_SCRIPT_MODI, /**< Modi */
+	PARAGRAPH_SCRIPT_MONG, /**< Mongolian */
+	PARAGRAPH_SCRIPT_MROO, /**< Mro */
+	PARAGRAPH_SCRIPT_MTEI, /**< Meetei_Mayek */
+	PARAGRAPH_SCRIPT_MULT, /**< Multani */
+	PARAGRAPH_SCRIPT_MYMR, /**< Myanmar */
+	PARAGRAPH_SCRIPT_NAND, /**< Nandinagari */
+	PARAGRAPH_SCRIPT_NARB, /**< Old_North_Arabian */
+	PARAGRAPH_SCRIPT_NBAT, /**< Nabataean */
+	PARAGRAPH_SCRIPT_NEWA, /**< Newa */
+	PARAGRAPH_SCRIPT_NKOO, /**< Nko */
+	PARAGRAPH_SCRIPT_NSHU, /**< Nushu */
+	PARAGRAPH_SCRIPT_OGAM, /**< Ogham */
+	PARAGRAPH_SCRIPT_OLCK, /**< Ol_Chiki */
+	PARAGRAPH_SCRIPT_ORKH, /**< Old_Turkic */
+	PARAGRAPH_SCRIPT_ORYA, /**< Oriya */
+	PARAGRAPH_SCRIPT_OSGE, /**< Osage */
+	PARAGRAPH_SCRIPT_OSMA, /**< Osmanya */
+	PARAGRAPH_SCRIPT_OUGR, /**< Old_Uyghur */
+	PARAGRAPH_SCRIPT_PALM, /**< Palmyrene */
+	PARAGRAPH_SCRIPT_PAUC, /**< Pau_Cin_Hau */
+	PARAGRAPH_SCRIPT_PERM, /**< Old_Permic */
+	PARAGRAPH_SCRIPT_PHAG, /**< Phags_Pa */
+	PARAGRAPH_SCRIPT_PHLI, /**< Inscriptional_Pahlavi */
+	PARAGRAPH_SCRIPT_PHLP, /**< Psalter_Pahlavi */
+	PARAGRAPH_SCRIPT_PHNX, /**< Phoenician */
+	PARAGRAPH_SCRIPT_PLRD, /**< Miao */
+	PARAGRAPH_SCRIPT_PRTI, /**< Inscriptional_Parthian */
+	PARAGRAPH_SCRIPT_RJNG, /**< Rejang */
+	PARAGRAPH_SCRIPT_ROHG, /**< Hanifi_Rohingya */
+	PARAGRAPH_SCRIPT_RUNR, /**< Runic */
+	PARAGRAPH_SCRIPT_SAMR, /**< Samaritan */
+	PARAGRAPH_SCRIPT_SARB, /**< Old_South_Arabian */
+	PARAGRAPH_SCRIPT_SAUR, /**< Saurashtra */
+	PARAGRAPH_SCRIPT_SGNW, /**< SignWriting */
+	PARAGRAPH_SCRIPT_SHAW, /**< Shavian */
+	PARAGRAPH_SCRIPT_SHRD, /**< Sharada */
+	PARAGRAPH_SCRIPT_SIDD, /**< Siddham */
+	PARAGRAPH_SCRIPT_SIND, /**< Khudawadi */
+	PARAGRAPH_SCRIPT_SINH, /**< Sinhala */
+	PARAGRAPH_SCRIPT_SOGD, /**< Sogdian */
+	PARAGRAPH_SCRIPT_SOGO, /**< Old_Sogdian */
+	PARAGRAPH_SCRIPT_SORA, /**< Sora_Sompeng */
+	PARAGRAPH_SCRIPT_SOYO, /**< Soyombo */
+	PARAGRAPH_SCRIPT_SUND, /**< Sundanese */
+	PARAGRAPH_SCRIPT_SYLO, /**< Syloti_Nagri */
+	PARAGRAPH_SCRIPT_SYRC, /**< Syriac */
+	PARAGRAPH_SCRIPT_TAGB, /**< Tagbanwa */
+	PARAGRAPH_SCRIPT_TAKR, /**< Takri */
+	PARAGRAPH_SCRIPT_TALE, /**< Tai_Le */
+	PARAGRAPH_SCRIPT_TALU, /**< New_Tai_Lue */
+	PARAGRAPH_SCRIPT_TAML, /**< Tamil */
+	PARAGRAPH_SCRIPT_TANG, /**< Tangut */
+	PARAGRAPH_SCRIPT_TAVT, /**< Tai_Viet */
+	PARAGRAPH_SCRIPT_TELU, /**< Telugu */
+	PARAGRAPH_SCRIPT_TFNG, /**< Tifinagh */
+	PARAGRAPH_SCRIPT_TGLG, /**< Tagalog */
+	PARAGRAPH_SCRIPT_THAA, /**< Thaana */
+	PARAGRAPH_SCRIPT_THAI, /**< Thai */
+	PARAGRAPH_SCRIPT_TIBT, /**< Tibetan */
+	PARAGRAPH_SCRIPT_TIRH, /**< Tirhuta */
+	PARAGRAPH_SCRIPT_TNSA, /**< Tangsa */
+	PARAGRAPH_SCRIPT_TOTO, /**< Toto */
+	PARAGRAPH_SCRIPT_UGAR, /**< Ugaritic */
+	PARAGRAPH_SCRIPT_VAII, /**< Vai */
+	PARAGRAPH_SCRIPT_VITH, /**< Vithkuqi */
+	PARAGRAPH_SCRIPT_WARA, /**< Warang_Citi */
+	PARAGRAPH_SCRIPT_WCHO, /**< Wancho */
+	PARAGRAPH_SCRIPT_XPEO, /**< Old_Persian */
+	PARAGRAPH_SCRIPT_XSUX, /**< Cuneiform */
+	PARAGRAPH_SCRIPT_YEZI, /**< Yezidi */
+	PARAGRAPH_SCRIPT_YIII, /**< Yi */
+	PARAGRAPH_SCRIPT_ZANB, /**< Zanabazar_Square */
+	PARAGRAPH_SCRIPT__COUNT,
+};
+
+/** ISO 15924 code of each script, packed big-endian. */
+static const uint32_t paragraph_script_codes[162] = {
+	0x5A797979, /* Zyyy */
+	0x5A696E68, /* Zinh */
+	0x5A7A7A7A, /* Zzzz */
+	0x41646C6D, /* Adlm */
+	0x41676862, /* Aghb */
+	0x41686F6D, /* Ahom */
+	0x41726162, /* Arab */
+	0x41726D69, /* Armi */
+	0x41726D6E, /* Armn */
+	0x41767374, /* Avst */
+	0x42616C69, /* Bali */
+	0x42616D75, /* Bamu */
+	0x42617373, /* Bass */
+	0x4261746B, /* Batk */
+	0x42656E67, /* Beng */
+	0x42686B73, /* Bhks */
+	0x426F706F, /* Bopo */
+	0x42726168, /* Brah */
+	0x42726169, /* Brai */
+	0x42756769, /* Bugi */
+	0x42756864, /* Buhd */
+	0x43616B6D, /* Cakm */
+	0x43616E73, /* Cans */
+	0x43617269, /* Cari */
+	0x4368616D, /* Cham */
+	0x43686572, /* Cher */
+	0x43687273, /* Chrs */
+	0x436F7074, /* Copt */
+	0x43706D6E, /* Cpmn */
+	0x43707274, /* Cprt */
+	0x4379726C, /* Cyrl */
+	0x44657661, /* Deva */
+	0x4469616B, /* Diak */
+	0x446F6772, /* Dogr */
+	0x44737274, /* Dsrt */
+	0x4475706C, /* Dupl */
+	0x45677970, /* Egyp */
+	0x456C6261, /* Elba */
+	0x456C796D, /* Elym */
+	0x45746869, /* Ethi */
+	0x47656F72, /* Geor */
+	0x476C6167, /* Glag */
+	0x476F6E67, /* Gong */
+	0x476F6E6D, /* Gonm */
+	0x476F7468, /* Goth */
+	0x4772616E, /* Gran */
+	0x4772656B, /* Grek */
+	0x47756A72, /* Gujr */
+	0x47757275, /* Guru */
+	0x48616E67, /* Hang */
+	0x48616E69, /* Hani */
+	0x48616E6F, /* Hano */
+	0x48617472, /* Hatr */
+	0x48656272, /* Hebr */
+	0x48697261, /* Hira */
+	0x486C7577, /* Hluw */
+	0x486D6E67, /* Hmng */
+	0x486D6E70, /* Hmnp */
+	0x48756E67, /* Hung */
+	0x4974616C, /* Ital */
+	0x4A617661, /* Java */
+	0x4B616C69, /* Kali */
+	0x4B616E61, /* Kana */
+	0x4B686172, /* Khar */
+	0x4B686D72, /* Khmr */
+	0x4B686F6A, /* Khoj */
+	0x4B697473, /* Kits */
+	0x4B6E6461, /* Knda */
+	0x4B746869, /* Kthi */
+	0x4C616E61, /* Lana */
+	0x4C616F6F, /* Laoo */
+	0x4C61746E, /* Latn */
+	0x4C657063, /* Lepc */
+	0x4C696D62, /* Limb */
+	0x4C696E61, /* Lina */
+	0x4C696E62, /* Linb */
+	0x4C697375, /* Lisu */
+	0x4C796369, /* Lyci */
+	0x4C796469, /* Lydi */
+	0x4D61686A, /* Mahj */
+	0x4D616B61, /* Maka */
+	0x4D616E64, /* Mand */
+	0x4D616E69, /* Mani */
+	0x4D617263, /* Marc */
+	0x4D656466, /* Medf */
+	0x4D656E64, /* Mend */
+	0x4D657263, /* Merc */
+	0x4D65726F, /* Mero */
+	0x4D6C796D, /* Mlym */
+	0x4D6F6469, /* Modi */
+	0x4D6F6E67, /* Mong */
+	0x4D726F6F, /* Mroo */
+	0x4D746569, /* Mtei */
+	0x4D756C74, /* Mult */
+	0x4D796D72, /* Mymr */
+	0x4E616E64, /* Nand */
+	0x4E617262, /* Narb */
+	0x4E626174, /* Nbat */
+	0x4E657761, /* Newa */
+	0x4E6B6F6F, /* Nkoo */
+	0x4E736875, /* Nshu */
+	0x4F67616D, /* Ogam */
+	0x4F6C636B, /* Olck */
+	0x4F726B68, /* Orkh */
+	0x4F727961, /* Orya */
+	0x4F736765, /* Osge */
+	0x4F736D61, /* Osma */
+	0x4F756772, /* Ougr */
+	0x50616C6D, /* Palm */
+	0x50617563, /* Pauc */
+	0x5065726D, /* Perm */
+	0x50686167, /* Phag */
+	0x50686C69, /* Phli */
+	0x50686C70, /* Phlp */
+	0x50686E78, /* Phnx */
+	0x506C7264, /* Plrd */
+	0x50727469, /* Prti */
+	0x526A6E67, /* Rjng */
+	0x526F6867, /* Rohg */
+	0x52756E72, /* Runr */
+	0x53616D72, /* Samr */
+	0x53617262, /* Sarb */
+	0x53617572, /* Saur */
+	0x53676E77, /* Sgnw */
+	0x53686177, /* Shaw */
+	0x53687264, /* Shrd */
+	0x53696464, /* Sidd */
+	0x53696E64, /* Sind */
+	0x53696E68, /* Sinh */
+	0x536F6764, /* Sogd */
+	0x536F676F, /* Sogo */
+	0x536F7261, /* Sora */
+	0x536F796F, /* Soyo */
+	0x53756E64, /* Sund */
+	0x53796C6F, /* Sylo */
+	0x53797263, /* Syrc */
+	0x54616762, /* Tagb */
+	0x54616B72, /* Takr */
+	0x54616C65, /* Tale */
+	0x54616C75, /* Talu */
+	0x54616D6C, /* Taml */
+	0x54616E67, /* Tang */
+	0x54617674, /* Tavt */
+	0x54656C75, /* Telu */
+	0x54666E67, /* Tfng */
+	0x54676C67, /* Tglg */
+	0x54686161, /* Thaa */
+	0x54686169, /* Thai */
+	0x54696274, /* Tibt */
+	0x54697268, /* Tirh */
+	0x546E7361, /* Tnsa */
+	0x546F746F, /* Toto */
+	0x55676172, /* Ugar */
+	0x56616969, /* Vaii */
+	0x56697468, /* Vith */
+	0x57617261, /* Wara */
+	0x5763686F, /* Wcho */
+	0x5870656F, /* Xpeo */
+	0x58737578, /* Xsux */
+	0x59657A69, /* Yezi */
+	0x59696969, /* Yiii */
+	0x5A616E62, /* Zanb */
+};
+
+#endif
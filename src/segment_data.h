@@ -0,0 +1,193 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Text segmentation tables.
+ *
+ * Generated by `tools/segment_gen.c` from GraphemeBreakProperty-14.0.0.txt, WordBreakProperty-14.0.0.txt and emoji-data-14.0.0.txt.
+ * Do not edit.
+ */
+
+#ifndef PARAGRAPH__SEGMENT_DATA_H
+#define PARAGRAPH__SEGMENT_DATA_H
+
+#include <stdint.h>
+
+/** Grapheme cluster break classes. */
+enum paragraph_gcb_e {
+	PARAGRAPH_GCB_XX, /**< Other */
+	PARAGRAPH_GCB_CR, /**< CR */
+	PARAGRAPH_GCB_LF, /**< LF */
+	PARAGRAPH_GCB_CN, /**< Control */
+	PARAGRAPH_GCB_EX, /**< Extend */
+	PARAGRAPH_GCB_ZWJ, /**< ZWJ */
+	PARAGRAPH_GCB_RI, /**< Regional_Indicator */
+	PARAGRAPH_GCB_PP, /**< Prepend */
+	PARAGRAPH_GCB_SM, /**< SpacingMark */
+	PARAGRAPH_GCB_L, /**< L */
+	PARAGRAPH_GCB_V, /**< V */
+	PARAGRAPH_GCB_T, /**< T */
+	PARAGRAPH_GCB_LV, /**< LV */
+	PARAGRAPH_GCB_LVT, /**< LVT */
+	PARAGRAPH_GCB_EP, /**< Extended_Pictographic */
+	PARAGRAPH_GCB__COUNT,
+};
+
+/** Word break classes. */
+enum paragraph_wb_e {
+	PARAGRAPH_WB_XX, /**< Other */
+	PARAGRAPH_WB_CR, /**< CR */
+	PARAGRAPH_WB_LF, /**< LF */
+	PARAGRAPH_WB_NL, /**< Newline */
+	PARAGRAPH_WB_EXTEND, /**< Extend */
+	PARAGRAPH_WB_ZWJ, /**< ZWJ */
+	PARAGRAPH_WB_RI, /**< Regional_Indicator */
+	PARAGRAPH_WB_FO, /**< Format */
+	PARAGRAPH_WB_KA, /**< Katakana */
+	PARAGRAPH_WB_HL, /**< Hebrew_Letter */
+	PARAGRAPH_WB_LE, /**< ALetter */
+	PARAGRAPH_WB_SQ, /**< Single_Quote */
+	PARAGRAPH_WB_DQ, /**< Double_Quote */
+	PARAGRAPH_WB_MB, /**< MidNumLet */
+	PARAGRAPH_WB_ML, /**< MidLetter */
+	PARAGRAPH_WB_MN, /**< MidNum */
+	PARAGRAPH_WB_NU, /**< Numeric */
+	PARAGRAPH_WB_EX, /**< ExtendNumLet */
+	PARAGRAPH_WB_WSEGSPACE, /**< WSegSpace */
+	PARAGRAPH_WB__COUNT,
+};
+
+/** Whether there is a grapheme cluster boundary between pairs of classes. */
+static const uint8_t paragraph_gcb_pair[15][15] = {
+	[PARAGRAPH_GCB_XX] = {
+		1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_CR] = {
+		1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_LF] = {
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_CN] = {
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_EX] = {
+		1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_ZWJ] = {
+		1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_RI] = {
+		1, 1, 1, 1, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_PP] = {
+		0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	[PARAGRAPH_GCB_SM] = {
+		1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_L] = {
+		1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 1,
+	},
+	[PARAGRAPH_GCB_V] = {
+		1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_T] = {
+		1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 0, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_LV] = {
+		1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_LVT] = {
+		1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 0, 1, 1, 1,
+	},
+	[PARAGRAPH_GCB_EP] = {
+		1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+	},
+};
+
+/** Whether there is a word boundary between pairs of classes. */
+static const uint8_t paragraph_wb_pair[19][19] = {
+	[PARAGRAPH_WB_XX] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_CR] = {
+		1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_LF] = {
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_NL] = {
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_EXTEND] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_ZWJ] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_RI] = {
+		1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_FO] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_KA] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+		1, 0, 1,
+	},
+	[PARAGRAPH_WB_HL] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1,
+		0, 0, 1,
+	},
+	[PARAGRAPH_WB_LE] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 1, 1,
+		0, 0, 1,
+	},
+	[PARAGRAPH_WB_SQ] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_DQ] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_MB] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_ML] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_MN] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+	[PARAGRAPH_WB_NU] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 1, 1,
+		0, 0, 1,
+	},
+	[PARAGRAPH_WB_EX] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+		0, 0, 1,
+	},
+	[PARAGRAPH_WB_WSEGSPACE] = {
+		1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1,
+	},
+};
+
+#endif
@@ -14,12 +14,35 @@
 #include <paragraph.h>
 
 #include "vec.h"
+#include "ctx.h"
 #include "style.h"
 
 static const vec_opts_t options = {
 	.sso_element_max = PARAGRAPH_STYLES_SSO,
 };
 
+/* Exported function, documented in styles.h. */
+paragraph_err_t paragraph_style__ref(
+		const paragraph_ctx_t *ctx,
+		paragraph_style_t *style)
+{
+	if (ctx->cb_text->style_ref == NULL) {
+		return PARAGRAPH_OK;
+	}
+
+	return ctx->cb_text->style_ref(ctx->pw, style);
+}
+
+/* Exported function, documented in styles.h. */
+void paragraph_style__unref(
+		const paragraph_ctx_t *ctx,
+		paragraph_style_t *style)
+{
+	if (ctx->cb_text->style_unref != NULL) {
+		ctx->cb_text->style_unref(ctx->pw, style);
+	}
+}
+
 paragraph_err_t paragraph_style__ensure(
 		paragraph_styles_t *styles)
 {
@@ -32,6 +55,7 @@ paragraph_err_t paragraph_style__ensure(
 }
 
 paragraph_err_t paragraph_style__push(
+		const paragraph_ctx_t *ctx,
 		paragraph_styles_t *styles,
 		paragraph_style_t *style)
 {
@@ -42,30 +66,45 @@ paragraph_err_t paragraph_style__push(
 		return err;
 	}
 
-	styles->array[styles->count++] = paragraph_style__ref(style);
+	err = paragraph_style__ref(ctx, style);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	styles->array[styles->count++] = style;
 	return PARAGRAPH_OK;
 }
 
 /* Exported function, documented in styles.h. */
 paragraph_err_t paragraph_style__pop(
+		const paragraph_ctx_t *ctx,
 		paragraph_styles_t *styles,
 		paragraph_style_t **style_out)
 {
 	assert(styles->count > 0);
 
 	*style_out = styles->array[--styles->count];
-	paragraph_style__unref(*style_out);
+	paragraph_style__unref(ctx, *style_out);
 	return PARAGRAPH_OK;
 }
 
 /* Exported function, documented in styles.h. */
-void paragraph_style__fini(
+void paragraph_style__clear(
+		const paragraph_ctx_t *ctx,
 		paragraph_styles_t *styles)
 {
 	while (styles->count > 0) {
 		paragraph_style_t *style;
-		paragraph_style__pop(styles, &style);
+		paragraph_style__pop(ctx, styles, &style);
 	}
+}
+
+/* Exported function, documented in styles.h. */
+void paragraph_style__fini(
+		const paragraph_ctx_t *ctx,
+		paragraph_styles_t *styles)
+{
+	paragraph_style__clear(ctx, styles);
 
 	vec_free((void **)&styles->array, &styles->alloc, options);
 }
\ No newline at end of file
@@ -33,20 +33,26 @@ static inline void paragraph_style__init(
 	styles->alloc = PARAGRAPH_ARRAY_LEN(styles->sso);
 }
 
-static inline paragraph_style_t *paragraph_style__ref(
-		paragraph_style_t *style)
-{
-	/* TODO: Call client ref function. */
-	return style;
-}
+/**
+ * Take a reference to a style with the client's `style_ref` callback.
+ *
+ * \param[in]  ctx    The context to use the callbacks of.
+ * \param[in]  style  The style to reference.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_style__ref(
+		const paragraph_ctx_t *ctx,
+		paragraph_style_t *style);
 
-static inline paragraph_style_t *paragraph_style__unref(
-		paragraph_style_t *style)
-{
-	(void)(style);
-	/* TODO: Call client unref function. */
-	return NULL;
-}
+/**
+ * Release a reference to a style with the client's `style_unref` callback.
+ *
+ * \param[in]  ctx    The context to use the callbacks of.
+ * \param[in]  style  The style to release.
+ */
+void paragraph_style__unref(
+		const paragraph_ctx_t *ctx,
+		paragraph_style_t *style);
 
 static inline paragraph_style_t *paragraph_style__get_current(
 		const paragraph_styles_t *styles)
@@ -59,14 +65,21 @@ static inline paragraph_style_t *paragraph_style__get_current(
 }
 
 paragraph_err_t paragraph_style__push(
+		const paragraph_ctx_t *ctx,
 		paragraph_styles_t *styles,
 		paragraph_style_t *style);
 
 paragraph_err_t paragraph_style__pop(
+		const paragraph_ctx_t *ctx,
 		paragraph_styles_t *styles,
 		paragraph_style_t **style_out);
 
+void paragraph_style__clear(
+		const paragraph_ctx_t *ctx,
+		paragraph_styles_t *styles);
+
 void paragraph_style__fini(
+		const paragraph_ctx_t *ctx,
 		paragraph_styles_t *styles);
 
 #endif
@@ -0,0 +1,29 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Paragraph text implementation.
+ */
+
+#include <paragraph.h>
+
+#include "text.h"
+
+/* Internally exported function, documented in `src/text.h` */
+void paragraph_text__cursor_at(
+		paragraph_text_cursor_t *cursor,
+		paragraph_content_t *content,
+		size_t pos)
+{
+	uint32_t index = 0;
+	size_t offset;
+
+	/* On failure, index 0 gives a cursor at the end of the text. */
+	(void) paragraph_content__entry_at(content, pos, &index, &offset);
+
+	paragraph_text__cursor_init(cursor, content, index, pos);
+}
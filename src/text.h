@@ -0,0 +1,143 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Paragraph text interface.
+ */
+
+#ifndef PARAGRAPH__TEXT_H
+#define PARAGRAPH__TEXT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "content.h"
+
+/**
+ * A cursor over paragraph text.
+ *
+ * The text is read in chunks, where each chunk is the remaining text of the
+ * current content entry.
+ */
+typedef struct paragraph_text_cursor_s {
+	const paragraph_content_t *content; /**< Content being read. */
+	uint32_t entry; /**< Index of content entry containing cursor. */
+	size_t start;   /**< Byte offset of entry's text in paragraph text. */
+	size_t pos;     /**< Byte offset of cursor in paragraph text. */
+	const char *data; /**< Text at cursor. */
+	size_t avail;     /**< Bytes of text available at data. */
+} paragraph_text_cursor_t;
+
+/**
+ * Set up the cursor's current chunk for its entry, skipping to the next
+ * content entry with text, if necessary.
+ *
+ * \param[in]  cursor  The cursor to update.
+ */
+static inline void paragraph_text__cursor_fill(
+		paragraph_text_cursor_t *cursor)
+{
+	const paragraph_content_t *content = cursor->content;
+
+	while (cursor->entry < content->count) {
+		uint32_t e = cursor->entry;
+		size_t end = cursor->start + content->text_len[e];
+
+		if (content->type[e] == PARAGRAPH_CONTENT_TEXT &&
+				cursor->pos < end) {
+			size_t offset = cursor->pos - cursor->start;
+
+			cursor->data = content->cold[e].data + offset;
+			cursor->avail = end - cursor->pos;
+			return;
+		}
+		cursor->start = end;
+		cursor->entry++;
+	}
+
+	cursor->data = NULL;
+	cursor->avail = 0;
+}
+
+/**
+ * Initialise a cursor at a position within a given content entry.
+ *
+ * \param[in]  cursor   The cursor to initialise.
+ * \param[in]  content  The content to read text from.
+ * \param[in]  entry    Index of the content entry containing pos, or of an
+ *                      earlier entry.
+ * \param[in]  pos      Byte offset into the paragraph text.
+ */
+static inline void paragraph_text__cursor_init(
+		paragraph_text_cursor_t *cursor,
+		const paragraph_content_t *content,
+		uint32_t entry,
+		size_t pos)
+{
+	cursor->content = content;
+	cursor->entry = entry;
+	cursor->start = paragraph_content__offset(content, entry);
+	cursor->pos = pos;
+
+	paragraph_text__cursor_fill(cursor);
+}
+
+/**
+ * Initialise a cursor at a position in the paragraph text.
+ *
+ * \param[in]  cursor   The cursor to initialise.
+ * \param[in]  content  The content to read text from.
+ * \param[in]  pos      Byte offset into the paragraph text.
+ */
+void paragraph_text__cursor_at(
+		paragraph_text_cursor_t *cursor,
+		paragraph_content_t *content,
+		size_t pos);
+
+/**
+ * Advance a cursor.
+ *
+ * \param[in]  cursor  The cursor to advance.
+ * \param[in]  n       Number of bytes to advance by.
+ */
+static inline void paragraph_text__cursor_advance(
+		paragraph_text_cursor_t *cursor,
+		size_t n)
+{
+	while (n > 0 && cursor->avail > 0) {
+		size_t step = n < cursor->avail ? n : cursor->avail;
+
+		cursor->pos += step;
+		cursor->data += step;
+		cursor->avail -= step;
+		n -= step;
+
+		if (cursor->avail == 0) {
+			cursor->start = cursor->pos;
+			cursor->entry++;
+			paragraph_text__cursor_fill(cursor);
+		}
+	}
+}
+
+/**
+ * Get the byte at a cursor.
+ *
+ * \param[in]  cursor  The cursor to read from.
+ * \return the byte at the cursor, or -1 at the end of the text.
+ */
+static inline int paragraph_text__cursor_byte(
+		const paragraph_text_cursor_t *cursor)
+{
+	if (cursor->avail == 0) {
+		return -1;
+	}
+
+	return (unsigned char)*cursor->data;
+}
+
+#endif
@@ -0,0 +1,539 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Text transform implementation.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <paragraph.h>
+
+#include "vec.h"
+#include "ctx.h"
+#include "util.h"
+#include "utf8.h"
+#include "transform.h"
+#include "case_data.h"
+
+/** Most bytes a character can become when it is transformed. */
+#define PARAGRAPH_TRANSFORM_CHAR_MAX 12
+
+static const vec_opts_t options = {
+	.sso_element_max = 0,
+};
+
+/**
+ * Get a code point's case class.
+ *
+ * \param[in]  cp  The code point to look up.
+ * \return the code point's case class.
+ */
+static inline const paragraph_case_class_t *paragraph__transform_class(
+		uint32_t cp)
+{
+	uint8_t block;
+
+	if (cp >= PARAGRAPH_ARRAY_LEN(paragraph_case_stage1) *
+			PARAGRAPH_CASE_BLOCK_SIZE) {
+		return &paragraph_case_classes[0];
+	}
+
+	block = paragraph_case_stage1[cp / PARAGRAPH_CASE_BLOCK_SIZE];
+	return &paragraph_case_classes[paragraph_case_stage2[
+			block * PARAGRAPH_CASE_BLOCK_SIZE +
+			cp % PARAGRAPH_CASE_BLOCK_SIZE]];
+}
+
+/**
+ * Find a code point's full case mapping.
+ *
+ * \param[in]  cp  The code point to look up.
+ * \return the code point's full case mapping, or NULL if it has none.
+ */
+static const paragraph_case_special_t *paragraph__transform_special(
+		uint32_t cp)
+{
+	size_t lo = 0;
+	size_t hi = PARAGRAPH_ARRAY_LEN(paragraph_case_specials);
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (paragraph_case_specials[mid].cp < cp) {
+			lo = mid + 1;
+		} else if (paragraph_case_specials[mid].cp > cp) {
+			hi = mid;
+		} else {
+			return &paragraph_case_specials[mid];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Get a code point's fullwidth form.
+ *
+ * \param[in]  cp  The code point to look up.
+ * \return the code point's fullwidth form, or cp if it has none.
+ */
+static uint32_t paragraph__transform_wide(
+		uint32_t cp)
+{
+	size_t lo = 0;
+	size_t hi = PARAGRAPH_ARRAY_LEN(paragraph_case_wides);
+
+	if (cp == ' ') {
+		return cp;
+	}
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (paragraph_case_wides[mid].last < cp) {
+			lo = mid + 1;
+		} else if (paragraph_case_wides[mid].first > cp) {
+			hi = mid;
+		} else {
+			return cp + paragraph_case_wides[mid].delta;
+		}
+	}
+
+	return cp;
+}
+
+/**
+ * Check whether text ends with a letter, mark or number.
+ *
+ * \param[in]  data  The text to check.
+ * \param[in]  len   Byte length of text.  Must not be zero.
+ * \return true if the text's last character is part of a word.
+ */
+static bool paragraph__transform_ends_word(
+		const char *data,
+		size_t len)
+{
+	const uint8_t *s = (const uint8_t *)data;
+	size_t start = len - 1;
+	uint32_t cp;
+	size_t n;
+
+	/* Step back over continuation bytes to the last character. */
+	while (start > 0 && len - start < 4 && (s[start] & 0xC0) == 0x80) {
+		start--;
+	}
+
+	cp = paragraph_utf8__decode(s + start, len - start, &n);
+	if (start + n != len) {
+		return false;
+	}
+
+	return paragraph_transform__letter(cp);
+}
+
+/**
+ * Transform a character.
+ *
+ * \param[in]     mode  The transform to apply.
+ * \param[in]     cp    The character's code point.
+ * \param[in,out] word  Whether the character follows a letter, updated to
+ *                      whether the next character does.
+ * \param[out]    out   Returns the transformed character as UTF-8.  Must
+ *                      have space for PARAGRAPH_TRANSFORM_CHAR_MAX bytes.
+ * \return the number of bytes written to out.
+ */
+static size_t paragraph__transform_char(
+		paragraph_text_transform_t mode,
+		uint32_t cp,
+		bool *word,
+		uint8_t *out)
+{
+	const paragraph_case_class_t *class = paragraph__transform_class(cp);
+	const paragraph_case_special_t *special = NULL;
+	const uint32_t *full = NULL;
+	size_t n = 0;
+
+	if (class->flags & PARAGRAPH_CASE_SPECIAL) {
+		special = paragraph__transform_special(cp);
+	}
+
+	switch (mode) {
+	case PARAGRAPH_TEXT_TRANSFORM_UPPERCASE:
+		full = special != NULL ? special->upper : NULL;
+		cp += class->upper;
+		break;
+
+	case PARAGRAPH_TEXT_TRANSFORM_LOWERCASE:
+		full = special != NULL ? special->lower : NULL;
+		cp += class->lower;
+		break;
+
+	case PARAGRAPH_TEXT_TRANSFORM_CAPITALIZE:
+		if (!(class->flags & PARAGRAPH_CASE_LETTER)) {
+			*word = false;
+			break;
+		}
+		if (!*word) {
+			full = special != NULL ? special->title : NULL;
+			cp += class->title;
+			*word = true;
+		}
+		break;
+
+	case PARAGRAPH_TEXT_TRANSFORM_FULL_WIDTH:
+		cp = paragraph__transform_wide(cp);
+		break;
+
+	default:
+		break;
+	}
+
+	if (full == NULL) {
+		return paragraph_utf8__encode(cp, out);
+	}
+
+	for (size_t i = 0; i < 3 && full[i] != 0; i++) {
+		n += paragraph_utf8__encode(full[i], out + n);
+	}
+	return n;
+}
+
+/**
+ * Add a mark where the transformed text lines up with the processed text.
+ *
+ * \param[in]  tr   The text transform.
+ * \param[in]  pos  Byte offset of mark in processed text.
+ * \param[in]  out  Byte offset of mark in transformed text.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__transform_mark(
+		paragraph_transform_t *tr,
+		size_t pos,
+		size_t out)
+{
+	paragraph_err_t err;
+
+	/* An entry may start where the last one's final mark is. */
+	if (tr->mark_count > 0 && tr->marks[tr->mark_count - 1].pos == pos) {
+		tr->marks[tr->mark_count - 1].out = out;
+		return PARAGRAPH_OK;
+	}
+
+	err = vec_ensure((void **)&tr->marks, 1, sizeof(*tr->marks),
+			tr->mark_count, &tr->mark_alloc, options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	tr->marks[tr->mark_count++] = (paragraph_transform_mark_t) {
+		.pos = pos,
+		.out = out,
+	};
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/transform.h` */
+paragraph_err_t paragraph_transform__add(
+		paragraph_transform_t *tr,
+		uint32_t entry,
+		size_t pos,
+		const char *data,
+		size_t len)
+{
+	paragraph_text_transform_t mode = paragraph_transform__mode(tr, entry);
+	bool word = tr->entries[entry] & PARAGRAPH_TRANSFORM_WORD;
+	const uint8_t *s = (const uint8_t *)data;
+	size_t out = tr->len;
+	paragraph_err_t err;
+
+	err = paragraph__transform_mark(tr, pos, out);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	for (size_t i = 0; i < len; ) {
+		uint32_t cp;
+		size_t n, m;
+
+		if (tr->alloc - out < PARAGRAPH_TRANSFORM_CHAR_MAX) {
+			err = vec_ensure((void **)&tr->text,
+					len - i + PARAGRAPH_TRANSFORM_CHAR_MAX,
+					sizeof(*tr->text), out,
+					&tr->alloc, options);
+			if (err != PARAGRAPH_OK) {
+				return err;
+			}
+		}
+
+		cp = paragraph_utf8__decode(s + i, len - i, &n);
+		if (cp == PARAGRAPH_UTF8_REPLACEMENT) {
+			memcpy(tr->text + out, s + i, n);
+			word = false;
+			m = n;
+		} else {
+			m = paragraph__transform_char(mode, cp, &word,
+					(uint8_t *)tr->text + out);
+		}
+		i += n;
+		out += m;
+
+		if (m != n) {
+			err = paragraph__transform_mark(tr, pos + i, out);
+			if (err != PARAGRAPH_OK) {
+				return err;
+			}
+		}
+	}
+
+	tr->len = out;
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/transform.h` */
+uint32_t paragraph_transform__lower(
+		uint32_t cp)
+{
+	return cp + paragraph__transform_class(cp)->lower;
+}
+
+/* Internally exported function, documented in `src/transform.h` */
+bool paragraph_transform__letter(
+		uint32_t cp)
+{
+	return paragraph__transform_class(cp)->flags & PARAGRAPH_CASE_LETTER;
+}
+
+/**
+ * Find each content entry's `text-transform` value and flags.
+ *
+ * \param[in]  tr       The text transform.
+ * \param[in]  content  The content.
+ * \param[in]  ctx      The library context, for the client's callbacks.
+ */
+static void paragraph__transform_entries(
+		paragraph_transform_t *tr,
+		const paragraph_content_t *content,
+		const paragraph_ctx_t *ctx)
+{
+	const paragraph_cb_text_t *cb = ctx->cb_text;
+	paragraph_text_transform_t mode = PARAGRAPH_TEXT_TRANSFORM_NONE;
+	uint32_t style = UINT32_MAX;
+	bool word = false;
+
+	tr->active = false;
+	if (content->count > 0) {
+		memset(tr->entries, 0, content->count * sizeof(*tr->entries));
+	}
+
+	if (cb->text_transform == NULL) {
+		return;
+	}
+
+	for (uint32_t e = 0; e < content->count; e++) {
+		size_t len = content->text_len[e];
+
+		if (content->type[e] != PARAGRAPH_CONTENT_TEXT) {
+			continue;
+		}
+
+		if (content->style[e] != style) {
+			style = content->style[e];
+			mode = cb->text_transform(ctx->pw,
+					content->styles[style]);
+			if (mode > PARAGRAPH_TEXT_TRANSFORM_FULL_WIDTH) {
+				mode = PARAGRAPH_TEXT_TRANSFORM_NONE;
+			}
+		}
+		tr->entries[e] = mode;
+		if (mode != PARAGRAPH_TEXT_TRANSFORM_NONE) {
+			tr->active = true;
+		}
+
+		if (len == 0) {
+			continue;
+		}
+
+		/* Words continue across entries, whatever their style. */
+		if (mode == PARAGRAPH_TEXT_TRANSFORM_CAPITALIZE && word) {
+			tr->entries[e] |= PARAGRAPH_TRANSFORM_WORD;
+		}
+		word = paragraph__transform_ends_word(
+				content->cold[e].data, len);
+	}
+}
+
+/**
+ * Extend the changed entry range to cover entries with different values.
+ *
+ * \param[in]  tr       The text transform.
+ * \param[in]  content  The content.
+ */
+static void paragraph__transform_extend(
+		const paragraph_transform_t *tr,
+		paragraph_content_t *content)
+{
+	paragraph_content_dirty_t *dirty = &content->dirty;
+	int64_t shift = (int64_t)tr->entry_count - (int64_t)tr->old_count;
+
+	/* Unchanged entries before the changes are at the same indices. */
+	for (uint32_t e = 0; e < dirty->start && e < tr->old_count; e++) {
+		if (tr->entries[e] != tr->old[e]) {
+			dirty->start = e;
+			break;
+		}
+	}
+
+	/* Unchanged entries after the changes are shifted. */
+	for (uint32_t e = tr->entry_count; e > dirty->end; e--) {
+		int64_t old = (int64_t)e - 1 - shift;
+
+		if (old < 0 || tr->entries[e - 1] != tr->old[old]) {
+			dirty->end = e;
+			break;
+		}
+	}
+}
+
+/* Internally exported function, documented in `src/transform.h` */
+paragraph_err_t paragraph_transform__update(
+		paragraph_transform_t *tr,
+		paragraph_content_t *content,
+		const paragraph_ctx_t *ctx)
+{
+	bool compare = tr->valid;
+	paragraph_err_t err;
+	uint8_t *swap;
+	size_t alloc;
+
+	if (tr->valid && !content->dirty.dirty) {
+		return PARAGRAPH_OK;
+	}
+
+	paragraph_transform__clear(tr);
+
+	/* Keep the previous entry values to compare with. */
+	swap = tr->old;
+	tr->old = tr->entries;
+	tr->entries = swap;
+	alloc = tr->old_alloc;
+	tr->old_alloc = tr->entry_alloc;
+	tr->entry_alloc = alloc;
+	tr->old_count = tr->entry_count;
+	tr->entry_count = 0;
+	tr->valid = false;
+
+	err = vec_ensure((void **)&tr->entries, content->count,
+			sizeof(*tr->entries), 0, &tr->entry_alloc, options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+	tr->entry_count = content->count;
+
+	paragraph__transform_entries(tr, content, ctx);
+	tr->valid = true;
+
+	if (compare && content->dirty.dirty) {
+		paragraph__transform_extend(tr, content);
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/transform.h` */
+void paragraph_transform__reset(
+		paragraph_transform_t *tr)
+{
+	paragraph_transform__clear(tr);
+	tr->entry_count = 0;
+	tr->old_count = 0;
+	tr->active = false;
+	tr->valid = false;
+}
+
+/* Internally exported function, documented in `src/transform.h` */
+void paragraph_transform__destroy(
+		paragraph_transform_t *tr)
+{
+	vec_free((void **)&tr->text, &tr->alloc, options);
+	vec_free((void **)&tr->marks, &tr->mark_alloc, options);
+	vec_free((void **)&tr->entries, &tr->entry_alloc, options);
+	vec_free((void **)&tr->old, &tr->old_alloc, options);
+	*tr = (paragraph_transform_t) { 0 };
+}
+
+/* Internally exported function, documented in `src/transform.h` */
+void paragraph_transform__share(
+		paragraph_transform_t *tr,
+		const paragraph_transform_t *src)
+{
+	vec_free((void **)&tr->text, &tr->alloc, options);
+	vec_free((void **)&tr->marks, &tr->mark_alloc, options);
+	vec_free((void **)&tr->entries, &tr->entry_alloc, options);
+
+	tr->text = src->text;
+	tr->len = src->len;
+	tr->alloc = src->alloc;
+	tr->marks = src->marks;
+	tr->mark_count = src->mark_count;
+	tr->mark_alloc = src->mark_alloc;
+	tr->entries = src->entries;
+	tr->entry_count = src->entry_count;
+	tr->entry_alloc = src->entry_alloc;
+	tr->active = src->active;
+	tr->valid = src->valid;
+}
+
+/* Internally exported function, documented in `src/transform.h` */
+paragraph_err_t paragraph_transform__own(
+		paragraph_transform_t *tr)
+{
+	paragraph_transform_t own = *tr;
+	paragraph_err_t err;
+
+	err = vec_dup((void **)&own.text, sizeof(*own.text),
+			tr->len, &own.alloc);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = vec_dup((void **)&own.marks, sizeof(*own.marks),
+			tr->mark_count, &own.mark_alloc);
+	if (err != PARAGRAPH_OK) {
+		free(own.text);
+		return err;
+	}
+
+	err = vec_dup((void **)&own.entries, sizeof(*own.entries),
+			tr->entry_count, &own.entry_alloc);
+	if (err != PARAGRAPH_OK) {
+		free(own.text);
+		free(own.marks);
+		return err;
+	}
+
+	*tr = own;
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/transform.h` */
+void paragraph_transform__forget(
+		paragraph_transform_t *tr)
+{
+	tr->text = NULL;
+	tr->len = 0;
+	tr->alloc = 0;
+	tr->marks = NULL;
+	tr->mark_count = 0;
+	tr->mark_alloc = 0;
+	tr->entries = NULL;
+	tr->entry_count = 0;
+	tr->entry_alloc = 0;
+	tr->active = false;
+	tr->valid = false;
+}
@@ -0,0 +1,227 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Text transform interface.
+ */
+
+#ifndef PARAGRAPH__TRANSFORM_H
+#define PARAGRAPH__TRANSFORM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "content.h"
+
+/**
+ * A point where transformed text and processed text line up.
+ *
+ * Bytes from here up to the next mark are the same in number before and
+ * after they are transformed.
+ */
+typedef struct paragraph_transform_mark_s {
+	uint32_t pos; /**< Byte offset of mark in processed text. */
+	uint32_t out; /**< Byte offset of mark in transformed text. */
+} paragraph_transform_mark_t;
+
+/**
+ * Text transform of a paragraph's text.
+ */
+typedef struct paragraph_transform_s {
+	char *text;   /**< Transformed text of the runs transformed. */
+	size_t len;   /**< Byte length of transformed text. */
+	size_t alloc; /**< Number of bytes text has space for. */
+
+	paragraph_transform_mark_t *marks; /**< Map to transformed text. */
+	size_t mark_count; /**< Number of marks. */
+	size_t mark_alloc; /**< Number of marks marks has space for. */
+
+	/**
+	 * For each content entry, the entry's \ref paragraph_text_transform_e
+	 * and its PARAGRAPH_TRANSFORM_ flags.
+	 */
+	uint8_t *entries;
+	size_t entry_count; /**< Number of content entries. */
+	size_t entry_alloc; /**< Number of entries entries has space for. */
+
+	/** Entry values from the previous update, to compare with. */
+	uint8_t *old;
+	size_t old_count; /**< Number of content entries old is for. */
+	size_t old_alloc; /**< Number of entries old has space for. */
+
+	bool active; /**< Whether any entry has a transform. */
+	bool valid;  /**< Whether entry values are for the current content. */
+} paragraph_transform_t;
+
+/** Mask of an entry's \ref paragraph_text_transform_e. */
+#define PARAGRAPH_TRANSFORM_MODE 0x07
+
+/** Capitalized entry's text follows a letter, so starts within a word. */
+#define PARAGRAPH_TRANSFORM_WORD 0x08
+
+/**
+ * Find the `text-transform` values of changed content.
+ *
+ * Does nothing unless the content has changed since the last call.
+ *
+ * Whether capitalized text starts a word depends on the text before it.
+ * The content's changed entry range is extended to cover any entries
+ * with different values from the previous update.  Any transformed text
+ * is forgotten.
+ *
+ * \param[in]  tr       The text transform to update.
+ * \param[in]  content  The content to transform.  Must be settled.
+ * \param[in]  ctx      The library context, for the client's callbacks.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_transform__update(
+		paragraph_transform_t *tr,
+		paragraph_content_t *content,
+		const paragraph_ctx_t *ctx);
+
+/**
+ * Forget any transformed text.
+ *
+ * \param[in]  tr  The text transform.
+ */
+static inline void paragraph_transform__clear(
+		paragraph_transform_t *tr)
+{
+	tr->len = 0;
+	tr->mark_count = 0;
+}
+
+/**
+ * Transform a content entry's text.
+ *
+ * Entries must be added in text order, and not more than once until the
+ * transformed text is cleared.
+ *
+ * \param[in]  tr     The text transform.
+ * \param[in]  entry  Index of text content entry.  Must have a transform.
+ * \param[in]  pos    Byte offset of entry's text in processed text.
+ * \param[in]  data   The entry's processed text.
+ * \param[in]  len    Byte length of entry's processed text.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_transform__add(
+		paragraph_transform_t *tr,
+		uint32_t entry,
+		size_t pos,
+		const char *data,
+		size_t len);
+
+/**
+ * Get a character's simple lowercase mapping.
+ *
+ * \param[in]  cp  The character's code point.
+ * \return the code point of the lowercase character.
+ */
+uint32_t paragraph_transform__lower(
+		uint32_t cp);
+
+/**
+ * Check whether a character is a letter, mark or number.
+ *
+ * \param[in]  cp  The character's code point.
+ * \return true if the character can be part of a word.
+ */
+bool paragraph_transform__letter(
+		uint32_t cp);
+
+/**
+ * Forget all transforms, keeping allocations for reuse.
+ *
+ * \param[in]  tr  The text transform to reset.
+ */
+void paragraph_transform__reset(
+		paragraph_transform_t *tr);
+
+/**
+ * Free all transforms.
+ *
+ * \param[in]  tr  The text transform to destroy.
+ */
+void paragraph_transform__destroy(
+		paragraph_transform_t *tr);
+
+/**
+ * Use another paragraph's text transform, without copying it.
+ *
+ * Any transform tr has is freed.  The entry values and transformed text
+ * are then shared, until \ref paragraph_transform__own or
+ * \ref paragraph_transform__forget is called.
+ *
+ * \param[in]  tr   The text transform to share into.
+ * \param[in]  src  The text transform to share.
+ */
+void paragraph_transform__share(
+		paragraph_transform_t *tr,
+		const paragraph_transform_t *src);
+
+/**
+ * Take a copy of a shared text transform, so it can be changed.
+ *
+ * \param[in]  tr  The shared text transform.  Unchanged on failure.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_transform__own(
+		paragraph_transform_t *tr);
+
+/**
+ * Stop using a shared text transform, without freeing it.
+ *
+ * \param[in]  tr  The shared text transform.
+ */
+void paragraph_transform__forget(
+		paragraph_transform_t *tr);
+
+/**
+ * Get a content entry's `text-transform` value.
+ *
+ * \param[in]  tr     The text transform.
+ * \param[in]  entry  Index of content entry.
+ * \return the entry's \ref paragraph_text_transform_e.
+ */
+static inline paragraph_text_transform_t paragraph_transform__mode(
+		const paragraph_transform_t *tr,
+		uint32_t entry)
+{
+	return tr->entries[entry] & PARAGRAPH_TRANSFORM_MODE;
+}
+
+/**
+ * Map a processed text offset to the transformed text.
+ *
+ * \param[in]  tr   The text transform.  The offset must be in, or at the
+ *                  end of, an entry that has been added.
+ * \param[in]  pos  Byte offset in processed text, at a character boundary.
+ * \return the byte offset in the transformed text.
+ */
+static inline size_t paragraph_transform__map(
+		const paragraph_transform_t *tr,
+		size_t pos)
+{
+	const paragraph_transform_mark_t *marks = tr->marks;
+	size_t lo = 0;
+	size_t hi = tr->mark_count;
+
+	/* Each added entry starts with a mark. */
+	while (hi - lo > 1) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (marks[mid].pos <= pos) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return marks[lo].out + (pos - marks[lo].pos);
+}
+
+#endif
@@ -0,0 +1,286 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief UTF-8 validation implementation.
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <paragraph.h>
+
+#include "utf8.h"
+
+#ifdef __SSE2__
+/** Number of bytes checked at a time. */
+#define PARAGRAPH_UTF8_CHUNK 16
+
+/**
+ * Constraints carried from one chunk to the next.
+ *
+ * Each is a mask of the following chunk's bytes that the constraint
+ * applies to.
+ */
+typedef struct paragraph_utf8_carry_s {
+	uint32_t cont; /**< Bytes that must be continuation bytes. */
+	uint32_t e0;   /**< Bytes that follow 0xE0, so must be >= 0xA0. */
+	uint32_t ed;   /**< Bytes that follow 0xED, so must be < 0xA0. */
+	uint32_t f0;   /**< Bytes that follow 0xF0, so must be >= 0x90. */
+	uint32_t f4;   /**< Bytes that follow 0xF4, so must be < 0x90. */
+} paragraph_utf8_carry_t;
+
+/**
+ * Get a mask of bytes in a range.
+ *
+ * \param[in]  x      The bytes to test.
+ * \param[in]  first  The first byte in the range.
+ * \param[in]  count  The number of bytes in the range.
+ * \return mask with a bit set for each byte in the range.
+ */
+static inline uint32_t paragraph__utf8_range(
+		__m128i x,
+		uint8_t first,
+		uint8_t count)
+{
+	/* Bias, so an unsigned range check is a signed comparison. */
+	__m128i t = _mm_sub_epi8(x, _mm_set1_epi8((char)(first + 0x80)));
+
+	return (uint32_t)_mm_movemask_epi8(_mm_cmplt_epi8(t,
+			_mm_set1_epi8((char)(count - 0x80))));
+}
+
+/**
+ * Get a mask of bytes with a given value.
+ *
+ * \param[in]  x  The bytes to test.
+ * \param[in]  c  The byte value to test for.
+ * \return mask with a bit set for each byte equal to c.
+ */
+static inline uint32_t paragraph__utf8_eq(
+		__m128i x,
+		uint8_t c)
+{
+	return (uint32_t)_mm_movemask_epi8(
+			_mm_cmpeq_epi8(x, _mm_set1_epi8((char)c)));
+}
+
+/**
+ * Get a mask of bytes following a given byte value.
+ *
+ * \param[in]  x      The bytes to test.
+ * \param[in]  c      The byte value to test for.
+ * \param[in]  carry  Mask carried from the previous chunk.
+ * \return mask with a bit set for each byte after one equal to c.
+ */
+static inline uint32_t paragraph__utf8_after(
+		__m128i x,
+		uint8_t c,
+		uint32_t carry)
+{
+	return (paragraph__utf8_eq(x, c) << 1) | carry;
+}
+
+/**
+ * Check a chunk of UTF-8.
+ *
+ * \param[in]  carry      Constraints from the previous chunk, updated with
+ *                        constraints on the next chunk.
+ * \param[in]  x          The chunk to check.
+ * \param[out] rtl_out    Returns mask of bytes of right-to-left characters.
+ * \param[out] check_out  Returns mask of lead bytes of sequences to decode
+ *                        to check for right-to-left characters.
+ * \return true if no errors were found.
+ */
+static inline bool paragraph__utf8_chunk(
+		paragraph_utf8_carry_t *carry,
+		__m128i x,
+		uint32_t *rtl_out,
+		uint32_t *check_out)
+{
+	uint32_t ascii = ~(uint32_t)_mm_movemask_epi8(x) & 0xFFFF;
+	uint32_t l2 = paragraph__utf8_range(x, 0xC2, 0xDF - 0xC2 + 1);
+	uint32_t l3 = paragraph__utf8_range(x, 0xE0, 0xEF - 0xE0 + 1);
+	uint32_t l4 = paragraph__utf8_range(x, 0xF0, 0xF4 - 0xF0 + 1);
+	uint32_t cont = paragraph__utf8_range(x, 0x80, 0xBF - 0x80 + 1);
+	uint32_t need = carry->cont |
+			(l2 << 1) |
+			(l3 << 1) | (l3 << 2) |
+			(l4 << 1) | (l4 << 2) | (l4 << 3);
+	uint32_t e0 = paragraph__utf8_after(x, 0xE0, carry->e0);
+	uint32_t ed = paragraph__utf8_after(x, 0xED, carry->ed);
+	uint32_t f0 = paragraph__utf8_after(x, 0xF0, carry->f0);
+	uint32_t f4 = paragraph__utf8_after(x, 0xF4, carry->f4);
+	uint32_t err;
+
+	/* Bytes that are never valid: 0xC0, 0xC1 and 0xF5 to 0xFF. */
+	err = ~(ascii | l2 | l3 | l4 | cont);
+
+	/* Continuation bytes exactly where lead bytes need them.  Where
+	 * sequences overlap, a lead byte is found where a continuation byte
+	 * is needed. */
+	err |= need ^ cont;
+
+	/* Overlong forms, surrogates and code points above U+10FFFF. */
+	err |= e0 & paragraph__utf8_range(x, 0x80, 0xA0 - 0x80);
+	err |= ed & paragraph__utf8_range(x, 0xA0, 0xC0 - 0xA0);
+	err |= f0 & paragraph__utf8_range(x, 0x80, 0x90 - 0x80);
+	err |= f4 & paragraph__utf8_range(x, 0x90, 0xC0 - 0x90);
+
+	/* U+0580 to U+07FF, and U+0800 to U+08FF. */
+	*rtl_out = paragraph__utf8_range(x, 0xD6, 0xDF - 0xD6 + 1) |
+			(e0 & paragraph__utf8_range(x, 0xA0, 0xA4 - 0xA0));
+	*check_out = paragraph__utf8_eq(x, 0xE2) |
+			paragraph__utf8_eq(x, 0xEF) |
+			paragraph__utf8_eq(x, 0xF0);
+
+	carry->cont = need >> PARAGRAPH_UTF8_CHUNK;
+	carry->e0 = e0 >> PARAGRAPH_UTF8_CHUNK;
+	carry->ed = ed >> PARAGRAPH_UTF8_CHUNK;
+	carry->f0 = f0 >> PARAGRAPH_UTF8_CHUNK;
+	carry->f4 = f4 >> PARAGRAPH_UTF8_CHUNK;
+
+	return (err & 0xFFFF) == 0;
+}
+
+/**
+ * Decode sequences to check for right-to-left characters.
+ *
+ * \param[in]  s      The text.
+ * \param[in]  len    Byte length of the text.
+ * \param[in]  pos    Offset of the chunk the mask is for.
+ * \param[in]  check  Mask of lead bytes in the chunk to decode.
+ * \return true if a right-to-left character was found.
+ */
+static bool paragraph__utf8_check_bidi(
+		const uint8_t *s,
+		size_t len,
+		size_t pos,
+		uint32_t check)
+{
+	while (check != 0) {
+		size_t at = pos + __builtin_ctz(check);
+		size_t n;
+
+		if (at < len && paragraph_utf8__bidi(
+				paragraph_utf8__decode(s + at, len - at, &n))) {
+			return true;
+		}
+		check &= check - 1;
+	}
+
+	return false;
+}
+
+/* Internally exported function, documented in `src/utf8.h` */
+enum paragraph_utf8_e paragraph_utf8__check(
+		const char *data,
+		size_t len,
+		bool *bidi_out)
+{
+	const uint8_t *s = (const uint8_t *)data;
+	paragraph_utf8_carry_t carry = { 0 };
+	uint32_t rtl, check;
+	bool ascii = true;
+	bool bidi = false;
+	size_t i = 0;
+	__m128i x;
+
+	*bidi_out = true;
+
+	for (; len - i >= PARAGRAPH_UTF8_CHUNK; i += PARAGRAPH_UTF8_CHUNK) {
+		x = _mm_loadu_si128((const __m128i *)(s + i));
+
+		/* Any carried constraint includes a continuation byte. */
+		if (_mm_movemask_epi8(x) == 0 && carry.cont == 0) {
+			continue;
+		}
+
+		ascii = false;
+		if (!paragraph__utf8_chunk(&carry, x, &rtl, &check)) {
+			return PARAGRAPH_UTF8_INVALID;
+		}
+		if (!bidi) {
+			bidi = rtl != 0 || paragraph__utf8_check_bidi(
+					s, len, i, check);
+		}
+	}
+
+	if (i < len) {
+		uint8_t tail[PARAGRAPH_UTF8_CHUNK] = { 0 };
+
+		/* The padding isn't made of continuation bytes, so sequences
+		 * truncated by the end of the text are caught. */
+		memcpy(tail, s + i, len - i);
+		x = _mm_loadu_si128((const __m128i *)tail);
+
+		if (_mm_movemask_epi8(x) != 0) {
+			ascii = false;
+		}
+		if (!paragraph__utf8_chunk(&carry, x, &rtl, &check)) {
+			return PARAGRAPH_UTF8_INVALID;
+		}
+		if (!bidi) {
+			bidi = rtl != 0 || paragraph__utf8_check_bidi(
+					s, len, i, check);
+		}
+	}
+
+	if (carry.cont != 0) {
+		return PARAGRAPH_UTF8_INVALID;
+	}
+
+	*bidi_out = bidi;
+	return ascii ? PARAGRAPH_UTF8_ASCII : PARAGRAPH_UTF8_VALID;
+}
+
+#else
+
+/* Internally exported function, documented in `src/utf8.h` */
+enum paragraph_utf8_e paragraph_utf8__check(
+		const char *data,
+		size_t len,
+		bool *bidi_out)
+{
+	const uint8_t *s = (const uint8_t *)data;
+	bool ascii = true;
+	bool bidi = false;
+	size_t i = 0;
+
+	*bidi_out = true;
+
+	while (i < len) {
+		uint32_t cp;
+		size_t n;
+
+		if (s[i] < 0x80) {
+			i++;
+			continue;
+		}
+
+		ascii = false;
+		cp = paragraph_utf8__decode(s + i, len - i, &n);
+
+		/* The only well-formed sequence that decodes as the
+		 * replacement character is U+FFFD itself. */
+		if (cp == PARAGRAPH_UTF8_REPLACEMENT &&
+				(n != 3 || s[i] != 0xEF)) {
+			return PARAGRAPH_UTF8_INVALID;
+		}
+		bidi = bidi || paragraph_utf8__bidi(cp);
+		i += n;
+	}
+
+	*bidi_out = bidi;
+	return ascii ? PARAGRAPH_UTF8_ASCII : PARAGRAPH_UTF8_VALID;
+}
+
+#endif
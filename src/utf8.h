@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief UTF-8 validation and decoding interface.
+ */
+
+#ifndef PARAGRAPH__UTF8_H
+#define PARAGRAPH__UTF8_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Code point used in place of ill-formed UTF-8. */
+#define PARAGRAPH_UTF8_REPLACEMENT 0xFFFD
+
+/**
+ * What is known about some text's encoding.
+ */
+enum paragraph_utf8_e {
+	PARAGRAPH_UTF8_ASCII,   /**< Text is all ASCII. */
+	PARAGRAPH_UTF8_VALID,   /**< Text is valid UTF-8. */
+	PARAGRAPH_UTF8_INVALID, /**< Text contains ill-formed UTF-8. */
+};
+
+/**
+ * Check whether text is valid UTF-8.
+ *
+ * \param[in]  data      The text to check.
+ * \param[in]  len       Byte length of data.
+ * \param[out] bidi_out  Returns whether the text may need bidirectional
+ *                       resolution.  This is true if it has right-to-left
+ *                       characters or explicit directional formatting
+ *                       characters, or isn't valid.
+ * \return the text's \ref paragraph_utf8_e.
+ */
+enum paragraph_utf8_e paragraph_utf8__check(
+		const char *data,
+		size_t len,
+		bool *bidi_out);
+
+/**
+ * Test whether a code point may need bidirectional resolution.
+ *
+ * This is true of code points in the blocks allocated to right-to-left
+ * scripts, and of the explicit directional formatting characters other than
+ * LRM.
+ *
+ * \param[in]  cp  The code point to test.
+ * \return true if the code point may need bidirectional resolution.
+ */
+static inline bool paragraph_utf8__bidi(
+		uint32_t cp)
+{
+	return (cp >= 0x0590 && cp <= 0x08FF) ||
+	       (cp == 0x200F) ||
+	       (cp >= 0x202A && cp <= 0x202E) ||
+	       (cp >= 0x2066 && cp <= 0x2069) ||
+	       (cp >= 0xFB1D && cp <= 0xFDFF) ||
+	       (cp >= 0xFE70 && cp <= 0xFEFE) ||
+	       (cp >= 0x10800 && cp <= 0x10FFF) ||
+	       (cp >= 0x1E800 && cp <= 0x1EFFF);
+}
+
+/**
+ * Decode a UTF-8 character from text that may be ill-formed.
+ *
+ * \param[in]  s      The text to decode from.
+ * \param[in]  len    Number of bytes available at s.  Must not be zero.
+ * \param[out] n_out  Returns the number of bytes decoded.
+ * \return the decoded code point, or \ref PARAGRAPH_UTF8_REPLACEMENT if
+ *         the bytes decoded are a maximal subpart of an ill-formed sequence.
+ */
+static inline uint32_t paragraph_utf8__decode(
+		const uint8_t *s,
+		size_t len,
+		size_t *n_out)
+{
+	uint8_t lo = 0x80;
+	uint8_t hi = 0xBF;
+	uint32_t cp;
+	size_t n;
+
+	if (s[0] < 0x80) {
+		*n_out = 1;
+		return s[0];
+	} else if (s[0] >= 0xC2 && s[0] <= 0xDF) {
+		cp = s[0] & 0x1F;
+		n = 2;
+	} else if (s[0] >= 0xE0 && s[0] <= 0xEF) {
+		/* Exclude overlong forms and surrogates. */
+		lo = (s[0] == 0xE0) ? 0xA0 : 0x80;
+		hi = (s[0] == 0xED) ? 0x9F : 0xBF;
+		cp = s[0] & 0x0F;
+		n = 3;
+	} else if (s[0] >= 0xF0 && s[0] <= 0xF4) {
+		/* Exclude overlong forms and code points above U+10FFFF. */
+		lo = (s[0] == 0xF0) ? 0x90 : 0x80;
+		hi = (s[0] == 0xF4) ? 0x8F : 0xBF;
+		cp = s[0] & 0x07;
+		n = 4;
+	} else {
+		*n_out = 1;
+		return PARAGRAPH_UTF8_REPLACEMENT;
+	}
+
+	for (size_t i = 1; i < n; i++) {
+		if (i >= len || s[i] < lo || s[i] > hi) {
+			*n_out = i;
+			return PARAGRAPH_UTF8_REPLACEMENT;
+		}
+		cp = (cp << 6) | (s[i] & 0x3F);
+		lo = 0x80;
+		hi = 0xBF;
+	}
+
+	*n_out = n;
+	return cp;
+}
+
+/**
+ * Decode a UTF-8 character from text known to be valid.
+ *
+ * \param[in]  s      The text to decode from.
+ * \param[out] n_out  Returns the number of bytes decoded.
+ * \return the decoded code point.
+ */
+static inline uint32_t paragraph_utf8__decode_valid(
+		const uint8_t *s,
+		size_t *n_out)
+{
+	if (s[0] < 0x80) {
+		*n_out = 1;
+		return s[0];
+	} else if (s[0] < 0xE0) {
+		*n_out = 2;
+		return ((uint32_t)(s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+	} else if (s[0] < 0xF0) {
+		*n_out = 3;
+		return ((uint32_t)(s[0] & 0x0F) << 12) |
+				((uint32_t)(s[1] & 0x3F) << 6) |
+				(s[2] & 0x3F);
+	}
+
+	*n_out = 4;
+	return ((uint32_t)(s[0] & 0x07) << 18) |
+			((uint32_t)(s[1] & 0x3F) << 12) |
+			((uint32_t)(s[2] & 0x3F) << 6) |
+			(s[3] & 0x3F);
+}
+
+/**
+ * Encode a code point as UTF-8.
+ *
+ * \param[in]  cp   The code point to encode.  Must be a scalar value.
+ * \param[out] out  Returns the encoded bytes.  Must have space for four.
+ * \return the number of bytes encoded.
+ */
+static inline size_t paragraph_utf8__encode(
+		uint32_t cp,
+		uint8_t *out)
+{
+	if (cp < 0x80) {
+		out[0] = cp;
+		return 1;
+	} else if (cp < 0x800) {
+		out[0] = 0xC0 | (cp >> 6);
+		out[1] = 0x80 | (cp & 0x3F);
+		return 2;
+	} else if (cp < 0x10000) {
+		out[0] = 0xE0 | (cp >> 12);
+		out[1] = 0x80 | ((cp >> 6) & 0x3F);
+		out[2] = 0x80 | (cp & 0x3F);
+		return 3;
+	}
+
+	out[0] = 0xF0 | (cp >> 18);
+	out[1] = 0x80 | ((cp >> 12) & 0x3F);
+	out[2] = 0x80 | ((cp >> 6) & 0x3F);
+	out[3] = 0x80 | (cp & 0x3F);
+	return 4;
+}
+
+#endif
@@ -77,7 +77,7 @@ static inline paragraph_err_t vec_ensure(
 		return PARAGRAPH_ERR_OOM;
 	}
 
-	if (*element_alloc <= options.sso_element_max) {
+	if (*element_alloc <= options.sso_element_max && element_count > 0) {
 		memcpy(temp, *data, element_count * element_size);
 	}
 
@@ -87,6 +87,56 @@ static inline paragraph_err_t vec_ensure(
 	return PARAGRAPH_OK;
 }
 
+/**
+ * Copy a vector's elements to a new heap allocation.
+ *
+ * This is for taking a private copy of a vector that is shared with another
+ * owner, so the original allocation is neither changed nor freed.  Small
+ * size optimisation is not supported.
+ *
+ * \param[in,out] data           Address of vector to copy.  Updated to the
+ *                               copy on success, or NULL if no elements are
+ *                               copied.
+ * \param[in]     element_size   Size of an element in bytes.
+ * \param[in]     element_count  Number of elements to copy.  No more than
+ *                               element_alloc are copied.
+ * \param[in,out] element_alloc  Number of elements that can be stored in data.
+ *                               Updated on success.
+ * \return PARAGRAPH_OK on success, appropriate error otherwise.
+ */
+static inline paragraph_err_t vec_dup(
+		void **data,
+		size_t element_size,
+		size_t element_count,
+		size_t *element_alloc)
+{
+	void *temp;
+
+	assert(data != NULL);
+
+	if (element_count > *element_alloc) {
+		element_count = *element_alloc;
+	}
+
+	if (*data == NULL || element_count == 0) {
+		*data = NULL;
+		*element_alloc = 0;
+		return PARAGRAPH_OK;
+	}
+
+	temp = malloc(element_count * element_size);
+	if (temp == NULL) {
+		return PARAGRAPH_ERR_OOM;
+	}
+
+	memcpy(temp, *data, element_count * element_size);
+
+	*element_alloc = element_count;
+	*data = temp;
+
+	return PARAGRAPH_OK;
+}
+
 /**
  * Free a vector.
  *
@@ -0,0 +1,620 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief White space processing implementation.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <paragraph.h>
+
+#include "vec.h"
+#include "ctx.h"
+#include "whitespace.h"
+
+static const vec_opts_t options = {
+	.sso_element_max = 0,
+};
+
+/**
+ * State of a white space processing pass.
+ *
+ * The pass holds the processed text and runs while it builds them, and
+ * gives them back to the \ref paragraph_whitespace_t when it ends.
+ */
+typedef struct paragraph_whitespace_pass_s {
+	paragraph_whitespace_t *ws; /**< The processing being updated. */
+	const paragraph_content_t *content; /**< The content being processed. */
+
+	char *text;   /**< Processed text, if active. */
+	size_t alloc; /**< Number of bytes text has space for. */
+	paragraph_whitespace_run_t *runs; /**< Runs, if active. */
+	size_t run_count; /**< Number of runs. */
+	size_t run_alloc; /**< Number of runs runs has space for. */
+	bool active;  /**< Whether the text has been changed. */
+
+	size_t out;  /**< Byte length of the processed text so far. */
+	size_t next; /**< Paragraph text offset after the last byte kept. */
+	bool space;  /**< Whether a collapsible space here would be removed. */
+	/** Entry holding the last byte kept, if it is a collapsible space. */
+	uint32_t space_entry;
+} paragraph_whitespace_pass_t;
+
+/**
+ * Find the first byte in text that may be white space.
+ *
+ * \param[in]  s    The text to scan.
+ * \param[in]  len  Byte length of the text.
+ * \return the offset of the first byte that is a space or control
+ *         character, or len if there is none.
+ */
+static inline size_t paragraph__whitespace_skip(
+		const char *s,
+		size_t len)
+{
+	size_t i = 0;
+
+#ifdef __SSE2__
+	const __m128i limit = _mm_set1_epi8(' ');
+
+	for (; i + 16 <= len; i += 16) {
+		__m128i x = _mm_loadu_si128((const __m128i *)(s + i));
+		unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+				_mm_min_epu8(x, limit), x));
+
+		if (mask != 0) {
+			return i + __builtin_ctz(mask);
+		}
+	}
+#endif
+
+	while (i < len && (uint8_t)s[i] > ' ') {
+		i++;
+	}
+
+	return i;
+}
+
+/**
+ * Start keeping processed text, when processing first changes the text.
+ *
+ * \param[in]  pass  The processing pass.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__whitespace_start(
+		paragraph_whitespace_pass_t *pass)
+{
+	const paragraph_content_t *content = pass->content;
+	paragraph_err_t err;
+	size_t done = 0;
+
+	err = vec_ensure((void **)&pass->text, content->len,
+			sizeof(*pass->text), 0, &pass->alloc, options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = vec_ensure((void **)&pass->runs, 1,
+			sizeof(*pass->runs), 0, &pass->run_alloc, options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	/* Everything so far was kept as it was. */
+	for (uint32_t e = 0; e < content->count && done < pass->out; e++) {
+		size_t len = content->text_len[e];
+
+		if (content->type[e] != PARAGRAPH_CONTENT_TEXT) {
+			continue;
+		}
+
+		if (len > pass->out - done) {
+			len = pass->out - done;
+		}
+		memcpy(pass->text + done, content->cold[e].data, len);
+		done += len;
+	}
+
+	pass->runs[0] = (paragraph_whitespace_run_t) { 0 };
+	pass->run_count = 1;
+	pass->active = true;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Keep text in the processed text.
+ *
+ * \param[in]  pass  The processing pass.
+ * \param[in]  pos   Byte offset of text in paragraph text.
+ * \param[in]  data  The text to keep.  May differ from the text at pos.
+ * \param[in]  len   Byte length of text.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__whitespace_keep(
+		paragraph_whitespace_pass_t *pass,
+		size_t pos,
+		const char *data,
+		size_t len)
+{
+	paragraph_err_t err;
+
+	if (len == 0) {
+		return PARAGRAPH_OK;
+	}
+
+	if (pass->active) {
+		if (pos != pass->next) {
+			/* Bytes were removed before this. */
+			err = vec_ensure((void **)&pass->runs, 1,
+					sizeof(*pass->runs), pass->run_count,
+					&pass->run_alloc, options);
+			if (err != PARAGRAPH_OK) {
+				return err;
+			}
+
+			pass->runs[pass->run_count++] =
+					(paragraph_whitespace_run_t) {
+				.pos = pos,
+				.out = pass->out,
+			};
+		}
+		memcpy(pass->text + pass->out, data, len);
+	}
+
+	pass->out += len;
+	pass->next = pos + len;
+	pass->space = false;
+	pass->space_entry = UINT32_MAX;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Keep a white space byte in the processed text.
+ *
+ * \param[in]  pass  The processing pass.
+ * \param[in]  pos   Byte offset of the byte in paragraph text.
+ * \param[in]  from  The byte in the paragraph text.
+ * \param[in]  c     The byte to keep it as.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__whitespace_put(
+		paragraph_whitespace_pass_t *pass,
+		size_t pos,
+		char from,
+		char c)
+{
+	paragraph_err_t err;
+
+	if (c != from && !pass->active) {
+		err = paragraph__whitespace_start(pass);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+	}
+
+	return paragraph__whitespace_keep(pass, pos, &c, 1);
+}
+
+/**
+ * Remove the collapsible space that was the last byte kept.
+ *
+ * \param[in]  pass  The processing pass.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__whitespace_retract(
+		paragraph_whitespace_pass_t *pass)
+{
+	paragraph_err_t err;
+
+	if (!pass->active) {
+		err = paragraph__whitespace_start(pass);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+	}
+
+	pass->ws->entries[pass->space_entry] |= PARAGRAPH_WHITESPACE_TAIL;
+	pass->space_entry = UINT32_MAX;
+	pass->out--;
+	pass->next--;
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Process the text of an entry whose spaces collapse.
+ *
+ * \param[in]  pass      The processing pass.
+ * \param[in]  entry     Index of the content entry.
+ * \param[in]  base      Byte offset of the entry's text in paragraph text.
+ * \param[in]  newlines  Whether newlines are preserved.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__whitespace_collapse(
+		paragraph_whitespace_pass_t *pass,
+		uint32_t entry,
+		size_t base,
+		bool newlines)
+{
+	const paragraph_content_t *content = pass->content;
+	const char *s = content->cold[entry].data;
+	size_t len = content->text_len[entry];
+	paragraph_err_t err;
+	size_t i = 0;
+
+	while (i < len) {
+		size_t n = paragraph__whitespace_skip(s + i, len - i);
+
+		err = paragraph__whitespace_keep(pass, base + i, s + i, n);
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+		i += n;
+		if (i == len) {
+			break;
+		}
+
+		switch (s[i]) {
+		case '\n':
+			if (newlines) {
+				/* Spaces either side of a newline go. */
+				if (pass->space_entry != UINT32_MAX) {
+					err = paragraph__whitespace_retract(
+							pass);
+					if (err != PARAGRAPH_OK) {
+						return err;
+					}
+				}
+				err = paragraph__whitespace_put(pass,
+						base + i, s[i], '\n');
+				pass->space = true;
+				break;
+			}
+			/* Fall through. */
+		case ' ':
+		case '\t':
+		case '\r':
+			if (pass->space) {
+				uint8_t *flags = &pass->ws->entries[entry];
+
+				if (i == 0) {
+					*flags |= PARAGRAPH_WHITESPACE_LEAD;
+				}
+				err = pass->active ? PARAGRAPH_OK :
+						paragraph__whitespace_start(
+								pass);
+				break;
+			}
+			err = paragraph__whitespace_put(pass,
+					base + i, s[i], ' ');
+			pass->space = true;
+			pass->space_entry = entry;
+			break;
+
+		default:
+			err = paragraph__whitespace_keep(pass,
+					base + i, s + i, 1);
+			break;
+		}
+		if (err != PARAGRAPH_OK) {
+			return err;
+		}
+		i++;
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Process the white space of all the content's text.
+ *
+ * \param[in]  ws       The white space processing.  Entries must have
+ *                      space for the content.
+ * \param[in]  content  The content to process.
+ * \param[in]  ctx      The library context, for the client's callbacks.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t paragraph__whitespace_process(
+		paragraph_whitespace_t *ws,
+		const paragraph_content_t *content,
+		const paragraph_ctx_t *ctx)
+{
+	const paragraph_cb_text_t *cb = ctx->cb_text;
+	paragraph_whitespace_pass_t pass = {
+		.ws = ws,
+		.content = content,
+		.text = ws->text,
+		.alloc = ws->alloc,
+		.runs = ws->runs,
+		.run_alloc = ws->run_alloc,
+		.space = true,
+		.space_entry = UINT32_MAX,
+	};
+	paragraph_white_space_t mode = PARAGRAPH_WHITE_SPACE_NORMAL;
+	paragraph_err_t err = PARAGRAPH_OK;
+	uint32_t style = UINT32_MAX;
+	bool newline = false;
+	size_t offset = 0;
+
+	ws->nowrap = false;
+
+	for (uint32_t e = 0; e < content->count; e++) {
+		const char *s = content->cold[e].data;
+		size_t len = content->text_len[e];
+		size_t pos = offset;
+
+		offset += len;
+
+		ws->entries[e] = 0;
+		if (content->type[e] != PARAGRAPH_CONTENT_TEXT) {
+			continue;
+		}
+
+		if (content->style[e] != style) {
+			style = content->style[e];
+			mode = cb->white_space == NULL ?
+					PARAGRAPH_WHITE_SPACE_NORMAL :
+					cb->white_space(ctx->pw,
+						content->styles[style]);
+			if (mode > PARAGRAPH_WHITE_SPACE_BREAK_SPACES) {
+				mode = PARAGRAPH_WHITE_SPACE_NORMAL;
+			}
+		}
+		ws->entries[e] = mode;
+		if (newline && len > 0) {
+			ws->entries[e] |= PARAGRAPH_WHITESPACE_NEWLINE;
+		}
+
+		switch (mode) {
+		case PARAGRAPH_WHITE_SPACE_NORMAL:
+		case PARAGRAPH_WHITE_SPACE_NOWRAP:
+		case PARAGRAPH_WHITE_SPACE_PRE_LINE:
+			err = paragraph__whitespace_collapse(&pass, e, pos,
+					mode == PARAGRAPH_WHITE_SPACE_PRE_LINE);
+			break;
+
+		default:
+			err = paragraph__whitespace_keep(&pass, pos, s, len);
+			if (len > 0) {
+				pass.space = s[len - 1] == '\n';
+			}
+			break;
+		}
+		if (err != PARAGRAPH_OK) {
+			break;
+		}
+
+		if (mode == PARAGRAPH_WHITE_SPACE_NOWRAP ||
+				mode == PARAGRAPH_WHITE_SPACE_PRE) {
+			ws->nowrap = true;
+		}
+		if (len > 0) {
+			newline = s[len - 1] == '\n';
+		}
+	}
+
+	ws->text = pass.text;
+	ws->alloc = pass.alloc;
+	ws->runs = pass.runs;
+	ws->run_alloc = pass.run_alloc;
+	ws->run_count = pass.run_count;
+	ws->active = pass.active;
+	ws->len = pass.out;
+	return err;
+}
+
+/**
+ * Extend the changed entry range to cover entries processed differently.
+ *
+ * \param[in]  ws       The white space processing.
+ * \param[in]  content  The processed content.
+ */
+static void paragraph__whitespace_extend(
+		const paragraph_whitespace_t *ws,
+		paragraph_content_t *content)
+{
+	paragraph_content_dirty_t *dirty = &content->dirty;
+	int64_t shift = (int64_t)ws->entry_count - (int64_t)ws->old_count;
+
+	/* Unchanged entries before the changes are at the same indices. */
+	for (uint32_t e = 0; e < dirty->start && e < ws->old_count; e++) {
+		if (ws->entries[e] != ws->old[e]) {
+			dirty->start = e;
+			break;
+		}
+	}
+
+	/* Unchanged entries after the changes are shifted. */
+	for (uint32_t e = ws->entry_count; e > dirty->end; e--) {
+		int64_t old = (int64_t)e - 1 - shift;
+
+		if (old < 0 || ws->entries[e - 1] != ws->old[old]) {
+			dirty->end = e;
+			break;
+		}
+	}
+}
+
+/* Internally exported function, documented in `src/whitespace.h` */
+paragraph_err_t paragraph_whitespace__update(
+		paragraph_whitespace_t *ws,
+		paragraph_content_t *content,
+		const paragraph_ctx_t *ctx)
+{
+	bool compare = ws->valid;
+	paragraph_err_t err;
+	uint8_t *swap;
+	size_t alloc;
+
+	if (ws->valid && !content->dirty.dirty) {
+		return PARAGRAPH_OK;
+	}
+
+	/* Keep the previous entry values to compare with. */
+	swap = ws->old;
+	ws->old = ws->entries;
+	ws->entries = swap;
+	alloc = ws->old_alloc;
+	ws->old_alloc = ws->entry_alloc;
+	ws->entry_alloc = alloc;
+	ws->old_count = ws->entry_count;
+	ws->entry_count = 0;
+	ws->valid = false;
+
+	err = vec_ensure((void **)&ws->entries, content->count,
+			sizeof(*ws->entries), 0, &ws->entry_alloc, options);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+	ws->entry_count = content->count;
+
+	err = paragraph__whitespace_process(ws, content, ctx);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+	ws->valid = true;
+
+	if (compare && content->dirty.dirty) {
+		paragraph__whitespace_extend(ws, content);
+	}
+
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/whitespace.h` */
+bool paragraph_whitespace__wraps(
+		const paragraph_whitespace_t *ws,
+		paragraph_content_t *content,
+		size_t pos)
+{
+	paragraph_white_space_t mode;
+	uint32_t index;
+	size_t offset;
+
+	if (!ws->nowrap || pos >= content->len ||
+			paragraph_content__entry_at(content, pos,
+					&index, &offset) != PARAGRAPH_OK) {
+		return true;
+	}
+
+	/* The line starting here, if there is one, has the text's entry
+	 * in it, so changes to the entry are seen by the layout. */
+	mode = paragraph_whitespace__mode(ws, index);
+	if (mode != PARAGRAPH_WHITE_SPACE_NOWRAP &&
+			mode != PARAGRAPH_WHITE_SPACE_PRE) {
+		return true;
+	}
+
+	/* Lines still end after preserved newlines.  There is always a
+	 * break opportunity after a newline. */
+	if (offset == 0) {
+		return ws->entries[index] & PARAGRAPH_WHITESPACE_NEWLINE;
+	}
+	return content->cold[index].data[offset - 1] == '\n';
+}
+
+/* Internally exported function, documented in `src/whitespace.h` */
+void paragraph_whitespace__reset(
+		paragraph_whitespace_t *ws)
+{
+	ws->len = 0;
+	ws->run_count = 0;
+	ws->entry_count = 0;
+	ws->old_count = 0;
+	ws->active = false;
+	ws->nowrap = false;
+	ws->valid = false;
+}
+
+/* Internally exported function, documented in `src/whitespace.h` */
+void paragraph_whitespace__destroy(
+		paragraph_whitespace_t *ws)
+{
+	vec_free((void **)&ws->text, &ws->alloc, options);
+	vec_free((void **)&ws->runs, &ws->run_alloc, options);
+	vec_free((void **)&ws->entries, &ws->entry_alloc, options);
+	vec_free((void **)&ws->old, &ws->old_alloc, options);
+	*ws = (paragraph_whitespace_t) { 0 };
+}
+
+/* Internally exported function, documented in `src/whitespace.h` */
+void paragraph_whitespace__share(
+		paragraph_whitespace_t *ws,
+		const paragraph_whitespace_t *src)
+{
+	vec_free((void **)&ws->text, &ws->alloc, options);
+	vec_free((void **)&ws->runs, &ws->run_alloc, options);
+	vec_free((void **)&ws->entries, &ws->entry_alloc, options);
+
+	ws->text = src->text;
+	ws->len = src->len;
+	ws->alloc = src->alloc;
+	ws->runs = src->runs;
+	ws->run_count = src->run_count;
+	ws->run_alloc = src->run_alloc;
+	ws->entries = src->entries;
+	ws->entry_count = src->entry_count;
+	ws->entry_alloc = src->entry_alloc;
+	ws->active = src->active;
+	ws->nowrap = src->nowrap;
+	ws->valid = src->valid;
+}
+
+/* Internally exported function, documented in `src/whitespace.h` */
+paragraph_err_t paragraph_whitespace__own(
+		paragraph_whitespace_t *ws)
+{
+	paragraph_whitespace_t own = *ws;
+	paragraph_err_t err;
+
+	err = vec_dup((void **)&own.text, sizeof(*own.text),
+			ws->len, &own.alloc);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = vec_dup((void **)&own.runs, sizeof(*own.runs),
+			ws->run_count, &own.run_alloc);
+	if (err != PARAGRAPH_OK) {
+		free(own.text);
+		return err;
+	}
+
+	err = vec_dup((void **)&own.entries, sizeof(*own.entries),
+			ws->entry_count, &own.entry_alloc);
+	if (err != PARAGRAPH_OK) {
+		free(own.text);
+		free(own.runs);
+		return err;
+	}
+
+	*ws = own;
+	return PARAGRAPH_OK;
+}
+
+/* Internally exported function, documented in `src/whitespace.h` */
+void paragraph_whitespace__forget(
+		paragraph_whitespace_t *ws)
+{
+	ws->text = NULL;
+	ws->len = 0;
+	ws->alloc = 0;
+	ws->runs = NULL;
+	ws->run_count = 0;
+	ws->run_alloc = 0;
+	ws->entries = NULL;
+	ws->entry_count = 0;
+	ws->entry_alloc = 0;
+	ws->active = false;
+	ws->nowrap = false;
+	ws->valid = false;
+}
@@ -0,0 +1,206 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief White space processing interface.
+ */
+
+#ifndef PARAGRAPH__WHITESPACE_H
+#define PARAGRAPH__WHITESPACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "content.h"
+
+/**
+ * A run of kept bytes followed by removed bytes.
+ *
+ * The run's kept bytes continue up to the next run's offset in the
+ * processed text.  The rest of the run, up to the next run's offset in the
+ * paragraph text, has been removed.
+ */
+typedef struct paragraph_whitespace_run_s {
+	uint32_t pos; /**< Byte offset of run in paragraph text. */
+	uint32_t out; /**< Byte offset of run in processed text. */
+} paragraph_whitespace_run_t;
+
+/**
+ * White space processing of a paragraph's text.
+ */
+typedef struct paragraph_whitespace_s {
+	char *text;   /**< Processed text, if active. */
+	size_t len;   /**< Byte length of processed text. */
+	size_t alloc; /**< Number of bytes text has space for. */
+
+	paragraph_whitespace_run_t *runs; /**< Map to processed text. */
+	size_t run_count; /**< Number of runs, if active. */
+	size_t run_alloc; /**< Number of runs runs has space for. */
+
+	/**
+	 * For each content entry, the entry's \ref paragraph_white_space_e
+	 * and its PARAGRAPH_WHITESPACE_ flags.
+	 */
+	uint8_t *entries;
+	size_t entry_count; /**< Number of content entries. */
+	size_t entry_alloc; /**< Number of entries entries has space for. */
+
+	/** Entry values from the previous processing, to compare with. */
+	uint8_t *old;
+	size_t old_count; /**< Number of content entries old is for. */
+	size_t old_alloc; /**< Number of entries old has space for. */
+
+	bool active; /**< Whether the processed text differs from the text. */
+	bool nowrap; /**< Whether any text doesn't wrap. */
+	bool valid;  /**< Whether processing is for the current content. */
+} paragraph_whitespace_t;
+
+/** Mask of an entry's \ref paragraph_white_space_e. */
+#define PARAGRAPH_WHITESPACE_MODE 0x07
+
+/** Entry's first byte was removed, following a space before the entry. */
+#define PARAGRAPH_WHITESPACE_LEAD 0x08
+
+/** Entry's last kept space was removed, by a newline after the entry. */
+#define PARAGRAPH_WHITESPACE_TAIL 0x10
+
+/** Entry's text follows a newline at the end of an earlier entry. */
+#define PARAGRAPH_WHITESPACE_NEWLINE 0x20
+
+/**
+ * Process the white space of changed content.
+ *
+ * Does nothing unless the content has changed since the last call.
+ *
+ * Collapsing spaces can affect the unchanged content either side of a
+ * change.  The content's changed entry range is extended to cover any
+ * entries processed differently from the previous processing.
+ *
+ * \param[in]  ws       The white space processing to update.
+ * \param[in]  content  The content to process.  Must be settled.
+ * \param[in]  ctx      The library context, for the client's callbacks.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_whitespace__update(
+		paragraph_whitespace_t *ws,
+		paragraph_content_t *content,
+		const paragraph_ctx_t *ctx);
+
+/**
+ * Forget all processing, keeping allocations for reuse.
+ *
+ * \param[in]  ws  The white space processing to reset.
+ */
+void paragraph_whitespace__reset(
+		paragraph_whitespace_t *ws);
+
+/**
+ * Free all processing.
+ *
+ * \param[in]  ws  The white space processing to destroy.
+ */
+void paragraph_whitespace__destroy(
+		paragraph_whitespace_t *ws);
+
+/**
+ * Use another paragraph's white space processing, without copying it.
+ *
+ * Any processing ws has is freed.  The processed text, its map and the
+ * entry values are then shared, until \ref paragraph_whitespace__own or
+ * \ref paragraph_whitespace__forget is called.
+ *
+ * \param[in]  ws   The white space processing to share into.
+ * \param[in]  src  The white space processing to share.
+ */
+void paragraph_whitespace__share(
+		paragraph_whitespace_t *ws,
+		const paragraph_whitespace_t *src);
+
+/**
+ * Take a copy of shared white space processing, so it can be changed.
+ *
+ * \param[in]  ws  The shared processing.  Unchanged on failure.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+paragraph_err_t paragraph_whitespace__own(
+		paragraph_whitespace_t *ws);
+
+/**
+ * Stop using shared white space processing, without freeing it.
+ *
+ * \param[in]  ws  The shared processing.
+ */
+void paragraph_whitespace__forget(
+		paragraph_whitespace_t *ws);
+
+/**
+ * Check whether text may wrap at a line break opportunity.
+ *
+ * Whether text wraps is decided by the entry the text after the break
+ * opportunity is in, so changes that affect it are in changed entry
+ * ranges.  Text that doesn't wrap only breaks after newlines.
+ *
+ * \param[in]  ws       The white space processing.
+ * \param[in]  content  The processed content.
+ * \param[in]  pos      Byte offset of break opportunity in paragraph text.
+ * \return true if a line may start at pos.
+ */
+bool paragraph_whitespace__wraps(
+		const paragraph_whitespace_t *ws,
+		paragraph_content_t *content,
+		size_t pos);
+
+/**
+ * Get a content entry's `white-space` value.
+ *
+ * \param[in]  ws     The white space processing.
+ * \param[in]  entry  Index of content entry.
+ * \return the entry's \ref paragraph_white_space_e.
+ */
+static inline paragraph_white_space_t paragraph_whitespace__mode(
+		const paragraph_whitespace_t *ws,
+		uint32_t entry)
+{
+	return ws->entries[entry] & PARAGRAPH_WHITESPACE_MODE;
+}
+
+/**
+ * Map a paragraph text offset to the processed text.
+ *
+ * \param[in]  ws   The white space processing.  Must be active.
+ * \param[in]  pos  Byte offset in paragraph text.
+ * \return the byte offset in the processed text of the first kept byte at
+ *         or after pos, or the processed text length if there is none.
+ */
+static inline size_t paragraph_whitespace__map(
+		const paragraph_whitespace_t *ws,
+		size_t pos)
+{
+	const paragraph_whitespace_run_t *runs = ws->runs;
+	size_t lo = 0;
+	size_t hi = ws->run_count;
+	size_t kept;
+
+	/* The first run starts at zero. */
+	while (hi - lo > 1) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (runs[mid].pos <= pos) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+
+	kept = (lo + 1 < ws->run_count ? runs[lo + 1].out : ws->len) -
+			runs[lo].out;
+	pos -= runs[lo].pos;
+
+	return runs[lo].out + (pos < kept ? pos : kept);
+}
+
+#endif
@@ -0,0 +1,2392 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Public API tests.
+ *
+ * Usage: api [hyphen.hyf]
+ */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <paragraph.h>
+
+#include "para.h"
+#include "hyphen.h"
+#include "utf8.h"
+
+#define UNUSED(_v) ((void)(_v))
+
+/** Width of every byte of text, in the test's fixed width font. */
+#define TEST_CHAR_WIDTH 8
+
+/** Height of text, in the test's fixed width font. */
+#define TEST_LINE_HEIGHT 16
+
+/** Check a condition, and record a failure if it's false. */
+#define CHECK(_cond) \
+	test_check((_cond), #_cond, __func__, __LINE__)
+
+/** Styles.  Only their addresses matter. */
+static int style_container;
+static int style_a;
+static int style_b;
+static int style_c;
+static int style_pre;
+static int style_pre_wrap;
+static int style_nowrap;
+static int style_pre_line;
+static int style_break_spaces;
+static int style_cycle[8];
+
+/** Number of times the `measure_text` callback has been called. */
+static unsigned measure_calls;
+
+/** Number of times the `measure_text_batch` callback has been called. */
+static unsigned batch_calls;
+
+/** Number of pieces of text measured or laid out with a newline. */
+static unsigned newlines;
+
+/** Width added to every measurement, as if for kerning or side bearings,
+ *  so text measured in pieces is wider than when measured together. */
+static uint32_t measure_extra;
+
+/** Whether 'i' is narrow and 'W' is wide, rather than all characters
+ *  having the same width.  UTF-8 continuation bytes have no width. */
+static bool measure_proportional;
+
+/** If not NULL, a record of the scripts of the text measured. */
+static struct record *measure_scripts;
+
+/** Number of style references held by the library. */
+static unsigned style_refs;
+
+/** If not zero, the `style_ref` call, counting from one, that fails. */
+static unsigned style_ref_fail;
+
+/** Number of failed checks. */
+static unsigned failures;
+
+/**
+ * Record of the pieces given to the layout callbacks.
+ */
+struct record {
+	char buf[4096]; /**< Pieces, as text. */
+	size_t len;     /**< Byte length of buf. */
+	unsigned lines; /**< Number of lines laid out. */
+};
+
+/**
+ * Record a failed check.
+ *
+ * \param[in]  ok    Whether the check passed.
+ * \param[in]  cond  The condition checked.
+ * \param[in]  func  The function with the check.
+ * \param[in]  line  The line with the check.
+ */
+static void test_check(bool ok, const char *cond, const char *func, int line)
+{
+	if (!ok) {
+		fprintf(stderr, "%s:%d: check failed: %s\n", func, line, cond);
+		failures++;
+	}
+}
+
+/**
+ * Append to a layout record.
+ *
+ * \param[in]  rec  The record.
+ * \param[in]  fmt  Format string.
+ */
+static void record_append(struct record *rec, const char *fmt, ...)
+{
+	va_list ap;
+	int len;
+
+	va_start(ap, fmt);
+	len = vsnprintf(rec->buf + rec->len, sizeof(rec->buf) - rec->len,
+			fmt, ap);
+	va_end(ap);
+
+	if (len > 0) {
+		rec->len += (size_t)len;
+		if (rec->len >= sizeof(rec->buf)) {
+			rec->len = sizeof(rec->buf) - 1;
+		}
+	}
+}
+
+paragraph_err_t api_measure_text(
+		void *pw,
+		const paragraph_text_t *text,
+		const paragraph_style_t *style,
+		uint32_t *width_out,
+		uint32_t *height_out,
+		uint32_t *baseline_out)
+{
+	UNUSED(pw);
+	UNUSED(style);
+
+	measure_calls++;
+	if (memchr(text->data, '\n', text->len) != NULL) {
+		newlines++;
+	}
+
+	*width_out = text->len * TEST_CHAR_WIDTH + measure_extra;
+	if (measure_proportional) {
+		*width_out = measure_extra;
+		for (size_t i = 0; i < text->len; i++) {
+			char c = text->data[i];
+
+			*width_out += c == 'i' ? TEST_CHAR_WIDTH / 4 :
+					c == 'W' ? TEST_CHAR_WIDTH * 3 / 2 :
+					(c & 0xc0) == 0x80 ? 0 :
+					TEST_CHAR_WIDTH;
+		}
+	}
+	*height_out = TEST_LINE_HEIGHT;
+	*baseline_out = 12;
+
+	if (measure_scripts != NULL) {
+		record_append(measure_scripts, "[%c%c%c%c %.*s]",
+				(char)(text->script >> 24),
+				(char)(text->script >> 16),
+				(char)(text->script >> 8),
+				(char)(text->script),
+				(int)text->len, text->data);
+	}
+
+	return PARAGRAPH_OK;
+}
+
+paragraph_err_t api_measure_text_batch(
+		void *pw,
+		const paragraph_text_segment_t *segments,
+		paragraph_text_metrics_t *metrics_out,
+		size_t count)
+{
+	unsigned calls = measure_calls;
+
+	batch_calls++;
+	for (size_t i = 0; i < count; i++) {
+		api_measure_text(pw, &segments[i].text, segments[i].style,
+				&metrics_out[i].width,
+				&metrics_out[i].height,
+				&metrics_out[i].baseline);
+	}
+	measure_calls = calls;
+
+	return PARAGRAPH_OK;
+}
+
+paragraph_err_t api_text_get(
+		void *pw,
+		const paragraph_string_t *text,
+		const char **data_out,
+		size_t *len_out)
+{
+	UNUSED(pw);
+
+	*data_out = text;
+	*len_out = strlen(text);
+
+	return PARAGRAPH_OK;
+}
+
+paragraph_white_space_t api_white_space(
+		void *pw,
+		const paragraph_style_t *style)
+{
+	UNUSED(pw);
+
+	if (style == &style_pre) {
+		return PARAGRAPH_WHITE_SPACE_PRE;
+	} else if (style == &style_pre_wrap) {
+		return PARAGRAPH_WHITE_SPACE_PRE_WRAP;
+	} else if (style == &style_nowrap) {
+		return PARAGRAPH_WHITE_SPACE_NOWRAP;
+	} else if (style == &style_pre_line) {
+		return PARAGRAPH_WHITE_SPACE_PRE_LINE;
+	} else if (style == &style_break_spaces) {
+		return PARAGRAPH_WHITE_SPACE_BREAK_SPACES;
+	}
+
+	return PARAGRAPH_WHITE_SPACE_NORMAL;
+}
+
+bool api_same_font(
+		void *pw,
+		const paragraph_style_t *a,
+		const paragraph_style_t *b)
+{
+	UNUSED(pw);
+
+	/* Styles a and b differ only in colour. */
+	return (a == &style_a || a == &style_b) &&
+			(b == &style_a || b == &style_b);
+}
+
+static const paragraph_cb_text_t cb_text = {
+	.measure_text = api_measure_text,
+	.text_get     = api_text_get,
+	.white_space  = api_white_space,
+};
+
+static const paragraph_cb_text_t cb_batch = {
+	.measure_text       = api_measure_text,
+	.text_get           = api_text_get,
+	.white_space        = api_white_space,
+	.measure_text_batch = api_measure_text_batch,
+};
+
+paragraph_text_transform_t api_text_transform(
+		void *pw,
+		const paragraph_style_t *style)
+{
+	UNUSED(pw);
+
+	if (style == &style_a) {
+		return PARAGRAPH_TEXT_TRANSFORM_UPPERCASE;
+	} else if (style == &style_b) {
+		return PARAGRAPH_TEXT_TRANSFORM_LOWERCASE;
+	} else if (style == &style_c) {
+		return PARAGRAPH_TEXT_TRANSFORM_CAPITALIZE;
+	} else if (style == &style_cycle[0]) {
+		return PARAGRAPH_TEXT_TRANSFORM_FULL_WIDTH;
+	}
+
+	return PARAGRAPH_TEXT_TRANSFORM_NONE;
+}
+
+paragraph_hyphens_t api_hyphens(
+		void *pw,
+		const paragraph_style_t *style)
+{
+	UNUSED(pw);
+
+	if (style == &style_c) {
+		return PARAGRAPH_HYPHENS_AUTO;
+	}
+
+	return PARAGRAPH_HYPHENS_MANUAL;
+}
+
+static const paragraph_cb_text_t cb_hyphens = {
+	.measure_text = api_measure_text,
+	.text_get     = api_text_get,
+	.white_space  = api_white_space,
+	.hyphens      = api_hyphens,
+};
+
+static const paragraph_cb_text_t cb_transform = {
+	.measure_text   = api_measure_text,
+	.text_get       = api_text_get,
+	.white_space    = api_white_space,
+	.text_transform = api_text_transform,
+};
+
+static const paragraph_cb_text_t cb_same_font = {
+	.measure_text       = api_measure_text,
+	.text_get           = api_text_get,
+	.white_space        = api_white_space,
+	.same_font          = api_same_font,
+	.measure_text_batch = api_measure_text_batch,
+};
+
+paragraph_err_t api_style_ref(
+		void *pw,
+		paragraph_style_t *style)
+{
+	UNUSED(pw);
+	UNUSED(style);
+
+	if (style_ref_fail > 0 && --style_ref_fail == 0) {
+		return PARAGRAPH_ERR_OOM;
+	}
+
+	style_refs++;
+	return PARAGRAPH_OK;
+}
+
+void api_style_unref(
+		void *pw,
+		paragraph_style_t *style)
+{
+	UNUSED(pw);
+	UNUSED(style);
+
+	CHECK(style_refs > 0);
+	style_refs--;
+}
+
+static const paragraph_cb_text_t cb_style_ref = {
+	.measure_text = api_measure_text,
+	.text_get     = api_text_get,
+	.white_space  = api_white_space,
+	.style_ref    = api_style_ref,
+	.style_unref  = api_style_unref,
+};
+
+static paragraph_err_t api_layout_text(
+		void *pw,
+		void *handle,
+		const paragraph_style_t *style,
+		const paragraph_text_t *text,
+		const paragraph_position_t *pos)
+{
+	UNUSED(handle);
+
+	if (memchr(text->data, '\n', text->len) != NULL) {
+		newlines++;
+	}
+
+	record_append(pw, "[%u %s %.*s]", pos->x,
+			style == &style_a ? "a" :
+			style == &style_b ? "b" :
+			style == &style_c ? "c" : "-",
+			(int)text->len, text->data);
+
+	return PARAGRAPH_OK;
+}
+
+static paragraph_err_t api_layout_level(
+		void *pw,
+		void *handle,
+		const paragraph_style_t *style,
+		const paragraph_text_t *text,
+		const paragraph_position_t *pos)
+{
+	UNUSED(handle);
+	UNUSED(style);
+
+	record_append(pw, "[%u %u %.*s]", pos->x, text->level,
+			(int)text->len, text->data);
+
+	return PARAGRAPH_OK;
+}
+
+static paragraph_err_t api_layout_replaced(
+		void *pw,
+		void *handle,
+		const paragraph_style_t *style,
+		const paragraph_position_t *pos)
+{
+	UNUSED(handle);
+	UNUSED(style);
+
+	record_append(pw, "[%u replaced]", pos->x);
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Lay out a paragraph, recording the pieces in its record.
+ *
+ * \param[in]  para   The paragraph, created with its record as its pw.
+ * \param[in]  width  Available width.
+ * \param[out] rec    Returns the record of the pieces.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t test_layout(paragraph_para_t *para, uint32_t width,
+		struct record *rec)
+{
+	paragraph_err_t err;
+	uint32_t height;
+
+	rec->len = 0;
+	rec->buf[0] = '\0';
+	rec->lines = 0;
+
+	do {
+		err = paragraph_layout_line(para, width,
+				api_layout_text,
+				api_layout_replaced,
+				&height);
+		if (err != PARAGRAPH_OK && err != PARAGRAPH_END_OF_LINE) {
+			return err;
+		}
+		record_append(rec, " %u\n", height);
+		rec->lines++;
+	} while (err == PARAGRAPH_END_OF_LINE);
+
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Add a piece of text to the end of a paragraph.
+ *
+ * \param[in]  para  The paragraph.
+ * \param[in]  text  The text, which must stay valid.
+ * \return The new content's identifier, or \ref PARAGRAPH_CONTENT_ID_NONE.
+ */
+static paragraph_content_id_t test_add_text(
+		paragraph_para_t *para,
+		const char *text)
+{
+	paragraph_content_id_t id;
+
+	if (paragraph_content_add(para,
+			&(paragraph_content_params_t) {
+				.type = PARAGRAPH_CONTENT_TEXT,
+				.text = {
+					.string = text,
+				},
+			}, NULL, &id) != PARAGRAPH_OK) {
+		return PARAGRAPH_CONTENT_ID_NONE;
+	}
+
+	return id;
+}
+
+/**
+ * Add an inline start or end to the end of a paragraph.
+ *
+ * \param[in]  para   The paragraph.
+ * \param[in]  style  The inline's style, or NULL for an inline end.
+ * \return The new content's identifier, or \ref PARAGRAPH_CONTENT_ID_NONE.
+ */
+static paragraph_content_id_t test_add_inline(
+		paragraph_para_t *para,
+		paragraph_style_t *style)
+{
+	paragraph_content_id_t id;
+
+	if (paragraph_content_add(para,
+			&(paragraph_content_params_t) {
+				.type = style != NULL ?
+						PARAGRAPH_CONTENT_INLINE_START :
+						PARAGRAPH_CONTENT_INLINE_END,
+				.inline_start = {
+					.style = style,
+				},
+			}, NULL, &id) != PARAGRAPH_OK) {
+		return PARAGRAPH_CONTENT_ID_NONE;
+	}
+
+	return id;
+}
+
+/**
+ * Add replaced content to the end of a paragraph.
+ *
+ * \param[in]  para   The paragraph.
+ * \param[in]  width  The content's width.
+ * \return The new content's identifier, or \ref PARAGRAPH_CONTENT_ID_NONE.
+ */
+static paragraph_content_id_t test_add_replaced(
+		paragraph_para_t *para,
+		uint32_t width)
+{
+	paragraph_content_id_t id;
+
+	if (paragraph_content_add(para,
+			&(paragraph_content_params_t) {
+				.type = PARAGRAPH_CONTENT_REPLACED,
+				.replaced = {
+					.style = &style_container,
+					.px_width = width,
+					.px_height = TEST_LINE_HEIGHT,
+				},
+			}, NULL, &id) != PARAGRAPH_OK) {
+		return PARAGRAPH_CONTENT_ID_NONE;
+	}
+
+	return id;
+}
+
+/**
+ * Check importing content from one buffer, against adding it entry by
+ * entry.
+ */
+static void test_add_spans(paragraph_ctx_t *ctx)
+{
+	static const char text[] = "The quick brown fox";
+	paragraph_content_span_t spans[] = {
+		{ .type = PARAGRAPH_CONTENT_TEXT, .offset = 0, .len = 4 },
+		{ .type = PARAGRAPH_CONTENT_INLINE_START, .style = &style_a },
+		{ .type = PARAGRAPH_CONTENT_TEXT, .offset = 4, .len = 5,
+				.style = &style_a },
+		{ .type = PARAGRAPH_CONTENT_INLINE_END },
+		{ .type = PARAGRAPH_CONTENT_TEXT, .offset = 9, .len = 10 },
+	};
+	size_t count = sizeof(spans) / sizeof(spans[0]);
+	paragraph_content_id_t ids[sizeof(spans) / sizeof(spans[0])];
+	struct record rec, rec_fresh;
+	paragraph_para_t *para, *fresh, *clone;
+	paragraph_content_span_t bad;
+	char before[sizeof(rec.buf)];
+	paragraph_content_id_t id;
+	uint32_t entries;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_content_add_spans(para, text, sizeof(text) - 1,
+			spans, count, ids) == PARAGRAPH_OK);
+
+	CHECK(paragraph_create(&rec_fresh, ctx, &fresh, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(fresh, "The ");
+	test_add_inline(fresh, &style_a);
+	id = test_add_text(fresh, "quick");
+	CHECK(paragraph_content_set_style(fresh, id, &style_a) ==
+			PARAGRAPH_OK);
+	test_add_inline(fresh, NULL);
+	test_add_text(fresh, " brown fox");
+
+	for (uint32_t width = 1000; width >= 40; width /= 5) {
+		CHECK(test_layout(para, width, &rec) == PARAGRAPH_OK);
+		CHECK(test_layout(fresh, width, &rec_fresh) == PARAGRAPH_OK);
+		CHECK(strcmp(rec.buf, rec_fresh.buf) == 0);
+	}
+	CHECK(strstr(rec.buf, "a quick") != NULL);
+
+	/* The identifiers returned work. */
+	CHECK(paragraph_content_set_style(para, ids[2], &style_b) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strstr(rec.buf, "b quick") != NULL);
+	memcpy(before, rec.buf, rec.len + 1);
+	entries = para->content.count;
+
+	/* Invalid spans are rejected, and nothing is added. */
+	bad = (paragraph_content_span_t) {
+		.type = PARAGRAPH_CONTENT_TEXT,
+		.offset = 15,
+		.len = 5,
+	};
+	spans[4] = bad;
+	CHECK(paragraph_content_add_spans(para, text, sizeof(text) - 1,
+			spans, count, NULL) == PARAGRAPH_ERR_BAD_PARAM);
+	bad.offset = sizeof(text);
+	bad.len = 0;
+	spans[4] = bad;
+	CHECK(paragraph_content_add_spans(para, text, sizeof(text) - 1,
+			spans, count, NULL) == PARAGRAPH_ERR_BAD_PARAM);
+	spans[4] = (paragraph_content_span_t) {
+		.type = PARAGRAPH_CONTENT_INLINE_START,
+	};
+	CHECK(paragraph_content_add_spans(para, text, sizeof(text) - 1,
+			spans, count, NULL) == PARAGRAPH_ERR_BAD_PARAM);
+	spans[4] = (paragraph_content_span_t) {
+		.type = PARAGRAPH_CONTENT_NONE,
+	};
+	CHECK(paragraph_content_add_spans(para, text, sizeof(text) - 1,
+			spans, count, NULL) == PARAGRAPH_ERR_BAD_TYPE);
+	CHECK(para->content.count == entries);
+	CHECK(!para->content.dirty.dirty);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, before) == 0);
+
+	/* Adding no spans changes nothing, and doesn't unshare a clone. */
+	CHECK(paragraph_clone(&rec_fresh, para, &clone) == PARAGRAPH_OK);
+	CHECK(paragraph_content_add_spans(para, text, sizeof(text) - 1,
+			spans, 0, NULL) == PARAGRAPH_OK);
+	CHECK(!para->content.dirty.dirty);
+	CHECK(para->content.block == clone->content.block);
+	clone = paragraph_destroy(clone);
+
+	/* Text spans with no style take the current style, and others
+	 * keep theirs. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	spans[0].style = &style_b;
+	spans[2].style = NULL;
+	spans[4] = (paragraph_content_span_t) {
+		.type = PARAGRAPH_CONTENT_TEXT,
+		.offset = 9,
+		.len = 10,
+		.style = &style_c,
+	};
+	CHECK(paragraph_content_add_spans(para, text, sizeof(text) - 1,
+			spans, count, NULL) == PARAGRAPH_OK);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 b The ][32 - quick][72 c  brown fox] 16\n")
+			== 0);
+
+	fresh = paragraph_destroy(fresh);
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Check that styles are referenced while they're used, and that a failed
+ * reference leaves a paragraph's styles as they were.
+ */
+static void test_style_ref(const paragraph_config_t *config)
+{
+	static const char text[] = "one two three four";
+	static const paragraph_content_span_t spans[] = {
+		{ .type = PARAGRAPH_CONTENT_TEXT, .offset = 0, .len = 4,
+				.style = &style_a },
+		{ .type = PARAGRAPH_CONTENT_TEXT, .offset = 4, .len = 4,
+				.style = &style_b },
+		{ .type = PARAGRAPH_CONTENT_TEXT, .offset = 8, .len = 6,
+				.style = &style_c },
+		{ .type = PARAGRAPH_CONTENT_TEXT, .offset = 14, .len = 4 },
+	};
+	size_t count = sizeof(spans) / sizeof(spans[0]);
+	paragraph_para_t *para, *clone;
+	char before[sizeof(((struct record *)NULL)->buf)];
+	size_t styles, entries;
+	paragraph_ctx_t *ctx;
+	struct record rec;
+	unsigned refs;
+
+	CHECK(paragraph_ctx_create(NULL, &ctx, config, &cb_style_ref) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	CHECK(style_refs == 1);
+
+	test_add_text(para, "zero ");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	memcpy(before, rec.buf, rec.len + 1);
+	styles = para->content.style_count;
+	entries = para->content.count;
+	refs = style_refs;
+
+	/* The spans add three styles to the table.  Failing any of their
+	 * references releases the ones taken before it, newest first, and
+	 * adds nothing. */
+	for (unsigned fail = 1; fail <= 3; fail++) {
+		style_ref_fail = fail;
+		CHECK(paragraph_content_add_spans(para, text, sizeof(text) - 1,
+				spans, count, NULL) == PARAGRAPH_ERR_OOM);
+		CHECK(style_refs == refs);
+		CHECK(para->content.style_count == styles);
+		CHECK(para->content.count == entries);
+		CHECK(!para->content.dirty.dirty);
+		CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+		CHECK(strcmp(rec.buf, before) == 0);
+	}
+
+	style_ref_fail = 4;
+	CHECK(paragraph_content_add_spans(para, text, sizeof(text) - 1,
+			spans, count, NULL) == PARAGRAPH_OK);
+	CHECK(style_refs == refs + 3);
+	style_ref_fail = 0;
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - zero ][40 a one ][72 b two ]"
+			"[104 c three ][152 - four] 16\n") == 0);
+
+	/* A clone references the styles it uses, and a failed clone holds
+	 * none. */
+	refs = style_refs;
+	for (unsigned fail = 1; fail <= 5; fail++) {
+		style_ref_fail = fail;
+		CHECK(paragraph_clone(NULL, para, &clone) ==
+				PARAGRAPH_ERR_OOM);
+		CHECK(style_refs == refs);
+	}
+	style_ref_fail = 0;
+	CHECK(paragraph_clone(NULL, para, &clone) == PARAGRAPH_OK);
+	CHECK(style_refs == refs * 2);
+	clone = paragraph_destroy(clone);
+	CHECK(style_refs == refs);
+
+	para = paragraph_destroy(para);
+	CHECK(style_refs == 0);
+	ctx = paragraph_ctx_destroy(ctx);
+}
+
+/**
+ * Check that floats take no room, and are skipped by the layout callbacks.
+ */
+static void test_float(paragraph_ctx_t *ctx)
+{
+	struct record rec, rec_fresh;
+	paragraph_para_t *para, *fresh;
+	paragraph_content_id_t id;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(para, "one tw");
+	CHECK(paragraph_content_add(para,
+			&(paragraph_content_params_t) {
+				.type = PARAGRAPH_CONTENT_FLOAT,
+				.floated = {
+					.style = &style_c,
+				},
+			}, NULL, &id) == PARAGRAPH_OK);
+	test_add_text(para, "o three");
+	CHECK(test_layout(para, 8 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+
+	CHECK(paragraph_create(&rec_fresh, ctx, &fresh, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(fresh, "one tw");
+	test_add_text(fresh, "o three");
+	CHECK(test_layout(fresh, 8 * TEST_CHAR_WIDTH, &rec_fresh) ==
+			PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, rec_fresh.buf) == 0);
+	CHECK(strcmp(rec.buf, "[0 - one tw][48 - o ] 16\n[0 - three] 16\n") ==
+			0);
+
+	fresh = paragraph_destroy(fresh);
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Check hit testing and selection rectangles.
+ */
+static void test_hit(paragraph_ctx_t *ctx)
+{
+	static const char text[] = "hello world";
+	paragraph_content_offset_t start, end, hit;
+	paragraph_rect_t rects[4];
+	paragraph_content_id_t id;
+	paragraph_para_t *para;
+	struct record rec;
+	size_t count;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	id = test_add_text(para, text);
+	CHECK(id != PARAGRAPH_CONTENT_ID_NONE);
+
+	/* Not laid out yet. */
+	CHECK(paragraph_hit_test(para, 0, 0, &hit) != PARAGRAPH_OK);
+
+	/* "hello" and "world" on lines of their own. */
+	CHECK(test_layout(para, 6 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(rec.lines == 2);
+
+	CHECK(paragraph_hit_test(para, 2 * TEST_CHAR_WIDTH + 1, 1, &hit) ==
+			PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 2);
+
+	CHECK(paragraph_hit_test(para, 1 * TEST_CHAR_WIDTH + 1,
+			TEST_LINE_HEIGHT + 1, &hit) == PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 7);
+
+	/* Past the end of a line finds the line's end. */
+	CHECK(paragraph_hit_test(para, 1000, 1, &hit) == PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 6);
+
+	/* Below the last line finds the last line. */
+	CHECK(paragraph_hit_test(para, 0, 10 * TEST_LINE_HEIGHT, &hit) ==
+			PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 6);
+
+	/* "llo wo" is on both lines. */
+	start = (paragraph_content_offset_t) { .id = id, .offset = 2 };
+	end = (paragraph_content_offset_t) { .id = id, .offset = 8 };
+	CHECK(paragraph_selection_rects(para, &start, &end,
+			rects, sizeof(rects) / sizeof(rects[0]), &count) ==
+			PARAGRAPH_OK);
+	CHECK(count == 2);
+	CHECK(rects[0].x == 2 * TEST_CHAR_WIDTH && rects[0].y == 0 &&
+			rects[0].height == TEST_LINE_HEIGHT);
+	CHECK(rects[1].x == 0 && rects[1].y == TEST_LINE_HEIGHT &&
+			rects[1].width == 2 * TEST_CHAR_WIDTH);
+
+	/* The count is given without an array. */
+	CHECK(paragraph_selection_rects(para, &start, &end,
+			NULL, 0, &count) == PARAGRAPH_OK);
+	CHECK(count == 2);
+
+	/* "or" is on the second line only. */
+	start.offset = 7;
+	end.offset = 9;
+	CHECK(paragraph_selection_rects(para, &start, &end,
+			rects, sizeof(rects) / sizeof(rects[0]), &count) ==
+			PARAGRAPH_OK);
+	CHECK(count == 1);
+	CHECK(rects[0].x == 1 * TEST_CHAR_WIDTH &&
+			rects[0].y == TEST_LINE_HEIGHT &&
+			rects[0].width == 2 * TEST_CHAR_WIDTH &&
+			rects[0].height == TEST_LINE_HEIGHT);
+
+	/* Changing the content invalidates the layout. */
+	CHECK(test_add_text(para, "!") != PARAGRAPH_CONTENT_ID_NONE);
+	CHECK(paragraph_hit_test(para, 0, 0, &hit) != PARAGRAPH_OK);
+	CHECK(paragraph_selection_rects(para, &start, &end,
+			NULL, 0, &count) != PARAGRAPH_OK);
+
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Check hit testing lines ended by preserved newlines, and a line reordered
+ * for right-to-left text.
+ */
+static void test_hit_lines(paragraph_ctx_t *ctx)
+{
+	/* "ab ", then two Hebrew words, then " cd". */
+	static const char rtl[] = "ab \xd7\x90\xd7\x91 \xd7\x92\xd7\x93 cd";
+	paragraph_content_offset_t hit;
+	paragraph_content_id_t id;
+	paragraph_para_t *para;
+	struct record rec;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	id = test_add_text(para, "ab\n\ncd");
+	CHECK(paragraph_content_set_style(para, id, &style_pre) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(rec.lines == 3);
+
+	/* Past the end of a line is before its newline. */
+	CHECK(paragraph_hit_test(para, 10 * TEST_CHAR_WIDTH, 0, &hit) ==
+			PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 2);
+
+	/* Anywhere on the empty line is its start. */
+	CHECK(paragraph_hit_test(para, 0, TEST_LINE_HEIGHT, &hit) ==
+			PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 3);
+	CHECK(paragraph_hit_test(para, 10 * TEST_CHAR_WIDTH,
+			TEST_LINE_HEIGHT, &hit) == PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 3);
+
+	CHECK(paragraph_hit_test(para, 10 * TEST_CHAR_WIDTH,
+			2 * TEST_LINE_HEIGHT, &hit) == PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 6);
+
+	/* The Hebrew words are shown right to left, from x = 24 to 96, so
+	 * their first character is at the right. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	id = test_add_text(para, rtl);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(para->layout.prev.lines[0].reordered);
+
+	CHECK(paragraph_hit_test(para, 90, 0, &hit) == PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 3);
+	CHECK(paragraph_hit_test(para, 44, 0, &hit) == PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 10);
+	CHECK(paragraph_hit_test(para, 4, 0, &hit) == PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 1);
+	CHECK(paragraph_hit_test(para, 108, 0, &hit) == PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 14);
+
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Check finding grapheme cluster and word boundaries.
+ */
+static void test_boundary(paragraph_ctx_t *ctx)
+{
+	static const char text[] = "one two";
+	paragraph_content_offset_t from, found;
+	paragraph_content_id_t id;
+	paragraph_para_t *para;
+	struct record rec;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	id = test_add_text(para, text);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+
+	from = (paragraph_content_offset_t) { .id = id, .offset = 1 };
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_WORD, true, &found) == PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == 3);
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_WORD, false, &found) ==
+			PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == 0);
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_GRAPHEME, true, &found) ==
+			PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == 2);
+
+	/* The end of the text is a boundary. */
+	from.offset = sizeof(text) - 1;
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_WORD, true, &found) == PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == sizeof(text) - 1);
+
+	/* A letter with a combining mark, and an emoji with a skin tone
+	 * modifier, are single grapheme clusters, and a word can contain an
+	 * apostrophe. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	id = test_add_text(para, "e\xcc\x81\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd "
+			"can't");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+
+	from = (paragraph_content_offset_t) { .id = id, .offset = 0 };
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_GRAPHEME, true, &found) ==
+			PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == 3);
+	from.offset = 3;
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_GRAPHEME, true, &found) ==
+			PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == 11);
+	from.offset = 13;
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_WORD, true, &found) == PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == 17);
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_WORD, false, &found) ==
+			PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == 12);
+
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Check that a clone lays out like its source, and that changing either
+ * doesn't change the other.
+ */
+static void test_clone(paragraph_ctx_t *ctx)
+{
+	struct record rec, rec_clone;
+	paragraph_para_t *para, *clone;
+	paragraph_content_id_t id;
+	char before[sizeof(rec.buf)];
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(para, "The ");
+	test_add_inline(para, &style_a);
+	id = test_add_text(para, "quick");
+	test_add_inline(para, NULL);
+	test_add_text(para, " brown fox");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	memcpy(before, rec.buf, rec.len + 1);
+
+	/* The clone shares the content until one of them changes it. */
+	CHECK(paragraph_clone(&rec_clone, para, &clone) == PARAGRAPH_OK);
+	CHECK(clone->content.block == para->content.block &&
+			para->content.block->refs == 2);
+	CHECK(test_layout(clone, 1000, &rec_clone) == PARAGRAPH_OK);
+	CHECK(strcmp(rec_clone.buf, before) == 0);
+
+	/* Source content identifiers work in the clone. */
+	CHECK(paragraph_content_set_style(clone, id, &style_b) ==
+			PARAGRAPH_OK);
+	CHECK(clone->content.block != para->content.block &&
+			para->content.block->refs == 1 &&
+			clone->content.block->refs == 1);
+	CHECK(test_layout(clone, 1000, &rec_clone) == PARAGRAPH_OK);
+	CHECK(strstr(rec_clone.buf, "b quick") != NULL);
+
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, before) == 0);
+
+	/* Removing from the source leaves the clone's content. */
+	CHECK(paragraph_content_remove(para, id) == PARAGRAPH_OK);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strstr(rec.buf, "quick") == NULL);
+	CHECK(test_layout(clone, 1000, &rec_clone) == PARAGRAPH_OK);
+	CHECK(strstr(rec_clone.buf, "b quick") != NULL);
+
+	clone = paragraph_destroy(clone);
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Check where the pieces of a word that crosses content entries are put,
+ * and what measuring them costs.
+ */
+static void test_joined(const paragraph_config_t *config)
+{
+	paragraph_config_t uncached = *config;
+	struct record rec;
+	paragraph_para_t *para;
+	paragraph_ctx_t *ctx;
+
+	uncached.measure_cache_size = 0;
+	measure_proportional = true;
+
+	/* Measured in batches, each piece starts where the text before it
+	 * ends. */
+	CHECK(paragraph_ctx_create(NULL, &ctx, &uncached, &cb_batch) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(para, "iiii");
+	test_add_text(para, "WWWW end");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - iiii][8 - WWWW end] 16\n") == 0);
+
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	test_add_text(para, "\xc3\xa9\xc3\xa9");
+	test_add_text(para, "ab");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - \xc3\xa9\xc3\xa9][16 - ab] 16\n") == 0);
+
+	/* Apart from the container style's strut, everything is measured in
+	 * one call. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	test_add_text(para, "ab");
+	test_add_text(para, "cd");
+	test_add_text(para, "ef");
+	test_add_text(para, "gh xyz");
+	measure_calls = 0;
+	batch_calls = 0;
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(measure_calls == 1 && batch_calls == 1);
+	para = paragraph_destroy(para);
+	ctx = paragraph_ctx_destroy(ctx);
+
+	/* Measured one piece of text at a time, the word is one call, and
+	 * its width is shared by the pieces' numbers of characters. */
+	CHECK(paragraph_ctx_create(NULL, &ctx, &uncached, &cb_text) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(para, "ab");
+	test_add_text(para, "cd");
+	test_add_text(para, "ef");
+	test_add_text(para, "gh xyz");
+	measure_calls = 0;
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	/* The strut, "abcdefgh", a space, and "xyz". */
+	CHECK(measure_calls == 4);
+	CHECK(strcmp(rec.buf, "[0 - ab][16 - cd][32 - ef][48 - gh xyz] 16\n")
+			== 0);
+
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	test_add_text(para, "iiii");
+	test_add_text(para, "WWWW end");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - iiii][28 - WWWW end] 16\n") == 0);
+
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	test_add_text(para, "\xc3\xa9\xc3\xa9");
+	test_add_text(para, "ab");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - \xc3\xa9\xc3\xa9][16 - ab] 16\n") == 0);
+	para = paragraph_destroy(para);
+	ctx = paragraph_ctx_destroy(ctx);
+
+	/* Styles that measure the same are measured together, so the word
+	 * gets the extra width once. */
+	measure_proportional = false;
+	measure_extra = 1;
+	CHECK(paragraph_ctx_create(NULL, &ctx, &uncached, &cb_same_font) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_content_set_style(para, test_add_text(para, "on"),
+			&style_a) == PARAGRAPH_OK);
+	CHECK(paragraph_content_set_style(para, test_add_text(para, "e"),
+			&style_b) == PARAGRAPH_OK);
+	test_add_text(para, " two");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 a on][17 b e][25 -  two] 16\n") == 0);
+	para = paragraph_destroy(para);
+	ctx = paragraph_ctx_destroy(ctx);
+
+	/* Without the callback, only the same style is measured together. */
+	CHECK(paragraph_ctx_create(NULL, &ctx, &uncached, &cb_batch) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_content_set_style(para, test_add_text(para, "on"),
+			&style_a) == PARAGRAPH_OK);
+	CHECK(paragraph_content_set_style(para, test_add_text(para, "e"),
+			&style_b) == PARAGRAPH_OK);
+	test_add_text(para, " two");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 a on][17 b e][26 -  two] 16\n") == 0);
+	para = paragraph_destroy(para);
+	ctx = paragraph_ctx_destroy(ctx);
+
+	measure_extra = 0;
+}
+
+/**
+ * Add the text used by the clone sharing test to a paragraph.
+ *
+ * \param[in]  para   The paragraph to add to.
+ * \param[in]  style  Style of the inline in the middle of the text.
+ * \return the content identifier of the text in the inline.
+ */
+static paragraph_content_id_t test_add_fox(
+		paragraph_para_t *para,
+		paragraph_style_t *style)
+{
+	paragraph_content_id_t id;
+
+	test_add_text(para, "The ");
+	test_add_inline(para, style);
+	id = test_add_text(para, "quick");
+	test_add_inline(para, NULL);
+	test_add_text(para, " brown fox jumps over the lazy dog");
+
+	return id;
+}
+
+/**
+ * Check that clones share analysis and measurements until they are edited.
+ *
+ * Uses a context without a measurement cache, so that only the shared
+ * measurements can avoid calls to the client.
+ */
+static void test_clone_share(const paragraph_config_t *config)
+{
+	paragraph_config_t uncached = *config;
+	struct record rec, rec_clone, rec_fresh;
+	paragraph_para_t *para, *clone, *fresh;
+	paragraph_content_id_t id;
+	paragraph_ctx_t *ctx;
+	char narrow[sizeof(rec.buf)];
+
+	uncached.measure_cache_size = 0;
+	CHECK(paragraph_ctx_create(NULL, &ctx, &uncached, &cb_text) ==
+			PARAGRAPH_OK);
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	id = test_add_fox(para, &style_a);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+
+	CHECK(paragraph_clone(&rec_clone, para, &clone) == PARAGRAPH_OK);
+	CHECK(para->share != NULL && para->share == clone->share);
+	CHECK(para->share != NULL && para->share->refs == 2);
+
+	/* Laying out the clone at any width measures nothing. */
+	measure_calls = 0;
+	CHECK(test_layout(clone, 80, &rec_clone) == PARAGRAPH_OK);
+	CHECK(measure_calls == 0);
+	CHECK(rec_clone.lines > 1);
+	CHECK(test_layout(para, 80, &rec) == PARAGRAPH_OK);
+	CHECK(measure_calls == 0);
+	CHECK(strcmp(rec.buf, rec_clone.buf) == 0);
+	memcpy(narrow, rec.buf, rec.len + 1);
+
+	/* Editing the clone gives it its own copy, and leaves the source. */
+	CHECK(paragraph_content_set_style(clone, id, &style_b) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(clone, 80, &rec_clone) == PARAGRAPH_OK);
+	CHECK(clone->share == NULL);
+
+	CHECK(paragraph_create(&rec_fresh, ctx, &fresh, &style_container) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_content_set_style(fresh, test_add_fox(fresh, &style_a),
+			&style_b) == PARAGRAPH_OK);
+	CHECK(test_layout(fresh, 80, &rec_fresh) == PARAGRAPH_OK);
+	CHECK(strcmp(rec_clone.buf, rec_fresh.buf) == 0);
+	fresh = paragraph_destroy(fresh);
+
+	measure_calls = 0;
+	CHECK(test_layout(para, 80, &rec) == PARAGRAPH_OK);
+	CHECK(measure_calls == 0);
+	CHECK(strcmp(rec.buf, narrow) == 0);
+
+	/* Editing the source, once the clone has its own copy. */
+	test_add_text(para, " again");
+	CHECK(test_layout(para, 80, &rec) == PARAGRAPH_OK);
+	CHECK(para->share == NULL);
+
+	CHECK(paragraph_create(&rec_fresh, ctx, &fresh, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_fox(fresh, &style_a);
+	test_add_text(fresh, " again");
+	CHECK(test_layout(fresh, 80, &rec_fresh) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, rec_fresh.buf) == 0);
+	fresh = paragraph_destroy(fresh);
+	clone = paragraph_destroy(clone);
+
+	/* A clone outlives the source it shares with. */
+	CHECK(paragraph_clone(&rec_clone, para, &clone) == PARAGRAPH_OK);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	para = paragraph_destroy(para);
+	measure_calls = 0;
+	CHECK(test_layout(clone, 1000, &rec_clone) == PARAGRAPH_OK);
+	CHECK(measure_calls == 0);
+	CHECK(strcmp(rec.buf, rec_clone.buf) == 0);
+	clone = paragraph_destroy(clone);
+
+	ctx = paragraph_ctx_destroy(ctx);
+}
+
+/**
+ * Check removing an inline with its content.
+ */
+static void test_remove_inline(paragraph_ctx_t *ctx)
+{
+	paragraph_content_id_t outer, text, inner;
+	struct record rec, rec_fresh;
+	paragraph_para_t *para, *fresh;
+	size_t slots;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(para, "one ");
+	outer = test_add_inline(para, &style_a);
+	test_add_text(para, "two ");
+	inner = test_add_inline(para, &style_b);
+	test_add_text(para, "three ");
+	test_add_inline(para, NULL);
+	test_add_inline(para, NULL);
+	text = test_add_text(para, "four");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+
+	/* Only inline starts can be removed with their content. */
+	CHECK(paragraph_content_remove_inline(para, text) ==
+			PARAGRAPH_ERR_BAD_TYPE);
+
+	CHECK(paragraph_content_remove_inline(para, outer) == PARAGRAPH_OK);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+
+	/* Layout compacts the removed entries away. */
+	CHECK(para->content.count == 2 && para->content.removed == 0);
+
+	/* The inline's content has gone, and its identifiers are stale. */
+	CHECK(paragraph_content_set_style(para, inner, &style_c) ==
+			PARAGRAPH_ERR_BAD_PARAM);
+	CHECK(paragraph_content_remove_inline(para, outer) ==
+			PARAGRAPH_ERR_BAD_PARAM);
+
+	CHECK(paragraph_create(&rec_fresh, ctx, &fresh, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(fresh, "one ");
+	test_add_text(fresh, "four");
+	CHECK(test_layout(fresh, 1000, &rec_fresh) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, rec_fresh.buf) == 0);
+
+	/* New content reuses the removed content's handle slots. */
+	slots = para->content.slot_count;
+	for (unsigned i = 0; i < 6; i++) {
+		CHECK(test_add_text(para, "five") != PARAGRAPH_CONTENT_ID_NONE);
+	}
+	CHECK(para->content.slot_count == slots);
+
+	fresh = paragraph_destroy(fresh);
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Check that paragraph text offsets map to the expected content entries.
+ *
+ * \param[in]  para   The paragraph.
+ * \param[in]  ids    The paragraph's content, in order.
+ * \param[in]  texts  The text of each entry in ids, or "" for none.
+ * \param[in]  count  Number of entries in ids.
+ */
+static void test_offsets_check(
+		paragraph_para_t *para,
+		const paragraph_content_id_t *ids,
+		const char *const *texts,
+		size_t count)
+{
+	paragraph_content_t *content = &para->content;
+	uint32_t index, found;
+	size_t offset;
+	size_t pos = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		size_t len = strlen(texts[i]);
+
+		CHECK(paragraph_content__index(content, ids[i], &index) ==
+				PARAGRAPH_OK);
+		CHECK(paragraph_content__offset(content, index) == pos);
+
+		for (size_t k = 0; k < len; k++) {
+			CHECK(paragraph_content__entry_at(content, pos + k,
+					&found, &offset) == PARAGRAPH_OK);
+			CHECK(found == index && offset == k);
+		}
+		pos += len;
+	}
+
+	/* The end of the text is in the last entry. */
+	CHECK(content->len == pos);
+	CHECK(paragraph_content__entry_at(content, pos,
+			&found, &offset) == PARAGRAPH_OK);
+	CHECK(found == content->count - 1 &&
+			offset == content->text_len[found]);
+	CHECK(paragraph_content__entry_at(content, pos + 1,
+			&found, &offset) == PARAGRAPH_ERR_BAD_PARAM);
+}
+
+/**
+ * Check mapping paragraph text offsets to content entries as content is
+ * added, removed and reordered.
+ */
+static void test_offsets(paragraph_ctx_t *ctx)
+{
+	static const char *const words[] = {
+		"a", "bb", "ccc", "dddd", "eeeee",
+	};
+	paragraph_content_id_t ids[64];
+	const char *texts[64];
+	struct record rec;
+	paragraph_para_t *para;
+	size_t count = 0;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+
+	/* Enough entries for the arrays to grow, with some empty ones. */
+	for (size_t i = 0; i < 40; i++) {
+		if (i % 8 == 3) {
+			ids[count] = test_add_inline(para, &style_a);
+			texts[count++] = "";
+		} else if (i % 8 == 6) {
+			ids[count] = test_add_inline(para, NULL);
+			texts[count++] = "";
+		} else {
+			ids[count] = test_add_text(para, words[i % 5]);
+			texts[count++] = words[i % 5];
+		}
+	}
+	test_offsets_check(para, ids, texts, count);
+
+	/* Removed entries are left as tombstones until layout. */
+	for (size_t i = count; i-- > 0; ) {
+		if (i % 3 == 1) {
+			CHECK(paragraph_content_remove(para, ids[i]) ==
+					PARAGRAPH_OK);
+			memmove(ids + i, ids + i + 1,
+					(count - i - 1) * sizeof(*ids));
+			memmove(texts + i, texts + i + 1,
+					(count - i - 1) * sizeof(*texts));
+			count--;
+		}
+	}
+	CHECK(para->content.removed > 0);
+	test_offsets_check(para, ids, texts, count);
+
+	/* Reorder by moving entries from the end to before earlier ones. */
+	for (size_t i = 0; i < 6; i++) {
+		size_t to = i * 4;
+		const char *text = texts[count - 1];
+
+		CHECK(paragraph_content_remove(para, ids[count - 1]) ==
+				PARAGRAPH_OK);
+		memmove(ids + to + 1, ids + to,
+				(count - 1 - to) * sizeof(*ids));
+		memmove(texts + to + 1, texts + to,
+				(count - 1 - to) * sizeof(*texts));
+		CHECK(paragraph_content_add(para,
+				&(paragraph_content_params_t) {
+					.type = PARAGRAPH_CONTENT_TEXT,
+					.text = {
+						.string = text,
+					},
+				},
+				&(paragraph_content_position_t) {
+					.rel = ids[to + 1],
+					.pos = PARAGRAPH_CONTENT_POS_BEFORE,
+				}, &ids[to]) == PARAGRAPH_OK);
+		texts[to] = text;
+		test_offsets_check(para, ids, texts, count);
+	}
+
+	/* Layout compacts the tombstones away. */
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(para->content.removed == 0 && para->content.count == count);
+	test_offsets_check(para, ids, texts, count);
+
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Check that unchanged content isn't measured again, and that a changed
+ * paragraph lays out like one built with its content from scratch.
+ */
+static void test_edit(paragraph_ctx_t *ctx)
+{
+	paragraph_measure_stats_t before, after;
+	paragraph_content_id_t first, second;
+	struct record rec, rec_fresh;
+	paragraph_para_t *para, *fresh;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	first = test_add_text(para, "alpha beta ");
+	test_add_inline(para, &style_a);
+	second = test_add_text(para, "gamma delta ");
+	test_add_inline(para, NULL);
+	test_add_text(para, "epsilon");
+	CHECK(test_layout(para, 12 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(rec.lines == 3);
+
+	/* Laying out again, at either width, doesn't measure anything. */
+	measure_calls = 0;
+	CHECK(test_layout(para, 12 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(rec.lines == 1);
+	CHECK(measure_calls == 0);
+
+	/* Changes are tracked as a range of entries, which layout
+	 * clears. */
+	CHECK(!para->content.dirty.dirty);
+	CHECK(paragraph_content_set_style(para, second, &style_b) ==
+			PARAGRAPH_OK);
+	CHECK(para->content.dirty.dirty &&
+			para->content.dirty.start == 2 &&
+			para->content.dirty.end == 3);
+	CHECK(paragraph_ctx_get_measure_stats(ctx, &before) == PARAGRAPH_OK);
+	CHECK(test_layout(para, 12 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(!para->content.dirty.dirty);
+
+	/* Only the changed entry's two words, and a space in its new style,
+	 * are measured again, whether or not the cache has them.  The other
+	 * pieces keep their measurements. */
+	CHECK(paragraph_ctx_get_measure_stats(ctx, &after) == PARAGRAPH_OK);
+	CHECK(after.hits + after.misses == before.hits + before.misses + 3);
+
+	/* Removing an entry changes only its range. */
+	CHECK(paragraph_content_remove(para, first) == PARAGRAPH_OK);
+	CHECK(para->content.dirty.dirty &&
+			para->content.dirty.start == 0 &&
+			para->content.dirty.end == 1);
+	CHECK(test_layout(para, 12 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+
+	CHECK(paragraph_create(&rec_fresh, ctx, &fresh, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_inline(fresh, &style_a);
+	second = test_add_text(fresh, "gamma delta ");
+	test_add_inline(fresh, NULL);
+	test_add_text(fresh, "epsilon");
+	CHECK(paragraph_content_set_style(fresh, second, &style_b) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(fresh, 12 * TEST_CHAR_WIDTH, &rec_fresh) ==
+			PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, rec_fresh.buf) == 0);
+
+	fresh = paragraph_destroy(fresh);
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Check that resizing replaced content lays out again only the lines it
+ * affects.
+ */
+static void test_replaced_size(paragraph_ctx_t *ctx)
+{
+	paragraph_content_id_t text, image;
+	struct record rec, rec_fresh;
+	paragraph_para_t *para, *fresh;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	for (unsigned i = 0; i < 3; i++) {
+		text = test_add_text(para, "word word ");
+	}
+	test_add_text(para, "word ");
+	image = test_add_replaced(para, 16);
+	test_add_text(para, " word word word");
+	CHECK(test_layout(para, 10 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - word word ] 16\n[0 - word word ] 16\n"
+			"[0 - word word ] 16\n[0 - word ][40 replaced] 20\n"
+			"[0 - word word ] 16\n[0 - word] 16\n") == 0);
+
+	/* Resizing to the same size isn't a change. */
+	CHECK(paragraph_content_set_replaced_size(para, image, 16,
+			TEST_LINE_HEIGHT) == PARAGRAPH_OK);
+	CHECK(!para->content.dirty.dirty);
+
+	CHECK(paragraph_content_set_replaced_size(para, image, 48,
+			TEST_LINE_HEIGHT) == PARAGRAPH_OK);
+	CHECK(para->content.dirty.dirty &&
+			para->content.dirty.start == 4 &&
+			para->content.dirty.end == 5);
+
+	/* The image no longer fits on its line, so it and the lines after
+	 * it move down.  The lines before the image's line, and the one
+	 * before that, are reused. */
+	CHECK(test_layout(para, 10 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(para->layout.reuse_end == 2);
+	CHECK(strcmp(rec.buf, "[0 - word word ] 16\n[0 - word word ] 16\n"
+			"[0 - word word ] 16\n[0 - word ] 16\n"
+			"[0 replaced][48 - word ] 20\n[0 - word word] 16\n") ==
+			0);
+
+	CHECK(paragraph_create(&rec_fresh, ctx, &fresh, &style_container) ==
+			PARAGRAPH_OK);
+	for (unsigned i = 0; i < 3; i++) {
+		test_add_text(fresh, "word word ");
+	}
+	test_add_text(fresh, "word ");
+	test_add_replaced(fresh, 48);
+	test_add_text(fresh, " word word word");
+	CHECK(test_layout(fresh, 10 * TEST_CHAR_WIDTH, &rec_fresh) ==
+			PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, rec_fresh.buf) == 0);
+
+	/* Only replaced content can be resized. */
+	CHECK(paragraph_content_set_replaced_size(para, text, 48,
+			TEST_LINE_HEIGHT) == PARAGRAPH_ERR_BAD_TYPE);
+
+	fresh = paragraph_destroy(fresh);
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Check that a paragraph whose content has had many styles lays out like
+ * one built with its final styles.
+ */
+static void test_edit_styles(paragraph_ctx_t *ctx)
+{
+	paragraph_content_id_t first, second;
+	struct record rec, rec_fresh;
+	paragraph_para_t *para, *fresh;
+	size_t cycle = sizeof(style_cycle) / sizeof(style_cycle[0]);
+
+	measure_extra = 1;
+	CHECK(paragraph_ctx_clear_measure_cache(ctx) == PARAGRAPH_OK);
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	first = test_add_text(para, "on");
+	second = test_add_text(para, "e two");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+
+	for (size_t i = 0; i < 3 * cycle; i++) {
+		CHECK(paragraph_content_set_style(para, first,
+				&style_cycle[i % cycle]) == PARAGRAPH_OK);
+		CHECK(paragraph_content_set_style(para, second,
+				&style_cycle[(i + 3) % cycle]) == PARAGRAPH_OK);
+		CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	}
+
+	/* Replaced styles don't stay in the style table. */
+	for (size_t i = 0; i < 100 * cycle; i++) {
+		CHECK(paragraph_content_set_style(para, second,
+				&style_cycle[i % cycle]) == PARAGRAPH_OK);
+	}
+	CHECK(para->content.style_count <= 2 * cycle);
+
+	/* Give the other styles a use in between, so the table has more
+	 * than one entry for the final style. */
+	CHECK(paragraph_content_set_style(para, first, &style_a) ==
+			PARAGRAPH_OK);
+	for (size_t i = 0; i < cycle; i++) {
+		CHECK(paragraph_content_set_style(para, second,
+				&style_cycle[i]) == PARAGRAPH_OK);
+	}
+	CHECK(paragraph_content_set_style(para, second, &style_a) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+
+	CHECK(paragraph_create(&rec_fresh, ctx, &fresh, &style_container) ==
+			PARAGRAPH_OK);
+	first = test_add_text(fresh, "on");
+	second = test_add_text(fresh, "e two");
+	CHECK(paragraph_content_set_style(fresh, first, &style_a) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_content_set_style(fresh, second, &style_a) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(fresh, 1000, &rec_fresh) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, rec_fresh.buf) == 0);
+
+	fresh = paragraph_destroy(fresh);
+	para = paragraph_destroy(para);
+
+	measure_extra = 0;
+	CHECK(paragraph_ctx_clear_measure_cache(ctx) == PARAGRAPH_OK);
+}
+
+/**
+ * Check that preserved newlines end lines, without being measured or given
+ * to the layout callbacks.
+ */
+static void test_newline(paragraph_ctx_t *ctx)
+{
+	static paragraph_style_t *styles[] = { &style_pre, &style_pre_wrap };
+	struct record rec;
+
+	for (size_t i = 0; i < sizeof(styles) / sizeof(styles[0]); i++) {
+		paragraph_para_t *para;
+		paragraph_content_id_t id;
+
+		CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+				PARAGRAPH_OK);
+		id = test_add_text(para, "one\n\ntwo  \nthree\n");
+		CHECK(paragraph_content_set_style(para, id, styles[i]) ==
+				PARAGRAPH_OK);
+
+		newlines = 0;
+		CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+		CHECK(rec.lines == 4);
+		CHECK(strstr(rec.buf, "[0 - one] 16\n") == rec.buf);
+		CHECK(strstr(rec.buf, "[0 - two  ] 16\n") != NULL);
+		CHECK(newlines == 0);
+
+		para = paragraph_destroy(para);
+	}
+}
+
+/**
+ * Check the measurement cache counters.
+ */
+static void test_measure_stats(paragraph_ctx_t *ctx)
+{
+	const paragraph_config_t config = {
+		.measure_cache_size = 4096,
+	};
+	paragraph_measure_stats_t before, after;
+	paragraph_para_t *para;
+	paragraph_ctx_t *small;
+	char words[4 * 1024 + 1] = "";
+	struct record rec;
+
+	CHECK(paragraph_ctx_get_measure_stats(ctx, &before) == PARAGRAPH_OK);
+
+	/* Every word has been measured in this style before. */
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(para, "alpha beta epsilon");
+	measure_calls = 0;
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(measure_calls == 0);
+
+	CHECK(paragraph_ctx_get_measure_stats(ctx, &after) == PARAGRAPH_OK);
+	CHECK(after.hits > before.hits);
+	CHECK(after.misses == before.misses);
+	CHECK(after.entries > 0 && after.bytes > 0);
+
+	CHECK(paragraph_ctx_clear_measure_cache(ctx) == PARAGRAPH_OK);
+	CHECK(paragraph_ctx_get_measure_stats(ctx, &after) == PARAGRAPH_OK);
+	CHECK(after.entries == 0);
+
+	/* After clearing, the three words and a space are measured
+	 * again. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	test_add_text(para, "alpha beta epsilon");
+	measure_calls = 0;
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(measure_calls == 4);
+	para = paragraph_destroy(para);
+
+	/* A cache kept to its smallest budget evicts measurements to stay
+	 * within it. */
+	CHECK(paragraph_ctx_create(NULL, &small, &config, &cb_text) ==
+			PARAGRAPH_OK);
+	for (size_t i = 0; i < sizeof(words) - 1; i++) {
+		size_t word = i / 4;
+
+		words[i] = i % 4 == 3 ? ' ' :
+				'a' + (word >> (i % 4 * 4) & 0xf);
+	}
+	CHECK(paragraph_create(&rec, small, &para, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(para, words);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(paragraph_ctx_get_measure_stats(small, &after) == PARAGRAPH_OK);
+	CHECK(after.evictions > 0);
+	CHECK(after.entries < after.misses);
+	CHECK(after.bytes <= 4096);
+	para = paragraph_destroy(para);
+	small = paragraph_ctx_destroy(small);
+}
+
+/**
+ * Test reusing paragraphs, from the context's pool and by resetting them.
+ *
+ * \param[in]  ctx  The library context.
+ */
+static void test_reuse(paragraph_ctx_t *ctx)
+{
+	const paragraph_layout_item_t *items[2];
+	const paragraph_content_block_t *block;
+	paragraph_content_id_t id, old;
+	paragraph_para_t *para, *reused;
+	struct record rec;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	for (unsigned i = 0; i < 20; i++) {
+		old = test_add_text(para, "word ");
+	}
+	CHECK(test_layout(para, 10 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(rec.lines == 10);
+
+	block = para->content.block;
+	items[0] = para->layout.prev.items;
+	items[1] = para->layout.cur.items;
+	CHECK(block != NULL && (items[0] != NULL || items[1] != NULL));
+
+	/* A destroyed paragraph is created again from the pool, with the
+	 * allocations it had. */
+	para = paragraph_destroy(para);
+	CHECK(paragraph_create(&rec, ctx, &reused, &style_container) ==
+			PARAGRAPH_OK);
+	CHECK(reused->content.block == block);
+	CHECK(reused->layout.prev.items == items[0]);
+	CHECK(reused->layout.cur.items == items[1]);
+
+	/* Handles to the old paragraph's content aren't valid in the new
+	 * one, and new content doesn't get them. */
+	CHECK(paragraph_content_set_style(reused, old, &style_a) ==
+			PARAGRAPH_ERR_BAD_PARAM);
+	CHECK(paragraph_content_remove(reused, old) ==
+			PARAGRAPH_ERR_BAD_PARAM);
+	id = test_add_text(reused, "new");
+	CHECK(id != PARAGRAPH_CONTENT_ID_NONE && id != old);
+	CHECK(reused->content.block == block);
+
+	CHECK(test_layout(reused, 10 * TEST_CHAR_WIDTH, &rec) ==
+			PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - new] 16\n") == 0);
+
+	/* The same goes for a paragraph that is reset. */
+	CHECK(paragraph_reset(reused, &style_container) == PARAGRAPH_OK);
+	CHECK(reused->content.block == block);
+	CHECK(paragraph_content_remove(reused, id) ==
+			PARAGRAPH_ERR_BAD_PARAM);
+	CHECK(test_add_text(reused, "again") != id);
+	CHECK(test_layout(reused, 10 * TEST_CHAR_WIDTH, &rec) ==
+			PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - again] 16\n") == 0);
+
+	reused = paragraph_destroy(reused);
+}
+
+/**
+ * Hit test a point on the first line of a paragraph.
+ *
+ * \param[in]  para  The paragraph.
+ * \param[in]  x     Index of the byte of laid out text to hit, in the test's
+ *                   fixed width font.
+ * \return The content at the point, or no content on failure.
+ */
+static paragraph_content_offset_t test_hit_byte(paragraph_para_t *para,
+		unsigned x)
+{
+	paragraph_content_offset_t hit = {
+		.id = PARAGRAPH_CONTENT_ID_NONE,
+	};
+
+	if (paragraph_hit_test(para, x * TEST_CHAR_WIDTH + 1, 1, &hit) !=
+			PARAGRAPH_OK) {
+		hit.id = PARAGRAPH_CONTENT_ID_NONE;
+	}
+
+	return hit;
+}
+
+/**
+ * Check the text and positions given to the layout callbacks for each
+ * `white-space` value, and that hit testing maps offsets in the processed
+ * text back to the text as it was added.
+ */
+static void test_white_space(paragraph_ctx_t *ctx)
+{
+	paragraph_content_offset_t hit;
+	paragraph_content_id_t id, id2;
+	paragraph_para_t *para;
+	struct record rec;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+
+	/* Spaces collapse, and nowrap text doesn't break even when it
+	 * doesn't fit. */
+	id = test_add_text(para, "one  two three");
+	CHECK(test_layout(para, 5 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - one ] 16\n[0 - two ] 16\n"
+			"[0 - three] 16\n") == 0);
+	CHECK(paragraph_content_set_style(para, id, &style_nowrap) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(para, 5 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - one two three] 16\n") == 0);
+
+	/* Spaces collapse, and are removed around preserved newlines,
+	 * which aren't given to the client. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	id = test_add_text(para, "one   two \n  three  four");
+	CHECK(paragraph_content_set_style(para, id, &style_pre_line) ==
+			PARAGRAPH_OK);
+	newlines = 0;
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - one two] 16\n[0 - three four] 16\n") ==
+			0);
+	CHECK(newlines == 0);
+
+	/* Trailing spaces hang past the end of a pre-wrap line, but take up
+	 * room on a break-spaces line. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	id = test_add_text(para, "ab cd  ef");
+	CHECK(paragraph_content_set_style(para, id, &style_pre_wrap) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(para, 5 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - ab cd  ] 16\n[0 - ef] 16\n") == 0);
+	CHECK(paragraph_content_set_style(para, id, &style_break_spaces) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(para, 5 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - ab ] 16\n[0 - cd  ] 16\n"
+			"[0 - ef] 16\n") == 0);
+
+	/* The spaces of a break-spaces line each have a space's width. */
+	CHECK(paragraph_hit_test(para, 3 * TEST_CHAR_WIDTH + 1,
+			TEST_LINE_HEIGHT, &hit) == PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 6);
+
+	/* Offsets in the collapsed text map back to the added text, across
+	 * content entries. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	id = test_add_text(para, "one   ");
+	id2 = test_add_text(para, "  two");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - one ][32 - two] 16\n") == 0);
+	hit = test_hit_byte(para, 3);
+	CHECK(hit.id == id && hit.offset == 3);
+	hit = test_hit_byte(para, 4);
+	CHECK(hit.id == id2 && hit.offset == 2);
+	hit = test_hit_byte(para, 6);
+	CHECK(hit.id == id2 && hit.offset == 4);
+
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Test text transforms, including ones that change the text's length.
+ *
+ * \param[in]  config  Configuration to create a context with.
+ */
+static void test_transform(const paragraph_config_t *config)
+{
+	/* "straße ﬁx été", where "ß" and "ﬁ" uppercase to two letters. */
+	static const char text[] = "stra\xc3\x9f" "e \xef\xac\x81x "
+			"\xc3\xa9t\xc3\xa9";
+	paragraph_content_offset_t hit;
+	paragraph_content_id_t id, end;
+	paragraph_para_t *para;
+	paragraph_ctx_t *ctx;
+	struct record rec;
+
+	CHECK(paragraph_ctx_create(NULL, &ctx, config, &cb_transform) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+
+	/* Uppercase text is measured as transformed, so what follows is
+	 * placed after it. */
+	id = test_add_text(para, text);
+	CHECK(paragraph_content_set_style(para, id, &style_a) ==
+			PARAGRAPH_OK);
+	end = test_add_text(para, " !");
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 a STRASSE FIX \xc3\x89T\xc3\x89]"
+			"[136 -  !] 16\n") == 0);
+
+	/* Hit tests inside the transformed text find offsets in the text
+	 * as it was added. */
+	hit = test_hit_byte(para, 3);
+	CHECK(hit.id == id && hit.offset == 3);
+	hit = test_hit_byte(para, 5);
+	CHECK(hit.id == id && hit.offset == 4);
+	hit = test_hit_byte(para, 6);
+	CHECK(hit.id == id && hit.offset == 6);
+	hit = test_hit_byte(para, 9);
+	CHECK(hit.id == id && hit.offset == 8);
+	hit = test_hit_byte(para, 10);
+	CHECK(hit.id == id && hit.offset == 11);
+	hit = test_hit_byte(para, 14);
+	CHECK(hit.id == id && hit.offset == 15);
+	hit = test_hit_byte(para, 18);
+	CHECK(hit.id == end && hit.offset == 1);
+
+	/* Lowercase, where "İ" lowercases to a letter and a mark. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	id = test_add_text(para, "STRASSE \xc3\x89T\xc3\x89 \xc4\xb0x");
+	CHECK(paragraph_content_set_style(para, id, &style_b) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 b strasse \xc3\xa9t\xc3\xa9 "
+			"i\xcc\x87x] 16\n") == 0);
+	hit = test_hit_byte(para, 17);
+	CHECK(hit.id == id && hit.offset == 16);
+
+	/* Capitalize, where "ﬁ" titlecases to two letters. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	id = test_add_text(para, text);
+	CHECK(paragraph_content_set_style(para, id, &style_c) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 c Stra\xc3\x9f" "e Fix "
+			"\xc3\x89t\xc3\xa9] 16\n") == 0);
+	hit = test_hit_byte(para, 10);
+	CHECK(hit.id == id && hit.offset == 11);
+
+	/* Full width, where each character becomes three bytes. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	id = test_add_text(para, "ab1!");
+	CHECK(paragraph_content_set_style(para, id, &style_cycle[0]) ==
+			PARAGRAPH_OK);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - \xef\xbd\x81\xef\xbd\x82"
+			"\xef\xbc\x91\xef\xbc\x81] 16\n") == 0);
+	hit = test_hit_byte(para, 7);
+	CHECK(hit.id == id && hit.offset == 2);
+
+	para = paragraph_destroy(para);
+	ctx = paragraph_ctx_destroy(ctx);
+}
+
+/**
+ * Test laying out text with ill-formed UTF-8.
+ *
+ * \param[in]  ctx  The library context.
+ */
+static void test_ill_formed(paragraph_ctx_t *ctx)
+{
+	/* A lone continuation byte, a truncated sequence, an overlong
+	 * encoding, a surrogate, and a sequence cut off by the end. */
+	static const char text[] = "ab\x80" "cd e\xe2\x82" "f g\xc0\xaf "
+			"h\xed\xa0\x80 i\xf0\x9f";
+	paragraph_content_offset_t from, found, hit;
+	paragraph_content_id_t id;
+	paragraph_para_t *para;
+	struct record rec;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	id = test_add_text(para, text);
+	CHECK(id != PARAGRAPH_CONTENT_ID_NONE);
+	CHECK(para->content.cold[0].utf8 == PARAGRAPH_UTF8_INVALID);
+
+	/* The bytes are given to the callbacks as they are, and each part
+	 * that can't be decoded is a letter, so the words stay whole. */
+	CHECK(test_layout(para, 6 * TEST_CHAR_WIDTH, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - ab\x80" "cd ] 16\n"
+			"[0 - e\xe2\x82" "f ] 16\n"
+			"[0 - g\xc0\xaf ] 16\n"
+			"[0 - h\xed\xa0\x80 ] 16\n"
+			"[0 - i\xf0\x9f] 16\n") == 0);
+
+	CHECK(paragraph_hit_test(para, 1 * TEST_CHAR_WIDTH + 1,
+			TEST_LINE_HEIGHT + 1, &hit) == PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 7);
+
+	/* Each maximal subpart of an ill-formed sequence is a character. */
+	from = (paragraph_content_offset_t) { .id = id, .offset = 7 };
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_GRAPHEME, true, &found) ==
+			PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == 9);
+	from.offset = 12;
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_GRAPHEME, true, &found) ==
+			PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == 13);
+	from.offset = 16;
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_GRAPHEME, true, &found) ==
+			PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == 17);
+	from.offset = sizeof(text) - 1;
+	CHECK(paragraph_text_boundary(para, &from,
+			PARAGRAPH_BOUNDARY_GRAPHEME, false, &found) ==
+			PARAGRAPH_OK);
+	CHECK(found.id == id && found.offset == 21);
+
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Check whether a line can start at a byte of a paragraph's text.
+ *
+ * \param[in]  para    The paragraph, which must have been laid out.
+ * \param[in]  offset  Byte offset into the paragraph's text.
+ * \return true if there is a line break opportunity before the byte.
+ */
+static bool test_break(const paragraph_para_t *para, size_t offset)
+{
+	return para->linebreak.bits[offset / 64] >> (offset % 64) & 1;
+}
+
+/**
+ * Test the fast path for simple text finds the same line breaks as the
+ * pair table.
+ *
+ * The text is analysed as it is, which takes the fast path through its
+ * runs of ASCII, and with each letter replaced by a Greek letter, which
+ * has the same line break class but takes the pair table.
+ *
+ * \param[in]  ctx  The library context.
+ */
+static void test_linebreak(paragraph_ctx_t *ctx)
+{
+	static const char text[] = "Call 555-1234, or (at 12:30) visit "
+			"example.com/path?q=1 now; \"quoted\" text's fine: "
+			"1,000.50 $5 100% a/b-c x--y (1)2 [z]abc!?";
+	char greek[sizeof(text) * 2];
+	size_t map[sizeof(text)];
+	paragraph_para_t *para, *slow;
+	struct record rec;
+	size_t len = 0;
+
+	for (size_t i = 0; i < sizeof(text); i++) {
+		char c = text[i];
+
+		map[i] = len;
+		if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+			greek[len++] = '\xce';
+			greek[len++] = '\xb1';
+		} else {
+			greek[len++] = c;
+		}
+	}
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_create(&rec, ctx, &slow, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(para, text);
+	test_add_text(slow, greek);
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(test_layout(slow, 1000, &rec) == PARAGRAPH_OK);
+
+	for (size_t i = 0; i < sizeof(text) - 1; i++) {
+		CHECK(test_break(para, i) == test_break(slow, map[i]));
+	}
+
+	slow = paragraph_destroy(slow);
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Test the visual order and embedding levels of right-to-left text.
+ *
+ * \param[in]  ctx  The library context.
+ */
+static void test_rtl(paragraph_ctx_t *ctx)
+{
+	/* Hebrew "alef bet gimel dalet he vav", "abc def", and Hebrew
+	 * "zayin", with a full stop. */
+	static const char text[] = "\xd7\x90\xd7\x91\xd7\x92 \xd7\x93\xd7\x94"
+			"\xd7\x95 abc def \xd7\x96!";
+	paragraph_content_offset_t hit;
+	paragraph_content_id_t id;
+	paragraph_para_t *para;
+	struct record rec;
+	paragraph_err_t err;
+	uint32_t height;
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	id = test_add_text(para, text);
+
+	/* The paragraph is right-to-left, from its first strong character,
+	 * so the Hebrew is at level 1, from the right, and the Latin text
+	 * between it is at level 2, from the left. */
+	rec.len = 0;
+	do {
+		err = paragraph_layout_line(para, 1000, api_layout_level,
+				api_layout_replaced, &height);
+		record_append(&rec, " %u\n", height);
+	} while (err == PARAGRAPH_END_OF_LINE);
+	CHECK(err == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[88 1 \xd7\x90\xd7\x91\xd7\x92 "
+			"\xd7\x93\xd7\x94\xd7\x95 ][32 2 abc def][24 1  ]"
+			"[0 1 \xd7\x96!] 16\n") == 0);
+
+	/* Hit tests find the end of the text at the left, and its start at
+	 * the right. */
+	hit = test_hit_byte(para, 0);
+	CHECK(hit.id == id && hit.offset == sizeof(text) - 1);
+	hit = test_hit_byte(para, 5);
+	CHECK(hit.id == id && hit.offset == 15);
+	hit = test_hit_byte(para, 24);
+	CHECK(hit.id == id && hit.offset == 0);
+
+	/* Each line is reordered on its own. */
+	rec.len = 0;
+	do {
+		err = paragraph_layout_line(para, 10 * TEST_CHAR_WIDTH,
+				api_layout_level, api_layout_replaced,
+				&height);
+		record_append(&rec, " %u\n", height);
+	} while (err == PARAGRAPH_END_OF_LINE);
+	CHECK(err == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 1 \xd7\x90\xd7\x91\xd7\x92 ] 16\n"
+			"[32 1 \xd7\x93\xd7\x94\xd7\x95 ][0 2 abc ] 16\n"
+			"[32 2 def][24 1  ][0 1 \xd7\x96!] 16\n") == 0);
+
+	CHECK(paragraph_hit_test(para, 1, TEST_LINE_HEIGHT + 1, &hit) ==
+			PARAGRAPH_OK);
+	CHECK(hit.id == id && hit.offset == 14);
+
+	para = paragraph_destroy(para);
+}
+
+/**
+ * Test the scripts given with text to measure.
+ *
+ * \param[in]  config  Configuration to create a context with.
+ */
+static void test_script(const paragraph_config_t *config)
+{
+	paragraph_config_t uncached = *config;
+	struct record rec, scripts;
+	paragraph_para_t *para;
+	paragraph_ctx_t *ctx;
+
+	uncached.measure_cache_size = 0;
+	CHECK(paragraph_ctx_create(NULL, &ctx, &uncached, &cb_text) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+
+	/* Common and Inherited characters take the script of the text
+	 * before them, or at the start, the script after them.  A word in two
+	 * scripts is measured in two parts.  Spaces measured on their own
+	 * are Common. */
+	test_add_text(para, "1 abc\xce\xb1\xce\xb2 \xce\xb3\xcc\x81 2 "
+			"\xd0\xb0\xd0\xb1!");
+	scripts.len = 0;
+	scripts.buf[0] = '\0';
+	measure_scripts = &scripts;
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(scripts.buf, "[Zyyy  ][Zyyy  ][Latn 1][Latn abc]"
+			"[Grek \xce\xb1\xce\xb2][Grek \xce\xb3\xcc\x81][Grek 2]"
+			"[Cyrl \xd0\xb0\xd0\xb1!]") == 0);
+	CHECK(strcmp(rec.buf, "[0 - 1 abc][40 - \xce\xb1\xce\xb2 "
+			"\xce\xb3\xcc\x81 2 ][136 - \xd0\xb0\xd0\xb1!] "
+			"16\n") == 0);
+
+	/* Text with no script of its own is Common. */
+	CHECK(paragraph_reset(para, &style_container) == PARAGRAPH_OK);
+	test_add_text(para, "12 34");
+	scripts.len = 0;
+	scripts.buf[0] = '\0';
+	CHECK(test_layout(para, 1000, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(scripts.buf, "[Zyyy  ][Zyyy  ][Zyyy 12][Zyyy 34]") == 0);
+	measure_scripts = NULL;
+
+	para = paragraph_destroy(para);
+	ctx = paragraph_ctx_destroy(ctx);
+}
+
+/**
+ * Write a copy of a file, changed.
+ *
+ * \param[in]  src     Path of file to copy.
+ * \param[in]  dst     Path of copy.
+ * \param[in]  change  Called to change the file's data before it's written.
+ * \return true on success.
+ */
+static bool test_copy_file(const char *src, const char *dst,
+		size_t (*change)(uint8_t *data, size_t len))
+{
+	static uint8_t data[4096];
+	size_t len;
+	FILE *f;
+
+	f = fopen(src, "rb");
+	if (f == NULL) {
+		return false;
+	}
+	len = fread(data, 1, sizeof(data), f);
+	fclose(f);
+
+	len = change(data, len);
+
+	f = fopen(dst, "wb");
+	if (f == NULL) {
+		return false;
+	}
+	if (fwrite(data, 1, len, f) != len) {
+		fclose(f);
+		return false;
+	}
+	return fclose(f) == 0;
+}
+
+/** Lose the end of a pattern file. */
+static size_t test_hyphen_truncate(uint8_t *data, size_t len)
+{
+	UNUSED(data);
+
+	return len - 1;
+}
+
+/** Spoil a pattern file's magic number. */
+static size_t test_hyphen_magic(uint8_t *data, size_t len)
+{
+	data[0] = 'X';
+
+	return len;
+}
+
+/** Point a pattern file's first trie edge at a node that isn't there. */
+static size_t test_hyphen_edge(uint8_t *data, size_t len)
+{
+	/* The header is 24 bytes, ending with the node count at 8, and each
+	 * node is 12 bytes.  An edge's top three bytes are its node. */
+	uint32_t nodes = data[8] | data[9] << 8 | data[10] << 16 |
+			(uint32_t)data[11] << 24;
+	size_t edge = 24 + nodes * 12;
+
+	if (edge + 4 <= len) {
+		data[edge + 1] = 0xff;
+		data[edge + 2] = 0xff;
+		data[edge + 3] = 0xff;
+	}
+
+	return len;
+}
+
+/**
+ * Check a damaged copy of a pattern file is rejected.
+ *
+ * \param[in]  config  Configuration to create contexts with.
+ * \param[in]  path    The pattern file.
+ * \param[in]  change  Called to damage the copy.
+ */
+static void test_hyphen_bad(const paragraph_config_t *config,
+		const char *path, size_t (*change)(uint8_t *data, size_t len))
+{
+	paragraph_config_t bad = *config;
+	paragraph_hyphen_t hyph;
+	paragraph_ctx_t *ctx;
+	char copy[1024];
+
+	snprintf(copy, sizeof(copy), "%s.bad", path);
+	if (!test_copy_file(path, copy, change)) {
+		CHECK(!"copied pattern file");
+		return;
+	}
+
+	CHECK(paragraph_hyphen__init(&hyph, copy) == PARAGRAPH_ERR_BAD_PARAM);
+	CHECK(hyph.map == NULL);
+
+	bad.hyphenation_patterns = copy;
+	CHECK(paragraph_ctx_create(NULL, &ctx, &bad, &cb_hyphens) ==
+			PARAGRAPH_ERR_BAD_PARAM);
+
+	remove(copy);
+}
+
+/**
+ * Test hyphenation with the patterns in `test/hyphen.txt`.
+ *
+ * \param[in]  config  Configuration to create contexts with.
+ * \param[in]  path    The compiled pattern file.
+ */
+static void test_hyphen(const paragraph_config_t *config, const char *path)
+{
+	paragraph_config_t patterns = *config;
+	paragraph_hyphen_t hyph;
+	paragraph_hyphen_word_t *word = NULL;
+	struct record rec;
+	paragraph_para_t *para;
+	paragraph_ctx_t *ctx;
+	size_t points[8];
+	size_t count;
+
+	CHECK(paragraph_hyphen__init(&hyph, path) == PARAGRAPH_OK);
+	if (!paragraph_hyphen__active(&hyph)) {
+		return;
+	}
+
+	/* Liang's example, in any case, and words in running text. */
+	count = paragraph_hyphen__find(&hyph, "hyphenation", 11, points, 8);
+	CHECK(count == 2 && points[0] == 2 && points[1] == 6);
+	count = paragraph_hyphen__find(&hyph, "Hyphenation", 11, points, 8);
+	CHECK(count == 2 && points[0] == 2 && points[1] == 6);
+	count = paragraph_hyphen__find(&hyph, "computer", 8, points, 8);
+	CHECK(count == 1 && points[0] == 3);
+	count = paragraph_hyphen__find(&hyph, "hyphenation computer", 20,
+			points, 8);
+	CHECK(count == 3 && points[0] == 2 && points[1] == 6 &&
+			points[2] == 15);
+	count = paragraph_hyphen__find(&hyph, "hyphenation computer", 20,
+			points, 1);
+	CHECK(count == 1 && points[0] == 2);
+
+	/* The points of a word hyphenated before come from the cache. */
+	for (size_t i = 0; i < 256; i++) {
+		if (hyph.words[i].len == 11 && memcmp(hyph.words[i].word,
+				"hyphenation", 11) == 0) {
+			word = &hyph.words[i];
+		}
+	}
+	CHECK(word != NULL);
+	if (word != NULL) {
+		word->points = 1u << 4;
+		count = paragraph_hyphen__find(&hyph, "hyphenation", 11,
+				points, 8);
+		CHECK(count == 1 && points[0] == 4);
+	}
+
+	paragraph_hyphen__fini(&hyph);
+
+	/* Only text with `hyphens: auto` is hyphenated, ending the line with
+	 * as much of the word as fits, and a hyphen. */
+	patterns.hyphenation_patterns = path;
+	CHECK(paragraph_ctx_create(NULL, &ctx, &patterns, &cb_hyphens) ==
+			PARAGRAPH_OK);
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(para, "a ");
+	CHECK(paragraph_content_set_style(para,
+			test_add_text(para, "hyphenation"),
+			&style_c) == PARAGRAPH_OK);
+	CHECK(test_layout(para, 80, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - a ][16 c hyphen][64 c -] 16\n"
+			"[0 c ation] 16\n") == 0);
+	para = paragraph_destroy(para);
+
+	CHECK(paragraph_create(&rec, ctx, &para, &style_container) ==
+			PARAGRAPH_OK);
+	test_add_text(para, "a hyphenation");
+	CHECK(test_layout(para, 80, &rec) == PARAGRAPH_OK);
+	CHECK(strcmp(rec.buf, "[0 - a ] 16\n[0 - hyphenation] 16\n") == 0);
+	para = paragraph_destroy(para);
+	ctx = paragraph_ctx_destroy(ctx);
+
+	/* Damaged pattern files are rejected. */
+	test_hyphen_bad(config, path, test_hyphen_truncate);
+	test_hyphen_bad(config, path, test_hyphen_magic);
+	test_hyphen_bad(config, path, test_hyphen_edge);
+}
+
+int main(int argc, char *argv[])
+{
+	paragraph_config_t config = {
+		.log_fn = paragraph_log,
+		.log_level = PARAGRAPH_LOG_WARNING,
+		.measure_cache_size = 64 * 1024,
+	};
+	paragraph_ctx_t *ctx;
+	paragraph_err_t err;
+
+	err = paragraph_ctx_create(NULL, &ctx, &config, &cb_text);
+	if (err != PARAGRAPH_OK) {
+		fprintf(stderr, "Failed to create context: %s\n",
+				paragraph_strerror(err));
+		return EXIT_FAILURE;
+	}
+
+	test_add_spans(ctx);
+	test_style_ref(&config);
+	test_float(ctx);
+	test_hit(ctx);
+	test_hit_lines(ctx);
+	test_boundary(ctx);
+	test_clone(ctx);
+	test_clone_share(&config);
+	test_joined(&config);
+	test_remove_inline(ctx);
+	test_offsets(ctx);
+	test_edit(ctx);
+	test_replaced_size(ctx);
+	test_newline(ctx);
+	test_white_space(ctx);
+	test_measure_stats(ctx);
+	test_edit_styles(ctx);
+	test_transform(&config);
+	test_reuse(ctx);
+	test_ill_formed(ctx);
+	test_linebreak(ctx);
+	test_rtl(ctx);
+	test_script(&config);
+	if (argc > 1) {
+		test_hyphen(&config, argv[1]);
+	}
+
+	ctx = paragraph_ctx_destroy(ctx);
+
+	printf("api: %u failed\n", failures);
+
+	return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -67,9 +67,80 @@ paragraph_err_t basic_dom_string_text_get(
 	return PARAGRAPH_OK;
 }
 
+static paragraph_err_t basic_layout_text(
+		void *pw,
+		void *handle,
+		const paragraph_style_t *style,
+		const paragraph_text_t *text,
+		const paragraph_position_t *pos)
+{
+	UNUSED(pw);
+	UNUSED(handle);
+	UNUSED(style);
+
+	printf("    text (%u, %u): \"%.*s\"\n", pos->x, pos->y,
+			(int)text->len, text->data);
+
+	return PARAGRAPH_OK;
+}
+
+static paragraph_err_t basic_layout_replaced(
+		void *pw,
+		void *handle,
+		const paragraph_style_t *style,
+		const paragraph_position_t *pos)
+{
+	UNUSED(pw);
+	UNUSED(handle);
+	UNUSED(style);
+
+	printf("    replaced (%u, %u)\n", pos->x, pos->y);
+
+	return PARAGRAPH_OK;
+}
+
+static paragraph_white_space_t basic_white_space(
+		void *pw,
+		const paragraph_style_t *style)
+{
+	const css_select_results *results = style;
+	UNUSED(pw);
+
+	switch (css_computed_white_space(
+			results->styles[CSS_PSEUDO_ELEMENT_NONE])) {
+	case CSS_WHITE_SPACE_PRE:      return PARAGRAPH_WHITE_SPACE_PRE;
+	case CSS_WHITE_SPACE_NOWRAP:   return PARAGRAPH_WHITE_SPACE_NOWRAP;
+	case CSS_WHITE_SPACE_PRE_WRAP: return PARAGRAPH_WHITE_SPACE_PRE_WRAP;
+	case CSS_WHITE_SPACE_PRE_LINE: return PARAGRAPH_WHITE_SPACE_PRE_LINE;
+	default:                       return PARAGRAPH_WHITE_SPACE_NORMAL;
+	}
+}
+
+static paragraph_text_transform_t basic_text_transform(
+		void *pw,
+		const paragraph_style_t *style)
+{
+	const css_select_results *results = style;
+	UNUSED(pw);
+
+	switch (css_computed_text_transform(
+			results->styles[CSS_PSEUDO_ELEMENT_NONE])) {
+	case CSS_TEXT_TRANSFORM_CAPITALIZE:
+		return PARAGRAPH_TEXT_TRANSFORM_CAPITALIZE;
+	case CSS_TEXT_TRANSFORM_UPPERCASE:
+		return PARAGRAPH_TEXT_TRANSFORM_UPPERCASE;
+	case CSS_TEXT_TRANSFORM_LOWERCASE:
+		return PARAGRAPH_TEXT_TRANSFORM_LOWERCASE;
+	default:
+		return PARAGRAPH_TEXT_TRANSFORM_NONE;
+	}
+}
+
 paragraph_cb_text_t cb_text = {
-	.measure_text = bitmap_font_measure_text,
-	.text_get     = basic_dom_string_text_get,
+	.measure_text   = bitmap_font_measure_text,
+	.text_get       = basic_dom_string_text_get,
+	.white_space    = basic_white_space,
+	.text_transform = basic_text_transform,
 };
 
 static void paragraph_sd_ctx_fini(void)
@@ -221,7 +292,7 @@ static bool paragraph_sd_add_text(
 	dom_string *content;
 	paragraph_err_t err;
 	paragraph_para_t *para;
-	paragraph_content_id_t *content_id;
+	paragraph_content_id_t content_id;
 
 	assert(type == DOM_TEXT_NODE);
 
@@ -265,7 +336,7 @@ static bool paragraph_sd_add_start(
 	paragraph_err_t err;
 	paragraph_para_t *para;
 	css_select_results *style;
-	paragraph_content_id_t *content_id;
+	paragraph_content_id_t content_id;
 
 	assert(type == DOM_ELEMENT_NODE);
 
@@ -306,7 +377,7 @@ static bool paragraph_sd_add_end(
 	bool res;
 	paragraph_err_t err;
 	paragraph_para_t *para;
-	paragraph_content_id_t *content_id;
+	paragraph_content_id_t content_id;
 
 	assert(type == DOM_ELEMENT_NODE);
 
@@ -347,10 +418,18 @@ static bool paragraph_sd_layout(
 		return true;
 	}
 
-	err = paragraph_layout_line(para, 800, NULL, NULL, &height);
-	if (err != PARAGRAPH_OK) {
-		return false;
-	}
+	do {
+		err = paragraph_layout_line(para, 800,
+				basic_layout_text,
+				basic_layout_replaced,
+				&height);
+		if (err != PARAGRAPH_OK && err != PARAGRAPH_END_OF_LINE) {
+			fprintf(stderr, "%s: Failed to lay out line: %s\n",
+					__func__, paragraph_strerror(err));
+			return false;
+		}
+		printf("  line height: %u\n", height);
+	} while (err == PARAGRAPH_END_OF_LINE);
 
 	return true;
 }
@@ -504,6 +583,7 @@ static bool example_latin(void)
 			"p > em {font_size: 200%;}\n";
 	paragraph_config_t para_config = {
 		.log_fn = paragraph_log,
+		.measure_cache_size = 256 * 1024,
 	};
 	paragraph_ctx_t *ctx;
 	paragraph_err_t err;
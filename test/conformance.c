@@ -0,0 +1,490 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Unicode conformance tests.
+ *
+ * Usage: conformance UCD_DIR
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <paragraph.h>
+
+#include "para.h"
+#include "utf8.h"
+#include "util.h"
+
+#define UNUSED(_v) ((void)(_v))
+
+/** Most code points in a test. */
+#define TEST_CP_MAX 512
+
+/** Most failures to report for each test file. */
+#define TEST_REPORT_MAX 10
+
+/**
+ * Kinds of test file.
+ */
+enum test_kind {
+	TEST_LINE,     /**< Line break opportunities. */
+	TEST_GRAPHEME, /**< Grapheme cluster boundaries. */
+	TEST_WORD,     /**< Word boundaries. */
+	TEST_BIDI,     /**< Resolved embedding levels. */
+};
+
+/**
+ * A test from one of the test files.
+ */
+struct test {
+	uint32_t cp[TEST_CP_MAX]; /**< Code points. */
+	size_t count;             /**< Number of code points. */
+
+	uint8_t text[TEST_CP_MAX * 4]; /**< Code points as UTF-8. */
+	size_t len;                    /**< Byte length of text. */
+	size_t offset[TEST_CP_MAX];    /**< Byte offset of each code point. */
+
+	/** For segmentation tests, whether each code point has a boundary
+	 *  before it.  For bidi tests, each code point's level, or -1. */
+	int expect[TEST_CP_MAX];
+
+	int direction; /**< Paragraph direction: 0 LTR, 1 RTL, 2 auto. */
+	int level;     /**< Expected paragraph embedding level. */
+};
+
+/**
+ * Results of running a test file.
+ */
+struct results {
+	const char *name;    /**< Test file name. */
+	enum test_kind kind; /**< Kind of tests in the file. */
+	unsigned passed;     /**< Number of tests passed. */
+	unsigned failed;     /**< Number of tests failed. */
+	unsigned skipped;    /**< Number of tests not checked. */
+	bool missing;        /**< Whether the test file wasn't found. */
+};
+
+paragraph_err_t conformance_measure_text(
+		void *pw,
+		const paragraph_text_t *text,
+		const paragraph_style_t *style,
+		uint32_t *width_out,
+		uint32_t *height_out,
+		uint32_t *baseline_out)
+{
+	UNUSED(pw);
+	UNUSED(style);
+
+	*width_out = text->len * 8;
+	*height_out = 16;
+	*baseline_out = 12;
+
+	return PARAGRAPH_OK;
+}
+
+static const paragraph_cb_text_t cb_text = {
+	.measure_text = conformance_measure_text,
+};
+
+/**
+ * Encode a test's code points as UTF-8.
+ *
+ * \param[in]  t  The test.
+ * \return false if a code point can't be encoded, true otherwise.
+ */
+static bool test_encode(struct test *t)
+{
+	t->len = 0;
+	for (size_t i = 0; i < t->count; i++) {
+		if (t->cp[i] > 0x10FFFF ||
+		    (t->cp[i] >= 0xD800 && t->cp[i] <= 0xDFFF)) {
+			return false;
+		}
+		t->offset[i] = t->len;
+		t->len += paragraph_utf8__encode(t->cp[i], t->text + t->len);
+	}
+
+	return true;
+}
+
+/**
+ * Parse a line of a segmentation test file.
+ *
+ * Lines are code points in hex, separated by "÷" where there is a boundary
+ * and "×" where there isn't, and starting and ending with one of those.
+ *
+ * \param[in]  line  The line to parse.  Comments are removed.
+ * \param[out] t     Returns the test.
+ * \return false if the line has no test, true otherwise.
+ */
+static bool test_parse_segments(char *line, struct test *t)
+{
+	bool boundary = false;
+	char *tok;
+
+	t->count = 0;
+	for (tok = strtok(line, " \t"); tok != NULL;
+			tok = strtok(NULL, " \t")) {
+		if (strcmp(tok, "\xc3\xb7") == 0) {
+			boundary = true;
+		} else if (strcmp(tok, "\xc3\x97") == 0) {
+			boundary = false;
+		} else if (t->count < TEST_CP_MAX) {
+			t->expect[t->count] = boundary;
+			t->cp[t->count++] = strtoul(tok, NULL, 16);
+		}
+	}
+
+	return t->count > 0;
+}
+
+/**
+ * Parse a line of `BidiCharacterTest.txt`.
+ *
+ * Fields are separated by ";".  They are the code points in hex, the
+ * paragraph direction, the resolved paragraph embedding level, the resolved
+ * level of each code point, or "x" if it is removed by rule X9, and the
+ * visual order.
+ *
+ * \param[in]  line  The line to parse.  Comments are removed.
+ * \param[out] t     Returns the test.
+ * \return false if the line has no test, true otherwise.
+ */
+static bool test_parse_bidi(char *line, struct test *t)
+{
+	char *field[4];
+	char *tok;
+	size_t n;
+
+	field[0] = strtok(line, ";");
+	for (size_t i = 1; i < PARAGRAPH_ARRAY_LEN(field); i++) {
+		field[i] = strtok(NULL, ";");
+		if (field[i] == NULL) {
+			return false;
+		}
+	}
+
+	t->count = 0;
+	for (tok = strtok(field[0], " "); tok != NULL && t->count < TEST_CP_MAX;
+			tok = strtok(NULL, " ")) {
+		t->cp[t->count++] = strtoul(tok, NULL, 16);
+	}
+	t->direction = atoi(field[1]);
+	t->level = atoi(field[2]);
+
+	n = 0;
+	for (tok = strtok(field[3], " "); tok != NULL && n < t->count;
+			tok = strtok(NULL, " ")) {
+		t->expect[n++] = tok[0] == 'x' ? -1 : atoi(tok);
+	}
+
+	return t->count > 0 && n == t->count;
+}
+
+/**
+ * Set a paragraph's content to a test's text, and settle it.
+ *
+ * \param[in]  para   The paragraph.
+ * \param[in]  style  The paragraph's container style.
+ * \param[in]  t      The test.
+ * \return \ref PARAGRAPH_OK on success, or appropriate error otherwise.
+ */
+static paragraph_err_t test_content(
+		paragraph_para_t *para,
+		paragraph_style_t *style,
+		const struct test *t)
+{
+	paragraph_content_span_t span = {
+		.type = PARAGRAPH_CONTENT_TEXT,
+		.len = t->len,
+	};
+	paragraph_err_t err;
+
+	err = paragraph_reset(para, style);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	err = paragraph_content_add_spans(para, (const char *)t->text,
+			t->len, &span, 1, NULL);
+	if (err != PARAGRAPH_OK) {
+		return err;
+	}
+
+	paragraph_content__settle(para->ctx, &para->content);
+	return PARAGRAPH_OK;
+}
+
+/**
+ * Check a paragraph's boundaries against a segmentation test.
+ *
+ * \param[in]  bits  The paragraph's boundary bitset.
+ * \param[in]  t     The test.
+ * \return true if the boundaries match, false otherwise.
+ */
+static bool test_check_segments(const uint64_t *bits, const struct test *t)
+{
+	size_t i = 1;
+
+	/* The start and end of the text are always boundaries, so only the
+	 * boundaries within the text are checked. */
+	for (size_t pos = 1; pos < t->len; pos++) {
+		bool set = (bits[pos / 64] >> (pos % 64)) & 1;
+		bool expect = false;
+
+		if (i < t->count && t->offset[i] == pos) {
+			expect = t->expect[i++];
+		}
+		if (set != expect) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Check a paragraph's embedding levels against a bidi test.
+ *
+ * \param[in]  bidi  The paragraph's embedding levels.
+ * \param[in]  t     The test.
+ * \return true if the levels match, false otherwise.
+ */
+static bool test_check_bidi(const paragraph_bidi_t *bidi, const struct test *t)
+{
+	for (size_t i = 0; i < t->count; i++) {
+		if (t->expect[i] >= 0 && paragraph_bidi__level(bidi,
+				t->offset[i]) != t->expect[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Check whether a bidi test has a paragraph separator before its end.
+ *
+ * \param[in]  t  The test.
+ * \return true if the test has more than one paragraph.
+ */
+static bool test_bidi_paragraphs(const struct test *t)
+{
+	/* The characters with bidirectional class B. */
+	static const uint32_t separators[] = {
+		0x000A, 0x000D, 0x001C, 0x001D, 0x001E, 0x0085, 0x2029,
+	};
+
+	for (size_t i = 0; i + 1 < t->count; i++) {
+		for (size_t s = 0; s < PARAGRAPH_ARRAY_LEN(separators); s++) {
+			if (t->cp[i] == separators[s]) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Run a test on a paragraph.
+ *
+ * \param[in]  para   The paragraph to run the test with.
+ * \param[in]  style  The paragraph's container style.
+ * \param[in]  t      The test.
+ * \param[out] res    Updated with the test's result.
+ * \return false if the test failed, true otherwise.
+ */
+static bool test_run(
+		paragraph_para_t *para,
+		paragraph_style_t *style,
+		const struct test *t,
+		struct results *res)
+{
+	const paragraph_linebreak_t *lb = &para->linebreak;
+	paragraph_err_t err;
+	bool pass;
+
+	if (res->kind == TEST_BIDI && test_bidi_paragraphs(t)) {
+		res->skipped++;
+		return true;
+	}
+
+	err = test_content(para, style, t);
+	if (err == PARAGRAPH_OK) {
+		if (res->kind == TEST_BIDI) {
+			err = paragraph_bidi__update(&para->bidi,
+					&para->content);
+		} else {
+			err = paragraph_linebreak__update(&para->linebreak,
+					&para->content);
+		}
+	}
+	if (err != PARAGRAPH_OK) {
+		res->failed++;
+		return false;
+	}
+
+	switch (res->kind) {
+	case TEST_LINE:
+		pass = test_check_segments(lb->bits, t);
+		break;
+	case TEST_GRAPHEME:
+		pass = test_check_segments(lb->grapheme_bits, t);
+		break;
+	case TEST_WORD:
+		pass = test_check_segments(lb->word_bits, t);
+		break;
+	default:
+		if (t->direction != 2 && para->bidi.level != t->level) {
+			res->skipped++;
+			return true;
+		}
+		pass = para->bidi.level == t->level &&
+				test_check_bidi(&para->bidi, t);
+		break;
+	}
+
+	if (pass) {
+		res->passed++;
+	} else {
+		res->failed++;
+	}
+	return pass;
+}
+
+/**
+ * Run the tests in a test file.
+ *
+ * \param[in]  ctx  The library context.
+ * \param[in]  dir  The directory the test file is in.
+ * \param[in]  res  The test file, updated with its results.
+ * \return false if the file couldn't be read, true otherwise.
+ */
+static bool test_file(
+		paragraph_ctx_t *ctx,
+		const char *dir,
+		struct results *res)
+{
+	static int style;
+	static char line[8192];
+	static char copy[8192];
+	static struct test t;
+	paragraph_para_t *para;
+	paragraph_err_t err;
+	unsigned line_no = 0;
+	char path[4096];
+	FILE *f;
+
+	snprintf(path, sizeof(path), "%s/%s", dir, res->name);
+	f = fopen(path, "r");
+	if (f == NULL && errno == ENOENT) {
+		res->missing = true;
+		return true;
+	} else if (f == NULL) {
+		fprintf(stderr, "Failed to open %s\n", path);
+		return false;
+	}
+
+	err = paragraph_create(NULL, ctx, &para, &style);
+	if (err != PARAGRAPH_OK) {
+		fprintf(stderr, "Failed to create paragraph: %s\n",
+				paragraph_strerror(err));
+		fclose(f);
+		return false;
+	}
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		char *comment = strchr(line, '#');
+		bool parsed;
+
+		line_no++;
+		if (comment != NULL) {
+			*comment = '\0';
+		}
+		line[strcspn(line, "\r\n")] = '\0';
+		strcpy(copy, line);
+
+		parsed = res->kind == TEST_BIDI ? test_parse_bidi(line, &t) :
+				test_parse_segments(line, &t);
+		if (!parsed) {
+			continue;
+		}
+		if (!test_encode(&t)) {
+			res->skipped++;
+			continue;
+		}
+
+		if (!test_run(para, &style, &t, res) &&
+				res->failed <= TEST_REPORT_MAX) {
+			fprintf(stderr, "%s:%u: FAIL: %s\n",
+					res->name, line_no, copy);
+		}
+	}
+
+	para = paragraph_destroy(para);
+	fclose(f);
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	struct results results[] = {
+		{ .name = "LineBreakTest.txt", .kind = TEST_LINE },
+		{ .name = "GraphemeBreakTest.txt", .kind = TEST_GRAPHEME },
+		{ .name = "WordBreakTest.txt", .kind = TEST_WORD },
+		{ .name = "BidiCharacterTest.txt", .kind = TEST_BIDI },
+	};
+	paragraph_config_t config = {
+		.log_fn = paragraph_log,
+		.log_level = PARAGRAPH_LOG_WARNING,
+	};
+	paragraph_ctx_t *ctx;
+	paragraph_err_t err;
+	bool res = true;
+
+	if (argc != 2) {
+		fprintf(stderr, "Usage: %s UCD_DIR\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	err = paragraph_ctx_create(NULL, &ctx, &config, &cb_text);
+	if (err != PARAGRAPH_OK) {
+		fprintf(stderr, "Failed to create paragraph context: %s\n",
+				paragraph_strerror(err));
+		return EXIT_FAILURE;
+	}
+
+	for (size_t i = 0; i < PARAGRAPH_ARRAY_LEN(results); i++) {
+		struct results *r = &results[i];
+
+		if (!test_file(ctx, argv[1], r)) {
+			res = false;
+			continue;
+		}
+
+		if (r->missing) {
+			printf("%s: skipped, not found in %s\n",
+					r->name, argv[1]);
+			continue;
+		}
+
+		printf("%s: %u passed, %u failed, %u skipped\n",
+				r->name, r->passed, r->failed, r->skipped);
+		if (r->failed > 0) {
+			res = false;
+		}
+	}
+
+	ctx = paragraph_ctx_destroy(ctx);
+
+	return res ? EXIT_SUCCESS : EXIT_FAILURE;
+}
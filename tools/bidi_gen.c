@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Bidirectional class table generator.
+ *
+ * Usage: bidi_gen DerivedBidiClass.txt BidiBrackets.txt bidi.tab
+ *                 > src/bidi_data.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ucd.h"
+
+/** Bidirectional classes. */
+enum bidi {
+	L, R, AL, EN, ES, ET, AN, CS, NSM, BN, B, S, WS, ON,
+	LRE, LRO, RLE, RLO, PDF, LRI, RLI, FSI, PDI,
+	BIDI_COUNT
+};
+
+static const char * const bidi_name[BIDI_COUNT] = {
+	"L", "R", "AL", "EN", "ES", "ET", "AN", "CS", "NSM", "BN", "B", "S",
+	"WS", "ON", "LRE", "LRO", "RLE", "RLO", "PDF", "LRI", "RLI", "FSI",
+	"PDI",
+};
+
+/** Maximum number of paired brackets. */
+#define BRACKETS_MAX 512
+
+/** A paired bracket. */
+struct bracket {
+	uint32_t cp;   /**< The bracket. */
+	uint32_t pair; /**< The matching bracket. */
+	bool open;     /**< Whether the bracket is an opening bracket. */
+};
+
+static uint8_t cp_bidi[UCD_CP_COUNT];
+static struct bracket brackets[BRACKETS_MAX];
+static size_t bracket_count;
+
+/**
+ * Record the class of a range of code points from `DerivedBidiClass.txt`.
+ *
+ * Implements \ref ucd_line_fn.
+ */
+static bool bidi_line(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	uint8_t bidi;
+
+	(void)pw;
+
+	if (count < 1 || !ucd_lookup(bidi_name, BIDI_COUNT,
+			fields[0], &bidi)) {
+		return false;
+	}
+
+	for (uint32_t cp = first; cp <= last; cp++) {
+		cp_bidi[cp] = bidi;
+	}
+	return true;
+}
+
+/**
+ * Record a paired bracket from `BidiBrackets.txt`.
+ *
+ * Implements \ref ucd_line_fn.
+ */
+static bool bracket_line(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	char *end;
+
+	(void)pw;
+
+	if (first != last || count < 2 || bracket_count == BRACKETS_MAX ||
+			(strcmp(fields[1], "o") != 0 &&
+			 strcmp(fields[1], "c") != 0)) {
+		return false;
+	}
+
+	brackets[bracket_count].cp = first;
+	brackets[bracket_count].pair = strtoul(fields[0], &end, 16);
+	brackets[bracket_count].open = (fields[1][0] == 'o');
+	if (end == fields[0]) {
+		return false;
+	}
+	bracket_count++;
+	return true;
+}
+
+/**
+ * Get the canonical equivalent of a bracket.
+ *
+ * BD16 matches brackets by canonical equivalence.  The only paired
+ * brackets with canonical decompositions are the angle brackets U+2329 and
+ * U+232A, which decompose to U+3008 and U+3009.
+ *
+ * \param[in]  cp  The bracket.
+ * \return the bracket's canonical equivalent.
+ */
+static uint32_t bracket_canonical(uint32_t cp)
+{
+	switch (cp) {
+	case 0x2329: return 0x3008;
+	case 0x232A: return 0x3009;
+	default:     return cp;
+	}
+}
+
+static int bracket_cmp(const void *a, const void *b)
+{
+	const struct bracket *x = a;
+	const struct bracket *y = b;
+
+	return (x->cp > y->cp) - (x->cp < y->cp);
+}
+
+int main(int argc, char **argv)
+{
+	char version_class[128];
+	char version_brackets[128];
+	char source[300];
+
+	if (argc != 4) {
+		fprintf(stderr, "Usage: %s DerivedBidiClass.txt "
+				"BidiBrackets.txt bidi.tab\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	memset(cp_bidi, L, sizeof(cp_bidi));
+	if (!ucd_read(argv[1], bidi_line, NULL,
+			version_class, sizeof(version_class)) ||
+	    !ucd_read(argv[2], bracket_line, NULL,
+			version_brackets, sizeof(version_brackets)) ||
+	    !ucd_write_table(argv[3], cp_bidi)) {
+		return EXIT_FAILURE;
+	}
+	qsort(brackets, bracket_count, sizeof(*brackets), bracket_cmp);
+
+	snprintf(source, sizeof(source), "%s and %s",
+			version_class[0] != '\0' ?
+					version_class : "DerivedBidiClass.txt",
+			version_brackets[0] != '\0' ?
+					version_brackets : "BidiBrackets.txt");
+	ucd_print_header("PARAGRAPH__BIDI_DATA_H",
+			"Bidirectional class tables.",
+			"tools/bidi_gen.c", source);
+
+	printf("/** Bidirectional classes. */\n"
+	       "enum paragraph_bidi_e {\n");
+	for (size_t i = 0; i < BIDI_COUNT; i++) {
+		printf("\tPARAGRAPH_BIDI_%s,\n", bidi_name[i]);
+	}
+	printf("\tPARAGRAPH_BIDI__COUNT,\n"
+	       "};\n\n");
+
+	printf("/** A paired bracket. */\n"
+	       "typedef struct paragraph_bidi_bracket_s {\n"
+	       "\tuint32_t cp; /**< The bracket. */\n"
+	       "\t/** Canonical opening bracket of the pair, for matching. */\n"
+	       "\tuint32_t id;\n"
+	       "\tuint8_t open; "
+	       "/**< Whether the bracket is an opening bracket. */\n"
+	       "} paragraph_bidi_bracket_t;\n\n");
+
+	printf("/** Paired brackets, sorted by code point. */\n"
+	       "static const paragraph_bidi_bracket_t "
+	       "paragraph_bidi_brackets[%zu] = {\n", bracket_count);
+	for (size_t i = 0; i < bracket_count; i++) {
+		const struct bracket *b = &brackets[i];
+
+		printf("\t{ 0x%04X, 0x%04X, %u },\n", (unsigned)b->cp,
+				(unsigned)bracket_canonical(
+						b->open ? b->cp : b->pair),
+				b->open);
+	}
+	printf("};\n\n");
+	ucd_print_footer();
+
+	return EXIT_SUCCESS;
+}
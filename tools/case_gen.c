@@ -0,0 +1,434 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Case mapping table generator.
+ *
+ * Usage: case_gen UnicodeData.txt SpecialCasing.txt > src/case_data.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ucd.h"
+
+/** Maximum number of case classes. */
+#define CLASSES_MAX 256
+
+/** Maximum number of full case mappings. */
+#define SPECIAL_MAX 256
+
+/** Maximum number of code points in a full case mapping. */
+#define SPECIAL_LEN 3
+
+/** Class flag: Letters, marks and numbers. */
+#define FLAG_LETTER 0x01
+
+/** Class flag: Code points with a full case mapping. */
+#define FLAG_SPECIAL 0x02
+
+/** Simple case mappings of a class of code points. */
+struct case_class {
+	int32_t upper; /**< Offset to uppercase mapping. */
+	int32_t lower; /**< Offset to lowercase mapping. */
+	int32_t title; /**< Offset to titlecase mapping. */
+	uint8_t flags; /**< Class flags. */
+};
+
+/** A full case mapping. */
+struct special {
+	uint32_t cp;                  /**< Code point mapped. */
+	uint32_t lower[SPECIAL_LEN];  /**< Lowercase mapping. */
+	uint32_t title[SPECIAL_LEN];  /**< Titlecase mapping. */
+	uint32_t upper[SPECIAL_LEN];  /**< Uppercase mapping. */
+};
+
+static struct case_class cp_case[UCD_CP_COUNT];
+static uint32_t cp_wide[UCD_CP_COUNT];
+static uint32_t range_first = UINT32_MAX;
+
+static struct case_class classes[CLASSES_MAX];
+static size_t class_count;
+static uint8_t cp_class[UCD_CP_COUNT];
+
+static struct special specials[SPECIAL_MAX];
+static size_t special_count;
+
+/**
+ * Parse a code point mapping field.
+ *
+ * \param[in]  field  The field, which may be empty.
+ * \param[in]  cp     The code point the field is for.
+ * \param[out] delta  Returns the offset from cp to its mapping.
+ * \return true on success, false if the field is invalid.
+ */
+static bool case_delta(const char *field, uint32_t cp, int32_t *delta)
+{
+	unsigned long to;
+	char *end;
+
+	if (field[0] == '\0') {
+		*delta = 0;
+		return true;
+	}
+
+	to = strtoul(field, &end, 16);
+	if (*end != '\0' || to >= UCD_CP_COUNT) {
+		return false;
+	}
+
+	*delta = (int32_t)to - (int32_t)cp;
+	return true;
+}
+
+/**
+ * Record a code point's fullwidth form from its decomposition.
+ *
+ * \param[in]  field  The decomposition field.
+ * \param[in]  cp     The code point the field is for.
+ * \return true on success, false if the field is invalid.
+ */
+static bool case_wide(const char *field, uint32_t cp)
+{
+	bool wide = strncmp(field, "<wide> ", 7) == 0;
+	bool narrow = strncmp(field, "<narrow> ", 9) == 0;
+	unsigned long to;
+	char *end;
+
+	if (!wide && !narrow) {
+		return true;
+	}
+
+	to = strtoul(field + (wide ? 7 : 9), &end, 16);
+	if (*end != '\0' || to >= UCD_CP_COUNT) {
+		return false;
+	}
+
+	/* A wide character is the fullwidth form of its decomposition,
+	 * and a narrow character's decomposition is its fullwidth form. */
+	if (wide) {
+		cp_wide[to] = cp;
+	} else {
+		cp_wide[cp] = to;
+	}
+	return true;
+}
+
+/**
+ * Record the case mappings of a code point from `UnicodeData.txt`.
+ *
+ * Implements \ref ucd_line_fn.
+ */
+static bool case_line(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	struct case_class c = { 0 };
+	size_t name_len;
+
+	(void)pw;
+
+	if (count < 14 || first != last) {
+		return false;
+	}
+
+	if (!case_delta(fields[11], first, &c.upper) ||
+			!case_delta(fields[12], first, &c.lower) ||
+			!case_delta(fields[13], first, &c.title) ||
+			!case_wide(fields[4], first)) {
+		return false;
+	}
+
+	/* An empty titlecase mapping is the same as the uppercase one. */
+	if (fields[13][0] == '\0') {
+		c.title = c.upper;
+	}
+
+	if (fields[1][0] == 'L' || fields[1][0] == 'M' ||
+			fields[1][0] == 'N') {
+		c.flags |= FLAG_LETTER;
+	}
+
+	/* Large ranges of code points are given by their first and last
+	 * code points. */
+	name_len = strlen(fields[0]);
+	if (name_len > 8 && strcmp(fields[0] + name_len - 8,
+			", First>") == 0) {
+		range_first = first;
+	} else if (name_len > 7 && strcmp(fields[0] + name_len - 7,
+			", Last>") == 0) {
+		if (range_first > first) {
+			return false;
+		}
+		first = range_first;
+		range_first = UINT32_MAX;
+	}
+
+	for (uint32_t cp = first; cp <= last; cp++) {
+		cp_case[cp] = c;
+	}
+	return true;
+}
+
+/**
+ * Parse a full case mapping field.
+ *
+ * \param[in]  field  The field, of space separated code points.
+ * \param[out] to     Returns the mapping, zero padded.
+ * \return true on success, false if the field is invalid.
+ */
+static bool case_special_field(const char *field, uint32_t *to)
+{
+	const char *s = field;
+
+	for (size_t i = 0; i < SPECIAL_LEN; i++) {
+		char *end;
+
+		to[i] = 0;
+		while (*s == ' ') {
+			s++;
+		}
+		if (*s == '\0') {
+			continue;
+		}
+		to[i] = strtoul(s, &end, 16);
+		if (end == s || to[i] >= UCD_CP_COUNT) {
+			return false;
+		}
+		s = end;
+	}
+
+	while (*s == ' ') {
+		s++;
+	}
+	return *s == '\0' && to[0] != 0;
+}
+
+/**
+ * Record a full case mapping from `SpecialCasing.txt`.
+ *
+ * Mappings with conditions are ignored.
+ *
+ * Implements \ref ucd_line_fn.
+ */
+static bool case_special(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	struct special *s;
+
+	(void)pw;
+
+	if (count < 3 || first != last) {
+		return false;
+	}
+	if (count > 3 && fields[3][0] != '\0') {
+		return true;
+	}
+	if (special_count == SPECIAL_MAX) {
+		return false;
+	}
+
+	s = &specials[special_count];
+	s->cp = first;
+	if (!case_special_field(fields[0], s->lower) ||
+			!case_special_field(fields[1], s->title) ||
+			!case_special_field(fields[2], s->upper)) {
+		return false;
+	}
+	special_count++;
+
+	cp_case[first].flags |= FLAG_SPECIAL;
+	return true;
+}
+
+/**
+ * Compare full case mappings by code point, for qsort.
+ */
+static int case_special_cmp(const void *a, const void *b)
+{
+	const struct special *sa = a;
+	const struct special *sb = b;
+
+	return (sa->cp > sb->cp) - (sa->cp < sb->cp);
+}
+
+/**
+ * Give each code point the index of its case class.
+ *
+ * \return true on success, false if there are too many classes.
+ */
+static bool case_classes(void)
+{
+	/* Class zero is code points that map to themselves. */
+	class_count = 1;
+
+	for (uint32_t cp = 0; cp < UCD_CP_COUNT; cp++) {
+		const struct case_class *c = &cp_case[cp];
+		size_t i;
+
+		for (i = 0; i < class_count; i++) {
+			if (classes[i].upper == c->upper &&
+					classes[i].lower == c->lower &&
+					classes[i].title == c->title &&
+					classes[i].flags == c->flags) {
+				break;
+			}
+		}
+		if (i == class_count) {
+			if (class_count == CLASSES_MAX) {
+				fprintf(stderr, "Too many case classes\n");
+				return false;
+			}
+			classes[class_count++] = *c;
+		}
+		cp_class[cp] = i;
+	}
+
+	return true;
+}
+
+/**
+ * Print a full case mapping.
+ *
+ * \param[in]  to  The mapping, zero padded.
+ */
+static void case_print_special(const uint32_t *to)
+{
+	printf(" { ");
+	for (size_t i = 0; i < SPECIAL_LEN; i++) {
+		printf("0x%04X%s", to[i], i + 1 < SPECIAL_LEN ? ", " : " }");
+	}
+}
+
+int main(int argc, char **argv)
+{
+	char version_data[128];
+	char version_special[128];
+	char source[300];
+	size_t ranges = 0;
+
+	if (argc != 3) {
+		fprintf(stderr, "Usage: %s UnicodeData.txt "
+				"SpecialCasing.txt\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if (!ucd_read(argv[1], case_line, NULL,
+			version_data, sizeof(version_data)) ||
+			!ucd_read(argv[2], case_special, NULL,
+			version_special, sizeof(version_special)) ||
+			!case_classes()) {
+		return EXIT_FAILURE;
+	}
+	qsort(specials, special_count, sizeof(*specials), case_special_cmp);
+
+	snprintf(source, sizeof(source), "%s and %s",
+			version_data[0] != '\0' ?
+					version_data : "UnicodeData.txt",
+			version_special[0] != '\0' ?
+					version_special : "SpecialCasing.txt");
+	ucd_print_header("PARAGRAPH__CASE_DATA_H",
+			"Case mapping tables.",
+			"tools/case_gen.c", source);
+
+	printf("/** Case class flag: Letters, marks and numbers. */\n"
+	       "#define PARAGRAPH_CASE_LETTER 0x%02X\n\n"
+	       "/** Case class flag: Code points with a full case mapping. */\n"
+	       "#define PARAGRAPH_CASE_SPECIAL 0x%02X\n\n",
+	       FLAG_LETTER, FLAG_SPECIAL);
+
+	printf("/** Simple case mappings of a class of code points. */\n"
+	       "typedef struct paragraph_case_class_s {\n"
+	       "\tint32_t upper; /**< Offset to uppercase mapping. */\n"
+	       "\tint32_t lower; /**< Offset to lowercase mapping. */\n"
+	       "\tint32_t title; /**< Offset to titlecase mapping. */\n"
+	       "\tuint8_t flags; /**< PARAGRAPH_CASE_ flags. */\n"
+	       "} paragraph_case_class_t;\n\n");
+
+	printf("/** A full case mapping, zero padded. */\n"
+	       "typedef struct paragraph_case_special_s {\n"
+	       "\tuint32_t cp;       /**< Code point mapped. */\n"
+	       "\tuint32_t lower[%u]; /**< Lowercase mapping. */\n"
+	       "\tuint32_t title[%u]; /**< Titlecase mapping. */\n"
+	       "\tuint32_t upper[%u]; /**< Uppercase mapping. */\n"
+	       "} paragraph_case_special_t;\n\n",
+	       SPECIAL_LEN, SPECIAL_LEN, SPECIAL_LEN);
+
+	printf("/** A range of code points with fullwidth forms. */\n"
+	       "typedef struct paragraph_case_wide_s {\n"
+	       "\tuint32_t first; /**< First code point in range. */\n"
+	       "\tuint32_t last;  /**< Last code point in range. */\n"
+	       "\tint32_t delta;  /**< Offset to fullwidth forms. */\n"
+	       "} paragraph_case_wide_t;\n\n");
+
+	printf("/** Simple case mappings of each case class. */\n"
+	       "static const paragraph_case_class_t "
+	       "paragraph_case_classes[%zu] = {\n", class_count);
+	for (size_t i = 0; i < class_count; i++) {
+		printf("\t{ %d, %d, %d, 0x%02X },\n",
+				classes[i].upper, classes[i].lower,
+				classes[i].title, classes[i].flags);
+	}
+	printf("};\n\n");
+
+	printf("/** Unconditional full case mappings, by code point. */\n"
+	       "static const paragraph_case_special_t "
+	       "paragraph_case_specials[%zu] = {\n", special_count);
+	for (size_t i = 0; i < special_count; i++) {
+		printf("\t{ 0x%04X,", specials[i].cp);
+		case_print_special(specials[i].lower);
+		printf(",");
+		case_print_special(specials[i].title);
+		printf(",");
+		case_print_special(specials[i].upper);
+		printf(" },\n");
+	}
+	printf("};\n\n");
+
+	for (uint32_t cp = 0; cp < UCD_CP_COUNT; cp++) {
+		if (cp_wide[cp] != 0 && (cp == 0 || cp_wide[cp - 1] == 0 ||
+				cp_wide[cp] - cp !=
+						cp_wide[cp - 1] - (cp - 1))) {
+			ranges++;
+		}
+	}
+	printf("/** Code points with fullwidth forms, by code point. */\n"
+	       "static const paragraph_case_wide_t "
+	       "paragraph_case_wides[%zu] = {\n", ranges);
+	for (uint32_t cp = 0; cp < UCD_CP_COUNT; cp++) {
+		int32_t delta = (int32_t)cp_wide[cp] - (int32_t)cp;
+		uint32_t last = cp;
+
+		if (cp_wide[cp] == 0) {
+			continue;
+		}
+		while (last + 1 < UCD_CP_COUNT && cp_wide[last + 1] != 0 &&
+				(int32_t)cp_wide[last + 1] -
+				(int32_t)(last + 1) == delta) {
+			last++;
+		}
+		printf("\t{ 0x%04X, 0x%04X, %d },\n", cp, last, delta);
+		cp = last;
+	}
+	printf("};\n\n");
+
+	if (!ucd_print_stages("paragraph_case", "PARAGRAPH_CASE",
+			"case class", cp_class)) {
+		return EXIT_FAILURE;
+	}
+	ucd_print_footer();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,357 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Hyphenation pattern compiler.
+ *
+ * Usage: hyph_gen [-l left] [-r right] patterns.txt > patterns.hyf
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Longest pattern, in bytes. */
+#define PATTERN_MAX 64
+
+/** Most trie nodes, which must fit in 24 bits. */
+#define NODES_MAX (1 << 24)
+
+/** File format version. */
+#define HYPH_VERSION 1
+
+/** A trie node being built. */
+struct node {
+	uint32_t child;   /**< First child node, or 0. */
+	uint32_t sibling; /**< Next node with the same parent, or 0. */
+	uint32_t value;   /**< Offset of node's values. */
+	uint8_t value_count; /**< Number of values, if a pattern ends here. */
+	uint8_t byte;     /**< Byte on the edge to this node. */
+};
+
+static struct node *nodes;
+static size_t node_count;
+static size_t node_alloc;
+
+static uint8_t *values;
+static size_t value_count;
+static size_t value_alloc;
+
+/**
+ * Grow an array for another element.
+ *
+ * \param[in,out] array  The array.
+ * \param[in]     count  Number of elements in use.
+ * \param[in,out] alloc  Number of elements array has space for.
+ * \param[in]     size   Size of an element.
+ * \return true on success, false on error.
+ */
+static bool hyph_grow(void **array, size_t count, size_t *alloc, size_t size)
+{
+	void *grown;
+
+	if (count < *alloc) {
+		return true;
+	}
+
+	grown = realloc(*array, (*alloc * 2 + 64) * size);
+	if (grown == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		return false;
+	}
+
+	*array = grown;
+	*alloc = *alloc * 2 + 64;
+	return true;
+}
+
+/**
+ * Find or add the child of a node on an edge.
+ *
+ * Children are kept in order of byte.
+ *
+ * \param[in]  parent  Index of parent node.
+ * \param[in]  byte    Byte on the edge.
+ * \param[out] child   Returns index of the child node.
+ * \return true on success, false on error.
+ */
+static bool hyph_child(uint32_t parent, uint8_t byte, uint32_t *child)
+{
+	uint32_t *link = &nodes[parent].child;
+
+	while (*link != 0 && nodes[*link].byte < byte) {
+		link = &nodes[*link].sibling;
+	}
+	if (*link != 0 && nodes[*link].byte == byte) {
+		*child = *link;
+		return true;
+	}
+
+	if (node_count >= NODES_MAX) {
+		fprintf(stderr, "Too many patterns\n");
+		return false;
+	}
+	if (!hyph_grow((void **)&nodes, node_count, &node_alloc,
+			sizeof(*nodes))) {
+		return false;
+	}
+
+	/* Growing may have moved the parent's links. */
+	link = &nodes[parent].child;
+	while (*link != 0 && nodes[*link].byte < byte) {
+		link = &nodes[*link].sibling;
+	}
+
+	nodes[node_count] = (struct node) {
+		.sibling = *link,
+		.byte = byte,
+	};
+	*link = node_count;
+	*child = node_count++;
+	return true;
+}
+
+/**
+ * Add a pattern to the trie.
+ *
+ * \param[in]  pattern  The pattern.
+ * \param[in]  len      Byte length of pattern.
+ * \param[in]  line     Line the pattern is on, for errors.
+ * \return true on success, false on error.
+ */
+static bool hyph_pattern(const char *pattern, size_t len, size_t line)
+{
+	uint8_t vals[PATTERN_MAX + 1] = { 0 };
+	uint32_t node = 0;
+	size_t bytes = 0;
+	size_t count;
+
+	for (size_t i = 0; i < len; i++) {
+		uint8_t c = pattern[i];
+
+		if (c >= '0' && c <= '9') {
+			vals[bytes] = c - '0';
+			continue;
+		}
+		if (bytes >= PATTERN_MAX) {
+			fprintf(stderr, "%zu: Pattern too long\n", line);
+			return false;
+		}
+		if (!hyph_child(node, c, &node)) {
+			return false;
+		}
+		bytes++;
+	}
+
+	if (bytes == 0) {
+		fprintf(stderr, "%zu: Bad pattern\n", line);
+		return false;
+	}
+
+	count = bytes + 1;
+	while (count > 0 && vals[count - 1] == 0) {
+		count--;
+	}
+
+	nodes[node].value = value_count;
+	nodes[node].value_count = count;
+	for (size_t i = 0; i < count; i++) {
+		if (!hyph_grow((void **)&values, value_count, &value_alloc,
+				sizeof(*values))) {
+			return false;
+		}
+		values[value_count++] = vals[i];
+	}
+
+	return true;
+}
+
+/**
+ * Read a pattern file into the trie.
+ *
+ * \param[in]  path  The file to read.
+ * \return true on success, false on error.
+ */
+static bool hyph_read(const char *path)
+{
+	char token[PATTERN_MAX * 2 + 1];
+	size_t len = 0;
+	size_t line = 1;
+	bool skip = false;
+	FILE *f;
+	int c;
+
+	f = fopen(path, "r");
+	if (f == NULL) {
+		fprintf(stderr, "Failed to open %s\n", path);
+		return false;
+	}
+
+	do {
+		c = fgetc(f);
+
+		if (c == '%') {
+			while (c != EOF && c != '\n') {
+				c = fgetc(f);
+			}
+		}
+
+		if (c == EOF || c == ' ' || c == '\t' || c == '\r' ||
+				c == '\n' || c == '{' || c == '}') {
+			if (len > 0 && !skip &&
+					!hyph_pattern(token, len, line)) {
+				fclose(f);
+				return false;
+			}
+			if (c == '\n') {
+				line++;
+			}
+			len = 0;
+			skip = false;
+			continue;
+		}
+
+		if (len == 0 && c == '\\') {
+			skip = true;
+		}
+		if (len >= sizeof(token)) {
+			fprintf(stderr, "%zu: Pattern too long\n", line);
+			fclose(f);
+			return false;
+		}
+		token[len++] = c;
+	} while (c != EOF);
+
+	fclose(f);
+	return true;
+}
+
+/**
+ * Write a little-endian number.
+ *
+ * \param[in]  value  The number to write.
+ * \param[in]  size   Number of bytes to write.
+ */
+static void hyph_write(uint32_t value, size_t size)
+{
+	for (size_t i = 0; i < size; i++) {
+		putchar((value >> (8 * i)) & 0xFF);
+	}
+}
+
+/**
+ * Write the trie, with each node's edges together.
+ *
+ * Nodes are numbered in breadth first order, so a node's children are
+ * numbered together, and the edges are in the same order as the nodes.
+ *
+ * \param[in]  left   Minimum number of characters before a hyphen.
+ * \param[in]  right  Minimum number of characters after a hyphen.
+ * \return true on success, false on error.
+ */
+static bool hyph_print(unsigned left, unsigned right)
+{
+	uint32_t *order = malloc(node_count * sizeof(*order));
+	size_t edges = 0;
+	size_t next = 1;
+
+	if (order == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		return false;
+	}
+
+	order[0] = 0;
+	for (size_t i = 0; i < node_count; i++) {
+		for (uint32_t c = nodes[order[i]].child; c != 0;
+				c = nodes[c].sibling) {
+			order[next++] = c;
+		}
+	}
+
+	fwrite("PHYP", 1, 4, stdout);
+	hyph_write(HYPH_VERSION, 4);
+	hyph_write(node_count, 4);
+	hyph_write(node_count - 1, 4);
+	hyph_write(value_count, 4);
+	hyph_write(left, 1);
+	hyph_write(right, 1);
+	hyph_write(0, 2);
+
+	for (size_t i = 0; i < node_count; i++) {
+		const struct node *n = &nodes[order[i]];
+		size_t count = 0;
+
+		for (uint32_t c = n->child; c != 0; c = nodes[c].sibling) {
+			count++;
+		}
+
+		hyph_write(edges, 4);
+		hyph_write(n->value, 4);
+		hyph_write(count, 2);
+		hyph_write(n->value_count, 1);
+		hyph_write(0, 1);
+		edges += count;
+	}
+
+	/* Children were numbered in the order their edges are written. */
+	next = 1;
+	for (size_t i = 0; i < node_count; i++) {
+		for (uint32_t c = nodes[order[i]].child; c != 0;
+				c = nodes[c].sibling) {
+			hyph_write((uint32_t)next++ << 8 | nodes[c].byte, 4);
+		}
+	}
+
+	fwrite(values, 1, value_count, stdout);
+
+	free(order);
+	return fflush(stdout) == 0;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned left = 2;
+	unsigned right = 3;
+	int arg = 1;
+
+	while (arg + 1 < argc && argv[arg][0] == '-') {
+		unsigned *min = strcmp(argv[arg], "-l") == 0 ? &left :
+				strcmp(argv[arg], "-r") == 0 ? &right : NULL;
+
+		if (min == NULL) {
+			break;
+		}
+		*min = strtoul(argv[arg + 1], NULL, 10);
+		arg += 2;
+	}
+
+	if (arg + 1 != argc || left < 1 || left > 255 || right < 1 ||
+			right > 255) {
+		fprintf(stderr, "Usage: %s [-l left] [-r right] "
+				"patterns.txt\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	/* The root node. */
+	if (!hyph_grow((void **)&nodes, 0, &node_alloc, sizeof(*nodes))) {
+		return EXIT_FAILURE;
+	}
+	nodes[0] = (struct node) { 0 };
+	node_count = 1;
+
+	if (!hyph_read(argv[arg]) || !hyph_print(left, right)) {
+		free(nodes);
+		free(values);
+		return EXIT_FAILURE;
+	}
+
+	free(nodes);
+	free(values);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,444 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Line break table generator.
+ *
+ * Usage: linebreak_gen LineBreak.txt EastAsianWidth.txt UnicodeData.txt \
+ *         emoji-data.txt lb.tab > src/linebreak_data.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ucd.h"
+
+/**
+ * Resolved line break classes.
+ *
+ * OP_EA and CP_EA are OP and CP characters with an East Asian Width of
+ * F, W or H, which LB30 doesn't apply to.
+ *
+ * Classes that always have a break opportunity decided without the pair
+ * table come last.
+ */
+enum lb {
+	OP, CL, CP, QU, GL, NS, EX, SY, IS, PR, PO, NU, AL, HL, ID, IN, HY,
+	BA, BB, B2, ZW, CM, WJ, H2, H3, JL, JV, JT, RI, EB, EM, ZWJ, CB,
+	OP_EA, CP_EA,
+	SP, BK, CR, LF, NL,
+	LB_COUNT
+};
+
+static const char * const lb_name[LB_COUNT] = {
+	"OP", "CL", "CP", "QU", "GL", "NS", "EX", "SY", "IS", "PR", "PO",
+	"NU", "AL", "HL", "ID", "IN", "HY", "BA", "BB", "B2", "ZW", "CM",
+	"WJ", "H2", "H3", "JL", "JV", "JT", "RI", "EB", "EM", "ZWJ", "CB",
+	"OP_EA", "CP_EA",
+	"SP", "BK", "CR", "LF", "NL",
+};
+
+/**
+ * Classes that LB1 resolves to other classes.
+ *
+ * SA is resolved to AL here, and then to CM for characters of General
+ * Category Mn or Mc.  We don't do dictionary based breaking of complex
+ * context scripts.
+ */
+static const struct {
+	const char *name;
+	enum lb lb;
+} lb_alias[] = {
+	{ "AI", AL },
+	{ "SG", AL },
+	{ "XX", AL },
+	{ "SA", AL },
+	{ "CJ", NS },
+};
+
+/** Code point flag: Line break class SA. */
+#define FLAG_SA       (1 << 0)
+/** Code point flag: General Category Mn or Mc. */
+#define FLAG_MARK     (1 << 1)
+/** Code point flag: Assigned, so not General Category Cn. */
+#define FLAG_ASSIGNED (1 << 2)
+/** Code point flag: East Asian Width F, W or H. */
+#define FLAG_WIDE     (1 << 3)
+/** Code point flag: Extended_Pictographic. */
+#define FLAG_EP       (1 << 4)
+
+static uint8_t cp_lb[UCD_CP_COUNT];
+static uint8_t cp_flags[UCD_CP_COUNT];
+
+/** First code point of a `UnicodeData.txt` range, or UINT32_MAX. */
+static uint32_t range_first = UINT32_MAX;
+
+/**
+ * Record the class of a range of code points from `LineBreak.txt`.
+ *
+ * Implements \ref ucd_line_fn.
+ */
+static bool lb_line(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	uint8_t lb;
+
+	(void)pw;
+
+	if (count < 1) {
+		return false;
+	}
+
+	if (!ucd_lookup(lb_name, LB_COUNT, fields[0], &lb)) {
+		size_t i;
+
+		for (i = 0; i < sizeof(lb_alias) / sizeof(*lb_alias); i++) {
+			if (strcmp(fields[0], lb_alias[i].name) == 0) {
+				lb = lb_alias[i].lb;
+				break;
+			}
+		}
+		if (i == sizeof(lb_alias) / sizeof(*lb_alias)) {
+			return false;
+		}
+	}
+
+	for (uint32_t cp = first; cp <= last; cp++) {
+		cp_lb[cp] = lb;
+		if (strcmp(fields[0], "SA") == 0) {
+			cp_flags[cp] |= FLAG_SA;
+		} else {
+			cp_flags[cp] &= ~FLAG_SA;
+		}
+	}
+	return true;
+}
+
+/**
+ * Record the East Asian Width of a range of code points.
+ *
+ * Implements \ref ucd_line_fn.
+ */
+static bool ea_line(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	bool wide;
+
+	(void)pw;
+
+	if (count < 1) {
+		return false;
+	}
+
+	wide = strcmp(fields[0], "F") == 0 ||
+			strcmp(fields[0], "W") == 0 ||
+			strcmp(fields[0], "H") == 0;
+
+	for (uint32_t cp = first; cp <= last; cp++) {
+		if (wide) {
+			cp_flags[cp] |= FLAG_WIDE;
+		} else {
+			cp_flags[cp] &= ~FLAG_WIDE;
+		}
+	}
+	return true;
+}
+
+/**
+ * Record the General Category of a code point from `UnicodeData.txt`.
+ *
+ * Implements \ref ucd_line_fn.
+ */
+static bool gc_line(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	uint8_t flags = FLAG_ASSIGNED;
+	size_t name_len;
+
+	(void)pw;
+
+	if (count < 2 || first != last) {
+		return false;
+	}
+
+	if (strcmp(fields[1], "Mn") == 0 || strcmp(fields[1], "Mc") == 0) {
+		flags |= FLAG_MARK;
+	}
+
+	/* Large ranges of code points are given by their first and last
+	 * code points. */
+	name_len = strlen(fields[0]);
+	if (name_len > 8 && strcmp(fields[0] + name_len - 8,
+			", First>") == 0) {
+		range_first = first;
+	} else if (name_len > 7 && strcmp(fields[0] + name_len - 7,
+			", Last>") == 0) {
+		if (range_first > first) {
+			return false;
+		}
+		first = range_first;
+		range_first = UINT32_MAX;
+	}
+
+	for (uint32_t cp = first; cp <= last; cp++) {
+		cp_flags[cp] |= flags;
+	}
+	return true;
+}
+
+/**
+ * Record the Extended_Pictographic code points from `emoji-data.txt`.
+ *
+ * Implements \ref ucd_line_fn.
+ */
+static bool ep_line(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	(void)pw;
+
+	if (count < 1) {
+		return false;
+	}
+	if (strcmp(fields[0], "Extended_Pictographic") != 0) {
+		return true;
+	}
+
+	for (uint32_t cp = first; cp <= last; cp++) {
+		cp_flags[cp] |= FLAG_EP;
+	}
+	return true;
+}
+
+/**
+ * Resolve the classes that depend on other properties.
+ */
+static void lb_resolve(void)
+{
+	for (uint32_t cp = 0; cp < UCD_CP_COUNT; cp++) {
+		uint8_t flags = cp_flags[cp];
+
+		/* LB1: SA characters of General Category Mn or Mc are CM. */
+		if ((flags & FLAG_SA) && (flags & FLAG_MARK)) {
+			cp_lb[cp] = CM;
+		}
+
+		/* LB30 doesn't apply to East Asian wide OP and CP. */
+		if (flags & FLAG_WIDE) {
+			if (cp_lb[cp] == OP) {
+				cp_lb[cp] = OP_EA;
+			} else if (cp_lb[cp] == CP) {
+				cp_lb[cp] = CP_EA;
+			}
+		}
+
+		/* LB30b: Unassigned Extended_Pictographic characters are
+		 * treated as EB, which only differs from ID in LB30b. */
+		if ((flags & FLAG_EP) && !(flags & FLAG_ASSIGNED) &&
+				cp_lb[cp] == ID) {
+			cp_lb[cp] = EB;
+		}
+	}
+}
+
+/**
+ * Get the class an East Asian wide class is for all rules except LB30.
+ *
+ * \param[in]  lb  The class.
+ * \return the class, without its East Asian Width.
+ */
+static enum lb narrow(enum lb lb)
+{
+	return lb == OP_EA ? OP : lb == CP_EA ? CP : lb;
+}
+
+static bool in(enum lb lb, uint64_t set)
+{
+	return (set & ((uint64_t)1 << lb)) != 0;
+}
+
+#define S(x) ((uint64_t)1 << (x))
+
+/**
+ * Whether a break is allowed between adjacent characters.
+ *
+ * Rules that need more context than the pair are applied by the caller.
+ *
+ * \param[in]  a  Class of the character before.
+ * \param[in]  b  Class of the character after.
+ * \return true if a break is allowed.
+ */
+static bool break_direct(enum lb a, enum lb b)
+{
+	bool a_wide = (a != narrow(a));
+	bool b_wide = (b != narrow(b));
+
+	a = narrow(a);
+	b = narrow(b);
+
+	if (b == ZW) return false;                                 /* LB7 */
+	if (a == ZW) return true;                                  /* LB8 */
+	if (a == ZWJ) return false;                                /* LB8a */
+	if (in(b, S(CM) | S(ZWJ))) return false;                   /* LB9 */
+	if (a == WJ || b == WJ) return false;                      /* LB11 */
+	if (a == GL) return false;                                 /* LB12 */
+	if (b == GL && !in(a, S(BA) | S(HY))) return false;        /* LB12a */
+	if (in(b, S(CL) | S(CP) | S(EX) | S(IS) | S(SY))) return false; /* 13 */
+	if (a == OP) return false;                                 /* LB14 */
+	if (a == QU && b == OP) return false;                      /* LB15 */
+	if (in(a, S(CL) | S(CP)) && b == NS) return false;         /* LB16 */
+	if (a == B2 && b == B2) return false;                      /* LB17 */
+	if (a == QU || b == QU) return false;                      /* LB19 */
+	if (a == CB || b == CB) return true;                       /* LB20 */
+	if (in(b, S(BA) | S(HY) | S(NS)) || a == BB) return false; /* LB21 */
+	if (a == SY && b == HL) return false;                      /* LB21b */
+	if (b == IN) return false;                                 /* LB22 */
+
+	/* LB23 */
+	if (in(a, S(AL) | S(HL)) && b == NU) return false;
+	if (a == NU && in(b, S(AL) | S(HL))) return false;
+
+	/* LB23a */
+	if (a == PR && in(b, S(ID) | S(EB) | S(EM))) return false;
+	if (in(a, S(ID) | S(EB) | S(EM)) && b == PO) return false;
+
+	/* LB24 */
+	if (in(a, S(PR) | S(PO)) && in(b, S(AL) | S(HL))) return false;
+	if (in(a, S(AL) | S(HL)) && in(b, S(PR) | S(PO))) return false;
+
+	/* LB25, as tailored by UAX #14 example 7, which is what
+	 * LineBreakTest.txt expects.  The parts that depend on more than
+	 * the pair are applied by the caller. */
+	if (in(a, S(PR) | S(PO) | S(HY) | S(NU)) && b == NU) return false;
+	if (a == NU && in(b, S(PO) | S(PR))) return false;
+
+	/* LB26 */
+	if (a == JL && in(b, S(JL) | S(JV) | S(H2) | S(H3))) return false;
+	if (in(a, S(JV) | S(H2)) && in(b, S(JV) | S(JT))) return false;
+	if (in(a, S(JT) | S(H3)) && b == JT) return false;
+
+	/* LB27 */
+	if (in(a, S(JL) | S(JV) | S(JT) | S(H2) | S(H3)) && b == PO)
+		return false;
+	if (a == PR && in(b, S(JL) | S(JV) | S(JT) | S(H2) | S(H3)))
+		return false;
+
+	if (in(a, S(AL) | S(HL)) && in(b, S(AL) | S(HL))) return false; /* 28 */
+	if (a == IS && in(b, S(AL) | S(HL))) return false;         /* LB29 */
+
+	/* LB30 */
+	if (in(a, S(AL) | S(HL) | S(NU)) && b == OP && !b_wide) return false;
+	if (a == CP && !a_wide && in(b, S(AL) | S(HL) | S(NU))) return false;
+
+	if (a == RI && b == RI) return false;                      /* LB30a */
+	if (a == EB && b == EM) return false;                      /* LB30b */
+
+	return true;                                               /* LB31 */
+}
+
+/**
+ * Whether a break is allowed between characters separated by spaces.
+ *
+ * \param[in]  a  Class of the character before the spaces.
+ * \param[in]  b  Class of the character after the spaces.
+ * \return true if a break is allowed before the character after.
+ */
+static bool break_spaced(enum lb a, enum lb b)
+{
+	a = narrow(a);
+	b = narrow(b);
+
+	if (in(b, S(CM) | S(ZWJ))) b = AL;                         /* LB10 */
+
+	if (b == ZW) return false;                                 /* LB7 */
+	if (a == ZW) return true;                                  /* LB8 */
+	if (b == WJ) return false;                                 /* LB11 */
+	if (in(b, S(CL) | S(CP) | S(EX) | S(IS) | S(SY))) return false; /* 13 */
+	if (a == OP) return false;                                 /* LB14 */
+	if (a == QU && b == OP) return false;                      /* LB15 */
+	if (in(a, S(CL) | S(CP)) && b == NS) return false;         /* LB16 */
+	if (a == B2 && b == B2) return false;                      /* LB17 */
+
+	return true;                                               /* LB18 */
+}
+
+int main(int argc, char **argv)
+{
+	char version[128];
+	char other[128];
+
+	if (argc != 6) {
+		fprintf(stderr, "Usage: %s LineBreak.txt EastAsianWidth.txt "
+				"UnicodeData.txt emoji-data.txt lb.tab\n",
+				argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	memset(cp_lb, AL, sizeof(cp_lb));
+	if (!ucd_read(argv[1], lb_line, NULL, version, sizeof(version)) ||
+	    !ucd_read(argv[2], ea_line, NULL, other, sizeof(other)) ||
+	    !ucd_read(argv[3], gc_line, NULL, other, sizeof(other)) ||
+	    !ucd_read(argv[4], ep_line, NULL, other, sizeof(other))) {
+		return EXIT_FAILURE;
+	}
+	lb_resolve();
+	if (!ucd_write_table(argv[5], cp_lb)) {
+		return EXIT_FAILURE;
+	}
+
+	ucd_print_header("PARAGRAPH__LINEBREAK_DATA_H", "Line break tables.",
+			"tools/linebreak_gen.c",
+			version[0] != '\0' ? version : "LineBreak.txt");
+
+	printf("/** Line break classes, resolved by rule LB1. */\n"
+	       "enum paragraph_lb_e {\n");
+	for (size_t i = 0; i < LB_COUNT; i++) {
+		printf("\tPARAGRAPH_LB_%s,\n", lb_name[i]);
+	}
+	printf("\tPARAGRAPH_LB__COUNT,\n"
+	       "};\n\n");
+
+	printf("/** Pair table flag: "
+	       "break allowed between adjacent classes. */\n"
+	       "#define PARAGRAPH_LB_DIRECT (1 << 0)\n"
+	       "/** Pair table flag: "
+	       "break allowed after spaces between classes. */\n"
+	       "#define PARAGRAPH_LB_SPACED (1 << 1)\n\n");
+
+	printf("/** Break opportunities between pairs of classes. */\n"
+	       "static const uint8_t paragraph_lb_pair[%u][%u] = {\n",
+	       LB_COUNT, LB_COUNT);
+	for (size_t a = 0; a < LB_COUNT; a++) {
+		printf("\t[PARAGRAPH_LB_%s] = {", lb_name[a]);
+		for (size_t b = 0; b < LB_COUNT; b++) {
+			printf("%s%u,", b % 16 == 0 ? "\n\t\t" : " ",
+					break_direct(a, b) |
+					break_spaced(a, b) << 1);
+		}
+		printf("\n\t},\n");
+	}
+	printf("};\n\n");
+	ucd_print_footer();
+
+	return EXIT_SUCCESS;
+}
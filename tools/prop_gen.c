@@ -0,0 +1,266 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Combined property table generator.
+ *
+ * Usage: prop_gen EastAsianWidth.txt lb.tab bidi.tab script.tab gcb.tab
+ *                 wb.tab > src/prop_data.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ucd.h"
+
+/** Number of code points in each stage two block. */
+#define BLOCK_SIZE 256
+
+/** Number of stage two blocks needed to cover every code point. */
+#define BLOCK_COUNT (UCD_CP_COUNT / BLOCK_SIZE)
+
+/** Maximum number of distinct combinations of properties. */
+#define PROPS_MAX 65536
+
+/** East Asian Width values. */
+enum ea {
+	EA_N, EA_A, EA_H, EA_NA, EA_W, EA_F,
+	EA_COUNT
+};
+
+static const char * const ea_name[EA_COUNT] = {
+	"N", "A", "H", "Na", "W", "F",
+};
+
+static const char * const ea_code[EA_COUNT] = {
+	"N", "A", "H", "NA", "W", "F",
+};
+
+static const char * const ea_long[EA_COUNT] = {
+	"Neutral", "Ambiguous", "Halfwidth", "Narrow", "Wide", "Fullwidth",
+};
+
+/** The properties, in the order of their table arguments. */
+enum prop {
+	PROP_LB, PROP_BIDI, PROP_SCRIPT, PROP_GCB, PROP_WB, PROP_EA,
+	PROP_COUNT
+};
+
+/** Members of the property struct, in the order of \ref prop. */
+static const char * const prop_member[PROP_COUNT] = {
+	"lb", "bidi", "script", "gcb", "wb", "ea",
+};
+
+/** Descriptions of the properties, in the order of \ref prop. */
+static const char * const prop_what[PROP_COUNT] = {
+	"Line break class, \\ref paragraph_lb_e.",
+	"Bidirectional class, \\ref paragraph_bidi_e.",
+	"Script, \\ref paragraph_script_e.",
+	"Grapheme cluster break class, \\ref paragraph_gcb_e.",
+	"Word break class, \\ref paragraph_wb_e.",
+	"East Asian Width, \\ref paragraph_ea_e.",
+};
+
+static uint8_t cp_prop[PROP_COUNT][UCD_CP_COUNT];
+
+static uint8_t props[PROPS_MAX][PROP_COUNT];
+static size_t prop_count;
+
+static uint16_t cp_index[UCD_CP_COUNT];
+
+/**
+ * Record the East Asian Width of a range of code points.
+ *
+ * Implements \ref ucd_line_fn.
+ */
+static bool ea_line(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	uint8_t ea;
+
+	(void)pw;
+
+	if (count < 1 || !ucd_lookup(ea_name, EA_COUNT, fields[0], &ea)) {
+		return false;
+	}
+
+	for (uint32_t cp = first; cp <= last; cp++) {
+		cp_prop[PROP_EA][cp] = ea;
+	}
+	return true;
+}
+
+/**
+ * Find the index of each code point's combination of properties.
+ *
+ * \return true on success, false if there are too many combinations.
+ */
+static bool prop_combine(void)
+{
+	size_t i = 0;
+
+	for (uint32_t cp = 0; cp < UCD_CP_COUNT; cp++) {
+		uint8_t p[PROP_COUNT];
+
+		for (size_t k = 0; k < PROP_COUNT; k++) {
+			p[k] = cp_prop[k][cp];
+		}
+
+		/* Neighbours mostly share properties, so try the last
+		 * combination found first. */
+		if (i == prop_count || memcmp(props[i], p, PROP_COUNT) != 0) {
+			for (i = 0; i < prop_count; i++) {
+				if (memcmp(props[i], p, PROP_COUNT) == 0) {
+					break;
+				}
+			}
+		}
+		if (i == prop_count) {
+			if (prop_count == PROPS_MAX) {
+				fprintf(stderr, "Too many properties\n");
+				return false;
+			}
+			memcpy(props[prop_count++], p, PROP_COUNT);
+		}
+		cp_index[cp] = i;
+	}
+
+	return true;
+}
+
+/**
+ * Print the combined property lookup.
+ *
+ * \return true on success, false on error.
+ */
+static bool prop_print(void)
+{
+	static uint16_t block[256][BLOCK_SIZE];
+	static uint8_t stage1[BLOCK_COUNT];
+	size_t blocks = 0;
+
+	for (size_t i = 0; i < BLOCK_COUNT; i++) {
+		const uint16_t *b = cp_index + i * BLOCK_SIZE;
+		size_t j;
+
+		for (j = 0; j < blocks; j++) {
+			if (memcmp(block[j], b, sizeof(block[j])) == 0) {
+				break;
+			}
+		}
+		if (j == blocks) {
+			if (blocks == 256) {
+				fprintf(stderr, "Too many blocks\n");
+				return false;
+			}
+			memcpy(block[blocks++], b, sizeof(block[j]));
+		}
+		stage1[i] = j;
+	}
+
+	printf("/** East Asian Width values. */\n"
+	       "enum paragraph_ea_e {\n");
+	for (size_t i = 0; i < EA_COUNT; i++) {
+		printf("\tPARAGRAPH_EA_%s, /**< %s */\n",
+				ea_code[i], ea_long[i]);
+	}
+	printf("\tPARAGRAPH_EA__COUNT,\n"
+	       "};\n\n");
+
+	printf("/** Properties of a code point. */\n"
+	       "typedef struct paragraph_prop_s {\n");
+	for (size_t k = 0; k < PROP_COUNT; k++) {
+		printf("\tuint8_t %s; /**< %s */\n",
+				prop_member[k], prop_what[k]);
+	}
+	printf("} paragraph_prop_t;\n\n");
+
+	printf("/** Number of code points in each property block. */\n"
+	       "#define PARAGRAPH_PROP_BLOCK_SIZE %u\n\n", BLOCK_SIZE);
+
+	printf("/** Property block index for each block of code points. */\n"
+	       "extern const uint8_t paragraph_prop_stage1[%u];\n\n"
+	       "/** Index in paragraph_props of each code point in each "
+			"block. */\n"
+	       "extern const uint16_t paragraph_prop_stage2[%zu];\n\n"
+	       "/** Distinct combinations of properties. */\n"
+	       "extern const paragraph_prop_t paragraph_props[%zu];\n\n",
+	       BLOCK_COUNT, blocks * BLOCK_SIZE, prop_count);
+
+	printf("#ifdef PARAGRAPH_PROP_DATA\n\n");
+
+	printf("const uint8_t paragraph_prop_stage1[%u] = {", BLOCK_COUNT);
+	for (size_t i = 0; i < BLOCK_COUNT; i++) {
+		printf("%s%u,", i % 16 == 0 ? "\n\t" : " ", stage1[i]);
+	}
+	printf("\n};\n\n");
+
+	printf("const uint16_t paragraph_prop_stage2[%zu] = {",
+			blocks * BLOCK_SIZE);
+	for (size_t i = 0; i < blocks * BLOCK_SIZE; i++) {
+		printf("%s%u,", i % 12 == 0 ? "\n\t" : " ",
+				block[i / BLOCK_SIZE][i % BLOCK_SIZE]);
+	}
+	printf("\n};\n\n");
+
+	printf("const paragraph_prop_t paragraph_props[%zu] = {",
+			prop_count);
+	for (size_t i = 0; i < prop_count; i++) {
+		printf("%s{", i % 3 == 0 ? "\n\t" : " ");
+		for (size_t k = 0; k < PROP_COUNT; k++) {
+			printf(" %u,", props[i][k]);
+		}
+		printf(" },");
+	}
+	printf("\n};\n\n");
+
+	printf("#endif\n\n");
+
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	char version[128];
+	char source[300];
+
+	if (argc != 7) {
+		fprintf(stderr, "Usage: %s EastAsianWidth.txt lb.tab "
+				"bidi.tab script.tab gcb.tab wb.tab\n",
+				argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	for (size_t k = 0; k < PROP_EA; k++) {
+		if (!ucd_read_table(argv[2 + k], cp_prop[k])) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	/* Code points not listed are Neutral. */
+	if (!ucd_read(argv[1], ea_line, NULL, version, sizeof(version)) ||
+	    !prop_combine()) {
+		return EXIT_FAILURE;
+	}
+
+	snprintf(source, sizeof(source), "%s and the other generators' tables",
+			version[0] != '\0' ? version : "EastAsianWidth.txt");
+	ucd_print_header("PARAGRAPH__PROP_DATA_H",
+			"Combined Unicode property tables.",
+			"tools/prop_gen.c", source);
+	if (!prop_print()) {
+		return EXIT_FAILURE;
+	}
+	ucd_print_footer();
+
+	return EXIT_SUCCESS;
+}
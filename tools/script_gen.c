@@ -0,0 +1,186 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Script table generator.
+ *
+ * Usage: script_gen Scripts.txt PropertyValueAliases.txt script.tab
+ *                   > src/script_data.h
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ucd.h"
+
+/** Maximum number of scripts. */
+#define SCRIPTS_MAX 256
+
+/** Maximum length of a script's long name. */
+#define NAME_MAX_LEN 64
+
+/** Scripts that have to come first, in order: Common, Inherited, Unknown. */
+static const char * const script_first[] = { "Zyyy", "Zinh", "Zzzz" };
+
+/** A script. */
+struct script {
+	char code[5];             /**< ISO 15924 code. */
+	char name[NAME_MAX_LEN];  /**< Long name, as used in `Scripts.txt`. */
+};
+
+static struct script scripts[SCRIPTS_MAX];
+static const char *script_name[SCRIPTS_MAX];
+static size_t script_count;
+
+static uint8_t cp_script[UCD_CP_COUNT];
+
+/**
+ * Record a script from `PropertyValueAliases.txt`.
+ *
+ * Implements \ref ucd_value_fn.
+ */
+static bool script_value(
+		void *pw,
+		char **names,
+		size_t count)
+{
+	size_t first = sizeof(script_first) / sizeof(*script_first);
+	struct script *s;
+	size_t i;
+
+	(void)pw;
+
+	if (count < 2 || strlen(names[0]) != 4 ||
+			strlen(names[1]) >= NAME_MAX_LEN) {
+		return false;
+	}
+
+	/* The first scripts have their slots kept for them. */
+	for (i = 0; i < first; i++) {
+		if (strcmp(names[0], script_first[i]) == 0) {
+			break;
+		}
+	}
+	if (i == first) {
+		if (script_count < first) {
+			script_count = first;
+		}
+		if (script_count == SCRIPTS_MAX) {
+			return false;
+		}
+		i = script_count++;
+	} else if (scripts[i].code[0] != '\0') {
+		return false;
+	}
+
+	s = &scripts[i];
+	memcpy(s->code, names[0], sizeof(s->code));
+	memcpy(s->name, names[1], strlen(names[1]) + 1);
+	return true;
+}
+
+/**
+ * Record the script of a range of code points from `Scripts.txt`.
+ *
+ * Implements \ref ucd_line_fn.
+ */
+static bool script_line(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	uint8_t script;
+
+	(void)pw;
+
+	if (count < 1 || !ucd_lookup(script_name, script_count,
+			fields[0], &script)) {
+		return false;
+	}
+
+	for (uint32_t cp = first; cp <= last; cp++) {
+		cp_script[cp] = script;
+	}
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	size_t first = sizeof(script_first) / sizeof(*script_first);
+	char version_scripts[128];
+	char version_aliases[128];
+	char source[300];
+
+	if (argc != 4) {
+		fprintf(stderr, "Usage: %s Scripts.txt "
+				"PropertyValueAliases.txt script.tab\n",
+				argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if (!ucd_read_values(argv[2], "sc", script_value, NULL,
+			version_aliases, sizeof(version_aliases))) {
+		return EXIT_FAILURE;
+	}
+	for (size_t i = 0; i < first; i++) {
+		if (scripts[i].code[0] == '\0') {
+			fprintf(stderr, "%s: Missing %s\n", argv[2],
+					script_first[i]);
+			return EXIT_FAILURE;
+		}
+	}
+	for (size_t i = 0; i < script_count; i++) {
+		script_name[i] = scripts[i].name;
+	}
+
+	/* Code points not listed are Unknown. */
+	memset(cp_script, 2, sizeof(cp_script));
+	if (!ucd_read(argv[1], script_line, NULL,
+			version_scripts, sizeof(version_scripts)) ||
+	    !ucd_write_table(argv[3], cp_script)) {
+		return EXIT_FAILURE;
+	}
+
+	snprintf(source, sizeof(source), "%s and %s",
+			version_scripts[0] != '\0' ?
+					version_scripts : "Scripts.txt",
+			version_aliases[0] != '\0' ? version_aliases :
+					"PropertyValueAliases.txt");
+	ucd_print_header("PARAGRAPH__SCRIPT_DATA_H",
+			"Script tables.",
+			"tools/script_gen.c", source);
+
+	printf("/** Scripts. */\n"
+	       "enum paragraph_script_e {\n");
+	for (size_t i = 0; i < script_count; i++) {
+		printf("\tPARAGRAPH_SCRIPT_");
+		for (const char *c = scripts[i].code; *c != '\0'; c++) {
+			putchar(toupper((unsigned char)*c));
+		}
+		printf(", /**< %s */\n", scripts[i].name);
+	}
+	printf("\tPARAGRAPH_SCRIPT__COUNT,\n"
+	       "};\n\n");
+
+	printf("/** ISO 15924 code of each script, packed big-endian. */\n"
+	       "static const uint32_t paragraph_script_codes[%zu] = {\n",
+	       script_count);
+	for (size_t i = 0; i < script_count; i++) {
+		const unsigned char *c = (const unsigned char *)scripts[i].code;
+
+		printf("\t0x%02X%02X%02X%02X, /* %s */\n",
+				c[0], c[1], c[2], c[3], scripts[i].code);
+	}
+	printf("};\n\n");
+	ucd_print_footer();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,298 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Text segmentation table generator.
+ *
+ * Usage: segment_gen GraphemeBreakProperty.txt WordBreakProperty.txt
+ *                    emoji-data.txt gcb.tab wb.tab > src/segment_data.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ucd.h"
+
+/** Grapheme cluster break classes. */
+enum gcb {
+	GCB_XX, GCB_CR, GCB_LF, GCB_CN, GCB_EX, GCB_ZWJ, GCB_RI, GCB_PP,
+	GCB_SM, GCB_L, GCB_V, GCB_T, GCB_LV, GCB_LVT, GCB_EP,
+	GCB_COUNT
+};
+
+static const char * const gcb_name[GCB_COUNT] = {
+	"Other", "CR", "LF", "Control", "Extend", "ZWJ",
+	"Regional_Indicator", "Prepend", "SpacingMark", "L", "V", "T",
+	"LV", "LVT", "Extended_Pictographic",
+};
+
+static const char * const gcb_code[GCB_COUNT] = {
+	"XX", "CR", "LF", "CN", "EX", "ZWJ", "RI", "PP", "SM", "L", "V",
+	"T", "LV", "LVT", "EP",
+};
+
+/** Word break classes. */
+enum wb {
+	WB_XX, WB_CR, WB_LF, WB_NL, WB_EXTEND, WB_ZWJ, WB_RI, WB_FO, WB_KA,
+	WB_HL, WB_LE, WB_SQ, WB_DQ, WB_MB, WB_ML, WB_MN, WB_NU, WB_EX,
+	WB_WSEGSPACE,
+	WB_COUNT
+};
+
+static const char * const wb_name[WB_COUNT] = {
+	"Other", "CR", "LF", "Newline", "Extend", "ZWJ",
+	"Regional_Indicator", "Format", "Katakana", "Hebrew_Letter",
+	"ALetter", "Single_Quote", "Double_Quote", "MidNumLet", "MidLetter",
+	"MidNum", "Numeric", "ExtendNumLet", "WSegSpace",
+};
+
+static const char * const wb_code[WB_COUNT] = {
+	"XX", "CR", "LF", "NL", "EXTEND", "ZWJ", "RI", "FO", "KA", "HL",
+	"LE", "SQ", "DQ", "MB", "ML", "MN", "NU", "EX", "WSEGSPACE",
+};
+
+static uint8_t cp_gcb[UCD_CP_COUNT];
+static uint8_t cp_wb[UCD_CP_COUNT];
+
+/** A property read from a UCD data file. */
+struct property {
+	const char * const *names; /**< Names of the property's values. */
+	size_t count;              /**< Number of names. */
+	uint8_t *table;            /**< Value for each code point. */
+};
+
+/**
+ * Record a property of a range of code points.
+ *
+ * Implements \ref ucd_line_fn, with pw the \ref property.
+ */
+static bool seg_line(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	const struct property *prop = pw;
+	uint8_t value;
+
+	if (count < 1 || !ucd_lookup(prop->names, prop->count,
+			fields[0], &value)) {
+		return false;
+	}
+
+	for (uint32_t cp = first; cp <= last; cp++) {
+		prop->table[cp] = value;
+	}
+	return true;
+}
+
+/**
+ * Record the Extended_Pictographic code points from `emoji-data.txt`.
+ *
+ * Implements \ref ucd_line_fn.
+ */
+static bool seg_emoji(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count)
+{
+	(void)pw;
+
+	if (count < 1) {
+		return false;
+	}
+	if (strcmp(fields[0], "Extended_Pictographic") != 0) {
+		return true;
+	}
+
+	for (uint32_t cp = first; cp <= last; cp++) {
+		if (cp_gcb[cp] != GCB_XX) {
+			fprintf(stderr, "U+%04X: Extended_Pictographic "
+					"with grapheme cluster break %s\n",
+					cp, gcb_name[cp_gcb[cp]]);
+			return false;
+		}
+		cp_gcb[cp] = GCB_EP;
+	}
+	return true;
+}
+
+static bool in(unsigned cls, unsigned set)
+{
+	return (set & (1u << cls)) != 0;
+}
+
+#define S(x) (1u << (x))
+
+/**
+ * Whether there is a grapheme cluster boundary between two characters.
+ *
+ * GB11, GB12 and GB13 are applied by the caller.
+ *
+ * \param[in]  a  Class of the character before.
+ * \param[in]  b  Class of the character after.
+ * \return true if there is a boundary.
+ */
+static bool gcb_break(unsigned a, unsigned b)
+{
+	if (a == GCB_CR && b == GCB_LF) return false;              /* GB3 */
+	if (in(a, S(GCB_CN) | S(GCB_CR) | S(GCB_LF))) return true; /* GB4 */
+	if (in(b, S(GCB_CN) | S(GCB_CR) | S(GCB_LF))) return true; /* GB5 */
+
+	/* GB6, GB7, GB8 */
+	if (a == GCB_L && in(b, S(GCB_L) | S(GCB_V) | S(GCB_LV) |
+			S(GCB_LVT))) return false;
+	if (in(a, S(GCB_LV) | S(GCB_V)) && in(b, S(GCB_V) | S(GCB_T)))
+		return false;
+	if (in(a, S(GCB_LVT) | S(GCB_T)) && b == GCB_T) return false;
+
+	if (in(b, S(GCB_EX) | S(GCB_ZWJ))) return false;          /* GB9 */
+	if (b == GCB_SM) return false;                             /* GB9a */
+	if (a == GCB_PP) return false;                             /* GB9b */
+	if (a == GCB_RI && b == GCB_RI) return false;              /* GB12 */
+
+	return true;                                               /* GB999 */
+}
+
+/**
+ * Whether there is a word boundary between two characters.
+ *
+ * The characters are adjacent once any Extend, Format and ZWJ characters
+ * are ignored, as described by WB4.  WB3c, WB3d, WB4, WB6, WB7, WB7b,
+ * WB7c, WB11, WB12, WB15 and WB16 are applied by the caller.
+ *
+ * \param[in]  a  Class of the character before.
+ * \param[in]  b  Class of the character after.
+ * \return true if there is a boundary.
+ */
+static bool wb_break(unsigned a, unsigned b)
+{
+	const unsigned ah = S(WB_LE) | S(WB_HL);
+
+	if (a == WB_CR && b == WB_LF) return false;                /* WB3 */
+	if (in(a, S(WB_NL) | S(WB_CR) | S(WB_LF))) return true;   /* WB3a */
+	if (in(b, S(WB_NL) | S(WB_CR) | S(WB_LF))) return true;   /* WB3b */
+	if (in(b, S(WB_EXTEND) | S(WB_FO) | S(WB_ZWJ))) return false; /* 4 */
+	if (in(a, ah) && in(b, ah)) return false;                  /* WB5 */
+	if (a == WB_HL && b == WB_SQ) return false;                /* WB7a */
+	if (a == WB_NU && b == WB_NU) return false;                /* WB8 */
+	if (in(a, ah) && b == WB_NU) return false;                 /* WB9 */
+	if (a == WB_NU && in(b, ah)) return false;                 /* WB10 */
+	if (a == WB_KA && b == WB_KA) return false;                /* WB13 */
+
+	/* WB13a, WB13b */
+	if (in(a, ah | S(WB_NU) | S(WB_KA) | S(WB_EX)) && b == WB_EX)
+		return false;
+	if (a == WB_EX && in(b, ah | S(WB_NU) | S(WB_KA))) return false;
+
+	if (a == WB_RI && b == WB_RI) return false;                /* WB15 */
+
+	return true;                                               /* WB999 */
+}
+
+/**
+ * Print a pair table.
+ *
+ * \param[in]  name    Name of the table.
+ * \param[in]  PREFIX  Enum prefix of the classes.
+ * \param[in]  what    Description of the boundaries.
+ * \param[in]  code    Enum suffix of each class.
+ * \param[in]  count   Number of classes.
+ * \param[in]  fn      Whether there is a boundary between two classes.
+ */
+static void seg_print_pair(
+		const char *name,
+		const char *PREFIX,
+		const char *what,
+		const char * const *code,
+		size_t count,
+		bool (*fn)(unsigned a, unsigned b))
+{
+	printf("/** Whether there is a %s boundary between pairs of "
+			"classes. */\n"
+	       "static const uint8_t %s[%zu][%zu] = {\n",
+	       what, name, count, count);
+	for (size_t a = 0; a < count; a++) {
+		printf("\t[%s_%s] = {", PREFIX, code[a]);
+		for (size_t b = 0; b < count; b++) {
+			printf("%s%u,", b % 16 == 0 ? "\n\t\t" : " ",
+					fn(a, b));
+		}
+		printf("\n\t},\n");
+	}
+	printf("};\n\n");
+}
+
+int main(int argc, char **argv)
+{
+	char version_gcb[128];
+	char version_wb[128];
+	char version_emoji[128];
+	struct property gcb = { gcb_name, GCB_EP, cp_gcb };
+	struct property wb = { wb_name, WB_COUNT, cp_wb };
+	char source[400];
+
+	if (argc != 6) {
+		fprintf(stderr, "Usage: %s GraphemeBreakProperty.txt "
+				"WordBreakProperty.txt emoji-data.txt "
+				"gcb.tab wb.tab\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	/* Code points not listed are Other. */
+	if (!ucd_read(argv[1], seg_line, &gcb,
+			version_gcb, sizeof(version_gcb)) ||
+	    !ucd_read(argv[2], seg_line, &wb,
+			version_wb, sizeof(version_wb)) ||
+	    !ucd_read(argv[3], seg_emoji, NULL,
+			version_emoji, sizeof(version_emoji)) ||
+	    !ucd_write_table(argv[4], cp_gcb) ||
+	    !ucd_write_table(argv[5], cp_wb)) {
+		return EXIT_FAILURE;
+	}
+
+	snprintf(source, sizeof(source), "%s, %s and %s",
+			version_gcb[0] != '\0' ? version_gcb :
+					"GraphemeBreakProperty.txt",
+			version_wb[0] != '\0' ?
+					version_wb : "WordBreakProperty.txt",
+			version_emoji[0] != '\0' ?
+					version_emoji : "emoji-data.txt");
+	ucd_print_header("PARAGRAPH__SEGMENT_DATA_H",
+			"Text segmentation tables.",
+			"tools/segment_gen.c", source);
+
+	printf("/** Grapheme cluster break classes. */\n"
+	       "enum paragraph_gcb_e {\n");
+	for (size_t i = 0; i < GCB_COUNT; i++) {
+		printf("\tPARAGRAPH_GCB_%s, /**< %s */\n",
+				gcb_code[i], gcb_name[i]);
+	}
+	printf("\tPARAGRAPH_GCB__COUNT,\n"
+	       "};\n\n");
+
+	printf("/** Word break classes. */\n"
+	       "enum paragraph_wb_e {\n");
+	for (size_t i = 0; i < WB_COUNT; i++) {
+		printf("\tPARAGRAPH_WB_%s, /**< %s */\n",
+				wb_code[i], wb_name[i]);
+	}
+	printf("\tPARAGRAPH_WB__COUNT,\n"
+	       "};\n\n");
+
+	seg_print_pair("paragraph_gcb_pair", "PARAGRAPH_GCB",
+			"grapheme cluster", gcb_code, GCB_COUNT, gcb_break);
+	seg_print_pair("paragraph_wb_pair", "PARAGRAPH_WB", "word",
+			wb_code, WB_COUNT, wb_break);
+	ucd_print_footer();
+
+	return EXIT_SUCCESS;
+}
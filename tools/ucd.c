@@ -0,0 +1,397 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Unicode Character Database helpers for the table generators.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ucd.h"
+
+/** Number of code points in each stage two block. */
+#define BLOCK_SIZE 128
+
+/** Number of stage two blocks needed to cover every code point. */
+#define BLOCK_COUNT (UCD_CP_COUNT / BLOCK_SIZE)
+
+/**
+ * Strip leading and trailing space from a string, in place.
+ *
+ * \param[in]  s  The string to strip.
+ * \return the start of the stripped string.
+ */
+static char *ucd_strip(char *s)
+{
+	size_t len;
+
+	while (isspace((unsigned char)*s)) {
+		s++;
+	}
+	len = strlen(s);
+	while (len > 0 && isspace((unsigned char)s[len - 1])) {
+		s[--len] = '\0';
+	}
+
+	return s;
+}
+
+/**
+ * Split text into `;` separated fields, in place.
+ *
+ * \param[in]  s       The text to split.  Modified.
+ * \param[out] fields  Returns the fields, with surrounding spaces removed.
+ * \return the number of fields, up to \ref UCD_FIELDS_MAX.
+ */
+static size_t ucd_fields(char *s, char **fields)
+{
+	size_t count = 0;
+
+	while (count < UCD_FIELDS_MAX) {
+		char *sep = strchr(s, ';');
+
+		if (sep != NULL) {
+			*sep = '\0';
+		}
+		fields[count++] = ucd_strip(s);
+		if (sep == NULL) {
+			break;
+		}
+		s = sep + 1;
+	}
+
+	return count;
+}
+
+/**
+ * Parse a `first..last; field; ...` line.
+ *
+ * \param[in]  s   The text to parse.  Modified.
+ * \param[in]  fn  Callback for the parsed line.
+ * \param[in]  pw  Client private data for callback.
+ * \return true on success, false if the text isn't valid.
+ */
+static bool ucd_parse(char *s, ucd_line_fn fn, void *pw)
+{
+	char *fields[UCD_FIELDS_MAX];
+	unsigned long first, last;
+	size_t count;
+	char *end;
+
+	first = strtoul(s, &end, 16);
+	if (end == s) {
+		return false;
+	}
+	last = first;
+	if (end[0] == '.' && end[1] == '.') {
+		s = end + 2;
+		last = strtoul(s, &end, 16);
+		if (end == s) {
+			return false;
+		}
+	}
+
+	s = end;
+	while (isspace((unsigned char)*s)) {
+		s++;
+	}
+	if (*s != ';' || first > last || last >= UCD_CP_COUNT) {
+		return false;
+	}
+
+	count = ucd_fields(s + 1, fields);
+
+	return fn(pw, first, last, fields, count);
+}
+
+/**
+ * Copy the file name and version from a file's first comment line.
+ *
+ * \param[in]  line         The comment line, after the `#`.
+ * \param[out] version      Returns the stripped line.
+ * \param[in]  version_len  Size of the version buffer.
+ */
+static void ucd_version(char *line, char *version, size_t version_len)
+{
+	char *v = ucd_strip(line);
+	size_t len = strlen(v);
+
+	if (len >= version_len) {
+		len = version_len - 1;
+	}
+	memcpy(version, v, len);
+	version[len] = '\0';
+}
+
+/* Exported function, documented in `tools/ucd.h` */
+bool ucd_read(
+		const char *path,
+		ucd_line_fn fn,
+		void *pw,
+		char *version,
+		size_t version_len)
+{
+	char line[512];
+	unsigned n = 0;
+	FILE *f;
+
+	version[0] = '\0';
+
+	f = fopen(path, "r");
+	if (f == NULL) {
+		perror(path);
+		return false;
+	}
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		char *hash = strchr(line, '#');
+
+		n++;
+		if (n == 1 && hash == line) {
+			ucd_version(line + 1, version, version_len);
+			continue;
+		}
+
+		if (hash != NULL) {
+			char *missing = strstr(hash, "@missing:");
+
+			if (missing != NULL) {
+				if (!ucd_parse(missing + 9, fn, pw)) {
+					goto bad;
+				}
+				continue;
+			}
+			*hash = '\0';
+		}
+
+		if (line[strspn(line, " \t\r\n")] == '\0') {
+			continue;
+		}
+
+		if (!ucd_parse(line, fn, pw)) {
+			goto bad;
+		}
+	}
+
+	fclose(f);
+	return true;
+
+bad:
+	fprintf(stderr, "%s:%u: Bad line\n", path, n);
+	fclose(f);
+	return false;
+}
+
+/* Exported function, documented in `tools/ucd.h` */
+bool ucd_read_values(
+		const char *path,
+		const char *property,
+		ucd_value_fn fn,
+		void *pw,
+		char *version,
+		size_t version_len)
+{
+	char *fields[UCD_FIELDS_MAX];
+	char line[512];
+	unsigned n = 0;
+	FILE *f;
+
+	version[0] = '\0';
+
+	f = fopen(path, "r");
+	if (f == NULL) {
+		perror(path);
+		return false;
+	}
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		char *hash = strchr(line, '#');
+		size_t count;
+
+		n++;
+		if (n == 1 && hash == line) {
+			ucd_version(line + 1, version, version_len);
+			continue;
+		}
+
+		if (hash != NULL) {
+			*hash = '\0';
+		}
+
+		count = ucd_fields(line, fields);
+		if (count < 3 || strcmp(fields[0], property) != 0) {
+			continue;
+		}
+
+		if (!fn(pw, fields + 1, count - 1)) {
+			fprintf(stderr, "%s:%u: Bad value\n", path, n);
+			fclose(f);
+			return false;
+		}
+	}
+
+	fclose(f);
+	return true;
+}
+
+/* Exported function, documented in `tools/ucd.h` */
+bool ucd_lookup(
+		const char * const *names,
+		size_t count,
+		const char *name,
+		uint8_t *value)
+{
+	for (size_t i = 0; i < count; i++) {
+		if (names[i] != NULL && strcmp(name, names[i]) == 0) {
+			*value = i;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Exported function, documented in `tools/ucd.h` */
+void ucd_print_header(
+		const char *guard,
+		const char *brief,
+		const char *generator,
+		const char *source)
+{
+	printf("/*\n"
+	       " * SPDX-License-Identifier: ISC\n"
+	       " *\n"
+	       " * Copyright (C) 2021 Michael Drake "
+	       "<tlsa@netsurf-browser.org>\n"
+	       " */\n"
+	       "\n"
+	       "/**\n"
+	       " * \\file\n"
+	       " * \\brief %s\n"
+	       " *\n"
+	       " * Generated by `%s` from %s.\n"
+	       " * Do not edit.\n"
+	       " */\n"
+	       "\n"
+	       "#ifndef %s\n"
+	       "#define %s\n"
+	       "\n"
+	       "#include <stdint.h>\n"
+	       "\n", brief, generator, source, guard, guard);
+}
+
+/* Exported function, documented in `tools/ucd.h` */
+void ucd_print_footer(void)
+{
+	printf("#endif\n");
+}
+
+/* Exported function, documented in `tools/ucd.h` */
+bool ucd_print_stages(
+		const char *prefix,
+		const char *PREFIX,
+		const char *what,
+		const uint8_t *table)
+{
+	static uint8_t block[256][BLOCK_SIZE];
+	static uint8_t stage1[BLOCK_COUNT];
+	size_t blocks = 0;
+
+	for (size_t i = 0; i < BLOCK_COUNT; i++) {
+		const uint8_t *b = table + i * BLOCK_SIZE;
+		size_t j;
+
+		for (j = 0; j < blocks; j++) {
+			if (memcmp(block[j], b, BLOCK_SIZE) == 0) {
+				break;
+			}
+		}
+		if (j == blocks) {
+			if (blocks == 256) {
+				fprintf(stderr, "Too many blocks\n");
+				return false;
+			}
+			memcpy(block[blocks++], b, BLOCK_SIZE);
+		}
+		stage1[i] = j;
+	}
+
+	printf("/** Number of code points in each %s block. */\n"
+	       "#define %s_BLOCK_SIZE %u\n\n", what, PREFIX, BLOCK_SIZE);
+
+	printf("/** %c%s block index for each block of code points. */\n"
+	       "static const uint8_t %s_stage1[%u] = {",
+	       toupper((unsigned char)what[0]), what + 1,
+	       prefix, BLOCK_COUNT);
+	for (size_t i = 0; i < BLOCK_COUNT; i++) {
+		printf("%s%u,", i % 16 == 0 ? "\n\t" : " ", stage1[i]);
+	}
+	printf("\n};\n\n");
+
+	printf("/** %c%s of each code point in each %s block. */\n"
+	       "static const uint8_t %s_stage2[%zu] = {",
+	       toupper((unsigned char)what[0]), what + 1, what,
+	       prefix, blocks * BLOCK_SIZE);
+	for (size_t i = 0; i < blocks * BLOCK_SIZE; i++) {
+		printf("%s%u,", i % 16 == 0 ? "\n\t" : " ",
+				block[i / BLOCK_SIZE][i % BLOCK_SIZE]);
+	}
+	printf("\n};\n\n");
+
+	return true;
+}
+
+/* Exported function, documented in `tools/ucd.h` */
+bool ucd_write_table(
+		const char *path,
+		const uint8_t *table)
+{
+	FILE *f = fopen(path, "wb");
+
+	if (f == NULL) {
+		perror(path);
+		return false;
+	}
+
+	if (fwrite(table, 1, UCD_CP_COUNT, f) != UCD_CP_COUNT) {
+		perror(path);
+		fclose(f);
+		return false;
+	}
+
+	if (fclose(f) != 0) {
+		perror(path);
+		return false;
+	}
+	return true;
+}
+
+/* Exported function, documented in `tools/ucd.h` */
+bool ucd_read_table(
+		const char *path,
+		uint8_t *table)
+{
+	FILE *f = fopen(path, "rb");
+
+	if (f == NULL) {
+		perror(path);
+		return false;
+	}
+
+	if (fread(table, 1, UCD_CP_COUNT, f) != UCD_CP_COUNT ||
+			fgetc(f) != EOF) {
+		fprintf(stderr, "%s: Bad table\n", path);
+		fclose(f);
+		return false;
+	}
+
+	fclose(f);
+	return true;
+}
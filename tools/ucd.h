@@ -0,0 +1,176 @@
+/*
+ * SPDX-License-Identifier: ISC
+ *
+ * Copyright (C) 2021 Michael Drake <tlsa@netsurf-browser.org>
+ */
+
+/**
+ * \file
+ * \brief Unicode Character Database helpers for the table generators.
+ */
+
+#ifndef UCD_H
+#define UCD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Number of code points. */
+#define UCD_CP_COUNT 0x110000
+
+/** Maximum number of fields on a UCD data line. */
+#define UCD_FIELDS_MAX 16
+
+/**
+ * Callback for each line of a UCD data file.
+ *
+ * \param[in]  pw      Client private data.
+ * \param[in]  first   First code point in the line's range.
+ * \param[in]  last    Last code point in the line's range.
+ * \param[in]  fields  The line's fields after the code point range, with
+ *                     surrounding spaces removed.
+ * \param[in]  count   Number of fields.
+ * \return true on success, false if the line is invalid.
+ */
+typedef bool (*ucd_line_fn)(
+		void *pw,
+		uint32_t first,
+		uint32_t last,
+		char **fields,
+		size_t count);
+
+/**
+ * Read a UCD data file.
+ *
+ * Lines of the form `first..last; field; ...` are passed to the callback,
+ * as are the ranges given by `@missing` comment lines, which come before
+ * the data they provide defaults for.
+ *
+ * \param[in]  path         The file to read.
+ * \param[in]  fn           Callback for each line.
+ * \param[in]  pw           Client private data for callback.
+ * \param[out] version      Returns the file name and version from the
+ *                          file's first comment line.
+ * \param[in]  version_len  Size of the version buffer.
+ * \return true on success, false on error.
+ */
+bool ucd_read(
+		const char *path,
+		ucd_line_fn fn,
+		void *pw,
+		char *version,
+		size_t version_len);
+
+/**
+ * Callback for each value of a property in `PropertyValueAliases.txt`.
+ *
+ * \param[in]  pw      Client private data.
+ * \param[in]  names   The value's short name, long name, and any other
+ *                     aliases.
+ * \param[in]  count   Number of names.
+ * \return true on success, false if the value is invalid.
+ */
+typedef bool (*ucd_value_fn)(
+		void *pw,
+		char **names,
+		size_t count);
+
+/**
+ * Read the values of a property from `PropertyValueAliases.txt`.
+ *
+ * \param[in]  path         The file to read.
+ * \param[in]  property     Short name of the property, e.g. "sc".
+ * \param[in]  fn           Callback for each of the property's values.
+ * \param[in]  pw           Client private data for callback.
+ * \param[out] version      Returns the file name and version from the
+ *                          file's first comment line.
+ * \param[in]  version_len  Size of the version buffer.
+ * \return true on success, false on error.
+ */
+bool ucd_read_values(
+		const char *path,
+		const char *property,
+		ucd_value_fn fn,
+		void *pw,
+		char *version,
+		size_t version_len);
+
+/**
+ * Look up a property value by name.
+ *
+ * \param[in]  names  Array of count value names.
+ * \param[in]  count  Number of names.
+ * \param[in]  name   The name to look up.
+ * \param[out] value  Returns the index of the name on success.
+ * \return true on success, false if the name is unknown.
+ */
+bool ucd_lookup(
+		const char * const *names,
+		size_t count,
+		const char *name,
+		uint8_t *value);
+
+/**
+ * Print the start of a generated header.
+ *
+ * \param[in]  guard      Include guard macro name.
+ * \param[in]  brief      Brief description of the header.
+ * \param[in]  generator  Path of the generator source.
+ * \param[in]  source     Names of the UCD files the data comes from.
+ */
+void ucd_print_header(
+		const char *guard,
+		const char *brief,
+		const char *generator,
+		const char *source);
+
+/**
+ * Print the end of a generated header.
+ */
+void ucd_print_footer(void);
+
+/**
+ * Print a two stage lookup table for a code point property.
+ *
+ * Prints `<prefix>_stage1`, `<prefix>_stage2` and a `<PREFIX>_BLOCK_SIZE`
+ * macro.
+ *
+ * \param[in]  prefix  Lower case name prefix, e.g. "paragraph_lb".
+ * \param[in]  PREFIX  Upper case name prefix, e.g. "PARAGRAPH_LB".
+ * \param[in]  what    Description of the property, e.g. "Class".
+ * \param[in]  table   Property value for each code point.
+ * \return true on success, false on error.
+ */
+bool ucd_print_stages(
+		const char *prefix,
+		const char *PREFIX,
+		const char *what,
+		const uint8_t *table);
+
+/**
+ * Write a table of a property's value for each code point.
+ *
+ * The table is written as one byte per code point, for
+ * `tools/prop_gen.c` to combine with the tables of other properties.
+ *
+ * \param[in]  path   The file to write.
+ * \param[in]  table  Property value for each code point.
+ * \return true on success, false on error.
+ */
+bool ucd_write_table(
+		const char *path,
+		const uint8_t *table);
+
+/**
+ * Read a table written by \ref ucd_write_table.
+ *
+ * \param[in]  path   The file to read.
+ * \param[out] table  Returns the property value for each code point.
+ * \return true on success, false on error.
+ */
+bool ucd_read_table(
+		const char *path,
+		uint8_t *table);
+
+#endif